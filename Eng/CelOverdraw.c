@@ -0,0 +1,463 @@
+
+#include "CelOverdraw.h"
+
+// malloc(), realloc(), free(), qsort()
+#include "stdlib.h"
+// printf()
+#include "stdio.h"
+
+// Colors of the heatmap by overdraw depth, the last one for 7 and more
+static const uint32 CelOverdrawHeatmapColors[8] = {
+    0x000000, 0x203080, 0x20A040, 0xA0C020, 0xE0E020, 0xF08020, 0xE02020, 0xFFFFFF
+};
+
+// Context of the plot of a Cel into the analysis
+typedef struct {
+    // Analysis
+    CelOverdraw *overdraw;
+    // Position of the Cel in the list
+    int32 index;
+} CelOverdrawContext;
+
+// Counts a pixel written by a Cel
+static void CelOverdrawCoverPlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel drawn
+    CelOverdrawContext *plot = (CelOverdrawContext *)context;
+    CelOverdraw *overdraw = plot->overdraw;
+    // Index of the pixel
+    int32 pixel = y * overdraw->width + x;
+
+    // Only the screen position counts
+    (void)u;
+    (void)v;
+
+    // Fill cost of the Cel
+    overdraw->cels[plot->index].covered++;
+    overdraw->fills++;
+
+    // Overdraw depth of the pixel
+    if (overdraw->depth[pixel] == 0) { overdraw->touched++; }
+    if (overdraw->depth[pixel] < 0xFFFF) { overdraw->depth[pixel]++; }
+    if (overdraw->depth[pixel] > overdraw->depthMax) { overdraw->depthMax = overdraw->depth[pixel]; }
+
+    // An opaque Cel hides the pixels of the Cels drawn before it
+    if (overdraw->cels[plot->index].opaque == 1) { overdraw->front[pixel] = plot->index; }
+}
+
+// Counts a pixel of a Cel still visible at the end of the list
+static void CelOverdrawVisiblePlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel drawn
+    CelOverdrawContext *plot = (CelOverdrawContext *)context;
+    CelOverdraw *overdraw = plot->overdraw;
+
+    // Only the screen position counts
+    (void)u;
+    (void)v;
+
+    // Visible if no opaque Cel was drawn on it afterwards
+    if (overdraw->front[y * overdraw->width + x] <= plot->index) { overdraw->cels[plot->index].visible++; }
+}
+
+// Ranks the Cels by fill cost, the most expensive first
+static int CelOverdrawCompareCels(const void *first, const void *second) {
+
+    // Cels compared
+    const CelOverdrawCel *celA = *(const CelOverdrawCel **)first;
+    const CelOverdrawCel *celB = *(const CelOverdrawCel **)second;
+
+    if (celA->covered != celB->covered) { return (celA->covered > celB->covered) ? -1 : 1; }
+    // Same cost: order of the list
+    return (celA < celB) ? -1 : ((celA > celB) ? 1 : 0);
+}
+
+// Ranks the groups by fill cost, the most expensive first
+static int CelOverdrawCompareGroups(const void *first, const void *second) {
+
+    // Groups compared
+    const CelOverdrawGroup *groupA = *(const CelOverdrawGroup **)first;
+    const CelOverdrawGroup *groupB = *(const CelOverdrawGroup **)second;
+
+    if (groupA->covered != groupB->covered) { return (groupA->covered > groupB->covered) ? -1 : 1; }
+    // Same cost: order of addition
+    return (groupA < groupB) ? -1 : ((groupA > groupB) ? 1 : 0);
+}
+
+// Initialization of an analysis
+CelOverdraw *CelOverdrawInitialization(int32 width, int32 height, int32 groupsCapacity) {
+
+    // Analysis
+    CelOverdraw *overdraw = NULL;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawInitialization()*\n"); }
+
+    // Corrects parameters
+    // Minimum screen = 1 x 1 pixel
+    width = (width > 1) ? width : 1;
+    height = (height > 1) ? height : 1;
+    // Minimum 1 group
+    groupsCapacity = (groupsCapacity > 1) ? groupsCapacity : 1;
+
+    // Allocates memory for the analysis
+    overdraw = (CelOverdraw *)malloc(sizeof(CelOverdraw));
+    // If it's a failure
+    if (overdraw == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for CelOverdraw.\n");
+        return NULL;
+    }
+
+    // Allocates memory for the pixels and the groups
+    overdraw->depth = (uint16 *)malloc((size_t)width * height * sizeof(uint16));
+    overdraw->front = (int32 *)malloc((size_t)width * height * sizeof(int32));
+    overdraw->groups = (CelOverdrawGroup *)malloc((size_t)groupsCapacity * sizeof(CelOverdrawGroup));
+    // If it's a failure
+    if ((overdraw->depth == NULL) || (overdraw->front == NULL) || (overdraw->groups == NULL)) {
+        // Frees previously allocated memory
+        free(overdraw->depth);
+        free(overdraw->front);
+        free(overdraw->groups);
+        free(overdraw);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for CelOverdraw pixels.\n");
+        return NULL;
+    }
+
+    overdraw->width = width;
+    overdraw->height = height;
+    overdraw->cels = NULL;
+    overdraw->celsCount = 0;
+    overdraw->celsCapacity = 0;
+    overdraw->groupsCount = 0;
+    overdraw->groupsCapacity = groupsCapacity;
+    overdraw->opaque = CelOverdrawDefaultOpaque;
+    overdraw->fills = 0;
+    overdraw->touched = 0;
+    overdraw->depthMax = 0;
+
+    // Returns the created analysis
+    return overdraw;
+}
+
+// Adds a GroupCel to the analysis
+int32 CelOverdrawAddGroup(CelOverdraw *overdraw, GroupCel *groupCel) {
+
+    // Group added
+    CelOverdrawGroup *group = NULL;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawAddGroup()*\n"); }
+
+    // If the parameters are unknown
+    if ((overdraw == NULL) || (groupCel == NULL)) {
+        // Returns an error
+        printf("Error : CelOverdraw GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If all the groups are used
+    if (overdraw->groupsCount >= overdraw->groupsCapacity) {
+        // Returns an error
+        printf("Error : CelOverdraw full (%d groups).\n", overdraw->groupsCapacity);
+        return -1;
+    }
+
+    group = &overdraw->groups[overdraw->groupsCount];
+    group->groupCel = groupCel;
+    group->celsCount = 0;
+    group->covered = 0;
+    group->visible = 0;
+    group->occludedCount = 0;
+
+    // Returns the index of the group
+    return overdraw->groupsCount++;
+}
+
+// Default test of an opaque Cel
+int32 CelOverdrawDefaultOpaque(CCB *ccb, int32 cel) {
+
+    // Only the flags of the CCB count
+    (void)cel;
+
+    // Without CCB_BGND, the pixels of value 0 are transparent
+    return ((ccb->ccb_Flags & CCB_BGND) != 0) ? 1 : 0;
+}
+
+// Measures the coverage, the overdraw and the occlusion of a list of CCBs
+int32 CelOverdrawAnalyze(CelOverdraw *overdraw, CCB *ccb) {
+
+    // Current CCB
+    CCB *current = NULL;
+    // Number of Cels in the list
+    int32 celsCount = 0;
+    // Cels of the list
+    CelOverdrawCel *cels = NULL;
+    CelOverdrawCel *cel = NULL;
+    // Group of a Cel
+    CelOverdrawGroup *group = NULL;
+    // Cel drawn
+    CelOverdrawContext plot;
+    // Index to iterate through pixels, Cels and groups
+    int32 index = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawAnalyze()*\n"); }
+
+    // If the analysis is unknown
+    if (overdraw == NULL) {
+        // Returns an error
+        printf("Error : CelOverdraw unknown.\n");
+        return -1;
+    }
+
+    // Counts the Cels drawn, following the chain like the Cel Engine
+    for (current = ccb; (current != NULL) && (celsCount < CELRASTER_CELS_MAX); current = current->ccb_NextPtr) {
+        if ((current->ccb_Flags & CCB_SKIP) == 0) { celsCount++; }
+        if ((current->ccb_Flags & CCB_LAST) != 0) { break; }
+    }
+
+    // If the array of Cels is too small
+    if (celsCount > overdraw->celsCapacity) {
+        // Reallocates memory for the Cels
+        cels = (CelOverdrawCel *)realloc(overdraw->cels, (size_t)celsCount * sizeof(CelOverdrawCel));
+        // If it's a failure
+        if (cels == NULL) {
+            // Displays an error message
+            printf("Error : Failed to allocate memory for CelOverdraw Cels.\n");
+            return -1;
+        }
+        overdraw->cels = cels;
+        overdraw->celsCapacity = celsCount;
+    }
+
+    // Clears the previous analysis
+    for (index = 0; index < overdraw->width * overdraw->height; index++) {
+        overdraw->depth[index] = 0;
+        overdraw->front[index] = -1;
+    }
+    overdraw->celsCount = celsCount;
+    overdraw->fills = 0;
+    overdraw->touched = 0;
+    overdraw->depthMax = 0;
+
+    // Records the Cels drawn, in the order of the list
+    index = 0;
+    for (current = ccb; (current != NULL) && (index < celsCount); current = current->ccb_NextPtr) {
+        if ((current->ccb_Flags & CCB_SKIP) == 0) {
+            cel = &overdraw->cels[index++];
+            cel->ccb = current;
+            cel->covered = 0;
+            cel->visible = 0;
+            cel->opaque = (overdraw->opaque(current, index - 1) != 0) ? 1 : 0;
+            CelOverdrawFindElement(overdraw, cel);
+        }
+        if ((current->ccb_Flags & CCB_LAST) != 0) { break; }
+    }
+
+    // First pass: fill cost, overdraw depth and last opaque Cel of each pixel
+    plot.overdraw = overdraw;
+    for (plot.index = 0; plot.index < celsCount; plot.index++) {
+        CelRasterCoverage(overdraw->cels[plot.index].ccb, overdraw->width, overdraw->height, CelOverdrawCoverPlot, &plot);
+    }
+
+    // Second pass: pixels of each Cel not hidden by an opaque Cel drawn after it
+    for (plot.index = 0; plot.index < celsCount; plot.index++) {
+        CelRasterCoverage(overdraw->cels[plot.index].ccb, overdraw->width, overdraw->height, CelOverdrawVisiblePlot, &plot);
+    }
+
+    // Gathers the numbers of the groups
+    for (index = 0; index < overdraw->groupsCount; index++) {
+        group = &overdraw->groups[index];
+        group->celsCount = 0;
+        group->covered = 0;
+        group->visible = 0;
+        group->occludedCount = 0;
+    }
+    for (index = 0; index < celsCount; index++) {
+        cel = &overdraw->cels[index];
+        if (cel->group < 0) { continue; }
+        group = &overdraw->groups[cel->group];
+        group->celsCount++;
+        group->covered += cel->covered;
+        group->visible += cel->visible;
+        if ((cel->covered > 0) && (cel->visible == 0)) { group->occludedCount++; }
+    }
+
+    // Returns the number of Cels analysed
+    return celsCount;
+}
+
+// Finds the group and the element of a Cel
+void CelOverdrawFindElement(CelOverdraw *overdraw, CelOverdrawCel *cel) {
+
+    // Group searched
+    GroupCel *groupCel = NULL;
+    // Index to iterate through groups and elements
+    int32 groupIndex = 0;
+    uint32 celIndex = 0;
+
+    cel->group = -1;
+    cel->element = -1;
+
+    // Searches the Cel in the elements or the tiles of each group
+    for (groupIndex = 0; groupIndex < overdraw->groupsCount; groupIndex++) {
+        groupCel = overdraw->groups[groupIndex].groupCel;
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (((groupCel->tiles != NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel) == cel->ccb) {
+                cel->group = groupIndex;
+                cel->element = (int32)celIndex;
+                return;
+            }
+        }
+    }
+}
+
+// Saves the overdraw depth of each pixel as a PPM image
+int32 CelOverdrawWriteHeatmap(CelOverdraw *overdraw, char *filename) {
+
+    // Image of the heatmap
+    CelRaster *raster = NULL;
+    // Color of a pixel
+    uint32 color = 0;
+    // Index to iterate through pixels
+    int32 index = 0;
+    // Result of the saving
+    int32 result = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawWriteHeatmap()*\n"); }
+
+    // If the analysis is unknown
+    if (overdraw == NULL) {
+        // Returns an error
+        printf("Error : CelOverdraw unknown.\n");
+        return -1;
+    }
+
+    // Creates the image
+    raster = CelRasterInitialization(overdraw->width, overdraw->height);
+    // If it's a failure
+    if (raster == NULL) {
+        // Returns an error
+        printf("Error <- CelRasterInitialization()\n");
+        return -1;
+    }
+
+    // Colors each pixel by its overdraw depth
+    for (index = 0; index < overdraw->width * overdraw->height; index++) {
+        color = CelOverdrawHeatmapColors[(overdraw->depth[index] < 7) ? overdraw->depth[index] : 7];
+        raster->pixels[index * 3] = (uint8)(color >> 16);
+        raster->pixels[index * 3 + 1] = (uint8)(color >> 8);
+        raster->pixels[index * 3 + 2] = (uint8)color;
+    }
+
+    // Saves the image
+    result = CelRasterWritePPM(raster, filename);
+
+    // Deletes the image
+    CelRasterCleanup(raster);
+
+    return result;
+}
+
+// Displays the totals and the groups and Cels ranked by fill cost
+int32 CelOverdrawReport(CelOverdraw *overdraw, int32 linesCount) {
+
+    // Groups and Cels ranked
+    CelOverdrawGroup **groups = NULL;
+    CelOverdrawCel **cels = NULL;
+    CelOverdrawCel *cel = NULL;
+    // Occluded Cels and the pixels they write for nothing
+    int32 occludedCount = 0;
+    int32 occludedFills = 0;
+    // Index to iterate through groups and Cels
+    int32 index = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawReport()*\n"); }
+
+    // If the analysis is unknown
+    if (overdraw == NULL) {
+        // Returns an error
+        printf("Error : CelOverdraw unknown.\n");
+        return -1;
+    }
+
+    // Allocates memory for the rankings
+    groups = (CelOverdrawGroup **)malloc((size_t)(overdraw->groupsCount + 1) * sizeof(CelOverdrawGroup *));
+    cels = (CelOverdrawCel **)malloc((size_t)(overdraw->celsCount + 1) * sizeof(CelOverdrawCel *));
+    // If it's a failure
+    if ((groups == NULL) || (cels == NULL)) {
+        // Frees previously allocated memory
+        free(groups);
+        free(cels);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for CelOverdraw report.\n");
+        return -1;
+    }
+
+    // Occluded Cels
+    for (index = 0; index < overdraw->celsCount; index++) {
+        cel = &overdraw->cels[index];
+        cels[index] = cel;
+        if ((cel->covered > 0) && (cel->visible == 0)) {
+            occludedCount++;
+            occludedFills += cel->covered;
+        }
+    }
+    for (index = 0; index < overdraw->groupsCount; index++) { groups[index] = &overdraw->groups[index]; }
+
+    // Ranks the groups and the Cels by fill cost
+    qsort(groups, (size_t)overdraw->groupsCount, sizeof(CelOverdrawGroup *), CelOverdrawCompareGroups);
+    qsort(cels, (size_t)overdraw->celsCount, sizeof(CelOverdrawCel *), CelOverdrawCompareCels);
+
+    // Displays the totals
+    printf("CelOverdraw : %d Cels, %d groups, screen %d x %d\n", overdraw->celsCount, overdraw->groupsCount, overdraw->width, overdraw->height);
+    printf("  pixels written : %d (%.2f per pixel of the screen)\n", overdraw->fills, (double)overdraw->fills / (overdraw->width * overdraw->height));
+    printf("  overdraw depth : %.2f average on %d pixels written, %d max\n", (overdraw->touched > 0) ? (double)overdraw->fills / overdraw->touched : 0.0, overdraw->touched, overdraw->depthMax);
+    printf("  occluded Cels : %d (%d pixels written for nothing)\n", occludedCount, occludedFills);
+
+    // Displays the groups ranked
+    printf("  groups by fill cost :\n");
+    printf("    %4s %6s %5s %9s %9s %7s %8s\n", "rank", "group", "cels", "written", "visible", "hidden", "occluded");
+    for (index = 0; (index < overdraw->groupsCount) && (index < linesCount); index++) {
+        printf("    %4d %6d %5d %9d %9d %6d%% %8d\n", index + 1, (int32)(groups[index] - overdraw->groups), groups[index]->celsCount, groups[index]->covered, groups[index]->visible,
+            (groups[index]->covered > 0) ? (int32)(((double)(groups[index]->covered - groups[index]->visible) * 100) / groups[index]->covered) : 0, groups[index]->occludedCount);
+    }
+
+    // Displays the Cels ranked
+    printf("  Cels by fill cost :\n");
+    printf("    %4s %5s %6s %7s %9s %9s\n", "rank", "cel", "group", "element", "written", "visible");
+    for (index = 0; (index < overdraw->celsCount) && (index < linesCount); index++) {
+        cel = cels[index];
+        printf("    %4d %5d %6d %7d %9d %9d%s%s\n", index + 1, (int32)(cel - overdraw->cels), cel->group, cel->element, cel->covered, cel->visible,
+            (cel->opaque == 1) ? " opaque" : "", ((cel->covered > 0) && (cel->visible == 0)) ? " occluded" : "");
+    }
+
+    // Frees the memory used by the rankings
+    free(groups);
+    free(cels);
+
+    // Returns the number of occluded Cels
+    return occludedCount;
+}
+
+// Deletes the analysis
+int32 CelOverdrawCleanup(CelOverdraw *overdraw) {
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawCleanup()*\n"); }
+
+    // If the analysis is unknown
+    if (overdraw == NULL) {
+        // Returns an error
+        printf("Error : CelOverdraw unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used by the pixels, the Cels, the groups and the analysis
+    free(overdraw->depth);
+    free(overdraw->front);
+    free(overdraw->cels);
+    free(overdraw->groups);
+    free(overdraw);
+
+    // Returns success
+    return 1;
+}
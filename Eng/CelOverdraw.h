@@ -0,0 +1,172 @@
+#ifndef CELOVERDRAW_H
+#define CELOVERDRAW_H
+
+/******************************************************************************
+**
+**  CelOverdraw - Overdraw and fill cost of a list of CCBs (host)
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The Cel Engine is bound by the number of pixels it writes. This module
+**  measures them on the host for a list of CCBs, with the geometry of
+**  CelRaster: for each Cel, the screen pixels it covers (its fill cost) and the
+**  pixels still visible at the end of the list; for each pixel, the number of
+**  Cels drawn on it (its overdraw depth). A Cel covered entirely by opaque Cels
+**  drawn after it is reported as occluded: it costs its fill and shows nothing.
+**
+**  The GroupCels added to the analysis gather the numbers of their elements,
+**  so that the report ranks the groups to flatten or to cull.
+**
+**  Important notes:
+**
+**    - The source data isn't decoded. Whether a Cel hides what is behind it
+**      comes from a CelOverdrawOpaque function; the default one only trusts
+**      CCB_BGND, the Cels without transparent pixels. A game knowing which art
+**      is opaque gives its own function.
+**
+**    - A Cel belongs to a group when it is one of its elements or tiles. The
+**      groups must be added and configured before CelOverdrawAnalyze().
+**
+**    - This module is intended for the host tool, but it reads the elements
+**      and tiles of the groups: it includes GroupCel.h and therefore needs the
+**      headers of the SDK (graphics.h, animutils.h, types.h...) on the host,
+**      unlike CelRaster alone. The host build (Host/) provides them, and its
+**      CelOverdrawGolden checks the report and the heatmap of a scene.
+**
+**  Structure Roles :
+**
+**    CelOverdrawCel
+**      - ccb : CCB of the Cel
+**      - group, element : Group and element of the Cel, or -1
+**      - covered : Screen pixels written by the Cel (fill cost)
+**      - visible : Pixels not hidden by an opaque Cel drawn after it
+**      - opaque : 1 if the Cel hides what is behind it
+**
+**    CelOverdrawGroup
+**      - groupCel : Group analysed
+**      - celsCount : Number of Cels of the group in the list
+**      - covered, visible : Sums of the Cels of the group
+**      - occludedCount : Number of Cels of the group fully occluded
+**
+**    CelOverdraw
+**      - width, height : Size of the screen in pixels
+**      - depth : Number of Cels drawn on each pixel
+**      - front : Last opaque Cel drawn on each pixel, or -1
+**      - cels, celsCount, celsCapacity : Cels of the last list analysed
+**      - groups, groupsCount, groupsCapacity : Groups added to the analysis
+**      - opaque : Function telling if a Cel is opaque
+**      - fills : Total number of pixels written
+**      - touched : Number of pixels written at least once
+**      - depthMax : Highest overdraw depth
+**
+**  Main Functions :
+**
+**    CelOverdrawInitialization()
+**      -> Creates an analysis for a screen size and a number of groups.
+**
+**    CelOverdrawAddGroup()
+**      -> Adds a GroupCel whose elements are gathered in the report.
+**
+**    CelOverdrawAnalyze()
+**      -> Measures the coverage, the overdraw and the occlusion of a list of CCBs.
+**
+**    CelOverdrawWriteHeatmap()
+**      -> Saves the overdraw depth of each pixel as a PPM image.
+**
+**    CelOverdrawReport()
+**      -> Displays the totals and the groups and Cels ranked by fill cost.
+**
+**    CelOverdrawCleanup()
+**      -> Frees the memory used by the analysis.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// CelRasterCoverage()
+#include "CelRaster.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_CELOVERDRAW 0
+
+// Tells if a Cel hides what is behind it, cel is its position in the list
+typedef int32 (*CelOverdrawOpaque)(CCB *ccb, int32 cel);
+
+typedef struct {
+    // CCB of the Cel
+    CCB *ccb;
+    // Group and element of the Cel, or -1
+    int32 group;
+    int32 element;
+    // Screen pixels written by the Cel (fill cost)
+    int32 covered;
+    // Pixels not hidden by an opaque Cel drawn after it
+    int32 visible;
+    // 1 if the Cel hides what is behind it
+    int32 opaque;
+} CelOverdrawCel;
+
+typedef struct {
+    // Group analysed
+    GroupCel *groupCel;
+    // Number of Cels of the group in the list
+    int32 celsCount;
+    // Sums of the Cels of the group
+    int32 covered;
+    int32 visible;
+    // Number of Cels of the group fully occluded
+    int32 occludedCount;
+} CelOverdrawGroup;
+
+typedef struct {
+    // Size of the screen in pixels
+    int32 width;
+    int32 height;
+    // Number of Cels drawn on each pixel
+    uint16 *depth;
+    // Last opaque Cel drawn on each pixel, or -1
+    int32 *front;
+    // Cels of the last list analysed
+    CelOverdrawCel *cels;
+    int32 celsCount;
+    int32 celsCapacity;
+    // Groups added to the analysis
+    CelOverdrawGroup *groups;
+    int32 groupsCount;
+    int32 groupsCapacity;
+    // Function telling if a Cel is opaque
+    CelOverdrawOpaque opaque;
+    // Total number of pixels written
+    int32 fills;
+    // Number of pixels written at least once
+    int32 touched;
+    // Highest overdraw depth
+    int32 depthMax;
+} CelOverdraw;
+
+// Initialization of an analysis
+CelOverdraw *CelOverdrawInitialization(int32 width, int32 height, int32 groupsCapacity);
+// Adds a GroupCel to the analysis
+int32 CelOverdrawAddGroup(CelOverdraw *overdraw, GroupCel *groupCel);
+// Default test of an opaque Cel
+int32 CelOverdrawDefaultOpaque(CCB *ccb, int32 cel);
+
+// Measures the coverage, the overdraw and the occlusion of a list of CCBs
+int32 CelOverdrawAnalyze(CelOverdraw *overdraw, CCB *ccb);
+// Finds the group and the element of a Cel
+void CelOverdrawFindElement(CelOverdraw *overdraw, CelOverdrawCel *cel);
+
+// Saves the overdraw depth of each pixel as a PPM image
+int32 CelOverdrawWriteHeatmap(CelOverdraw *overdraw, char *filename);
+// Displays the totals and the groups and Cels ranked by fill cost
+int32 CelOverdrawReport(CelOverdraw *overdraw, int32 linesCount);
+
+// Deletes the analysis
+int32 CelOverdrawCleanup(CelOverdraw *overdraw);
+
+#endif // CELOVERDRAW_H
@@ -1,5 +1,7 @@
 #include "CelQuadMap.h"
 
+// MulSF30()
+#include "operamath.h"
 // printf()
 #include "stdio.h"
 
@@ -50,3 +52,34 @@ void CelQuadMap(CCB *ccb, Quad2D *quadMap) {
     // Set flags to load size and perspective
     ccb->ccb_Flags |= CCB_LDSIZE | CCB_LDPRS;
 }
+
+// Computes the reciprocals of the dimension of a CCB
+void CelQuadMapReciprocalsInitialization(CCB *ccb, CelQuadMapReciprocals *reciprocals) {
+
+    // Reciprocals in 2.30 fixed-point format (0 when the dimension is empty)
+    reciprocals->inverseWidth = (ccb->ccb_Width > 0) ? (1 << 30) / ccb->ccb_Width : 0;
+    reciprocals->inverseHeight = (ccb->ccb_Height > 0) ? (1 << 30) / ccb->ccb_Height : 0;
+    reciprocals->inverseArea = ((ccb->ccb_Width > 0) && (ccb->ccb_Height > 0)) ? (1 << 30) / (ccb->ccb_Width * ccb->ccb_Height) : 0;
+}
+
+// Applies a transformation to a CCB based on a quadrilateral in 16.16 format and the reciprocals of its dimension
+void CelQuadMapReciprocal(CCB *ccb, Quad2D *quadMap, CelQuadMapReciprocals *reciprocals) {
+
+    // HDX/HDY in 12.20 fixed-point format
+    ccb->ccb_HDX = MulSF30((quadMap->topRight.x - quadMap->topLeft.x) << 4, reciprocals->inverseWidth);
+    ccb->ccb_HDY = MulSF30((quadMap->topRight.y - quadMap->topLeft.y) << 4, reciprocals->inverseWidth);
+
+    // VDX/VDY in 16.16 fixed-point format
+    ccb->ccb_VDX = MulSF30(quadMap->bottomLeft.x - quadMap->topLeft.x, reciprocals->inverseHeight);
+    ccb->ccb_VDY = MulSF30(quadMap->bottomLeft.y - quadMap->topLeft.y, reciprocals->inverseHeight);
+
+    // HDDX/HDDY in 12.20 fixed-point format
+    ccb->ccb_HDDX = MulSF30(((quadMap->topLeft.x + quadMap->bottomRight.x) - (quadMap->topRight.x + quadMap->bottomLeft.x)) << 4, reciprocals->inverseArea);
+    ccb->ccb_HDDY = MulSF30(((quadMap->topLeft.y + quadMap->bottomRight.y) - (quadMap->topRight.y + quadMap->bottomLeft.y)) << 4, reciprocals->inverseArea);
+
+    ccb->ccb_XPos = quadMap->topLeft.x;
+    ccb->ccb_YPos = quadMap->topLeft.y;
+
+    // Set flags to load size and perspective
+    ccb->ccb_Flags |= CCB_LDSIZE | CCB_LDPRS;
+}
@@ -20,7 +20,24 @@
 // int32 type
 #include "types.h"
 
+typedef struct CelQuadMapReciprocals {
+    // Reciprocals of the width, height and area in 2.30 format
+    frac30 inverseWidth;
+    frac30 inverseHeight;
+    frac30 inverseArea;
+} CelQuadMapReciprocals;
+
 // Applies a transformation to a CCB based on a quadrilateral in 16.16 format
 void CelQuadMap(CCB *ccb, Quad2D *quadMap);
 
+// Computes the reciprocals of the dimension of a CCB
+void CelQuadMapReciprocalsInitialization(CCB *ccb, CelQuadMapReciprocals *reciprocals);
+
+// Applies a transformation to a CCB based on a quadrilateral in 16.16 format and the reciprocals of its dimension
+// -> Multiplications instead of divisions: MulSF30() rounds down where CelQuadMap() truncates toward zero,
+//    and the reciprocals are truncated. Each field can end 1 LSB below the one of CelQuadMap(), never above,
+//    while its delta (shifted by 4 for HDX/HDY and HDDX/HDDY) stays under 2^30 in magnitude.
+//    1 LSB of HDDX/HDDY moves the last pixel of the Cel by Width * Height / 2^20 pixel at most.
+void CelQuadMapReciprocal(CCB *ccb, Quad2D *quadMap, CelQuadMapReciprocals *reciprocals);
+
 #endif // CELQUADMAP_H
@@ -0,0 +1,429 @@
+
+#include "CelRaster.h"
+
+// malloc(), free()
+#include "stdlib.h"
+// ceil(), floor()
+#include "math.h"
+// fopen(), fwrite(), fread(), printf()
+#include "stdio.h"
+
+// Colors of the Cels for the default source, by position in the list
+static const uint32 CelRasterPalette[8] = {
+    0xE04040, 0x40C040, 0x4060E0, 0xE0C040, 0xC040C0, 0x40C0C0, 0xE08040, 0x8080E0
+};
+
+// Context of the plot of a Cel into the framebuffer
+typedef struct {
+    // Framebuffer
+    CelRaster *raster;
+    // Cel drawn and its position in the list
+    CCB *ccb;
+    int32 cel;
+} CelRasterDrawContext;
+
+// Writes the color of a source pixel into the framebuffer
+static void CelRasterDrawPlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel drawn
+    CelRasterDrawContext *draw = (CelRasterDrawContext *)context;
+    // Color of the source pixel
+    uint32 color = draw->raster->source(draw->ccb, draw->cel, u, v);
+    // Pixel of the framebuffer
+    uint8 *pixel = &draw->raster->pixels[(y * draw->raster->width + x) * 3];
+
+    pixel[0] = (uint8)(color >> 16);
+    pixel[1] = (uint8)(color >> 8);
+    pixel[2] = (uint8)color;
+}
+
+// Initialization of a framebuffer
+CelRaster *CelRasterInitialization(int32 width, int32 height) {
+
+    // Framebuffer
+    CelRaster *raster = NULL;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterInitialization()*\n"); }
+
+    // Corrects parameters
+    // Minimum framebuffer = 1 x 1 pixel
+    width = (width > 1) ? width : 1;
+    height = (height > 1) ? height : 1;
+
+    // Allocates memory for the framebuffer
+    raster = (CelRaster *)malloc(sizeof(CelRaster));
+    // If it's a failure
+    if (raster == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for CelRaster.\n");
+        return NULL;
+    }
+
+    // Allocates memory for the pixels
+    raster->pixels = (uint8 *)malloc((size_t)width * height * 3);
+    // If it's a failure
+    if (raster->pixels == NULL) {
+        // Frees previously allocated memory
+        free(raster);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for CelRaster pixels.\n");
+        return NULL;
+    }
+
+    raster->width = width;
+    raster->height = height;
+    raster->source = CelRasterDefaultSource;
+    raster->celsCount = 0;
+
+    // Black background
+    CelRasterClear(raster, 0x000000);
+
+    // Returns the created framebuffer
+    return raster;
+}
+
+// Fills the framebuffer with a color
+void CelRasterClear(CelRaster *raster, uint32 color) {
+
+    // Index to iterate through pixels
+    int32 index = 0;
+
+    for (index = 0; index < raster->width * raster->height; index++) {
+        raster->pixels[index * 3] = (uint8)(color >> 16);
+        raster->pixels[index * 3 + 1] = (uint8)(color >> 8);
+        raster->pixels[index * 3 + 2] = (uint8)color;
+    }
+}
+
+// Draws a list of CCBs
+int32 CelRasterDrawCels(CelRaster *raster, CCB *ccb) {
+
+    // Position of the Cel in the list
+    int32 cel = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterDrawCels()*\n"); }
+
+    // If the framebuffer is unknown
+    if (raster == NULL){
+        // Returns an error
+        printf("Error : CelRaster unknown.\n");
+        return -1;
+    }
+
+    // Follows the chain like the Cel Engine
+    for (cel = 0; (ccb != NULL) && (cel < CELRASTER_CELS_MAX); cel++) {
+
+        // A skipped Cel isn't drawn but its next pointer is followed
+        if ((ccb->ccb_Flags & CCB_SKIP) == 0) { CelRasterDrawCel(raster, ccb, cel); }
+
+        // The last Cel ends the list
+        if ((ccb->ccb_Flags & CCB_LAST) != 0) { cel++; break; }
+        ccb = ccb->ccb_NextPtr;
+    }
+
+    // If the chain didn't end
+    if (cel >= CELRASTER_CELS_MAX) {
+        // Displays a warning
+        printf("Warning : CelRaster list longer than %d Cels, looping chain?\n", CELRASTER_CELS_MAX);
+    }
+
+    // Returns the number of Cels visited
+    raster->celsCount = cel;
+    return cel;
+}
+
+// Draws a single CCB
+int32 CelRasterDrawCel(CelRaster *raster, CCB *ccb, int32 cel) {
+
+    // Cel drawn
+    CelRasterDrawContext draw;
+
+    // If the framebuffer or the CCB is unknown
+    if ((raster == NULL) || (ccb == NULL)){
+        // Returns an error
+        printf("Error : CelRaster CCB unknown.\n");
+        return -1;
+    }
+
+    // Plots each covered pixel with the color of its source pixel
+    draw.raster = raster;
+    draw.ccb = ccb;
+    draw.cel = cel;
+    CelRasterCoverage(ccb, raster->width, raster->height, CelRasterDrawPlot, &draw);
+
+    // Returns success
+    return 1;
+}
+
+// Default color of a source pixel
+uint32 CelRasterDefaultSource(CCB *ccb, int32 cel, int32 u, int32 v) {
+
+    // Color of the Cel
+    uint32 color = CelRasterPalette[cel & 7];
+
+    // Only the position of the Cel in the list chooses the color
+    (void)ccb;
+
+    // The first row and the first column are white: they show the orientation
+    if ((u == 0) || (v == 0)) { return 0xFFFFFF; }
+
+    // A checker shows each source pixel
+    if (((u + v) & 1) != 0) { color = (color >> 1) & 0x7F7F7F; }
+
+    return color;
+}
+
+// Calls a function for each screen pixel covered by a CCB, inside width x height
+void CelRasterCoverage(CCB *ccb, int32 width, int32 height, CelRasterPlot plot, void *context) {
+
+    // Source pixel
+    int32 u = 0;
+    int32 v = 0;
+    // Corners of the source pixel (u, v), (u + 1, v), (u + 1, v + 1), (u, v + 1)
+    double cornerX[4];
+    double cornerY[4];
+    // Triangle
+    double triangleX[3];
+    double triangleY[3];
+
+    // For each source pixel
+    for (v = 0; v < ccb->ccb_Height; v++) {
+        for (u = 0; u < ccb->ccb_Width; u++) {
+
+            // Corners of the quadrilateral
+            CelRasterCorner(ccb, u, v, &cornerX[0], &cornerY[0]);
+            CelRasterCorner(ccb, u + 1, v, &cornerX[1], &cornerY[1]);
+            CelRasterCorner(ccb, u + 1, v + 1, &cornerX[2], &cornerY[2]);
+            CelRasterCorner(ccb, u, v + 1, &cornerX[3], &cornerY[3]);
+
+            // Two triangles sharing the diagonal (u, v) - (u + 1, v + 1)
+            triangleX[0] = cornerX[0]; triangleY[0] = cornerY[0];
+            triangleX[1] = cornerX[1]; triangleY[1] = cornerY[1];
+            triangleX[2] = cornerX[2]; triangleY[2] = cornerY[2];
+            CelRasterTriangle(triangleX, triangleY, width, height, u, v, plot, context);
+            triangleX[1] = cornerX[2]; triangleY[1] = cornerY[2];
+            triangleX[2] = cornerX[3]; triangleY[2] = cornerY[3];
+            CelRasterTriangle(triangleX, triangleY, width, height, u, v, plot, context);
+        }
+    }
+}
+
+// Corner (u, v) of a CCB in 2^-20 pixel units
+void CelRasterCorner(CCB *ccb, int32 u, int32 v, double *x, double *y) {
+
+    // XPos/YPos and VDX/VDY are in 16.16, HDX/HDY and HDDX/HDDY in 12.20
+    *x = (double)((long long)ccb->ccb_XPos * 16 + (long long)v * ccb->ccb_VDX * 16 + (long long)u * ccb->ccb_HDX + (long long)u * v * ccb->ccb_HDDX);
+    *y = (double)((long long)ccb->ccb_YPos * 16 + (long long)v * ccb->ccb_VDY * 16 + (long long)u * ccb->ccb_HDY + (long long)u * v * ccb->ccb_HDDY);
+}
+
+// Calls a function for each screen pixel whose center is inside a triangle
+void CelRasterTriangle(double *x, double *y, int32 width, int32 height, int32 u, int32 v, CelRasterPlot plot, void *context) {
+
+    // One pixel and half a pixel in 2^-20 units
+    const double one = 1048576.0;
+    const double half = 524288.0;
+    // Twice the signed area
+    double area = 0;
+    // Swap of two vertices
+    double swap = 0;
+    // Bounding box in pixels
+    int32 left = 0;
+    int32 top = 0;
+    int32 right = 0;
+    int32 bottom = 0;
+    // Screen pixel and its center
+    int32 screenX = 0;
+    int32 screenY = 0;
+    double centerX = 0;
+    double centerY = 0;
+    // Edges and their values at the center
+    int32 edge = 0;
+    int32 inside = 0;
+    double value = 0;
+    double edgeX = 0;
+    double edgeY = 0;
+
+    // Orients the triangle so that the inside is on the positive side of each edge
+    area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    // A flat triangle covers nothing
+    if (area == 0) { return; }
+    if (area < 0) {
+        swap = x[1]; x[1] = x[2]; x[2] = swap;
+        swap = y[1]; y[1] = y[2]; y[2] = swap;
+    }
+
+    // Pixels whose center can be inside, clipped to the framebuffer
+    left = (int32)ceil(((x[0] < x[1] ? (x[0] < x[2] ? x[0] : x[2]) : (x[1] < x[2] ? x[1] : x[2])) - half) / one);
+    right = (int32)floor(((x[0] > x[1] ? (x[0] > x[2] ? x[0] : x[2]) : (x[1] > x[2] ? x[1] : x[2])) - half) / one);
+    top = (int32)ceil(((y[0] < y[1] ? (y[0] < y[2] ? y[0] : y[2]) : (y[1] < y[2] ? y[1] : y[2])) - half) / one);
+    bottom = (int32)floor(((y[0] > y[1] ? (y[0] > y[2] ? y[0] : y[2]) : (y[1] > y[2] ? y[1] : y[2])) - half) / one);
+    left = (left > 0) ? left : 0;
+    top = (top > 0) ? top : 0;
+    right = (right < width - 1) ? right : width - 1;
+    bottom = (bottom < height - 1) ? bottom : height - 1;
+
+    // For each candidate pixel
+    for (screenY = top; screenY <= bottom; screenY++) {
+        centerY = screenY * one + half;
+        for (screenX = left; screenX <= right; screenX++) {
+            centerX = screenX * one + half;
+
+            // Tests the center against the three edges
+            inside = 1;
+            for (edge = 0; (edge < 3) && (inside == 1); edge++) {
+                edgeX = x[(edge + 1) % 3] - x[edge];
+                edgeY = y[(edge + 1) % 3] - y[edge];
+                value = edgeX * (centerY - y[edge]) - edgeY * (centerX - x[edge]);
+                // A center on an edge belongs to the top and left edges only
+                if ((value < 0) || ((value == 0) && !((edgeY < 0) || ((edgeY == 0) && (edgeX > 0))))) { inside = 0; }
+            }
+
+            // If the center is inside
+            if (inside == 1) { plot(context, screenX, screenY, u, v); }
+        }
+    }
+}
+
+// Saves the framebuffer as a PPM image
+int32 CelRasterWritePPM(CelRaster *raster, char *filename) {
+
+    // File
+    FILE *file = NULL;
+    // Size of the pixels in bytes
+    size_t size = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterWritePPM()*\n"); }
+
+    // If the parameters are unknown
+    if ((raster == NULL) || (filename == NULL)) {
+        // Returns an error
+        printf("Error : CelRaster unknown.\n");
+        return -1;
+    }
+
+    // Opens the file
+    file = fopen(filename, "wb");
+    // If it's a failure
+    if (file == NULL) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Binary PPM: header then the RGB pixels row by row
+    size = (size_t)raster->width * raster->height * 3;
+    fprintf(file, "P6\n%d %d\n255\n", raster->width, raster->height);
+    if (fwrite(raster->pixels, 1, size, file) != size) {
+        // Closes the file
+        fclose(file);
+        // Returns an error
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Closes the file
+    fclose(file);
+
+    // Returns success
+    return 1;
+}
+
+// Counts the pixels differing from a PPM image by more than a tolerance
+int32 CelRasterCompare(CelRaster *raster, char *filename, int32 tolerance) {
+
+    // File
+    FILE *file = NULL;
+    // Header of the image
+    char magic[3] = {0};
+    int32 width = 0;
+    int32 height = 0;
+    int32 maximum = 0;
+    // Pixel read from the image
+    uint8 pixel[3];
+    // Index to iterate through pixels and channels
+    int32 index = 0;
+    int32 channel = 0;
+    // Difference of a channel
+    int32 difference = 0;
+    // Number of pixels differing
+    int32 differences = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterCompare()*\n"); }
+
+    // If the parameters are unknown
+    if ((raster == NULL) || (filename == NULL)) {
+        // Returns an error
+        printf("Error : CelRaster unknown.\n");
+        return -1;
+    }
+
+    // Opens the file
+    file = fopen(filename, "rb");
+    // If it's a failure
+    if (file == NULL) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Reads the header, written by CelRasterWritePPM()
+    if ((fscanf(file, "%2s %d %d %d", magic, &width, &height, &maximum) != 4) || (magic[0] != 'P') || (magic[1] != '6') || (maximum != 255) || (fgetc(file) == EOF)) {
+        // Closes the file
+        fclose(file);
+        // Returns an error
+        printf("Error : %s isn't a binary PPM image.\n", filename);
+        return -1;
+    }
+
+    // If the size differs
+    if ((width != raster->width) || (height != raster->height)) {
+        // Closes the file
+        fclose(file);
+        // Returns an error
+        printf("Error : %s is %d x %d, the framebuffer %d x %d.\n", filename, width, height, raster->width, raster->height);
+        return -1;
+    }
+
+    // Compares each pixel
+    for (index = 0; index < width * height; index++) {
+        // If the image is truncated
+        if (fread(pixel, 1, 3, file) != 3) {
+            // Closes the file
+            fclose(file);
+            // Returns an error
+            printf("Error : %s is truncated.\n", filename);
+            return -1;
+        }
+        // The pixel differs if one of its channels is beyond the tolerance
+        for (channel = 0; channel < 3; channel++) {
+            difference = (int32)raster->pixels[index * 3 + channel] - (int32)pixel[channel];
+            if ((difference > tolerance) || (difference < -tolerance)) { differences++; break; }
+        }
+    }
+
+    // Closes the file
+    fclose(file);
+
+    // Returns the number of pixels differing
+    return differences;
+}
+
+// Deletes the framebuffer
+int32 CelRasterCleanup(CelRaster *raster) {
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterCleanup()*\n"); }
+
+    // If the framebuffer is unknown
+    if (raster == NULL){
+        // Returns an error
+        printf("Error : CelRaster unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used by the pixels and the framebuffer
+    free(raster->pixels);
+    free(raster);
+
+    // Returns success
+    return 1;
+}
@@ -0,0 +1,136 @@
+#ifndef CELRASTER_H
+#define CELRASTER_H
+
+/******************************************************************************
+**
+**  CelRaster - Reference software rasterizer of CCB lists (host)
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  This module draws a list of CCBs into an RGB framebuffer on the host,
+**  following the fields written by CelQuadMap: XPos/YPos, HDX/HDY, VDX/VDY,
+**  HDDX/HDDY, CCB_SKIP, CCB_LAST and the ccb_NextPtr chain. The result can be
+**  saved as a PPM image and compared with a reference image, so a change in
+**  the projection or in its rounding shows up without 3DO hardware.
+**
+**  Each source pixel (u, v) of a Cel is the quadrilateral between the corners
+**  (u, v) and (u + 1, v + 1), with:
+**
+**    x = XPos + v * VDX + u * (HDX + v * HDDX)
+**    y = YPos + v * VDY + u * (HDY + v * HDDY)
+**
+**  computed exactly in 2^-20 pixel units. A screen pixel is drawn when its
+**  center is inside the quadrilateral, with a top-left rule on the edges so
+**  that two neighbouring source pixels never draw the same screen pixel.
+**
+**  Important notes:
+**
+**    - The source data isn't decoded: the color of a source pixel comes from
+**      a CelRasterSource function. The default one mixes a color per Cel with a
+**      white first row and first column and a checker, which shows the orientation
+**      and the edges of each Cel. PIXC blending isn't modeled, the last Cel drawn wins.
+**
+**    - The ccb_NextPtr chain is followed as absolute pointers, as written by
+**      LinkCel(). The traversal stops after CELRASTER_CELS_MAX Cels to survive a
+**      looping chain.
+**
+**    - This module is intended for the host tool. It takes the CCB and its
+**      types from graphics.h and types.h: Host/ holds host versions of them,
+**      with operamath.h for CelQuadMap and Geometry, and a Makefile building
+**      them with a standard C compiler. CelRasterCoverage() is the geometry
+**      shared with the analysis tools.
+**
+**    - Host/CelRasterGolden draws an axis-aligned, a rotated and a bilinear-
+**      stretched group and compares them with the images of Host/Golden
+**      (make test). After a change checked by eye, make golden writes them again.
+**
+**  Structure Roles :
+**
+**    CelRaster
+**      - width, height : Size of the framebuffer in pixels
+**      - pixels : RGB framebuffer, 3 bytes per pixel, row by row
+**      - source : Function giving the color of a source pixel
+**      - celsCount : Number of Cels drawn by the last CelRasterDrawCels()
+**
+**  Main Functions :
+**
+**    CelRasterInitialization()
+**      -> Creates a framebuffer with the default source.
+**
+**    CelRasterClear()
+**      -> Fills the framebuffer with a color.
+**
+**    CelRasterDrawCels()
+**      -> Draws a list of CCBs following the ccb_NextPtr chain.
+**
+**    CelRasterDrawCel()
+**      -> Draws a single CCB.
+**
+**    CelRasterCoverage()
+**      -> Calls a function for each screen pixel covered by each source pixel of a CCB.
+**
+**    CelRasterWritePPM() / CelRasterCompare()
+**      -> Saves the framebuffer as a PPM image, or counts the pixels differing from one.
+**
+**    CelRasterCleanup()
+**      -> Frees the memory used by the framebuffer.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_CELRASTER 0
+
+// Maximum number of Cels followed in a list
+#define CELRASTER_CELS_MAX 65536
+
+// Color of a source pixel (0xRRGGBB), cel is its position in the list
+typedef uint32 (*CelRasterSource)(CCB *ccb, int32 cel, int32 u, int32 v);
+// Screen pixel (x, y) covered by the source pixel (u, v)
+typedef void (*CelRasterPlot)(void *context, int32 x, int32 y, int32 u, int32 v);
+
+typedef struct {
+    // Size of the framebuffer in pixels
+    int32 width;
+    int32 height;
+    // RGB framebuffer, 3 bytes per pixel, row by row
+    uint8 *pixels;
+    // Function giving the color of a source pixel
+    CelRasterSource source;
+    // Number of Cels drawn by the last CelRasterDrawCels()
+    int32 celsCount;
+} CelRaster;
+
+// Initialization of a framebuffer
+CelRaster *CelRasterInitialization(int32 width, int32 height);
+// Fills the framebuffer with a color
+void CelRasterClear(CelRaster *raster, uint32 color);
+
+// Draws a list of CCBs
+int32 CelRasterDrawCels(CelRaster *raster, CCB *ccb);
+// Draws a single CCB
+int32 CelRasterDrawCel(CelRaster *raster, CCB *ccb, int32 cel);
+// Default color of a source pixel
+uint32 CelRasterDefaultSource(CCB *ccb, int32 cel, int32 u, int32 v);
+
+// Calls a function for each screen pixel covered by a CCB, inside width x height
+void CelRasterCoverage(CCB *ccb, int32 width, int32 height, CelRasterPlot plot, void *context);
+// Corner (u, v) of a CCB in 2^-20 pixel units
+void CelRasterCorner(CCB *ccb, int32 u, int32 v, double *x, double *y);
+// Calls a function for each screen pixel whose center is inside a triangle
+void CelRasterTriangle(double *x, double *y, int32 width, int32 height, int32 u, int32 v, CelRasterPlot plot, void *context);
+
+// Saves the framebuffer as a PPM image
+int32 CelRasterWritePPM(CelRaster *raster, char *filename);
+// Counts the pixels differing from a PPM image by more than a tolerance
+int32 CelRasterCompare(CelRaster *raster, char *filename, int32 tolerance);
+
+// Deletes the framebuffer
+int32 CelRasterCleanup(CelRaster *raster);
+
+#endif // CELRASTER_H
@@ -1,6 +1,8 @@
 
 // Definitions of arguments
 #include "DefinitionsArguments.h"
+// GroupCel
+#include "GroupCel.h"
 // LoadCel()
 #include "celutils.h"
 // Point2D, Quad2D
@@ -8,11 +10,19 @@
 // printf()
 #include "stdio.h"
 
+// Elements of the GroupCel (celReference, positionX, positionY)
+static const GroupCelElement groupCelElements[] = {
+    { 0, 0, 0 },
+    { 1, 0, 0 }
+};
+
 int32 main(){
     
     // Cel
     CCB *cel_1 = NULL;
     CCB *cel_2 = NULL;
+    // Table of Cels referenced by the elements
+    CCB *cels[2] = {NULL};
     // GroupCel
     GroupCel *groupCel = NULL;
     
@@ -58,20 +68,14 @@ int32 main(){
         return -1;
     }   
     
+    // Table of Cels
+    cels[0] = cel_1;
+    cels[1] = cel_2;
+
     // Configure the GroupCel
-    printf("-> GroupCelElementsConfiguration()\n");
-    if (GroupCelElementsConfiguration(
-        // GroupCel
-        groupCel,
-        // Start of list
-        LIST_START,
-        // celIndex, CCB, positionX, positionY
-        0, cel_1, 0, 0,
-        1, cel_2, 0, 0,
-        // End of list
-        LIST_END
-    ) == 0) {
-        printf("Error <- GroupCelElementsConfiguration()\n");
+    printf("-> GroupCelElementsTableConfiguration()\n");
+    if (GroupCelElementsTableConfiguration(groupCel, groupCelElements, 2, cels, 2) < 0) {
+        printf("Error <- GroupCelElementsTableConfiguration()\n");
         return -1;
     }   
     
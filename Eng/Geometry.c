@@ -185,6 +185,29 @@ int32 RectanglesIntersection(Rectangle *rectangle1, Rectangle *rectangle2) {
 
 }
 
+// Smallest rectangle enclosing the 4 corners of a quad
+// -> Directly modifies the rectangle values
+void Quad2DBounds(Quad2D *quad, Rectangle *rectangle) {
+
+    // Corners of the quad
+    Point2D *corners[4];
+    // Index to iterate through corners
+    int32 cornerIndex = 0;
+
+    corners[0] = &quad->topLeft;
+    corners[1] = &quad->topRight;
+    corners[2] = &quad->bottomRight;
+    corners[3] = &quad->bottomLeft;
+    rectangle->topLeft = quad->topLeft;
+    rectangle->bottomRight = quad->topLeft;
+    for (cornerIndex = 1; cornerIndex < 4; cornerIndex++) {
+        if (corners[cornerIndex]->x < rectangle->topLeft.x) { rectangle->topLeft.x = corners[cornerIndex]->x; }
+        if (corners[cornerIndex]->y < rectangle->topLeft.y) { rectangle->topLeft.y = corners[cornerIndex]->y; }
+        if (corners[cornerIndex]->x > rectangle->bottomRight.x) { rectangle->bottomRight.x = corners[cornerIndex]->x; }
+        if (corners[cornerIndex]->y > rectangle->bottomRight.y) { rectangle->bottomRight.y = corners[cornerIndex]->y; }
+    }
+}
+
 // Scaling of a Cel based on a multiplier
 // -> Directly modifies the ccb_HDX and ccb_VDY values of the Cel
 void CelScale(CCB *cel, int32 scaleX, int32 scaleY) {
@@ -289,46 +312,50 @@ void CelFlipVertical(CCB *cel, int32 flip, uint32 correction) {
     cel->ccb_VDY *= flip;
 }
 
-// Returns the rectangle occupied on screen by the transformed Cel
-// -> Directly modifies the rectangle values
+// Returns the rectangle occupied on screen by the transformed Cel in 16.16 (not in pixels), HDDX/HDDY included
+// -> Directly modifies the rectangle values, in 16.16
 void CelProjection(CCB *cel, Rectangle *rectangle) {
 
-    // The coefficients (in fixed-point)
-    int32 hdx = cel->ccb_HDX; // 12.20
-    int32 hdy = cel->ccb_HDY; // 12.20
-    int32 vdx = cel->ccb_VDX; // 16.16
-    int32 vdy = cel->ccb_VDY; // 16.16
+    // Corners of the Cel on screen
+    Quad2D quad;
 
-    // Corner 1: origin
-    int32 px0 = cel->ccb_XPos;
-    int32 py0 = cel->ccb_YPos;
+    // The Cel stays inside its 4 corners, even when the bilinear terms bend it
+    CelProjectionQuad(cel, &quad);
 
-    // Corner 2: move in X (width)
-    int32 px1 = cel->ccb_XPos + ((hdx * cel->ccb_Width) >> 20);
-    int32 py1 = cel->ccb_YPos + ((hdy * cel->ccb_Width) >> 20);
+    // Find min/max to enclose the Cel
+    Quad2DBounds(&quad, rectangle);
+}
 
-    // Corner 3: move in Y (height)
-    int32 px2 = cel->ccb_XPos + ((vdx * cel->ccb_Height) >> 16);
-    int32 py2 = cel->ccb_YPos + ((vdy * cel->ccb_Height) >> 16);
+// Returns the 4 corners on screen of the transformed Cel in 16.16, HDDX/HDDY included
+// -> Directly modifies the quad values
+void CelProjectionQuad(CCB *cel, Quad2D *quad) {
 
-    // Corner 4: move in X + Y (diagonal)
-    int32 px3 = cel->ccb_XPos + ((hdx * cel->ccb_Width) >> 20) + ((vdx * cel->ccb_Height) >> 16);
-    int32 py3 = cel->ccb_YPos + ((hdy * cel->ccb_Width) >> 20) + ((vdy * cel->ccb_Height) >> 16);
+    // The Cel Engine adds HDDX/HDDY to HDX/HDY after each line: step of the last line (12.20)
+    int32 hdxLast = cel->ccb_HDX + (cel->ccb_HDDX * cel->ccb_Height);
+    int32 hdyLast = cel->ccb_HDY + (cel->ccb_HDDY * cel->ccb_Height);
 
-    // Find min/max to enclose the Cel
-    int32 minX = px0, maxX = px0;
-    int32 minY = py0, maxY = py0;
+    // Corner 1: origin
+    quad->topLeft.x = cel->ccb_XPos;
+    quad->topLeft.y = cel->ccb_YPos;
 
-    if (px1 < minX) minX = px1; if (px1 > maxX) maxX = px1;
-    if (px2 < minX) minX = px2; if (px2 > maxX) maxX = px2;
-    if (px3 < minX) minX = px3; if (px3 > maxX) maxX = px3;
+    // Corner 2: move in X (width) along the first line
+    quad->topRight.x = cel->ccb_XPos + CelProjectionStep(cel->ccb_HDX, cel->ccb_Width);
+    quad->topRight.y = cel->ccb_YPos + CelProjectionStep(cel->ccb_HDY, cel->ccb_Width);
+
+    // Corner 4: move in Y (height), VDX/VDY are already in 16.16
+    quad->bottomLeft.x = cel->ccb_XPos + (cel->ccb_VDX * cel->ccb_Height);
+    quad->bottomLeft.y = cel->ccb_YPos + (cel->ccb_VDY * cel->ccb_Height);
+
+    // Corner 3: move in X (width) along the last line
+    quad->bottomRight.x = quad->bottomLeft.x + CelProjectionStep(hdxLast, cel->ccb_Width);
+    quad->bottomRight.y = quad->bottomLeft.y + CelProjectionStep(hdyLast, cel->ccb_Width);
+}
 
-    if (py1 < minY) minY = py1; if (py1 > maxY) maxY = py1;
-    if (py2 < minY) minY = py2; if (py2 > maxY) maxY = py2;
-    if (py3 < minY) minY = py3; if (py3 > maxY) maxY = py3;
+// Moves a number of pixels along a 12.20 step, in 16.16 without overflow
+// -> Returns the offset in 16.16
+int32 CelProjectionStep(int32 step, int32 count) {
 
-    rectangle->topLeft.x = minX;
-    rectangle->topLeft.y = minY;
-    rectangle->bottomRight.x = maxX;
-    rectangle->bottomRight.y = maxY;
+    // The step times the count overflows 12.20 beyond 2048 pixels: the 16.16 part
+    // and the 4 lowest bits of the step are multiplied apart, the sum stays exact
+    return ((step >> 4) * count) + (((step & 15) * count) >> 4);
 }
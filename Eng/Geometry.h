@@ -19,6 +19,11 @@ typedef struct Point2D {
     int32 y;
 } Point2D;
 
+typedef struct Point2D16 {
+    int16 x;
+    int16 y;
+} Point2D16;
+
 typedef struct Quad2D {
     Point2D topLeft;
     Point2D topRight;
@@ -68,6 +73,10 @@ int32 Point2DInRectangle(Rectangle *rectangle, Point2D *point);
 // -> Returns 1 if the rectangles overlap, 0 otherwise
 int32 RectanglesIntersection(Rectangle *rectangle1, Rectangle *rectangle2);
 
+// Smallest rectangle enclosing the 4 corners of a quad
+// -> Directly modifies the rectangle values
+void Quad2DBounds(Quad2D *quad, Rectangle *rectangle);
+
 /* Cel manipulation */
 
 // Scales a Cel using a multiplier
@@ -90,8 +99,16 @@ void CelFlipHorizontal(CCB *cel, int32 flip, uint32 correction);
 // -> Directly modifies the ccb_VDY and ccb_YPos values of the Cel
 void CelFlipVertical(CCB *cel, int32 flip, uint32 correction);
 
-// Returns the rectangle occupied on screen by the transformed Cel
-// -> Directly modifies the rectangle values
+// Returns the rectangle occupied on screen by the transformed Cel in 16.16 (not in pixels), HDDX/HDDY included
+// -> Directly modifies the rectangle values, in 16.16
 void CelProjection(CCB *cel, Rectangle *rectangle);
 
+// Returns the 4 corners on screen of the transformed Cel in 16.16, HDDX/HDDY included
+// -> Directly modifies the quad values
+void CelProjectionQuad(CCB *cel, Quad2D *quad);
+
+// Moves a number of pixels along a 12.20 step, in 16.16 without overflow
+// -> Returns the offset in 16.16
+int32 CelProjectionStep(int32 step, int32 count);
+
 #endif // LIBRARY_GEOMETRY_H
@@ -5,19 +5,119 @@
 #include "DefinitionsArguments.h"
 // AllocMem(), FreeMem(), MEMTYPE_DRAM
 #include "mem.h"
+// CreateItem(), DeleteItem()
+#include "item.h"
+// MKNODEID(), NODE_GRAPHICS
+#include "nodes.h"
 // CloneCel
 #include "celutils.h"
-// memset()
+// memset(), memcmp()
 #include "string.h"
 // CelQuadMap
 #include "CelQuadMap.h"
 // Point2D, Quad2D
 #include "Geometry.h"
-// Convert32_F16, ConvertF16_32
+// Convert32_F16, ConvertF16_32, MulSF16
 #include "operamath.h"
 // printf()
 #include "stdio.h"
 
+// Initialization of the frame of a GroupCel
+void GroupCelFrameInitialization(GroupCel *groupCel, int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY) {
+
+    // Group position
+    groupCel->position.x = positionX;
+    groupCel->position.y = positionY;
+    groupCel->position16.x = Convert32_F16(positionX);
+    groupCel->position16.y = Convert32_F16(positionY);
+    // Group dimension
+    groupCel->size.x = sizeX;
+    groupCel->size.y = sizeY;
+
+    // Quadrilateral intended for stretching
+    groupCel->stretching.topLeft.x = 0;
+    groupCel->stretching.topLeft.y = 0;
+    groupCel->stretching.topRight.x = sizeX;
+    groupCel->stretching.topRight.y = 0;
+    groupCel->stretching.bottomRight.x = sizeX;
+    groupCel->stretching.bottomRight.y = sizeY;
+    groupCel->stretching.bottomLeft.x = 0;
+    groupCel->stretching.bottomLeft.y = sizeY;  
+
+    // Rotation
+    groupCel->rotationAngle = 0;
+    groupCel->rotationPivot.x = 0;
+    groupCel->rotationPivot.y = 0;
+    groupCel->rotationAngle16 = 0;
+    groupCel->rotationPivot16.x = 0;
+    groupCel->rotationPivot16.y = 0;
+
+    // No bundle data
+    groupCel->data = NULL;
+    groupCel->dataSize = 0;
+    // No pool
+    groupCel->pool = NULL;
+    // No transformation pending
+    groupCel->transformations = 0;
+    // No grid
+    groupCel->gridColumns = 0;
+    groupCel->gridRows = 0;
+    groupCel->tileSize.x = 0;
+    groupCel->tileSize.y = 0;
+    groupCel->tiles = NULL;
+    groupCel->lattice = NULL;
+    // No animation
+    groupCel->animations = NULL;
+    // No LOD chain
+    groupCel->lods = NULL;
+    groupCel->lodSwaps = 0;
+    // No reciprocals
+    groupCel->reciprocals = NULL;
+    groupCel->tileDimension.x = 0;
+    groupCel->tileDimension.y = 0;
+    // No quad cache
+    groupCel->quads = NULL;
+    groupCel->quadHits = 0;
+    groupCel->quadMisses = 0;
+    // No CCB written yet
+    groupCel->epoch = 0;
+    // No camera
+    groupCel->camera = NULL;
+    groupCel->cameraOffset.x = 0;
+    groupCel->cameraOffset.y = 0;
+    groupCel->cameraPan.x = 0;
+    groupCel->cameraPan.y = 0;
+    groupCel->cameraZoom = GROUPCEL_ZOOM_ONE;
+    groupCel->cameraFocus.x = 0;
+    groupCel->cameraFocus.y = 0;
+    // No chain yet
+    groupCel->cel = NULL;
+    groupCel->tail = NULL;
+    // Not in a display list
+    groupCel->previous = NULL;
+    groupCel->visible = 1;
+    // Draw order of the indexes
+    groupCel->order = NULL;
+    groupCel->orderFirst = GROUPCEL_ORDER_NONE;
+    groupCel->orderLast = GROUPCEL_ORDER_NONE;
+    groupCel->depthSort = 0;
+    groupCel->depthChanged = 0;
+    // No occlusion pass
+    groupCel->bounds = NULL;
+    groupCel->occlusion = NULL;
+    groupCel->occluders = NULL;
+    groupCel->occlusionEpoch = 0;
+    groupCel->occlusionChanged = 0;
+    groupCel->occludedCount = 0;
+    // Not flattened
+    groupCel->flat = NULL;
+    // No dirty rectangles
+    groupCel->dirty = NULL;
+    groupCel->dirtyBounds = NULL;
+    // No projections kept
+    groupCel->projections = NULL;
+}
+
 // Initialization of a GroupCel
 GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY, uint32 celsCount) {
 
@@ -42,27 +142,8 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
     sizeX = (sizeX > 1) ? sizeX : 1;
     sizeY = (sizeY > 1) ? sizeY : 1;
 
-    // Group position
-    groupCel->position.x = positionX;
-    groupCel->position.y = positionY;
-    // Group dimension
-    groupCel->size.x = sizeX;
-    groupCel->size.y = sizeY;
-
-    // Quadrilateral intended for stretching
-    groupCel->stretching.topLeft.x = 0;
-    groupCel->stretching.topLeft.y = 0;
-    groupCel->stretching.topRight.x = sizeX;
-    groupCel->stretching.topRight.y = 0;
-    groupCel->stretching.bottomRight.x = sizeX;
-    groupCel->stretching.bottomRight.y = sizeY;
-    groupCel->stretching.bottomLeft.x = 0;
-    groupCel->stretching.bottomLeft.y = sizeY;  
-
-    // Rotation
-    groupCel->rotationAngle = 0;
-    groupCel->rotationPivot.x = 0;
-    groupCel->rotationPivot.y = 0;
+    // Frame of the group
+    GroupCelFrameInitialization(groupCel, positionX, positionY, sizeX, sizeY);
 
     // Total number of cels
     groupCel->celsCount = celsCount;
@@ -81,6 +162,20 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
     // Initializes the values of the cels to 0 
     memset(groupCel->cels, 0, (size_t)celsCount * sizeof(GroupCelList));
 
+    // Allocates memory for the reciprocals of the elements
+    groupCel->reciprocals = (CelQuadMapReciprocals *)AllocMem(celsCount * sizeof(CelQuadMapReciprocals), MEMTYPE_DRAM);
+    // If it's a failure
+    if (groupCel->reciprocals == NULL) {
+        // Frees previously allocated memory
+        FreeMem(groupCel->cels, celsCount * sizeof(GroupCelList));
+        FreeMem(groupCel, sizeof(GroupCel));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel reciprocals.\n");
+        return NULL;
+    }
+    // No dimension seen yet
+    memset(groupCel->reciprocals, 0, (size_t)celsCount * sizeof(CelQuadMapReciprocals));
+
     // Returns the created GroupCel
     return groupCel;
 }
@@ -90,6 +185,8 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
 
     // Quadrilateral for Cel projection in 16.16
     Quad2D quadMap = {0};
+    // CCB following the group in its display list
+    CCB *follower = NULL;
 
     if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementConfiguration()*\n"); }
 
@@ -122,13 +219,24 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
         celIndex = groupCel->celsCount - 1; 
     }
 
-    // Stores the Cel in the list
-    groupCel->cels[celIndex].position.x = positionX;
-    groupCel->cels[celIndex].position.y = positionY;
-    groupCel->cels[celIndex].cel = (CCB *)cel;
+    // CCB following the group, taken from the tail before it changes
+    if (groupCel->previous != NULL) { follower = GroupCelChainNext(groupCel->tail); }
 
+    // Shows the previous CCB if the occlusion pass hid it
+    if (groupCel->occlusion != NULL) { GroupCelOcclusionShow(groupCel, celIndex); }
+    // The new CCB drops the LOD chain of the previous one
+    if (groupCel->lods != NULL) { memset(&groupCel->lods[celIndex], 0, sizeof(GroupCelLod)); }
+    // Stores the Cel in the list
+    GroupCelElementStore(&groupCel->cels[celIndex], (CCB *)cel, Convert32_F16(positionX), Convert32_F16(positionY));
+    // Forgets the quad committed in the previous CCB
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+
+    // If the draw order is managed
+    if (groupCel->order != NULL) {
+        // The new CCB takes the place of the element in it
+        GroupCelDrawOrderReplace(groupCel, celIndex);
     // If it's the first Cel in the list
-    if(celIndex == 0){
+    } else if(celIndex == 0){
         // Updates the group's main CCB
         groupCel->cel = groupCel->cels[celIndex].cel;
     // Otherwise
@@ -136,9 +244,23 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
         // Informs the Cel Engine that this is the next Cel to render
         LinkCel(groupCel->cels[celIndex - 1].cel, groupCel->cels[celIndex].cel);
     }
+    // If the draw order isn't managed
+    if (groupCel->order == NULL) {
+        // If no configured element follows, the Cel ends the group's chain
+        if ((celIndex == groupCel->celsCount - 1) || (groupCel->cels[celIndex + 1].cel == NULL)) {
+            groupCel->tail = groupCel->cels[celIndex].cel;
+        // Otherwise, the new CCB goes on to the element configured after it
+        } else {
+            LinkCel(groupCel->cels[celIndex].cel, groupCel->cels[celIndex + 1].cel);
+        }
+        // If the group is already in a display list, relinks the ends of its chain
+        GroupCelChainRelink(groupCel, follower);
+    }
 
     // Updates the position in the Cel's CCB
     GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
+    // A flattened group renders its elements again
+    GroupCelElementsChanged(groupCel);
 
     // Returns success
     return 1;
@@ -180,7 +302,7 @@ int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...) {
         positionY = va_arg(args, uint32);
 
         // Sprite frame configuration
-        if (DEBUG_GROUPCEL_SETUP == 1) { printf("-> GroupCelElementConfiguration(%p, %u, %p, %u, %u)\n", groupCel, celIndex, cel, positionX, positionY); }
+        if (DEBUG_GROUPCEL_SETUP == 1) { printf("-> GroupCelElementConfiguration(%p, %u, %p, %u, %u)\n", (void *)groupCel, celIndex, (void *)cel, positionX, positionY); }
         if (GroupCelElementConfiguration(groupCel, celIndex, cel, positionX, positionY) < 0) {
             // End of the argument list
             va_end(args);
@@ -197,6 +319,388 @@ int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...) {
     return 1;
 }
 
+// Configuration of the cels in a GroupCel from a table of descriptors
+int32 GroupCelElementsTableConfiguration(GroupCel *groupCel, const GroupCelElement *elements, uint32 elementsCount, CCB **cels, uint32 celsCount) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Quadrilateral for Cel projection in 16.16
+    Quad2D quadMap = {0};
+    // CCB following the group in its display list
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementsTableConfiguration()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the list of Cels is unknown
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel list unknown.\n");
+        return -1;
+    }
+
+    // If the table of descriptors or the table of Cels is unknown
+    if ((elements == NULL) || (cels == NULL)){
+        // Returns an error
+        printf("Error : GroupCel table unknown.\n");
+        return -1;
+    }
+
+    // If the table doesn't fit in the group
+    if ((elementsCount == 0) || (elementsCount > groupCel->celsCount)) {
+        // Returns an error
+        printf("Error : GroupCel table of %u elements doesn't fit %u cels.\n", elementsCount, groupCel->celsCount);
+        return -1;
+    }
+
+    // Validates the whole table before modifying the group
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        // If the reference is out of bounds or the Cel is unknown
+        if ((elements[celIndex].celReference >= celsCount) || (cels[elements[celIndex].celReference] == NULL)) {
+            // Returns an error
+            printf("Error : GroupCel element %u references an unknown Cel.\n", celIndex);
+            return -1;
+        }
+    }
+
+    // CCB following the group, taken from the tail before it changes
+    if (groupCel->previous != NULL) { follower = GroupCelChainNext(groupCel->tail); }
+
+    // A new table brings back the order of the indexes
+    GroupCelDrawOrderCleanup(groupCel);
+
+    // Stores the Cels in the list and links them in a single pass
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        // Shows the previous CCB if the occlusion pass hid it
+        if (groupCel->occlusion != NULL) { GroupCelOcclusionShow(groupCel, celIndex); }
+        // The new CCB drops the LOD chain of the previous one
+        if (groupCel->lods != NULL) { memset(&groupCel->lods[celIndex], 0, sizeof(GroupCelLod)); }
+        GroupCelElementStore(&groupCel->cels[celIndex], cels[elements[celIndex].celReference], Convert32_F16(elements[celIndex].positionX), Convert32_F16(elements[celIndex].positionY));
+        // Forgets the quad committed in the previous CCB
+        if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+        // Informs the Cel Engine that this is the next Cel to render
+        if (celIndex > 0) { LinkCel(groupCel->cels[celIndex - 1].cel, groupCel->cels[celIndex].cel); }
+    }
+
+    // If an element configured earlier follows the table
+    if ((elementsCount < groupCel->celsCount) && (groupCel->cels[elementsCount].cel != NULL)) {
+        // Keeps the chain continuous
+        LinkCel(groupCel->cels[elementsCount - 1].cel, groupCel->cels[elementsCount].cel);
+    }
+
+    // Updates the group's main CCB
+    groupCel->cel = groupCel->cels[0].cel;
+    // The chain ends on the last element configured without a gap
+    celIndex = elementsCount;
+    while ((celIndex < groupCel->celsCount) && (groupCel->cels[celIndex].cel != NULL)) { celIndex++; }
+    groupCel->tail = groupCel->cels[celIndex - 1].cel;
+    // If the group is already in a display list, relinks the ends of its chain
+    GroupCelChainRelink(groupCel, follower);
+
+    // Updates the positions in the Cels' CCBs in a single batch
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
+    }
+    // A flattened group renders its elements again
+    GroupCelElementsChanged(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Initialization of a grid GroupCel
+GroupCel *GroupCelGridInitialization(int32 positionX, int32 positionY, uint32 columns, uint32 rows, uint32 tileSizeX, uint32 tileSizeY) {
+
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelGridInitialization()*\n"); }
+
+    // Allocates memory for the GroupCel
+    groupCel = (GroupCel *)AllocMem(sizeof(GroupCel), MEMTYPE_DRAM);
+    // If it's a failure
+    if (groupCel == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel.\n");
+        return NULL;
+    }
+
+    // Corrects parameters
+    // Minimum grid = 1 x 1 tile
+    columns = (columns > 1) ? columns : 1;
+    rows = (rows > 1) ? rows : 1;
+    // Minimum tile = 1 x 1 pixel
+    tileSizeX = (tileSizeX > 1) ? tileSizeX : 1;
+    tileSizeY = (tileSizeY > 1) ? tileSizeY : 1;
+
+    // The frame encloses the whole grid
+    GroupCelFrameInitialization(groupCel, positionX, positionY, columns * tileSizeX, rows * tileSizeY);
+
+    // Grid
+    groupCel->gridColumns = columns;
+    groupCel->gridRows = rows;
+    groupCel->tileSize.x = tileSizeX;
+    groupCel->tileSize.y = tileSizeY;
+    // Total number of tiles
+    groupCel->celsCount = columns * rows;
+    // The positions are implied by the index: no list of elements
+    groupCel->cels = NULL;
+
+    // Allocates memory for the array of tiles
+    groupCel->tiles = (CCB **)AllocMem(groupCel->celsCount * sizeof(CCB *), MEMTYPE_DRAM);
+    // Allocates memory for two rows of lattice vertices
+    groupCel->lattice = (Point2D *)AllocMem(2 * (columns + 1) * sizeof(Point2D), MEMTYPE_DRAM);
+    // If it's a failure
+    if ((groupCel->tiles == NULL) || (groupCel->lattice == NULL)) {
+        // Frees previously allocated memory
+        if (groupCel->tiles != NULL) { FreeMem(groupCel->tiles, groupCel->celsCount * sizeof(CCB *)); }
+        if (groupCel->lattice != NULL) { FreeMem(groupCel->lattice, 2 * (columns + 1) * sizeof(Point2D)); }
+        FreeMem(groupCel, sizeof(GroupCel));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel grid.\n");
+        return NULL;
+    }
+
+    // No tile yet
+    memset(groupCel->tiles, 0, (size_t)groupCel->celsCount * sizeof(CCB *));
+
+    // Returns the created GroupCel
+    return groupCel;
+}
+
+// Configuration of a tile in a grid GroupCel
+int32 GroupCelGridTileConfiguration(GroupCel *groupCel, uint32 column, uint32 row, CCB *cel) {
+
+    // Index of the tile
+    uint32 tileIndex = 0;
+    // Index to search for the neighbouring tiles
+    int32 searchIndex = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelGridTileConfiguration()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the group isn't a grid
+    if (groupCel->tiles == NULL){
+        // Returns an error
+        printf("Error : GroupCel grid unknown.\n");
+        return -1;
+    }
+
+    // If the Cel is unknown
+    if (cel == NULL){
+        // Returns an error
+        printf("Error : Cel unknown.\n");
+        return -1;
+    }
+
+    // If the tile is outside the grid
+    if ((column >= groupCel->gridColumns) || (row >= groupCel->gridRows)) {
+        // Returns an error
+        printf("Error : GroupCel tile (%u, %u) outside the %u x %u grid.\n", column, row, groupCel->gridColumns, groupCel->gridRows);
+        return -1;
+    }
+
+    // Stores the Cel in the grid
+    tileIndex = row * groupCel->gridColumns + column;
+    groupCel->tiles[tileIndex] = cel;
+
+    // Links the Cel after the previous tile configured
+    for (searchIndex = (int32)tileIndex - 1; searchIndex >= 0; searchIndex--) {
+        if (groupCel->tiles[searchIndex] != NULL) { break; }
+    }
+    // If there is none, it's the group's main CCB
+    if (searchIndex < 0) {
+        groupCel->cel = cel;
+    // Otherwise
+    } else {
+        // Informs the Cel Engine that this is the next Cel to render
+        LinkCel(groupCel->tiles[searchIndex], cel);
+    }
+
+    // Links the Cel before the next tile configured
+    for (searchIndex = (int32)tileIndex + 1; searchIndex < (int32)groupCel->celsCount; searchIndex++) {
+        if (groupCel->tiles[searchIndex] != NULL) {
+            LinkCel(cel, groupCel->tiles[searchIndex]);
+            break;
+        }
+    }
+    // If no tile follows, the Cel ends the group's chain
+    if (searchIndex == (int32)groupCel->celsCount) { groupCel->tail = cel; }
+
+    // Activates movement to place the tile
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Returns success
+    return 1;
+}
+
+// Configuration of all the tiles of a grid GroupCel
+int32 GroupCelGridTilesConfiguration(GroupCel *groupCel, CCB **cels, uint32 celsCount) {
+
+    // Index to iterate through tiles
+    uint32 tileIndex = 0;
+    // Last tile linked
+    CCB *previousCel = NULL;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelGridTilesConfiguration()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the group isn't a grid
+    if (groupCel->tiles == NULL){
+        // Returns an error
+        printf("Error : GroupCel grid unknown.\n");
+        return -1;
+    }
+
+    // If the table doesn't cover the grid
+    if ((cels == NULL) || (celsCount != groupCel->celsCount)) {
+        // Returns an error
+        printf("Error : GroupCel table of %u tiles doesn't fit %u tiles.\n", celsCount, groupCel->celsCount);
+        return -1;
+    }
+
+    // Stores the tiles row by row and links them in a single pass (an empty cell is NULL)
+    groupCel->cel = NULL;
+    for (tileIndex = 0; tileIndex < celsCount; tileIndex++) {
+        groupCel->tiles[tileIndex] = cels[tileIndex];
+        // If the cell is empty
+        if (cels[tileIndex] == NULL) { continue; }
+        // Informs the Cel Engine that this is the next Cel to render
+        if (previousCel == NULL) { groupCel->cel = cels[tileIndex]; } else { LinkCel(previousCel, cels[tileIndex]); }
+        previousCel = cels[tileIndex];
+    }
+    // The last tile linked ends the group's chain
+    groupCel->tail = previousCel;
+
+    // Places all the tiles
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    GroupCelUpdate(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Creation of a GroupCel sharing the source data of a template
+GroupCel *GroupCelInstantiate(GroupCel *templateGroupCel, GroupCelPool *pool, int32 positionX, int32 positionY) {
+
+    // GroupCel
+    GroupCel *groupCel = NULL;
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // CCB header of the instance
+    CCB *cel = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelInstantiate()*\n"); }
+
+    // If the template is unknown
+    if ((templateGroupCel == NULL) || (templateGroupCel->cels == NULL)){
+        // Returns an error
+        printf("Error : GroupCel template unknown.\n");
+        return NULL;
+    }
+
+    // If the pool is unknown
+    if (pool == NULL){
+        // Returns an error
+        printf("Error : GroupCel pool unknown.\n");
+        return NULL;
+    }
+
+    // If the pool can't provide all the CCB headers
+    if (pool->freeCount < templateGroupCel->celsCount) {
+        // Returns an error
+        printf("Error : GroupCel pool exhausted (%u free, %u needed).\n", pool->freeCount, templateGroupCel->celsCount);
+        return NULL;
+    }
+
+    // Validates the template before taking anything from the pool
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+        // If an element of the template isn't configured
+        if (templateGroupCel->cels[celIndex].cel == NULL) {
+            // Returns an error
+            printf("Error : GroupCel template element %u unknown.\n", celIndex);
+            return NULL;
+        }
+    }
+
+    // Creates the GroupCel with the frame of the template
+    groupCel = GroupCelInitialization(positionX, positionY, templateGroupCel->size.x, templateGroupCel->size.y, templateGroupCel->celsCount);
+    // If it fails
+    if (groupCel == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    // The CCB headers come from the pool
+    groupCel->pool = pool;
+
+    // Copies the layout: the stretching is local, the pivot follows the group
+    groupCel->stretching = templateGroupCel->stretching;
+    groupCel->rotationAngle = templateGroupCel->rotationAngle;
+    groupCel->rotationAngle16 = templateGroupCel->rotationAngle16;
+    groupCel->rotationPivot.x = templateGroupCel->rotationPivot.x + positionX - templateGroupCel->position.x;
+    groupCel->rotationPivot.y = templateGroupCel->rotationPivot.y + positionY - templateGroupCel->position.y;
+    groupCel->rotationPivot16.x = templateGroupCel->rotationPivot16.x + Convert32_F16(positionX) - templateGroupCel->position16.x;
+    groupCel->rotationPivot16.y = templateGroupCel->rotationPivot16.y + Convert32_F16(positionY) - templateGroupCel->position16.y;
+    // The instance is seen through the camera of the template
+    groupCel->camera = templateGroupCel->camera;
+
+    // For each element
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+
+        // Copies only the CCB header: source data and PLUT are shared
+        cel = GroupCelPoolAllocation(pool);
+        *cel = *templateGroupCel->cels[celIndex].cel;
+        // The instance draws the elements hidden by the occlusion pass of the template
+        if ((templateGroupCel->occlusion != NULL) && ((templateGroupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0)) { cel->ccb_Flags &= ~CCB_SKIP; }
+
+        // Copies the element with its cached dimension
+        groupCel->cels[celIndex] = templateGroupCel->cels[celIndex];
+        groupCel->cels[celIndex].cel = cel;
+        // The dimension is the same, so no resize would compute the reciprocals: computes them now
+        CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+
+        // Informs the Cel Engine that this is the next Cel to render
+        if (celIndex > 0) { LinkCel(groupCel->cels[celIndex - 1].cel, cel); }
+    }
+
+    // The last Cel ends the chain of the instance
+    cel->ccb_NextPtr = NULL;
+    cel->ccb_Flags |= CCB_LAST;
+    groupCel->tail = cel;
+
+    // Updates the group's main CCB
+    groupCel->cel = groupCel->cels[0].cel;
+
+    // Applies the position and the transformations of the template
+    groupCel->transformations = GROUPCEL_FLAG_MOVE;
+    if (GroupCelIsStretched(groupCel) == 1) { groupCel->transformations |= GROUPCEL_FLAG_STRETCH; }
+    if (groupCel->rotationAngle16 != 0) { groupCel->transformations |= GROUPCEL_FLAG_ROTATE; }
+    GroupCelUpdate(groupCel);
+
+    // Returns the created GroupCel
+    return groupCel;
+}
+
 // Moves the GroupCel
 void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY) {
     
@@ -210,7 +714,7 @@ void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY) {
     }
     
     // Modify the GroupCel's position
-    GroupCelSetPosition(groupCel, groupCel->position.x + moveX, groupCel->position.y + moveY);  
+    GroupCelSetPositionF16(groupCel, groupCel->position16.x + Convert32_F16(moveX), groupCel->position16.y + Convert32_F16(moveY));
 }
 
 // Sets the position of the GroupCel
@@ -218,16 +722,33 @@ void GroupCelSetPosition(GroupCel *groupCel, int32 positionX, int32 positionY) {
     
     if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetPosition()*\n"); } 
     
+    // Applies the position in 16.16
+    GroupCelSetPositionF16(groupCel, Convert32_F16(positionX), Convert32_F16(positionY));
+}
+
+// Sets the position of the GroupCel in 16.16
+void GroupCelSetPositionF16(GroupCel *groupCel, frac16 positionX16, frac16 positionY16) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetPositionF16()*\n"); }
+
     // If the group is unknown
     if (groupCel == NULL){
         // Returns an error
         printf("Error : GroupCel unknown.\n");
         return;
     }
-    
-    // Applies the changes
-    groupCel->position.x = positionX;
-    groupCel->position.y = positionY;
+
+    // If the GroupCel is already there
+    if ((groupCel->position16.x == positionX16) && (groupCel->position16.y == positionY16)) {
+        // Nothing to update
+        return;
+    }
+
+    // Applies the changes, the integer position follows
+    groupCel->position16.x = positionX16;
+    groupCel->position16.y = positionY16;
+    groupCel->position.x = ConvertF16_32(positionX16);
+    groupCel->position.y = ConvertF16_32(positionY16);
 
     // Activates movement
     groupCel->transformations |= GROUPCEL_FLAG_MOVE;
@@ -253,7 +774,7 @@ void GroupCelElementMove(GroupCel *groupCel, int32 celIndex, int32 moveX, int32
     }
     
     // Modifies the element's position in the group
-    GroupCelElementSetPosition(groupCel, celIndex, groupCel->cels[celIndex].position.x + moveX, groupCel->cels[celIndex].position.y + moveY);   
+    GroupCelElementSetPositionF16(groupCel, celIndex, GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]) + Convert32_F16(moveX), GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]) + Convert32_F16(moveY));
 }
 
 // Sets the position of a cel within the GroupCel
@@ -261,33 +782,173 @@ void GroupCelElementSetPosition(GroupCel *groupCel, int32 celIndex, int32 positi
     
     if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetPosition()*\n"); }  
     
-    // If the group is unknown
+    // Applies the position in 16.16
+    GroupCelElementSetPositionF16(groupCel, celIndex, Convert32_F16(positionX), Convert32_F16(positionY));
+}
+
+// Sets the position of a cel within the GroupCel in 16.16
+void GroupCelElementSetPositionF16(GroupCel *groupCel, int32 celIndex, frac16 positionX16, frac16 positionY16) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetPositionF16()*\n"); }
+
+    // If the group is unknown
     if (groupCel == NULL){
         // Returns an error
         printf("Error : GroupCel unknown.\n");
         return;
     }
-    
+
     // If the list of Cels is unknown
     if (groupCel->cels == NULL){
         // Returns an error
         printf("Error : GroupCel list unknown.\n");
         return;
     }
-    
+
+    // If the element is already there, once the position is stored
+    if ((GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]) == GROUPCEL_POSITION_F16(positionX16)) && (GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]) == GROUPCEL_POSITION_F16(positionY16))) {
+        // Nothing to update
+        return;
+    }
+
     // Applies the changes
-    groupCel->cels[celIndex].position.x = positionX;
-    groupCel->cels[celIndex].position.y = positionY;
-    
-    printf("positionX : %d\n", positionX);
-    printf("positionY : %d\n", positionY);
+    GroupCelElementStore(&groupCel->cels[celIndex], groupCel->cels[celIndex].cel, positionX16, positionY16);
 
     // Activates movement
     groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    // A flattened group renders its elements again
+    GroupCelElementsChanged(groupCel);
+}
+
+// Animation of an element of the GroupCel
+int32 GroupCelElementAnimation(GroupCel *groupCel, uint32 celIndex, ANIM *anim, int32 frameDuration) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementAnimation()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the element is unknown
+    if ((groupCel->cels == NULL) || (celIndex >= groupCel->celsCount) || (groupCel->cels[celIndex].cel == NULL)){
+        // Returns an error
+        printf("Error : GroupCel element %u unknown.\n", celIndex);
+        return -1;
+    }
+
+    // If the animation has no frame
+    if ((anim != NULL) && ((anim->num_Frames <= 0) || (anim->pentries == NULL))) {
+        // Returns an error
+        printf("Error : GroupCel animation without frames.\n");
+        return -1;
+    }
+
+    // If the element has a LOD chain, its levels already swap the source data
+    if ((anim != NULL) && (groupCel->lods != NULL) && (groupCel->lods[celIndex].levels != NULL)) {
+        // Returns an error
+        printf("Error : GroupCel element %u has a LOD chain.\n", celIndex);
+        return -1;
+    }
+
+    // If it's the first animated element
+    if (groupCel->animations == NULL) {
+        // Allocates memory for the animation states
+        groupCel->animations = (GroupCelAnimation *)AllocMem(groupCel->celsCount * sizeof(GroupCelAnimation), MEMTYPE_DRAM);
+        // If it's a failure
+        if (groupCel->animations == NULL) {
+            // Displays an error message
+            printf("Error : Failed to allocate memory for GroupCel animations.\n");
+            return -1;
+        }
+        // No element animated yet
+        memset(groupCel->animations, 0, (size_t)groupCel->celsCount * sizeof(GroupCelAnimation));
+    }
+
+    // Corrects parameters
+    // Minimum duration of a frame = 1
+    frameDuration = (frameDuration > 1) ? frameDuration : 1;
+
+    // Stores the animation (NULL stops it)
+    groupCel->animations[celIndex].anim = anim;
+    groupCel->animations[celIndex].frameIndex = 0;
+    groupCel->animations[celIndex].frameDuration = frameDuration;
+    groupCel->animations[celIndex].elapsed = 0;
+
+    // If the element is animated
+    if (anim != NULL) {
+        // Shows the first frame and places it if its dimension changed
+        if (GroupCelElementAnimationFrame(groupCel, celIndex, 0) == 1) {
+            groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        }
+    }
+    // A flattened group renders its elements again
+    GroupCelElementsChanged(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Quad cache of the elements of the GroupCel
+int32 GroupCelQuadCache(GroupCel *groupCel, int32 enable) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelQuadCache()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel quad cache needs a list of elements.\n");
+        return -1;
+    }
+
+    // The counters start again
+    groupCel->quadHits = 0;
+    groupCel->quadMisses = 0;
+
+    // If the cache must be disabled
+    if (enable == 0) {
+        // If there is a cache
+        if (groupCel->quads != NULL) {
+            // Free the memory used for the quads
+            FreeMem(groupCel->quads, groupCel->celsCount * sizeof(Quad2D));
+            groupCel->quads = NULL;
+        }
+        // Returns success
+        return 1;
+    }
+
+    // If the cache isn't allocated yet
+    if (groupCel->quads == NULL) {
+        // Allocates memory for the last quad of each element
+        groupCel->quads = (Quad2D *)AllocMem(groupCel->celsCount * sizeof(Quad2D), MEMTYPE_DRAM);
+        // If it's a failure
+        if (groupCel->quads == NULL) {
+            // Displays an error message
+            printf("Error : Failed to allocate memory for GroupCel quads.\n");
+            return -1;
+        }
+        // No quad committed yet
+        memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D));
+    }
+
+    // Returns success
+    return 1;
 }
 
 // Stretches the group according to its 4 corners in pixels
 void GroupCelStretch(GroupCel *groupCel, int32 point0X, int32 point0Y, int32 point1X, int32 point1Y, int32 point2X, int32 point2Y, int32 point3X, int32 point3Y) {
+
+    // Local stretching quadrilateral
+    Quad2D stretching;
     
     if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelStretch()*\n"); }
 
@@ -298,15 +959,24 @@ void GroupCelStretch(GroupCel *groupCel, int32 point0X, int32 point0Y, int32 poi
         return;
     }
     
+    // Local values of the corners
+    stretching.topLeft.x = point0X - groupCel->position.x;
+    stretching.topLeft.y = point0Y - groupCel->position.y;
+    stretching.topRight.x = point1X - groupCel->position.x;
+    stretching.topRight.y = point1Y - groupCel->position.y;
+    stretching.bottomRight.x = point2X - groupCel->position.x;
+    stretching.bottomRight.y = point2Y - groupCel->position.y;
+    stretching.bottomLeft.x = point3X - groupCel->position.x;
+    stretching.bottomLeft.y = point3Y - groupCel->position.y;
+
+    // If the frame already has these corners
+    if (memcmp(&groupCel->stretching, &stretching, sizeof(Quad2D)) == 0) {
+        // Nothing to update
+        return;
+    }
+
     // Modify transformation values
-    groupCel->stretching.topLeft.x = point0X - groupCel->position.x;
-    groupCel->stretching.topLeft.y = point0Y - groupCel->position.y;
-    groupCel->stretching.topRight.x = point1X - groupCel->position.x;
-    groupCel->stretching.topRight.y = point1Y - groupCel->position.y;
-    groupCel->stretching.bottomRight.x = point2X - groupCel->position.x;
-    groupCel->stretching.bottomRight.y = point2Y - groupCel->position.y;
-    groupCel->stretching.bottomLeft.x = point3X - groupCel->position.x;
-    groupCel->stretching.bottomLeft.y = point3Y - groupCel->position.y;
+    groupCel->stretching = stretching;
     
     // Activate stretching
     groupCel->transformations |= GROUPCEL_FLAG_STRETCH;
@@ -316,20 +986,40 @@ void GroupCelStretch(GroupCel *groupCel, int32 point0X, int32 point0Y, int32 poi
 void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY) {
     
     if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRotate()*\n"); }
+    
+    // Applies the rotation in 16.16
+    GroupCelRotateF16(groupCel, Convert32_F16(angle % 256), Convert32_F16(pivotX), Convert32_F16(pivotY));
+}
+
+// Rotates the group by an angle in 256 units in 16.16
+void GroupCelRotateF16(GroupCel *groupCel, frac16 angle16, frac16 pivotX16, frac16 pivotY16) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRotateF16()*\n"); }
 
     // If the group is unknown
     if (groupCel == NULL){
-        // Return an error
+        // Returns an error
         printf("Error : GroupCel unknown.\n");
         return;
     }
-    
-    // Modify angle within range [0 - 255]
-    groupCel->rotationAngle = angle % 256;
-    // Modify transformation values
-    groupCel->rotationPivot.x = pivotX;
-    groupCel->rotationPivot.y = pivotY;
-    
+
+    // Modify angle within range [0 - 256[
+    angle16 &= GROUPCEL_ANGLE_MASK;
+
+    // If the GroupCel already has this rotation
+    if ((groupCel->rotationAngle16 == angle16) && (groupCel->rotationPivot16.x == pivotX16) && (groupCel->rotationPivot16.y == pivotY16)) {
+        // Nothing to update
+        return;
+    }
+
+    // Modify transformation values, the integer values follow
+    groupCel->rotationAngle16 = angle16;
+    groupCel->rotationPivot16.x = pivotX16;
+    groupCel->rotationPivot16.y = pivotY16;
+    groupCel->rotationAngle = (uint32)ConvertF16_32(angle16);
+    groupCel->rotationPivot.x = ConvertF16_32(pivotX16);
+    groupCel->rotationPivot.y = ConvertF16_32(pivotY16);
+
     // Activate rotation
     groupCel->transformations |= GROUPCEL_FLAG_ROTATE;
 }
@@ -337,16 +1027,30 @@ void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY
 // Updates the elements inside the GroupCel
 void GroupCelUpdate(GroupCel *groupCel) {   
 
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }  
+
+    // Applies the transformations without advancing the animations
+    GroupCelUpdateElapsed(groupCel, 0);
+}
+
+// Advances the animations and updates the elements inside the GroupCel
+void GroupCelUpdateElapsed(GroupCel *groupCel, int32 elapsed) {
+
     // Index to iterate through elements
     int32 celIndex = 0;
     // Indicates if transformations are to be applied
-    int32 doMove = 0;
     int32 doStretch = 0;
     int32 doRotate = 0;
+    // Indicates if every element is to be recomputed
+    int32 doAll = 0;
+    // Indicates if the new frame of an element changed its dimension
+    int32 resized = 0;
+    // Transformation of the group
+    GroupCelTransform transform;
     // Quadrilateral for Cel projection in 16.16
     Quad2D quadMap = {0};
     
-    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }  
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdateElapsed()*\n"); }  
     
     // If the group is unknown
     if (groupCel == NULL){
@@ -356,60 +1060,135 @@ void GroupCelUpdate(GroupCel *groupCel) {
     }
     
     // If the list of Cels is unknown
-    if (groupCel->cels == NULL){
+    if ((groupCel->cels == NULL) && (groupCel->tiles == NULL)){
         // Return an error
         printf("Error : GroupCel list unknown.\n");
         return;
     }
     
-    // Determine if movement needs to be applied
-    doMove = (groupCel->transformations & GROUPCEL_FLAG_MOVE) != 0;
-    // Determine if stretching needs to be applied
-    doStretch = (groupCel->transformations & GROUPCEL_FLAG_STRETCH) != 0;
-    // Determine if rotation needs to be applied
-    doRotate = (groupCel->transformations & GROUPCEL_FLAG_ROTATE) != 0;
+    // Follows the camera with one add per CCB, without recomputing the elements
+    GroupCelCameraPan(groupCel);
+
+    // Sorts the draw order again if a depth key changed, starting from the current order
+    if ((groupCel->order != NULL) && (groupCel->depthSort == 1) && (groupCel->depthChanged == 1)) { GroupCelDrawOrderSort(groupCel); }
     
     // If there’s nothing to update
-    if ((doMove == 0) && (doStretch == 0) && (doRotate == 0)) {
+    if ((groupCel->transformations == 0) && ((groupCel->animations == NULL) || (elapsed == 0))) {
+        // A CCB resized outside the group is still detected, only it is placed again
+        GroupCelRevalidate(groupCel);
+        // Hides the elements covered since the last pass
+        GroupCelOcclusionUpdate(groupCel);
         // Exit early
         return;
     }
     
-    // If stretching or rotation is needed
-    if ((doStretch == 1) || (doRotate == 1)) {
-        // Call complex update function
-        GroupCelUpdateTransformations(groupCel, doStretch, doRotate, &quadMap);
-        // Exit immediately after
+    // Stretching and rotation stay applied once requested, a move alone must keep them
+    doStretch = ((groupCel->transformations & GROUPCEL_FLAG_STRETCH) != 0) || (GroupCelIsStretched(groupCel) == 1);
+    doRotate = ((groupCel->transformations & GROUPCEL_FLAG_ROTATE) != 0) || (groupCel->rotationAngle16 != 0);
+    
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // Its single CCB is placed instead of the elements
+        GroupCelFlattenUpdate(groupCel, elapsed, doStretch, doRotate);
+        // All the transformations are applied
+        groupCel->transformations = 0;
+        return;
+    }
+
+    // If it's a grid
+    if (groupCel->tiles != NULL) {
+        // Computes the shared lattice vertices
+        GroupCelGridUpdate(groupCel, doStretch, doRotate, &quadMap);
+        // All the transformations are applied
+        groupCel->transformations = 0;
         return;
     }
+
+    // Pre-computation of the stretching and the rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    // A transformation of the group moves every element
+    doAll = (groupCel->transformations != 0) ? 1 : 0;
     
-    // For each element
+    // For each element, in a single traversal
     for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
-        // Update the position in the Cel's CCB
-        GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
+
+        // If the element isn't configured
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+
+        // Advances the animation: a new frame can change the dimension of the CCB
+        resized = 0;
+        if ((elapsed != 0) && (groupCel->animations != NULL) && (groupCel->animations[celIndex].anim != NULL)) {
+            resized = GroupCelElementAnimationAdvance(groupCel, celIndex, elapsed);
+        }
+
+        // Detects a change of dimension since the last update
+        if (GroupCelElementResized(groupCel, celIndex) == 1) { resized = 1; }
+
+        // Recomputes the element if the group moved or if its dimension changed
+        if ((doAll == 1) || (resized == 1)) {
+            GroupCelElementUpdateTransform(groupCel, celIndex, &transform, &quadMap);
+        }
     }
     
-    // Disable movement
-    groupCel->transformations &= ~GROUPCEL_FLAG_MOVE;   
+    // All the transformations are applied
+    groupCel->transformations = 0;
+
+    // Hides the elements covered by an opaque element drawn after them
+    GroupCelOcclusionUpdate(groupCel);
 }
 
+
 // Applies the position to the Cel's CCB
 void GroupCelElementUpdatePosition(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
 
+    // Local positions of the corners in 16.16
+    frac16 left, top, right, bottom;
+
     if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementUpdatePosition()*\n"); } 
     
+    // Detects a change of dimension made outside the group
+    GroupCelElementResized(groupCel, celIndex);
+
+    // Corners of the element in 16.16, only the dimension is converted
+    left = groupCel->position16.x + GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+    top = groupCel->position16.y + GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+    right = left + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+    bottom = top + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+
     // Creates the quadrilateral for Cel projection in 16.16
-    quadMap->topLeft.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x);
-    quadMap->topLeft.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y);
-    quadMap->topRight.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width);
-    quadMap->topRight.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y);
-    quadMap->bottomRight.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width);
-    quadMap->bottomRight.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height);
-    quadMap->bottomLeft.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x);
-    quadMap->bottomLeft.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height);
+    quadMap->topLeft.x = left;
+    quadMap->topLeft.y = top;
+    quadMap->topRight.x = right;
+    quadMap->topRight.y = top;
+    quadMap->bottomRight.x = right;
+    quadMap->bottomRight.y = bottom;
+    quadMap->bottomLeft.x = left;
+    quadMap->bottomLeft.y = bottom;
+
+    // Modifies the Cel's CCB
+    GroupCelElementCommit(groupCel, celIndex, quadMap);
+}
+
+// Applies the transformations of the group to the Cel's CCB
+void GroupCelElementUpdateTransform(GroupCel *groupCel, int32 celIndex, GroupCelTransform *transform, Quad2D *quadMap) {
+
+    // Local positions of the corners in 16.16
+    frac16 left, top, right, bottom;
+
+    // Corners of the element in 16.16, only the dimension is converted
+    left = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+    top = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+    right = left + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+    bottom = top + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+
+    // Transforms the 4 corners
+    GroupCelTransformPoint(transform, left, top, &quadMap->topLeft);
+    GroupCelTransformPoint(transform, right, top, &quadMap->topRight);
+    GroupCelTransformPoint(transform, right, bottom, &quadMap->bottomRight);
+    GroupCelTransformPoint(transform, left, bottom, &quadMap->bottomLeft);
 
     // Modifies the Cel's CCB
-    CelQuadMap(groupCel->cels[celIndex].cel, quadMap);
+    GroupCelElementCommit(groupCel, celIndex, quadMap);
 }
 
 // Applies Stretch and Rotate transformations to the CCBs of the Cels
@@ -417,136 +1196,381 @@ void GroupCelUpdateTransformations(GroupCel *groupCel, int32 doStretch, int32 do
 
     // Index to loop through elements
     int32 celIndex = 0;
-    // Position in 16.16
-    Point2D position16 = {0};
-    // Pre-computation for stretching
-    int32 invW, invH;              
-    int32 Ax, Ay, Bx, By, Cx, Cy;
-    int32 delta16X = 0;
-    int32 delta16Y = 0;
-    // Pre-computation for rotation in 16.16
-    int32 sinus16 = 0;
-    int32 cosinus16 = 0;
-    Point2D rotationPivot16 = {0};
-    int32 rotationDelta16X = 0;
-    int32 rotationDelta16Y = 0;
-    // Local positions of the 4 corners (int32)
-    int32 localX[4] = {0};
-    int32 localY[4] = {0};
-    // Index to loop through corners
-    int32 indexCorner = 0;
-    int32 px, py, u, v, uv;
-    int32 rx, ry;   
+    // Transformation of the group
+    GroupCelTransform transform;
 
-    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }  
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdateTransformations()*\n"); }  
+
+    // Pre-computation of the stretching and the rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    
+    // For each element
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // If the element isn't configured
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // Detects a change of dimension since the last update
+        GroupCelElementResized(groupCel, celIndex);
+        // Transforms the element
+        GroupCelElementUpdateTransform(groupCel, celIndex, &transform, quadMap);
+    }
+}
+
+// Applies the position and the transformations to the tiles of a grid
+void GroupCelGridUpdate(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap) {
+
+    // Transformation of the group
+    GroupCelTransform transform;
+    // Rows of lattice vertices in 16.16
+    Point2D *previousRow = NULL;
+    Point2D *currentRow = NULL;
+    Point2D *swapRow = NULL;
+    // Index to loop through the grid
+    uint32 column = 0;
+    uint32 row = 0;
+    // Current tile
+    CCB **tile = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelGridUpdate()*\n"); }
+
+    // Pre-computation of the stretching and the rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+
+    // Two rows of vertices are enough: each row is shared by the tiles above and below it
+    previousRow = groupCel->lattice;
+    currentRow = groupCel->lattice + groupCel->gridColumns + 1;
+
+    // Top row of the lattice
+    for (column = 0; column <= groupCel->gridColumns; column++) {
+        GroupCelTransformPoint(&transform, Convert32_F16((int32)column * groupCel->tileSize.x), 0, &previousRow[column]);
+        GroupCelCameraPoint(groupCel, &previousRow[column]);
+    }
+
+    // For each row of tiles
+    tile = groupCel->tiles;
+    for (row = 1; row <= groupCel->gridRows; row++) {
+
+        // Bottom row of the lattice for these tiles
+        for (column = 0; column <= groupCel->gridColumns; column++) {
+            GroupCelTransformPoint(&transform, Convert32_F16((int32)column * groupCel->tileSize.x), Convert32_F16((int32)row * groupCel->tileSize.y), &currentRow[column]);
+            GroupCelCameraPoint(groupCel, &currentRow[column]);
+        }
+
+        // For each tile of the row
+        for (column = 0; column < groupCel->gridColumns; column++, tile++) {
+            // If the cell is empty
+            if (*tile == NULL) { continue; }
+            // The corners are the vertices shared with the neighbouring tiles
+            quadMap->topLeft = previousRow[column];
+            quadMap->topRight = previousRow[column + 1];
+            quadMap->bottomRight = currentRow[column + 1];
+            quadMap->bottomLeft = currentRow[column];
+            // Refreshes the shared reciprocals if the tile has another dimension
+            if (((*tile)->ccb_Width != groupCel->tileDimension.x) || ((*tile)->ccb_Height != groupCel->tileDimension.y)) {
+                CelQuadMapReciprocalsInitialization(*tile, &groupCel->tileReciprocals);
+                groupCel->tileDimension.x = (*tile)->ccb_Width;
+                groupCel->tileDimension.y = (*tile)->ccb_Height;
+            }
+            // Modifies the Cel's CCB
+            CelQuadMapReciprocal(*tile, quadMap, &groupCel->tileReciprocals);
+        }
+
+        // The bottom row becomes the top row of the next tiles
+        swapRow = previousRow;
+        previousRow = currentRow;
+        currentRow = swapRow;
+    }
+
+    // The placement of the group changed
+    groupCel->epoch++;
+}
+
+// Prepares the transformation of the local points of the GroupCel
+void GroupCelTransformPreparation(GroupCel *groupCel, int32 doStretch, int32 doRotate, GroupCelTransform *transform) {
 
     // Position in 16.16
-    position16.x = Convert32_F16(groupCel->position.x);
-    position16.y = Convert32_F16(groupCel->position.y);
+    transform->position16.x = groupCel->position16.x;
+    transform->position16.y = groupCel->position16.y;
+
+    // Transformations to apply
+    transform->doStretch = doStretch;
+    transform->doRotate = doRotate;
     
     // If stretching is enabled
     if (doStretch == 1) {
         // Inverse width/height
-        invW = (1 << 16) / groupCel->size.x;
-        invH = (1 << 16) / groupCel->size.y;
+        transform->invW = (1 << 16) / groupCel->size.x;
+        transform->invH = (1 << 16) / groupCel->size.y;
 
         // Corner A
-        Ax = Convert32_F16(groupCel->stretching.topLeft.x);
-        Ay = Convert32_F16(groupCel->stretching.topLeft.y);
+        transform->corner16.x = Convert32_F16(groupCel->stretching.topLeft.x);
+        transform->corner16.y = Convert32_F16(groupCel->stretching.topLeft.y);
 
         // Vectors B and C
-        Bx = Convert32_F16(groupCel->stretching.topRight.x - groupCel->stretching.topLeft.x);
-        By = Convert32_F16(groupCel->stretching.topRight.y - groupCel->stretching.topLeft.y);
-        Cx = Convert32_F16(groupCel->stretching.bottomLeft.x - groupCel->stretching.topLeft.x);
-        Cy = Convert32_F16(groupCel->stretching.bottomLeft.y - groupCel->stretching.topLeft.y);
+        transform->vectorB16.x = Convert32_F16(groupCel->stretching.topRight.x - groupCel->stretching.topLeft.x);
+        transform->vectorB16.y = Convert32_F16(groupCel->stretching.topRight.y - groupCel->stretching.topLeft.y);
+        transform->vectorC16.x = Convert32_F16(groupCel->stretching.bottomLeft.x - groupCel->stretching.topLeft.x);
+        transform->vectorC16.y = Convert32_F16(groupCel->stretching.bottomLeft.y - groupCel->stretching.topLeft.y);
 
         // Term D (bilinearity)
-        delta16X = Convert32_F16(groupCel->stretching.topLeft.x + groupCel->stretching.bottomRight.x - groupCel->stretching.topRight.x - groupCel->stretching.bottomLeft.x);
-        delta16Y = Convert32_F16(groupCel->stretching.topLeft.y + groupCel->stretching.bottomRight.y - groupCel->stretching.topRight.y - groupCel->stretching.bottomLeft.y);
+        transform->delta16.x = Convert32_F16(groupCel->stretching.topLeft.x + groupCel->stretching.bottomRight.x - groupCel->stretching.topRight.x - groupCel->stretching.bottomLeft.x);
+        transform->delta16.y = Convert32_F16(groupCel->stretching.topLeft.y + groupCel->stretching.bottomRight.y - groupCel->stretching.topRight.y - groupCel->stretching.bottomLeft.y);
     }
 
     // If rotation is enabled
     if (doRotate == 1) {
         // Calculate sine and cosine in 16.16
-        sinus16 = SinF16(Convert32_F16(groupCel->rotationAngle));
-        cosinus16 = CosF16(Convert32_F16(groupCel->rotationAngle));
+        transform->sinus16 = SinF16(groupCel->rotationAngle16);
+        transform->cosinus16 = CosF16(groupCel->rotationAngle16);
         // Locate the pivot
-        rotationPivot16.x = Convert32_F16(groupCel->rotationPivot.x - groupCel->position.x);
-        rotationPivot16.y = Convert32_F16(groupCel->rotationPivot.y - groupCel->position.y);
+        transform->rotationPivot16.x = groupCel->rotationPivot16.x - groupCel->position16.x;
+        transform->rotationPivot16.y = groupCel->rotationPivot16.y - groupCel->position16.y;
     }
-    
+}
+
+// Transforms a local point of the GroupCel into a screen point in 16.16
+void GroupCelTransformPoint(GroupCelTransform *transform, frac16 localX16, frac16 localY16, Point2D *point16) {
+
+    // Point in 16.16
+    int32 px, py, u, v, uv;
+    int32 rotationDelta16X, rotationDelta16Y;
+
+    // If stretching is enabled
+    if (transform->doStretch == 1) {
+        u = MulSF16(localX16, transform->invW);
+        v = MulSF16(localY16, transform->invH);
+        uv = MulSF16(u, v);
+        px = transform->corner16.x + MulSF16(transform->vectorB16.x, u) + MulSF16(transform->vectorC16.x, v) + MulSF16(transform->delta16.x, uv);
+        py = transform->corner16.y + MulSF16(transform->vectorB16.y, u) + MulSF16(transform->vectorC16.y, v) + MulSF16(transform->delta16.y, uv);
+    } else {
+        px = localX16;
+        py = localY16;
+    }
+
+    // If rotation is enabled
+    if (transform->doRotate == 1) {
+        rotationDelta16X = px - transform->rotationPivot16.x;
+        rotationDelta16Y = py - transform->rotationPivot16.y;
+        px = MulSF16(transform->cosinus16, rotationDelta16X) - MulSF16(transform->sinus16, rotationDelta16Y) + transform->rotationPivot16.x;
+        py = MulSF16(transform->sinus16, rotationDelta16X) + MulSF16(transform->cosinus16, rotationDelta16Y) + transform->rotationPivot16.y;
+    }
+
+    // Final translation + storage
+    point16->x = transform->position16.x + px;
+    point16->y = transform->position16.y + py;
+}
+
+// Detects a change of dimension of an element
+int32 GroupCelElementResized(GroupCel *groupCel, int32 celIndex) {
+
+    // Element
+    GroupCelList *element = &groupCel->cels[celIndex];
+    // Element's CCB
+    CCB *cel = element->cel;
+
+    // If the CCB still has the last dimension seen
+    if ((cel->ccb_Width == (int32)element->width) && (cel->ccb_Height == (int32)element->height)) {
+        // Nothing changes
+        return 0;
+    }
+
+    // Keeps the new dimension and refreshes its reciprocals
+    element->width = (uint16)cel->ccb_Width;
+    element->height = (uint16)cel->ccb_Height;
+    CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+    // Forgets the quad committed for the previous dimension
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+    // A flattened group renders its elements again
+    GroupCelElementsChanged(groupCel);
+
+    // Returns 1 if the element must be recomputed
+    return 1;
+}
+
+// Writes the projection of an element in its CCB
+void GroupCelElementCommit(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
+
+    // Quadrilateral seen through the camera
+    Quad2D viewQuad;
+
+    // If the quad cache is enabled
+    if (groupCel->quads != NULL) {
+        // If the element gets the same quad as last time
+        if (memcmp(&groupCel->quads[celIndex], quadMap, sizeof(Quad2D)) == 0) {
+            // Its CCB is already up to date
+            groupCel->quadHits++;
+            return;
+        }
+        // Keeps the quad committed
+        groupCel->quads[celIndex] = *quadMap;
+        groupCel->quadMisses++;
+    }
+
+    // Moves the quad into the view of the camera, the cache keeps it in the scene
+    viewQuad = *quadMap;
+    GroupCelCameraPoint(groupCel, &viewQuad.topLeft);
+    GroupCelCameraPoint(groupCel, &viewQuad.topRight);
+    GroupCelCameraPoint(groupCel, &viewQuad.bottomRight);
+    GroupCelCameraPoint(groupCel, &viewQuad.bottomLeft);
+
+    // Shows the level of detail matching the projected size
+    if (groupCel->lods != NULL) { GroupCelElementLodSelect(groupCel, celIndex, &viewQuad); }
+    // Reports where the element was and where it is now
+    if (groupCel->dirty != NULL) { GroupCelDirtyQuad(groupCel, &groupCel->dirtyBounds[celIndex], &viewQuad); }
+    // Keeps the screen bounds of the element
+    if (groupCel->projections != NULL) { Quad2DBounds(&viewQuad, &groupCel->projections[celIndex]); }
+
+    // Keeps the bounds written for the occlusion pass
+    if (groupCel->bounds != NULL) { GroupCelOcclusionBounds(groupCel, celIndex, &viewQuad); }
+
+    // Modifies the Cel's CCB without any division
+    CelQuadMapReciprocal(groupCel->cels[celIndex].cel, &viewQuad, &groupCel->reciprocals[celIndex]);
+
+    // The placement of the group changed
+    groupCel->epoch++;
+}
+
+// Recomputes only the elements whose dimension changed
+int32 GroupCelRevalidate(GroupCel *groupCel) {
+
+    // Index to iterate through elements
+    int32 celIndex = 0;
+    // Number of elements recomputed
+    int32 resizedCount = 0;
+    // Current stretching and rotation
+    int32 doStretch = 0;
+    int32 doRotate = 0;
+    // Index and pointer to loop through the tiles
+    uint32 tileIndex = 0;
+    CCB *tile = NULL;
+    // Transformation of the group
+    GroupCelTransform transform;
+    // Quadrilateral for Cel projection in 16.16
+    Quad2D quadMap = {0};
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRevalidate()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Return an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // Stretching and rotation currently applied
+    doStretch = GroupCelIsStretched(groupCel);
+    doRotate = (groupCel->rotationAngle16 != 0) ? 1 : 0;
+
+    // If it's a grid
+    if (groupCel->tiles != NULL) {
+        // Counts the tiles whose dimension differs from the shared reciprocals
+        for (tileIndex = 0; tileIndex < groupCel->gridColumns * groupCel->gridRows; tileIndex++) {
+            tile = groupCel->tiles[tileIndex];
+            if ((tile != NULL) && ((tile->ccb_Width != groupCel->tileDimension.x) || (tile->ccb_Height != groupCel->tileDimension.y))) { resizedCount++; }
+        }
+        // The tiles share their vertices: the whole lattice is placed again
+        if (resizedCount > 0) { GroupCelGridUpdate(groupCel, doStretch, doRotate, &quadMap); }
+        // Returns the number of tiles resized
+        return resizedCount;
+    }
+
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // Counts the elements resized, each one asks for a new rendering
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if ((groupCel->cels[celIndex].cel != NULL) && (GroupCelElementResized(groupCel, celIndex) == 1)) { resizedCount++; }
+        }
+        // The elements are drawn in the bitmap, not placed on screen
+        if (resizedCount > 0) {
+            GroupCelFlattenUpdate(groupCel, 0, doStretch, doRotate);
+            groupCel->transformations &= ~GROUPCEL_FLAG_ELEMENTS;
+        }
+        // Returns the number of elements resized
+        return resizedCount;
+    }
+
+    // Pre-computation of the current stretching and rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+
     // For each element
     for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // If the element isn't configured
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // If its dimension changed
+        if (GroupCelElementResized(groupCel, celIndex) == 1) {
+            // Recomputes only this element
+            GroupCelElementUpdateTransform(groupCel, celIndex, &transform, &quadMap);
+            resizedCount++;
+        }
+    }
 
-        // Local positions of the 4 corners (int32)
-        localX[0] = groupCel->cels[celIndex].position.x;
-        localX[1] = groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width;
-        localX[2] = groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width;
-        localX[3] = groupCel->cels[celIndex].position.x;
-        localY[0] = groupCel->cels[celIndex].position.y;
-        localY[1] = groupCel->cels[celIndex].position.y;
-        localY[2] = groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height;
-        localY[3] = groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height;
-
-        // For each corner
-        for (indexCorner = 0; indexCorner < 4; indexCorner++) {
-            
-            // If stretching is enabled
-            if (doStretch == 1) {
-                u = MulSF16(Convert32_F16(localX[indexCorner]), invW);
-                v = MulSF16(Convert32_F16(localY[indexCorner]), invH);
-                uv = MulSF16(u, v);
-                px = Ax + MulSF16(Bx, u) + MulSF16(Cx, v) + MulSF16(delta16X, uv);
-                py = Ay + MulSF16(By, u) + MulSF16(Cy, v) + MulSF16(delta16Y, uv);
-            } else {
-                px = Convert32_F16(localX[indexCorner]);
-                py = Convert32_F16(localY[indexCorner]);
-            }
+    // Returns the number of elements recomputed
+    return resizedCount;
+}
 
-            // If rotation is enabled
-            if (doRotate == 1) {
-                rotationDelta16X = px - rotationPivot16.x;
-                rotationDelta16Y = py - rotationPivot16.y;
-                rx = MulSF16(cosinus16, rotationDelta16X) - MulSF16(sinus16, rotationDelta16Y) + rotationPivot16.x;
-                ry = MulSF16(sinus16, rotationDelta16X) + MulSF16(cosinus16, rotationDelta16Y) + rotationPivot16.y;
-            } else {
-                rx = px;
-                ry = py;
-            }
-            
-            // Final translation + storage
-            switch (indexCorner) {
-                case 0:
-                    quadMap->topLeft.x = position16.x + rx;
-                    quadMap->topLeft.y = position16.y + ry;
-                    break;
-                case 1:
-                    quadMap->topRight.x = position16.x + rx;
-                    quadMap->topRight.y = position16.y + ry;
-                    break;
-                case 2:
-                    quadMap->bottomRight.x = position16.x + rx;
-                    quadMap->bottomRight.y = position16.y + ry;
-                    break;
-                case 3:
-                    quadMap->bottomLeft.x = position16.x + rx;
-                    quadMap->bottomLeft.y = position16.y + ry;
-                    break;
-            }
-        }
+// Advances the animation of an element
+int32 GroupCelElementAnimationAdvance(GroupCel *groupCel, uint32 celIndex, int32 elapsed) {
 
-        // Modifies the Cel's CCB
-        CelQuadMap(groupCel->cels[celIndex].cel, quadMap);
+    // Animation state of the element
+    GroupCelAnimation *animation = &groupCel->animations[celIndex];
+    // Number of frames to advance
+    int32 framesCount = 0;
+
+    // Accumulates the elapsed time
+    animation->elapsed += elapsed;
+
+    // If the current frame isn't over
+    if (animation->elapsed < animation->frameDuration) {
+        // Nothing changes
+        return 0;
     }
-    
-    // Disables stretching
-    groupCel->transformations &= ~GROUPCEL_FLAG_STRETCH;
-    // Disables rotation
-    groupCel->transformations &= ~GROUPCEL_FLAG_ROTATE;
+
+    // Advances by as many frames as the elapsed time covers
+    framesCount = animation->elapsed / animation->frameDuration;
+    animation->elapsed -= framesCount * animation->frameDuration;
+
+    // Shows the new frame
+    return GroupCelElementAnimationFrame(groupCel, celIndex, (animation->frameIndex + framesCount) % animation->anim->num_Frames);
+}
+
+// Shows a frame of the animation in the element's CCB
+int32 GroupCelElementAnimationFrame(GroupCel *groupCel, uint32 celIndex, int32 frameIndex) {
+
+    // Animation state of the element
+    GroupCelAnimation *animation = &groupCel->animations[celIndex];
+    // Frame to show
+    AnimFrame *frame = &animation->anim->pentries[frameIndex];
+    // Element's CCB
+    CCB *cel = groupCel->cels[celIndex].cel;
+    // Indicates if the dimension changes
+    int32 resized = 0;
+
+    // Current frame
+    animation->frameIndex = frameIndex;
+
+    // Compares the dimension of the frame with the element's CCB
+    resized = ((cel->ccb_Width != frame->af_CCB->ccb_Width) || (cel->ccb_Height != frame->af_CCB->ccb_Height)) ? 1 : 0;
+
+    // Swaps the source data, the PLUT and the preambles of the frame
+    cel->ccb_SourcePtr = (CelData *)frame->af_pix;
+    cel->ccb_PLUTPtr = frame->af_PLUT;
+    cel->ccb_PRE0 = frame->af_CCB->ccb_PRE0;
+    cel->ccb_PRE1 = frame->af_CCB->ccb_PRE1;
+    cel->ccb_Width = frame->af_CCB->ccb_Width;
+    cel->ccb_Height = frame->af_CCB->ccb_Height;
+
+    // The new frame is drawn in place of the previous one
+    if ((groupCel->dirty != NULL) && (groupCel->visible == 1)) { GroupCelDirtyAddF16(groupCel->dirty, &groupCel->dirtyBounds[celIndex]); }
+
+    // Returns 1 if the element must be recomputed
+    return resized;
 }
 
+
 // Deletes the GroupCel
 int32 GroupCelCleanup(GroupCel *groupCel) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
         
     if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelCleanup()*\n"); } 
     
@@ -556,13 +1580,74 @@ int32 GroupCelCleanup(GroupCel *groupCel) {
         printf("Error : GroupCel unknown.\n");
         return -1;  
     } 
+
+    // If the group is in a display list
+    if (groupCel->previous != NULL) {
+        // Takes it out so that the list doesn't reach its CCBs anymore
+        GroupCelUnlink(groupCel);
+    }
     
+    // Deletes the flattened CCB
+    GroupCelFlattenCleanup(groupCel);
+    // Frees the bounds of the dirty rectangles
+    GroupCelSetDirty(groupCel, NULL);
+    // Frees the projections
+    GroupCelProjections(groupCel, 0);
+    // Shows the elements hidden by the occlusion pass and frees its arrays
+    GroupCelOcclusionCleanup(groupCel);
     // If there are cels
     if (groupCel->cels != NULL) {
+        // If the CCB headers come from a pool
+        if (groupCel->pool != NULL) {
+            // Gives them back
+            for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+                if (groupCel->cels[celIndex].cel != NULL) { GroupCelPoolRelease(groupCel->pool, groupCel->cels[celIndex].cel); }
+            }
+        }
         // Free the memory used for the cels array
         FreeMem(groupCel->cels, groupCel->celsCount * sizeof(GroupCelList));
         groupCel->cels = NULL;
     }
+    // If it's a grid
+    if (groupCel->tiles != NULL) {
+        // Free the memory used for the tiles and the lattice
+        FreeMem(groupCel->tiles, groupCel->celsCount * sizeof(CCB *));
+        FreeMem(groupCel->lattice, 2 * (groupCel->gridColumns + 1) * sizeof(Point2D));
+        groupCel->tiles = NULL;
+        groupCel->lattice = NULL;
+    }
+    // If elements are animated
+    if (groupCel->animations != NULL) {
+        // Free the memory used for the animation states
+        FreeMem(groupCel->animations, groupCel->celsCount * sizeof(GroupCelAnimation));
+        groupCel->animations = NULL;
+    }
+    // If elements have a LOD chain
+    if (groupCel->lods != NULL) {
+        // Free the memory used for the LOD chains
+        FreeMem(groupCel->lods, groupCel->celsCount * sizeof(GroupCelLod));
+        groupCel->lods = NULL;
+    }
+    // Free the memory used for the draw order
+    GroupCelDrawOrderCleanup(groupCel);
+    // If there are reciprocals
+    if (groupCel->reciprocals != NULL) {
+        // Free the memory used for the reciprocals
+        FreeMem(groupCel->reciprocals, groupCel->celsCount * sizeof(CelQuadMapReciprocals));
+        groupCel->reciprocals = NULL;
+    }
+    // If there are quads
+    if (groupCel->quads != NULL) {
+        // Free the memory used for the quads
+        FreeMem(groupCel->quads, groupCel->celsCount * sizeof(Quad2D));
+        groupCel->quads = NULL;
+    }
+    // If the elements' data comes from a bundle
+    if (groupCel->data != NULL) {
+        // Free the block holding all the elements' data at once
+        FreeMem(groupCel->data, groupCel->dataSize);
+        groupCel->data = NULL;
+    }
     // Free the memory used for the GroupCel
     FreeMem(groupCel, sizeof(GroupCel));
     groupCel->cel = NULL;
@@ -574,3 +1659,1995 @@ int32 GroupCelCleanup(GroupCel *groupCel) {
     return 1;
 }
 
+// Is the frame of the GroupCel stretched
+int32 GroupCelIsStretched(GroupCel *groupCel) {
+
+    // Compares the stretch quadrilateral with the frame
+    return ((groupCel->stretching.topLeft.x != 0) || (groupCel->stretching.topLeft.y != 0) ||
+            (groupCel->stretching.topRight.x != groupCel->size.x) || (groupCel->stretching.topRight.y != 0) ||
+            (groupCel->stretching.bottomRight.x != groupCel->size.x) || (groupCel->stretching.bottomRight.y != groupCel->size.y) ||
+            (groupCel->stretching.bottomLeft.x != 0) || (groupCel->stretching.bottomLeft.y != groupCel->size.y)) ? 1 : 0;
+}
+
+// Stores an element in the list
+void GroupCelElementStore(GroupCelList *element, CCB *cel, frac16 positionX16, frac16 positionY16) {
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+    // Rounds the position to the pixel
+    int32 positionX = ConvertF16_32(positionX16 + (1 << 15));
+    int32 positionY = ConvertF16_32(positionY16 + (1 << 15));
+#endif
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+    // If the position doesn't fit in 16 bits
+    if ((positionX < GROUPCEL_POSITION_MIN) || (positionX > GROUPCEL_POSITION_MAX) || (positionY < GROUPCEL_POSITION_MIN) || (positionY > GROUPCEL_POSITION_MAX)) {
+        // Displays a warning
+        printf("Warning : GroupCel element position (%d, %d) out of 16-bit range. Clamped.\n", positionX, positionY);
+        // Clamps the position
+        positionX = (positionX < GROUPCEL_POSITION_MIN) ? GROUPCEL_POSITION_MIN : ((positionX > GROUPCEL_POSITION_MAX) ? GROUPCEL_POSITION_MAX : positionX);
+        positionY = (positionY < GROUPCEL_POSITION_MIN) ? GROUPCEL_POSITION_MIN : ((positionY > GROUPCEL_POSITION_MAX) ? GROUPCEL_POSITION_MAX : positionY);
+    }
+    // Position
+    element->position.x = (int16)positionX;
+    element->position.y = (int16)positionY;
+#else
+    // Position
+    element->position.x = positionX16;
+    element->position.y = positionY16;
+#endif
+    // Cel's CCB
+    element->cel = cel;
+}
+
+// Displays the memory used by the elements in both storage modes
+int32 GroupCelMemoryReport(GroupCel *groupCel) {
+
+    // Size of the elements in each mode, and in the layout without resize detection
+    int32 baselineSize = 0;
+    int32 wideSize = 0;
+    int32 compactSize = 0;
+    // Size of the reciprocals, the same in both modes
+    int32 reciprocalsSize = 0;
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // Size of the elements in each mode, and with only a 16.16 position and the CCB pointer
+    baselineSize = (int32)(groupCel->celsCount * (sizeof(Point2D) + sizeof(CCB *)));
+    wideSize = (int32)(groupCel->celsCount * sizeof(GroupCelListWide));
+    compactSize = (int32)(groupCel->celsCount * sizeof(GroupCelListCompact));
+    // Reciprocals of the elements
+    reciprocalsSize = (groupCel->reciprocals != NULL) ? (int32)(groupCel->celsCount * sizeof(CelQuadMapReciprocals)) : 0;
+
+    // Displays the report
+    printf("GroupCel : %u elements, storage %s\n", groupCel->celsCount, (GROUPCEL_STORAGE_COMPACT == 1) ? "compact" : "wide");
+    printf("  baseline : %u bytes/element (16.16 position and CCB pointer, no resize detection), %d bytes\n", (uint32)(sizeof(Point2D) + sizeof(CCB *)), baselineSize);
+    printf("  wide     : %u bytes/element (16.16 position, dimension read from the CCB), %d bytes\n", (uint32)sizeof(GroupCelListWide), wideSize);
+    printf("  compact  : %u bytes/element (int16 position, dimension read from the cache), %d bytes\n", (uint32)sizeof(GroupCelListCompact), compactSize);
+    printf("  reciprocals : %u bytes/element in both modes, %d bytes\n", (uint32)sizeof(CelQuadMapReciprocals), reciprocalsSize);
+    printf("  compact saves %d bytes on the wide mode and %d bytes on the baseline\n", wideSize - compactSize, baselineSize - compactSize);
+    printf("  with the reciprocals : %d bytes in the current mode, %d bytes for the baseline\n", (int32)(groupCel->celsCount * sizeof(GroupCelList)) + reciprocalsSize, baselineSize);
+    printf("  GroupCel structure : %u bytes\n", (uint32)sizeof(GroupCel));
+
+    // Returns the memory used by the elements and their reciprocals in the current mode
+    return (int32)(groupCel->celsCount * sizeof(GroupCelList)) + reciprocalsSize;
+}
+
+// Displays the hits of the quad cache
+int32 GroupCelQuadCacheReport(GroupCel *groupCel) {
+
+    // Number of quads committed or skipped
+    uint32 total = 0;
+    // Hit rate in percent
+    int32 hitRate = 0;
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the cache is disabled
+    if (groupCel->quads == NULL) {
+        // Displays the report
+        printf("GroupCel quad cache : disabled\n");
+        return 0;
+    }
+
+    // Hit rate since the cache was enabled
+    total = groupCel->quadHits + groupCel->quadMisses;
+    hitRate = (total > 0) ? (int32)((groupCel->quadHits * 100) / total) : 0;
+
+    // Displays the report
+    printf("GroupCel quad cache : %u hits, %u misses (%d%% skipped)\n", groupCel->quadHits, groupCel->quadMisses, hitRate);
+
+    // Returns the hit rate in percent
+    return hitRate;
+}
+
+// Initialization of a pool of CCB headers
+GroupCelPool *GroupCelPoolInitialization(uint32 capacity) {
+
+    // Pool
+    GroupCelPool *pool = NULL;
+    // Index to iterate through CCB headers
+    uint32 celIndex = 0;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelPoolInitialization()*\n"); }
+
+    // Allocates memory for the pool
+    pool = (GroupCelPool *)AllocMem(sizeof(GroupCelPool), MEMTYPE_DRAM);
+    // If it's a failure
+    if (pool == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel pool.\n");
+        return NULL;
+    }
+
+    // Corrects parameters
+    // Minimum number of CCB headers = 2
+    capacity = (capacity > 2) ? capacity : 2;
+
+    // Allocates a single block for all the CCB headers
+    pool->ccbs = (CCB *)AllocMem(capacity * sizeof(CCB), MEMTYPE_CEL);
+    // If it's a failure
+    if (pool->ccbs == NULL) {
+        // Frees previously allocated memory
+        FreeMem(pool, sizeof(GroupCelPool));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel pool CCBs.\n");
+        return NULL;
+    }
+
+    // Chains all the CCB headers in the free list
+    for (celIndex = 0; celIndex < capacity - 1; celIndex++) {
+        pool->ccbs[celIndex].ccb_NextPtr = &pool->ccbs[celIndex + 1];
+    }
+    pool->ccbs[capacity - 1].ccb_NextPtr = NULL;
+    pool->freeList = pool->ccbs;
+    pool->capacity = capacity;
+    pool->freeCount = capacity;
+
+    // Returns the created pool
+    return pool;
+}
+
+// Takes a CCB header from the pool
+CCB *GroupCelPoolAllocation(GroupCelPool *pool) {
+
+    // CCB header
+    CCB *cel = NULL;
+
+    // If the pool is empty
+    if ((pool == NULL) || (pool->freeList == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel pool exhausted.\n");
+        return NULL;
+    }
+
+    // Takes the first free CCB header
+    cel = pool->freeList;
+    pool->freeList = cel->ccb_NextPtr;
+    pool->freeCount--;
+
+    // Returns the CCB header
+    return cel;
+}
+
+// Gives a CCB header back to the pool
+void GroupCelPoolRelease(GroupCelPool *pool, CCB *cel) {
+
+    // If the pool or the CCB header is unknown
+    if ((pool == NULL) || (cel == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel pool unknown.\n");
+        return;
+    }
+
+    // Puts the CCB header back at the head of the free list
+    cel->ccb_NextPtr = pool->freeList;
+    pool->freeList = cel;
+    pool->freeCount++;
+}
+
+// Deletes the pool
+int32 GroupCelPoolCleanup(GroupCelPool *pool) {
+
+    if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelPoolCleanup()*\n"); }
+
+    // If the pool doesn't exist
+    if (pool == NULL){
+        // Display an error
+        printf("Error : GroupCel pool unknown.\n");
+        return -1;
+    }
+
+    // If instances still use CCB headers
+    if (pool->freeCount != pool->capacity) {
+        // Displays a warning
+        printf("Warning : GroupCel pool deleted with %u CCBs in use.\n", pool->capacity - pool->freeCount);
+    }
+
+    // Free the memory used for the CCB headers then for the pool
+    FreeMem(pool->ccbs, pool->capacity * sizeof(CCB));
+    FreeMem(pool, sizeof(GroupCelPool));
+
+    // Return success
+    return 1;
+}
+
+// Initialization of a camera
+GroupCelCamera *GroupCelCameraInitialization(int32 positionX, int32 positionY) {
+
+    // Camera
+    GroupCelCamera *camera = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelCameraInitialization()*\n"); }
+
+    // Allocates memory for the camera
+    camera = (GroupCelCamera *)AllocMem(sizeof(GroupCelCamera), MEMTYPE_DRAM);
+    // If it's a failure
+    if (camera == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel camera.\n");
+        return NULL;
+    }
+
+    // Position of the camera in the scene
+    camera->position.x = positionX;
+    camera->position.y = positionY;
+    // No zoom
+    camera->zoom = GROUPCEL_ZOOM_ONE;
+    camera->focus.x = 0;
+    camera->focus.y = 0;
+
+    // Returns the created camera
+    return camera;
+}
+
+// Moves the camera
+void GroupCelCameraMove(GroupCelCamera *camera, int32 moveX, int32 moveY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraMove()*\n"); }
+
+    // If the camera is unknown
+    if (camera == NULL){
+        // Returns an error
+        printf("Error : GroupCel camera unknown.\n");
+        return;
+    }
+
+    // Modifies the camera's position
+    GroupCelCameraSetPosition(camera, camera->position.x + moveX, camera->position.y + moveY);
+}
+
+// Sets the position of the camera
+void GroupCelCameraSetPosition(GroupCelCamera *camera, int32 positionX, int32 positionY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraSetPosition()*\n"); }
+
+    // If the camera is unknown
+    if (camera == NULL){
+        // Returns an error
+        printf("Error : GroupCel camera unknown.\n");
+        return;
+    }
+
+    // Applies the changes, the groups follow at their next update
+    camera->position.x = positionX;
+    camera->position.y = positionY;
+}
+
+// Zooms the camera about a focal point
+void GroupCelCameraZoom(GroupCelCamera *camera, frac16 zoom, int32 focusX, int32 focusY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraZoom()*\n"); }
+
+    // If the camera is unknown
+    if (camera == NULL){
+        // Returns an error
+        printf("Error : GroupCel camera unknown.\n");
+        return;
+    }
+
+    // Corrects parameters
+    // Minimum zoom = 1/256
+    zoom = (zoom > (GROUPCEL_ZOOM_ONE >> 8)) ? zoom : (GROUPCEL_ZOOM_ONE >> 8);
+
+    // Applies the changes, the groups recompute their elements at their next update
+    camera->zoom = zoom;
+    camera->focus.x = focusX;
+    camera->focus.y = focusY;
+}
+
+// Attaches a GroupCel to a camera
+int32 GroupCelSetCamera(GroupCel *groupCel, GroupCelCamera *camera) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelSetCamera()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // The CCBs follow the camera (or go back to the scene with NULL) at the next update
+    groupCel->camera = camera;
+
+    // Returns success
+    return 1;
+}
+
+// Moves the CCBs of a GroupCel by the displacement of its camera
+void GroupCelCameraPan(GroupCel *groupCel) {
+
+    // Index to iterate through elements or tiles
+    uint32 celIndex = 0;
+    // Offset, zoom and focal point the CCBs must have
+    Point2D offset = {0};
+    frac16 zoom = GROUPCEL_ZOOM_ONE;
+    Point2D focus = {0};
+    // Offset scaled by the zoom the CCBs must have, in 16.16
+    Point2D pan = {0};
+    // Displacement to apply in 16.16
+    frac16 panX = 0;
+    frac16 panY = 0;
+    // CCB of an element or a tile
+    CCB *cel = NULL;
+
+    // State of the camera (none without camera)
+    if (groupCel->camera != NULL) {
+        offset = groupCel->camera->position;
+        zoom = groupCel->camera->zoom;
+        focus = groupCel->camera->focus;
+    }
+
+    // Offset scaled by the zoom, computed from the whole offset so that the rounding doesn't add up pan after pan
+    pan.x = Convert32_F16(offset.x);
+    pan.y = Convert32_F16(offset.y);
+    if (zoom != GROUPCEL_ZOOM_ONE) {
+        pan.x = MulSF16(pan.x, zoom);
+        pan.y = MulSF16(pan.y, zoom);
+    }
+
+    // If the zoom or the focal point changed
+    if ((zoom != groupCel->cameraZoom) || (focus.x != groupCel->cameraFocus.x) || (focus.y != groupCel->cameraFocus.y)) {
+        // The new camera is applied by recomputing every element
+        groupCel->cameraOffset = offset;
+        groupCel->cameraPan = pan;
+        groupCel->cameraZoom = zoom;
+        groupCel->cameraFocus = focus;
+        groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        // The quads in the cache were written with the previous zoom
+        if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+        return;
+    }
+
+    // If the CCBs already have this offset
+    if ((offset.x == groupCel->cameraOffset.x) && (offset.y == groupCel->cameraOffset.y)) {
+        // Nothing to pan
+        return;
+    }
+
+    // Displacement since the last offset applied, scaled by the zoom
+    panX = pan.x - groupCel->cameraPan.x;
+    panY = pan.y - groupCel->cameraPan.y;
+    groupCel->cameraOffset = offset;
+    groupCel->cameraPan = pan;
+
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // Its single CCB follows the camera
+        groupCel->flat->cel.ccb_XPos -= panX;
+        groupCel->flat->cel.ccb_YPos -= panY;
+        // The dirty rectangles follow it
+        if (groupCel->dirty != NULL) { GroupCelDirtyPan(groupCel, &groupCel->flat->bounds, panX, panY); }
+        // The placement of the group changed
+        groupCel->epoch++;
+        return;
+    }
+
+    // For each CCB of the group, one add per coordinate
+    for (celIndex = 0; celIndex < ((groupCel->tiles != NULL) ? groupCel->gridColumns * groupCel->gridRows : groupCel->celsCount); celIndex++) {
+        cel = (groupCel->tiles != NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel;
+        // If the element or the tile isn't configured
+        if (cel == NULL) { continue; }
+        cel->ccb_XPos -= panX;
+        cel->ccb_YPos -= panY;
+        // The bounds of the occlusion pass follow the CCB
+        if (groupCel->bounds != NULL) {
+            groupCel->bounds[celIndex].topLeft.x -= panX;
+            groupCel->bounds[celIndex].topLeft.y -= panY;
+            groupCel->bounds[celIndex].bottomRight.x -= panX;
+            groupCel->bounds[celIndex].bottomRight.y -= panY;
+        }
+        // The dirty rectangles follow the CCB
+        if (groupCel->dirty != NULL) { GroupCelDirtyPan(groupCel, &groupCel->dirtyBounds[celIndex], panX, panY); }
+        // The projection follows the CCB
+        if (groupCel->projections != NULL) {
+            groupCel->projections[celIndex].topLeft.x -= panX;
+            groupCel->projections[celIndex].topLeft.y -= panY;
+            groupCel->projections[celIndex].bottomRight.x -= panX;
+            groupCel->projections[celIndex].bottomRight.y -= panY;
+        }
+    }
+
+    // The placement of the group changed
+    groupCel->epoch++;
+}
+
+// Applies the camera of a GroupCel to a point in 16.16
+void GroupCelCameraPoint(GroupCel *groupCel, Point2D *point16) {
+
+    // If the camera doesn't zoom
+    if (groupCel->cameraZoom == GROUPCEL_ZOOM_ONE) {
+        // The camera only translates
+        point16->x -= Convert32_F16(groupCel->cameraOffset.x);
+        point16->y -= Convert32_F16(groupCel->cameraOffset.y);
+        return;
+    }
+
+    // Scales the point about the focal point
+    point16->x = MulSF16(point16->x - Convert32_F16(groupCel->cameraOffset.x + groupCel->cameraFocus.x), groupCel->cameraZoom) + Convert32_F16(groupCel->cameraFocus.x);
+    point16->y = MulSF16(point16->y - Convert32_F16(groupCel->cameraOffset.y + groupCel->cameraFocus.y), groupCel->cameraZoom) + Convert32_F16(groupCel->cameraFocus.y);
+}
+
+// Deletes the camera
+int32 GroupCelCameraCleanup(GroupCelCamera *camera) {
+
+    if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelCameraCleanup()*\n"); }
+
+    // If the camera is unknown
+    if (camera == NULL){
+        // Returns an error
+        printf("Error : GroupCel camera unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used by the camera
+    FreeMem(camera, sizeof(GroupCelCamera));
+
+    // Returns success
+    return 1;
+}
+
+// Shows or hides the GroupCel
+int32 GroupCelSetVisible(GroupCel *groupCel, int32 visible) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetVisible()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // Any value other than 0 shows the group
+    visible = (visible != 0) ? 1 : 0;
+
+    // If the visibility doesn't change
+    if (groupCel->visible == visible) {
+        // Nothing to do
+        return 1;
+    }
+
+    // If the group is in a display list
+    if (groupCel->previous != NULL) {
+        // If the group is shown
+        if (visible == 1) {
+            // Splices the whole chain back after its CCB
+            GroupCelSpliceIn(groupCel);
+        // Otherwise, splices the whole chain out
+        } else if (GroupCelSpliceOut(groupCel) < 0) {
+            // Returns an error
+            printf("Error <- GroupCelSpliceOut()\n");
+            return -1;
+        }
+    }
+
+    // Stores the visibility, applied by GroupCelLinkAfter() when not linked yet
+    groupCel->visible = visible;
+    // The area of the group appears or disappears
+    GroupCelDirtyGroup(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Links the GroupCel after a CCB of a display list
+int32 GroupCelLinkAfter(GroupCel *groupCel, CCB *previous) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelLinkAfter()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the chain of the group isn't configured
+    if ((groupCel->cel == NULL) || (groupCel->tail == NULL)){
+        // Returns an error
+        printf("Error : GroupCel chain unknown.\n");
+        return -1;
+    }
+
+    // If the Cel is unknown
+    if (previous == NULL){
+        // Returns an error
+        printf("Error : Cel unknown.\n");
+        return -1;
+    }
+
+    // If the group is already in a display list
+    if (groupCel->previous != NULL) {
+        // Takes it out first
+        if (GroupCelUnlink(groupCel) < 0) {
+            // Returns an error
+            printf("Error <- GroupCelUnlink()\n");
+            return -1;
+        }
+    }
+
+    // The group now follows the CCB
+    groupCel->previous = previous;
+
+    // If the group is visible
+    if (groupCel->visible == 1) {
+        // Splices the whole chain after the CCB
+        GroupCelSpliceIn(groupCel);
+        // The area of the group appears
+        GroupCelDirtyGroup(groupCel);
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Takes the GroupCel out of its display list
+int32 GroupCelUnlink(GroupCel *groupCel) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUnlink()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the group isn't in a display list
+    if (groupCel->previous == NULL){
+        // Returns an error
+        printf("Error : GroupCel display list unknown.\n");
+        return -1;
+    }
+
+    // If the group is visible, its chain is in the list
+    if (groupCel->visible == 1) {
+        // Splices the whole chain out
+        if (GroupCelSpliceOut(groupCel) < 0) {
+            // Returns an error
+            printf("Error <- GroupCelSpliceOut()\n");
+            return -1;
+        }
+        // The area of the group disappears
+        GroupCelDirtyGroup(groupCel);
+    }
+
+    // The group doesn't follow any CCB anymore
+    groupCel->previous = NULL;
+
+    // Returns success
+    return 1;
+}
+
+// Splices the chain of the GroupCel after its CCB
+int32 GroupCelSpliceIn(GroupCel *groupCel) {
+
+    // The CCB that followed now follows the tail
+    GroupCelChainLink(GroupCelChainLast(groupCel), GroupCelChainNext(groupCel->previous));
+    // Informs the Cel Engine that the group is the next to render
+    LinkCel(groupCel->previous, GroupCelChainFirst(groupCel));
+
+    // Returns success
+    return 1;
+}
+
+// Splices the chain of the GroupCel out of the list
+int32 GroupCelSpliceOut(GroupCel *groupCel) {
+
+    // If the group doesn't directly follow its CCB anymore
+    if (GroupCelChainNext(groupCel->previous) != GroupCelChainFirst(groupCel)) {
+        // Returns an error
+        printf("Error : GroupCel doesn't follow its CCB, another chain was linked in between.\n");
+        return -1;
+    }
+
+    // The CCB now goes straight to the one following the tail
+    GroupCelChainLink(groupCel->previous, GroupCelChainNext(GroupCelChainLast(groupCel)));
+    // The tail ends the chain of the group
+    GroupCelChainLink(GroupCelChainLast(groupCel), NULL);
+
+    // Returns success
+    return 1;
+}
+
+// Relinks a GroupCel in its display list after the ends of its chain changed
+void GroupCelChainRelink(GroupCel *groupCel, CCB *follower) {
+
+    // If the chain is in a display list and the group isn't flattened
+    if ((groupCel->previous != NULL) && (groupCel->visible == 1) && (groupCel->flat == NULL)) {
+        // The CCB before the group goes on to its first element
+        LinkCel(groupCel->previous, groupCel->cel);
+        // The CCB that followed the group now follows its tail
+        GroupCelChainLink(groupCel->tail, follower);
+    }
+}
+
+// CCB rendered after a Cel (NULL at the end of a list)
+CCB *GroupCelChainNext(CCB *cel) {
+
+    // The last CCB of a list has no next one
+    return ((cel->ccb_Flags & CCB_LAST) != 0) ? NULL : cel->ccb_NextPtr;
+}
+
+// Links a Cel to the next one or ends the list on it
+void GroupCelChainLink(CCB *cel, CCB *next) {
+
+    // If there is no next CCB
+    if (next == NULL) {
+        // The Cel ends the list
+        cel->ccb_NextPtr = NULL;
+        cel->ccb_Flags |= CCB_LAST;
+    // Otherwise
+    } else {
+        // Informs the Cel Engine that this is the next Cel to render
+        LinkCel(cel, next);
+    }
+}
+
+// Draw order of the elements of the GroupCel
+int32 GroupCelDrawOrder(GroupCel *groupCel, int32 depthSort) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelDrawOrder()*\n"); }
+
+    // If the draw order can't be managed
+    if (GroupCelDrawOrderAllocation(groupCel) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderAllocation()\n");
+        return -1;
+    }
+
+    // Sorts by depth at each update where a key changed (1 = yes)
+    groupCel->depthSort = (depthSort != 0) ? 1 : 0;
+
+    // Returns success
+    return 1;
+}
+
+// Depth key of an element of the GroupCel
+int32 GroupCelElementSetDepth(GroupCel *groupCel, uint32 celIndex, int32 depth) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetDepth()*\n"); }
+
+    // If the element isn't in a draw order
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // If the key doesn't change
+    if (groupCel->order[celIndex].depth == depth) {
+        // Nothing to update
+        return 1;
+    }
+
+    // Applies the changes
+    groupCel->order[celIndex].depth = depth;
+
+    // The order must be sorted again
+    groupCel->depthChanged = 1;
+
+    // Returns success
+    return 1;
+}
+
+// Draws an element of the GroupCel above all the others
+int32 GroupCelBringToFront(GroupCel *groupCel, uint32 celIndex) {
+
+    // CCB following the group
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelBringToFront()*\n"); }
+
+    // If the element isn't in a draw order
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // If the element is already drawn last
+    if (groupCel->order[celIndex].next == GROUPCEL_ORDER_NONE) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Moves the element to the end of the chain
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, GROUPCEL_ORDER_NONE, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Draws an element of the GroupCel below all the others
+int32 GroupCelSendToBack(GroupCel *groupCel, uint32 celIndex) {
+
+    // CCB following the group
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSendToBack()*\n"); }
+
+    // If the element isn't in a draw order
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // If the element is already drawn first
+    if (groupCel->order[celIndex].previous == GROUPCEL_ORDER_NONE) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Moves the element to the start of the chain
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, groupCel->orderFirst, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Draws an element of the GroupCel just before another
+int32 GroupCelMoveBefore(GroupCel *groupCel, uint32 celIndex, uint32 beforeIndex) {
+
+    // CCB following the group
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelMoveBefore()*\n"); }
+
+    // If one of the elements isn't in a draw order
+    if ((GroupCelDrawOrderCheck(groupCel, celIndex) < 0) || (GroupCelDrawOrderCheck(groupCel, beforeIndex) < 0)) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // If the element is already in place
+    if ((celIndex == beforeIndex) || (groupCel->order[celIndex].next == (int32)beforeIndex)) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Moves the element in front of the other one
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, (int32)beforeIndex, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Returns success
+    return 1;
+}
+
+// Sorts the draw order of the GroupCel by depth
+int32 GroupCelDrawOrderSort(GroupCel *groupCel) {
+
+    // Draw order of the elements
+    GroupCelOrder *order = NULL;
+    // Element to place and the next one to visit
+    int32 celIndex = 0;
+    int32 nextIndex = 0;
+    // Element searched backward and the one to insert before
+    int32 searchIndex = 0;
+    int32 beforeIndex = 0;
+    // CCB following the group
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelDrawOrderSort()*\n"); }
+
+    // If the draw order isn't managed
+    if ((groupCel == NULL) || (groupCel->order == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel draw order unknown.\n");
+        return -1;
+    }
+
+    order = groupCel->order;
+    follower = GroupCelChainNext(groupCel->tail);
+
+    // Insertion sort in the current order: a nearly sorted list costs close to one pass
+    for (celIndex = order[groupCel->orderFirst].next; celIndex != GROUPCEL_ORDER_NONE; celIndex = nextIndex) {
+
+        nextIndex = order[celIndex].next;
+
+        // Walks back over the greater keys only, equal keys keep their order
+        beforeIndex = celIndex;
+        for (searchIndex = order[celIndex].previous; (searchIndex != GROUPCEL_ORDER_NONE) && (order[searchIndex].depth > order[celIndex].depth); searchIndex = order[searchIndex].previous) {
+            beforeIndex = searchIndex;
+        }
+
+        // If the element must move
+        if (beforeIndex != celIndex) {
+            // Relinks it in front of the first greater key
+            GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+            GroupCelDrawOrderInsert(groupCel, celIndex, beforeIndex, follower);
+        }
+    }
+
+    // Updates the ends of the group's chain
+    GroupCelDrawOrderEnds(groupCel);
+
+    // The order is sorted
+    groupCel->depthChanged = 0;
+
+    // Returns success
+    return 1;
+}
+
+// Allocates the draw order from the order of the indexes
+int32 GroupCelDrawOrderAllocation(GroupCel *groupCel) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel draw order needs a list of elements.\n");
+        return -1;
+    }
+
+    // If the draw order is already allocated
+    if (groupCel->order != NULL) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Validates the elements before allocating anything
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // If an element isn't configured
+        if (groupCel->cels[celIndex].cel == NULL) {
+            // Returns an error
+            printf("Error : GroupCel element %u unknown.\n", celIndex);
+            return -1;
+        }
+    }
+
+    // Allocates memory for the draw order
+    groupCel->order = (GroupCelOrder *)AllocMem(groupCel->celsCount * sizeof(GroupCelOrder), MEMTYPE_DRAM);
+    // If it's a failure
+    if (groupCel->order == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel draw order.\n");
+        return -1;
+    }
+
+    // The elements are chained in the order of their indexes
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        groupCel->order[celIndex].previous = (int32)celIndex - 1;
+        groupCel->order[celIndex].next = (celIndex + 1 < groupCel->celsCount) ? (int32)celIndex + 1 : GROUPCEL_ORDER_NONE;
+        groupCel->order[celIndex].depth = 0;
+    }
+    groupCel->orderFirst = 0;
+    groupCel->orderLast = (int32)groupCel->celsCount - 1;
+    groupCel->depthChanged = 0;
+
+    // Returns success
+    return 1;
+}
+
+// Checks that an element of the GroupCel can be reordered
+int32 GroupCelDrawOrderCheck(GroupCel *groupCel, uint32 celIndex) {
+
+    // If the draw order can't be managed
+    if (GroupCelDrawOrderAllocation(groupCel) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelDrawOrderAllocation()\n");
+        return -1;
+    }
+
+    // If the element is unknown
+    if (celIndex >= groupCel->celsCount) {
+        // Returns an error
+        printf("Error : GroupCel element %u unknown.\n", celIndex);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Takes an element out of the draw order
+void GroupCelDrawOrderRemove(GroupCel *groupCel, int32 celIndex, CCB *follower) {
+
+    // Draw order of the elements
+    GroupCelOrder *order = groupCel->order;
+    // Neighbours of the element
+    int32 previousIndex = order[celIndex].previous;
+    int32 nextIndex = order[celIndex].next;
+
+    // Joins the neighbours
+    if (previousIndex == GROUPCEL_ORDER_NONE) { groupCel->orderFirst = nextIndex; } else { order[previousIndex].next = nextIndex; }
+    if (nextIndex == GROUPCEL_ORDER_NONE) { groupCel->orderLast = previousIndex; } else { order[nextIndex].previous = previousIndex; }
+
+    // Relinks the CCB drawn before the element
+    if (previousIndex != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, previousIndex, follower); }
+}
+
+// Inserts an element in the draw order before another one (GROUPCEL_ORDER_NONE = at the end)
+void GroupCelDrawOrderInsert(GroupCel *groupCel, int32 celIndex, int32 beforeIndex, CCB *follower) {
+
+    // Draw order of the elements
+    GroupCelOrder *order = groupCel->order;
+    // Element drawn before the new place
+    int32 previousIndex = (beforeIndex == GROUPCEL_ORDER_NONE) ? groupCel->orderLast : order[beforeIndex].previous;
+
+    // Places the element between its new neighbours
+    order[celIndex].previous = previousIndex;
+    order[celIndex].next = beforeIndex;
+    if (previousIndex == GROUPCEL_ORDER_NONE) { groupCel->orderFirst = celIndex; } else { order[previousIndex].next = celIndex; }
+    if (beforeIndex == GROUPCEL_ORDER_NONE) { groupCel->orderLast = celIndex; } else { order[beforeIndex].previous = celIndex; }
+
+    // Relinks the CCBs of the element and of the one drawn before it
+    GroupCelDrawOrderLink(groupCel, celIndex, follower);
+    if (previousIndex != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, previousIndex, follower); }
+}
+
+// Gives the draw order's element a new CCB
+void GroupCelDrawOrderReplace(GroupCel *groupCel, int32 celIndex) {
+
+    // CCB following the group, taken from the tail before it changes
+    CCB *follower = GroupCelChainNext(groupCel->tail);
+
+    // Relinks the new CCB and the one drawn before it
+    GroupCelDrawOrderLink(groupCel, celIndex, follower);
+    if (groupCel->order[celIndex].previous != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, groupCel->order[celIndex].previous, follower); }
+
+    // Updates the ends of the group's chain
+    GroupCelDrawOrderEnds(groupCel);
+}
+
+// Links the CCB of an element to the next one in the draw order
+void GroupCelDrawOrderLink(GroupCel *groupCel, int32 celIndex, CCB *follower) {
+
+    // Next element in the draw order
+    int32 nextIndex = groupCel->order[celIndex].next;
+
+    // The occlusion pass must follow the new order
+    groupCel->occlusionChanged = 1;
+    // A flattened group renders its elements in the new order
+    GroupCelElementsChanged(groupCel);
+    // The last element goes on to the CCB following the group
+    GroupCelChainLink(groupCel->cels[celIndex].cel, (nextIndex == GROUPCEL_ORDER_NONE) ? follower : groupCel->cels[nextIndex].cel);
+}
+
+// Updates the first and last CCB of the group from the draw order
+void GroupCelDrawOrderEnds(GroupCel *groupCel) {
+
+    // Ends of the group's chain
+    groupCel->cel = groupCel->cels[groupCel->orderFirst].cel;
+    groupCel->tail = groupCel->cels[groupCel->orderLast].cel;
+
+    // If the chain is in a display list and the group isn't flattened
+    if ((groupCel->previous != NULL) && (groupCel->visible == 1) && (groupCel->flat == NULL)) {
+        // The CCB before the group goes on to its first element
+        LinkCel(groupCel->previous, groupCel->cel);
+    }
+}
+
+// Deletes the draw order, the chain keeps its current order
+void GroupCelDrawOrderCleanup(GroupCel *groupCel) {
+
+    // If there is a draw order
+    if (groupCel->order != NULL) {
+        // Free the memory used for the draw order
+        FreeMem(groupCel->order, groupCel->celsCount * sizeof(GroupCelOrder));
+        groupCel->order = NULL;
+    }
+}
+
+// Enables or disables the occlusion pass of the GroupCel
+int32 GroupCelOcclusion(GroupCel *groupCel, int32 enable) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelOcclusion()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel occlusion needs a list of elements.\n");
+        return -1;
+    }
+
+    // If the pass must be disabled
+    if (enable == 0) {
+        // Shows the elements hidden by the pass and frees its arrays
+        GroupCelOcclusionCleanup(groupCel);
+        // Returns success
+        return 1;
+    }
+
+    // If the pass is already enabled
+    if (groupCel->bounds != NULL) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Allocates memory for the bounds, the flags and the occluders of the elements
+    groupCel->bounds = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+    groupCel->occlusion = (uint8 *)AllocMem(groupCel->celsCount * sizeof(uint8), MEMTYPE_DRAM);
+    groupCel->occluders = (int32 *)AllocMem(groupCel->celsCount * sizeof(int32), MEMTYPE_DRAM);
+    // If it's a failure
+    if ((groupCel->bounds == NULL) || (groupCel->occlusion == NULL) || (groupCel->occluders == NULL)) {
+        // Frees previously allocated memory
+        GroupCelOcclusionCleanup(groupCel);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel occlusion.\n");
+        return -1;
+    }
+
+    // No element is opaque nor hidden yet
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        groupCel->bounds[celIndex].topLeft.x = 0;
+        groupCel->bounds[celIndex].topLeft.y = 0;
+        groupCel->bounds[celIndex].bottomRight.x = 0;
+        groupCel->bounds[celIndex].bottomRight.y = 0;
+        groupCel->occlusion[celIndex] = 0;
+    }
+    groupCel->occludedCount = 0;
+    groupCel->occlusionChanged = 1;
+
+    // The bounds are taken when the CCBs are written: every element is written again
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Returns success
+    return 1;
+}
+
+// Tells if an element of the GroupCel hides what is drawn behind it
+int32 GroupCelElementSetOpaque(GroupCel *groupCel, uint32 celIndex, int32 opaque) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetOpaque()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the occlusion pass isn't enabled
+    if (groupCel->occlusion == NULL){
+        // Returns an error
+        printf("Error : GroupCel occlusion disabled.\n");
+        return -1;
+    }
+
+    // If the element is unknown
+    if (celIndex >= groupCel->celsCount) {
+        // Returns an error
+        printf("Error : GroupCel element %u unknown.\n", celIndex);
+        return -1;
+    }
+
+    // Any value other than 0 makes the element opaque
+    opaque = (opaque != 0) ? GROUPCEL_OCCLUSION_OPAQUE : 0;
+
+    // If the opacity changes
+    if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_OPAQUE) != (uint8)opaque) {
+        groupCel->occlusion[celIndex] = (uint8)((groupCel->occlusion[celIndex] & ~GROUPCEL_OCCLUSION_OPAQUE) | opaque);
+        // The next update runs the pass again
+        groupCel->occlusionChanged = 1;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Skips the elements covered by an opaque aligned element drawn after them
+void GroupCelOcclusionUpdate(GroupCel *groupCel) {
+
+    // Element in the draw order
+    int32 celIndex = 0;
+    // Opaque aligned elements in the draw order
+    int32 occludersCount = 0;
+    // First occluder drawn after the current element
+    int32 occluderFirst = 0;
+    // Index to iterate through occluders
+    int32 occluderIndex = 0;
+    // Indicates if the current element is covered
+    int32 covered = 0;
+    // CCB of the element
+    CCB *cel = NULL;
+
+    // If the pass is disabled, or nothing moved and no opacity or order changed
+    if ((groupCel->bounds == NULL) || (groupCel->flat != NULL) || ((groupCel->epoch == groupCel->occlusionEpoch) && (groupCel->occlusionChanged == 0))) {
+        // The CCBs keep their flags
+        return;
+    }
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelOcclusionUpdate()*\n"); }
+
+    // Lists the opaque aligned elements, in the draw order
+    for (celIndex = (groupCel->order != NULL) ? groupCel->orderFirst : 0; (celIndex >= 0) && (celIndex < (int32)groupCel->celsCount); celIndex = (groupCel->order != NULL) ? groupCel->order[celIndex].next : celIndex + 1) {
+        if ((groupCel->occlusion[celIndex] & (GROUPCEL_OCCLUSION_OPAQUE | GROUPCEL_OCCLUSION_ALIGNED)) == (GROUPCEL_OCCLUSION_OPAQUE | GROUPCEL_OCCLUSION_ALIGNED)) {
+            groupCel->occluders[occludersCount++] = celIndex;
+        }
+    }
+
+    // For each element, in the draw order
+    groupCel->occludedCount = 0;
+    for (celIndex = (groupCel->order != NULL) ? groupCel->orderFirst : 0; (celIndex >= 0) && (celIndex < (int32)groupCel->celsCount); celIndex = (groupCel->order != NULL) ? groupCel->order[celIndex].next : celIndex + 1) {
+
+        // If the element isn't configured
+        cel = groupCel->cels[celIndex].cel;
+        if (cel == NULL) { continue; }
+
+        // Only the occluders drawn after the element can hide it
+        if ((occluderFirst < occludersCount) && (groupCel->occluders[occluderFirst] == celIndex)) { occluderFirst++; }
+
+        // Searches an occluder covering all the pixels the element can draw
+        covered = 0;
+        for (occluderIndex = occluderFirst; (occluderIndex < occludersCount) && (covered == 0); occluderIndex++) {
+            covered = GroupCelOcclusionCovers(&groupCel->bounds[groupCel->occluders[occluderIndex]], &groupCel->bounds[celIndex]);
+        }
+
+        // If the element is covered
+        if (covered == 1) {
+            // The Cel Engine skips it for this frame
+            cel->ccb_Flags |= CCB_SKIP;
+            groupCel->occlusion[celIndex] |= GROUPCEL_OCCLUSION_HIDDEN;
+            groupCel->occludedCount++;
+        // If the pass hid it before
+        } else if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0) {
+            // Shows it again
+            cel->ccb_Flags &= ~CCB_SKIP;
+            groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_HIDDEN;
+        }
+    }
+
+    // The pass is up to date with the CCBs
+    groupCel->occlusionEpoch = groupCel->epoch;
+    groupCel->occlusionChanged = 0;
+}
+
+// Keeps the bounds of an element as written in its CCB
+void GroupCelOcclusionBounds(GroupCel *groupCel, int32 celIndex, Quad2D *viewQuad) {
+
+    // Bounds of the element
+    Rectangle *bounds = &groupCel->bounds[celIndex];
+
+    // Smallest rectangle holding the 4 corners in 16.16
+    Quad2DBounds(viewQuad, bounds);
+
+    // An element fills its bounds only if its quad is an axis-aligned rectangle
+    if ((viewQuad->topLeft.y == viewQuad->topRight.y) && (viewQuad->bottomLeft.y == viewQuad->bottomRight.y) && (viewQuad->topLeft.x == viewQuad->bottomLeft.x) && (viewQuad->topRight.x == viewQuad->bottomRight.x)) {
+        groupCel->occlusion[celIndex] |= GROUPCEL_OCCLUSION_ALIGNED;
+    } else {
+        groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_ALIGNED;
+    }
+}
+
+// Tells if an aligned occluder covers every pixel an element can draw
+int32 GroupCelOcclusionCovers(Rectangle *occluder, Rectangle *element) {
+
+    // A pixel is drawn when its center is inside: the bounds are compared in pixel centers,
+    // the element widened and the occluder narrowed by the margin of the rounding of the CCB
+    const frac16 half = (1 << 15);
+
+    // Columns and rows drawn at most by the element and at least by the occluder
+    if (GROUPCEL_CEIL_F16(occluder->topLeft.x + GROUPCEL_OCCLUSION_MARGIN - half) > GROUPCEL_CEIL_F16(element->topLeft.x - GROUPCEL_OCCLUSION_MARGIN - half)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->topLeft.y + GROUPCEL_OCCLUSION_MARGIN - half) > GROUPCEL_CEIL_F16(element->topLeft.y - GROUPCEL_OCCLUSION_MARGIN - half)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->bottomRight.x - GROUPCEL_OCCLUSION_MARGIN - half) - 1 < ((element->bottomRight.x + GROUPCEL_OCCLUSION_MARGIN - half) >> 16)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->bottomRight.y - GROUPCEL_OCCLUSION_MARGIN - half) - 1 < ((element->bottomRight.y + GROUPCEL_OCCLUSION_MARGIN - half) >> 16)) { return 0; }
+
+    // Every pixel of the element is drawn again by the occluder
+    return 1;
+}
+
+// Shows an element hidden by the occlusion pass
+void GroupCelOcclusionShow(GroupCel *groupCel, int32 celIndex) {
+
+    // If the pass hid the element
+    if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0) {
+        // Gives its CCB back to the Cel Engine
+        groupCel->cels[celIndex].cel->ccb_Flags &= ~CCB_SKIP;
+        groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_HIDDEN;
+    }
+
+    // The next update runs the pass again
+    groupCel->occlusionChanged = 1;
+}
+
+// Deletes the occlusion pass, the hidden elements are shown
+void GroupCelOcclusionCleanup(GroupCel *groupCel) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+
+    // If there are flags
+    if (groupCel->occlusion != NULL) {
+        // Shows the elements hidden by the pass
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) { GroupCelOcclusionShow(groupCel, celIndex); }
+        // Free the memory used for the flags
+        FreeMem(groupCel->occlusion, groupCel->celsCount * sizeof(uint8));
+        groupCel->occlusion = NULL;
+    }
+    // If there are bounds
+    if (groupCel->bounds != NULL) {
+        // Free the memory used for the bounds
+        FreeMem(groupCel->bounds, groupCel->celsCount * sizeof(Rectangle));
+        groupCel->bounds = NULL;
+    }
+    // If there are occluders
+    if (groupCel->occluders != NULL) {
+        // Free the memory used for the occluders
+        FreeMem(groupCel->occluders, groupCel->celsCount * sizeof(int32));
+        groupCel->occluders = NULL;
+    }
+    groupCel->occludedCount = 0;
+}
+
+// Flattens the GroupCel into a single pre-rendered CCB, or brings back its chain
+int32 GroupCelFlatten(GroupCel *groupCel, int32 enable) {
+
+    // Flattened CCB
+    GroupCelFlat *flat = NULL;
+    // Description of the bitmap
+    TagArg tags[4];
+    // Indicates if the group is drawn in a display list
+    int32 displayed = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelFlatten()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the flattening must be undone
+    if (enable == 0) {
+        // Brings back the chain of the elements
+        return GroupCelFlattenCleanup(groupCel);
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel flattening needs a list of elements.\n");
+        return -1;
+    }
+
+    // If the chain of the group isn't configured
+    if ((groupCel->cel == NULL) || (groupCel->tail == NULL)){
+        // Returns an error
+        printf("Error : GroupCel chain unknown.\n");
+        return -1;
+    }
+
+    // If the group is already flattened
+    if (groupCel->flat != NULL) {
+        // Renders the elements again at the next update
+        GroupCelElementsChanged(groupCel);
+        return 1;
+    }
+
+    // Allocates memory for the flattened CCB
+    flat = (GroupCelFlat *)AllocMem(sizeof(GroupCelFlat), MEMTYPE_DRAM);
+    // If it's a failure
+    if (flat == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel flat.\n");
+        return -1;
+    }
+    memset(flat, 0, sizeof(GroupCelFlat));
+
+    // Size of the rendering: the frame, rounded up to pairs of pixels for the frame buffer format
+    flat->width = ((groupCel->size.x > 2) ? groupCel->size.x + 1 : 2) & ~1;
+    flat->height = ((groupCel->size.y > 2) ? groupCel->size.y + 1 : 2) & ~1;
+
+    // Allocates video memory for the pixels, 16 bits each
+    flat->bufferSize = flat->width * flat->height * 2;
+    flat->buffer = AllocMem(flat->bufferSize, MEMTYPE_VRAM);
+    // If it's a failure
+    if (flat->buffer == NULL) {
+        // Frees previously allocated memory
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel flat bitmap.\n");
+        return -1;
+    }
+
+    // Creates the offscreen bitmap the elements are drawn into
+    tags[0].ta_Tag = CBM_TAG_WIDTH;
+    tags[0].ta_Arg = (void *)flat->width;
+    tags[1].ta_Tag = CBM_TAG_HEIGHT;
+    tags[1].ta_Arg = (void *)flat->height;
+    tags[2].ta_Tag = CBM_TAG_BUFFER;
+    tags[2].ta_Arg = flat->buffer;
+    tags[3].ta_Tag = CBM_TAG_DONE;
+    tags[3].ta_Arg = NULL;
+    flat->bitmap = CreateItem(MKNODEID(NODE_GRAPHICS, TYPE_BITMAP), tags);
+    // If it's a failure
+    if (flat->bitmap < 0) {
+        // Frees previously allocated memory
+        FreeMem(flat->buffer, flat->bufferSize);
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Displays an error message
+        printf("Error : Failed to create the GroupCel flat bitmap.\n");
+        return -1;
+    }
+
+    // Uncoded 16-bit CCB reading the bitmap in the frame buffer format (LRFORM)
+    flat->cel.ccb_Flags = CCB_LAST | CCB_NPABS | CCB_SPABS | CCB_PPABS | CCB_LDSIZE | CCB_LDPRS | CCB_LDPPMP | CCB_CCBPRE | CCB_YOXY | CCB_ACW | CCB_ACCW;
+    flat->cel.ccb_NextPtr = NULL;
+    flat->cel.ccb_SourcePtr = (CelData *)flat->buffer;
+    flat->cel.ccb_PLUTPtr = NULL;
+    flat->cel.ccb_PIXC = GROUPCEL_FLAT_PIXC;
+    flat->cel.ccb_PRE0 = PRE0_BPP_16 | PRE0_LINEAR | ((uint32)(flat->height / 2 - 1) << PRE0_VCNT_SHIFT);
+    flat->cel.ccb_PRE1 = PRE1_LRFORM | PRE1_TLLSB_PDC0 | ((uint32)(flat->width - 2) << PRE1_WOFFSET10_SHIFT) | ((uint32)(flat->width - 1) << PRE1_TLHPCNT_SHIFT);
+    flat->cel.ccb_Width = flat->width;
+    flat->cel.ccb_Height = flat->height;
+    CelQuadMapReciprocalsInitialization(&flat->cel, &flat->reciprocals);
+
+    // If the group is drawn in a display list
+    displayed = ((groupCel->previous != NULL) && (groupCel->visible == 1)) ? 1 : 0;
+    if ((displayed == 1) && (GroupCelSpliceOut(groupCel) < 0)) {
+        // Frees previously allocated memory
+        DeleteItem(flat->bitmap);
+        FreeMem(flat->buffer, flat->bufferSize);
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Returns an error
+        printf("Error <- GroupCelSpliceOut()\n");
+        return -1;
+    }
+
+    // The elements leave their place to the flattened CCB
+    GroupCelDirtyGroup(groupCel);
+
+    // Renders the elements
+    groupCel->flat = flat;
+    if (GroupCelFlattenRender(groupCel) < 0) {
+        // Brings back the chain of the elements
+        GroupCelFlattenCleanup(groupCel);
+        // Returns an error
+        printf("Error <- GroupCelFlattenRender()\n");
+        return -1;
+    }
+
+    // The flattened CCB takes the place of the chain
+    if (displayed == 1) { GroupCelSpliceIn(groupCel); }
+
+    // Places the flattened CCB at the next update
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Returns success
+    return 1;
+}
+
+// Tells a flattened GroupCel that its elements changed
+void GroupCelElementsChanged(GroupCel *groupCel) {
+
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // The next update renders the elements again
+        groupCel->transformations |= GROUPCEL_FLAG_ELEMENTS;
+    }
+}
+
+// First CCB drawn for the GroupCel: its flattened CCB or the start of its chain
+CCB *GroupCelChainFirst(GroupCel *groupCel) {
+
+    return (groupCel->flat != NULL) ? &groupCel->flat->cel : groupCel->cel;
+}
+
+// Last CCB drawn for the GroupCel: its flattened CCB or the tail of its chain
+CCB *GroupCelChainLast(GroupCel *groupCel) {
+
+    return (groupCel->flat != NULL) ? &groupCel->flat->cel : groupCel->tail;
+}
+
+// Advances the animations and places the flattened CCB of the GroupCel
+void GroupCelFlattenUpdate(GroupCel *groupCel, int32 elapsed, int32 doStretch, int32 doRotate) {
+
+    // Flattened CCB
+    GroupCelFlat *flat = groupCel->flat;
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Frame shown before the animation advances
+    int32 frameIndex = 0;
+    // Transformation of the group
+    GroupCelTransform transform;
+    // Quadrilateral for Cel projection in 16.16
+    Quad2D quadMap = {0};
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelFlattenUpdate()*\n"); }
+
+    // Advances the animations: a new frame changes the rendering
+    if ((elapsed != 0) && (groupCel->animations != NULL)) {
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (groupCel->animations[celIndex].anim == NULL) { continue; }
+            frameIndex = groupCel->animations[celIndex].frameIndex;
+            GroupCelElementAnimationAdvance(groupCel, celIndex, elapsed);
+            if (groupCel->animations[celIndex].frameIndex != frameIndex) { groupCel->transformations |= GROUPCEL_FLAG_ELEMENTS; }
+        }
+    }
+
+    // If an element changed
+    if ((groupCel->transformations & GROUPCEL_FLAG_ELEMENTS) != 0) {
+        // Renders the elements again, the last rendering stays shown if it fails
+        if (GroupCelFlattenRender(groupCel) < 0) { printf("Error <- GroupCelFlattenRender()\n"); }
+        // The new rendering is drawn in place of the previous one
+        if ((groupCel->dirty != NULL) && (groupCel->visible == 1)) { GroupCelDirtyAddF16(groupCel->dirty, &flat->bounds); }
+    }
+
+    // The flattened CCB covers the frame like a single element: one projection for the group
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    GroupCelTransformPoint(&transform, 0, 0, &quadMap.topLeft);
+    GroupCelTransformPoint(&transform, Convert32_F16(flat->width), 0, &quadMap.topRight);
+    GroupCelTransformPoint(&transform, Convert32_F16(flat->width), Convert32_F16(flat->height), &quadMap.bottomRight);
+    GroupCelTransformPoint(&transform, 0, Convert32_F16(flat->height), &quadMap.bottomLeft);
+    GroupCelCameraPoint(groupCel, &quadMap.topLeft);
+    GroupCelCameraPoint(groupCel, &quadMap.topRight);
+    GroupCelCameraPoint(groupCel, &quadMap.bottomRight);
+    GroupCelCameraPoint(groupCel, &quadMap.bottomLeft);
+
+    // Modifies the flattened CCB without any division
+    CelQuadMapReciprocal(&flat->cel, &quadMap, &flat->reciprocals);
+    // Reports where the flattened CCB was and where it is now
+    if (groupCel->dirty != NULL) { GroupCelDirtyQuad(groupCel, &flat->bounds, &quadMap); }
+
+    // The placement of the group changed
+    groupCel->epoch++;
+}
+
+// Draws the elements of the GroupCel into its offscreen bitmap
+int32 GroupCelFlattenRender(GroupCel *groupCel) {
+
+    // Flattened CCB
+    GroupCelFlat *flat = groupCel->flat;
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Element's CCB
+    CCB *cel = NULL;
+    // Quadrilateral for Cel projection in 16.16
+    Quad2D quadMap = {0};
+    // Link of the tail saved during the rendering
+    CCB *tailNext = NULL;
+    uint32 tailLast = 0;
+    // Result of the rendering
+    int32 result = 0;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelFlattenRender()*\n"); }
+
+    // Places each element at its position in the frame, without transformation
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        cel = groupCel->cels[celIndex].cel;
+        // If the element isn't configured
+        if (cel == NULL) { continue; }
+        // Detects a change of dimension since the last rendering
+        GroupCelElementResized(groupCel, celIndex);
+        // Corners of the element in the bitmap in 16.16
+        quadMap.topLeft.x = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+        quadMap.topLeft.y = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+        quadMap.bottomRight.x = quadMap.topLeft.x + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+        quadMap.bottomRight.y = quadMap.topLeft.y + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+        quadMap.topRight.x = quadMap.bottomRight.x;
+        quadMap.topRight.y = quadMap.topLeft.y;
+        quadMap.bottomLeft.x = quadMap.topLeft.x;
+        quadMap.bottomLeft.y = quadMap.bottomRight.y;
+        // The bitmap is drawn at full resolution
+        if (groupCel->lods != NULL) { GroupCelElementLodSelect(groupCel, celIndex, &quadMap); }
+        CelQuadMapReciprocal(cel, &quadMap, &groupCel->reciprocals[celIndex]);
+    }
+    // The quads in the cache were written in the scene
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Clears the bitmap: the pixels no element draws stay transparent
+    memset(flat->buffer, 0, (size_t)flat->bufferSize);
+
+    // Draws the chain of the elements alone, the tail ending the list for the time of the rendering
+    tailNext = groupCel->tail->ccb_NextPtr;
+    tailLast = groupCel->tail->ccb_Flags & CCB_LAST;
+    GroupCelChainLink(groupCel->tail, NULL);
+    result = DrawCels(flat->bitmap, groupCel->cel);
+    groupCel->tail->ccb_NextPtr = tailNext;
+    groupCel->tail->ccb_Flags = (groupCel->tail->ccb_Flags & ~CCB_LAST) | tailLast;
+
+    // If it's a failure
+    if (result < 0) {
+        // Returns an error
+        printf("Error : GroupCel flat rendering failed (%d).\n", result);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Deletes the flattened CCB, the chain of the elements is drawn again
+int32 GroupCelFlattenCleanup(GroupCel *groupCel) {
+
+    // Flattened CCB
+    GroupCelFlat *flat = groupCel->flat;
+    // Indicates if the group is drawn in a display list
+    int32 displayed = 0;
+
+    // If the group isn't flattened
+    if (flat == NULL) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Takes the flattened CCB out of the display list
+    displayed = ((groupCel->previous != NULL) && (groupCel->visible == 1)) ? 1 : 0;
+    if ((displayed == 1) && (GroupCelSpliceOut(groupCel) < 0)) {
+        // Returns an error
+        printf("Error <- GroupCelSpliceOut()\n");
+        return -1;
+    }
+
+    // The flattened CCB leaves its place to the elements
+    GroupCelDirtyGroup(groupCel);
+
+    // Free the memory used for the bitmap and the flattened CCB
+    DeleteItem(flat->bitmap);
+    FreeMem(flat->buffer, flat->bufferSize);
+    FreeMem(flat, sizeof(GroupCelFlat));
+    groupCel->flat = NULL;
+
+    // The chain of the elements takes its place back
+    if (displayed == 1) { GroupCelSpliceIn(groupCel); }
+
+    // The elements were placed in the bitmap: the next update places them in the scene
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Returns success
+    return 1;
+}
+
+// Chain of pre-scaled Cels of an element of the GroupCel
+int32 GroupCelElementLod(GroupCel *groupCel, uint32 celIndex, CCB **levels, uint32 levelsCount) {
+
+    // Index to iterate through levels
+    uint32 level = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementLod()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the element is unknown
+    if ((groupCel->cels == NULL) || (celIndex >= groupCel->celsCount) || (groupCel->cels[celIndex].cel == NULL)){
+        // Returns an error
+        printf("Error : GroupCel element %u unknown.\n", celIndex);
+        return -1;
+    }
+
+    // If the chain must be removed
+    if (levels == NULL) {
+        // If the element has a chain
+        if ((groupCel->lods != NULL) && (groupCel->lods[celIndex].levels != NULL)) {
+            // Brings back the full resolution
+            GroupCelElementLodLevel(groupCel, celIndex, 0);
+            groupCel->lods[celIndex].levels = NULL;
+            groupCel->lods[celIndex].levelsCount = 0;
+            // The element is placed again at the next update
+            if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+            groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        }
+        return 1;
+    }
+
+    // Validates the whole chain before modifying the element
+    for (level = 0; level < levelsCount; level++) {
+        // If the level is unknown
+        if (levels[level] == NULL) {
+            // Returns an error
+            printf("Error : GroupCel LOD level %u unknown.\n", level);
+            return -1;
+        }
+    }
+
+    // If the chain is empty
+    if (levelsCount == 0) {
+        // Returns an error
+        printf("Error : GroupCel LOD chain without levels.\n");
+        return -1;
+    }
+
+    // If the element is animated, its frames already swap the source data
+    if ((groupCel->animations != NULL) && (groupCel->animations[celIndex].anim != NULL)) {
+        // Returns an error
+        printf("Error : GroupCel element %u is animated.\n", celIndex);
+        return -1;
+    }
+
+    // If it's the first element with a chain
+    if (groupCel->lods == NULL) {
+        // Allocates memory for the chains
+        groupCel->lods = (GroupCelLod *)AllocMem(groupCel->celsCount * sizeof(GroupCelLod), MEMTYPE_DRAM);
+        // If it's a failure
+        if (groupCel->lods == NULL) {
+            // Displays an error message
+            printf("Error : Failed to allocate memory for GroupCel LOD chains.\n");
+            return -1;
+        }
+        // No element with a chain yet
+        memset(groupCel->lods, 0, (size_t)groupCel->celsCount * sizeof(GroupCelLod));
+    }
+
+    // Stores the chain and shows the full resolution
+    groupCel->lods[celIndex].levels = levels;
+    groupCel->lods[celIndex].levelsCount = levelsCount;
+    GroupCelElementLodLevel(groupCel, celIndex, 0);
+
+    // The next update picks the level from the projected size
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Returns success
+    return 1;
+}
+
+// Picks the level of an element from its projected quad
+int32 GroupCelElementLodSelect(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
+
+    // Chain of the element
+    GroupCelLod *lod = &groupCel->lods[celIndex];
+    // Projected dimension in 16.16
+    frac16 width16 = 0;
+    frac16 height16 = 0;
+    // Length of an edge in 16.16
+    frac16 length16 = 0;
+    // Level to show
+    uint32 level = 0;
+
+    // If the element has no chain
+    if (lod->levels == NULL) {
+        // It keeps its CCB
+        return 0;
+    }
+
+    // Projected dimension, the longest of the opposite edges
+    width16 = GroupCelEdgeLength(&quadMap->topLeft, &quadMap->topRight);
+    length16 = GroupCelEdgeLength(&quadMap->bottomLeft, &quadMap->bottomRight);
+    if (length16 > width16) { width16 = length16; }
+    height16 = GroupCelEdgeLength(&quadMap->topLeft, &quadMap->bottomLeft);
+    length16 = GroupCelEdgeLength(&quadMap->topRight, &quadMap->bottomRight);
+    if (length16 > height16) { height16 = length16; }
+
+    // Smallest level that still has a source pixel for each pixel drawn
+    while ((level + 1 < lod->levelsCount) && (Convert32_F16(lod->levels[level + 1]->ccb_Width) >= width16) && (Convert32_F16(lod->levels[level + 1]->ccb_Height) >= height16)) {
+        level++;
+    }
+
+    // If the level is already shown
+    if (level == lod->level) {
+        // Nothing changes
+        return 0;
+    }
+
+    // Shows the new level
+    GroupCelElementLodLevel(groupCel, celIndex, level);
+
+    // Returns 1 if the level changed
+    return 1;
+}
+
+// Shows a level of the chain in the element's CCB
+void GroupCelElementLodLevel(GroupCel *groupCel, int32 celIndex, uint32 level) {
+
+    // Level to show
+    CCB *source = groupCel->lods[celIndex].levels[level];
+    // Element's CCB
+    CCB *cel = groupCel->cels[celIndex].cel;
+
+    // Current level
+    groupCel->lods[celIndex].level = level;
+
+    // Swaps the source data, the PLUT and the preambles of the level
+    cel->ccb_SourcePtr = source->ccb_SourcePtr;
+    cel->ccb_PLUTPtr = source->ccb_PLUTPtr;
+    cel->ccb_PRE0 = source->ccb_PRE0;
+    cel->ccb_PRE1 = source->ccb_PRE1;
+    cel->ccb_Width = source->ccb_Width;
+    cel->ccb_Height = source->ccb_Height;
+
+    // The dimension seen and the reciprocals follow the level, the element keeps its frame
+    groupCel->cels[celIndex].width = (uint16)cel->ccb_Width;
+    groupCel->cels[celIndex].height = (uint16)cel->ccb_Height;
+    CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+    groupCel->lodSwaps++;
+}
+
+// Length of an edge in 16.16, never shorter and at most 12% longer than the exact one
+frac16 GroupCelEdgeLength(Point2D *point0, Point2D *point1) {
+
+    // Absolute differences of the coordinates
+    frac16 deltaX = point1->x - point0->x;
+    frac16 deltaY = point1->y - point0->y;
+
+    if (deltaX < 0) { deltaX = -deltaX; }
+    if (deltaY < 0) { deltaY = -deltaY; }
+
+    // The longest difference plus half of the other one, without a square root
+    return (deltaX > deltaY) ? deltaX + (deltaY >> 1) : deltaY + (deltaX >> 1);
+}
+
+// Gives the GroupCel the accumulator of the dirty rectangles of the frame
+int32 GroupCelSetDirty(GroupCel *groupCel, GroupCelDirty *dirty) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelSetDirty()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the tracking must be disabled
+    if (dirty == NULL) {
+        // If there are bounds
+        if (groupCel->dirtyBounds != NULL) {
+            // Free the memory used for the bounds
+            FreeMem(groupCel->dirtyBounds, groupCel->celsCount * sizeof(Rectangle));
+            groupCel->dirtyBounds = NULL;
+        }
+        groupCel->dirty = NULL;
+        // Returns success
+        return 1;
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel dirty rectangles need a list of elements.\n");
+        return -1;
+    }
+
+    // If the bounds don't exist yet
+    if (groupCel->dirtyBounds == NULL) {
+        // Allocates memory for the bounds of the elements
+        groupCel->dirtyBounds = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+        // If it's a failure
+        if (groupCel->dirtyBounds == NULL) {
+            // Displays an error message
+            printf("Error : Failed to allocate memory for GroupCel dirty bounds.\n");
+            return -1;
+        }
+        // No element drawn yet
+        memset(groupCel->dirtyBounds, 0, (size_t)groupCel->celsCount * sizeof(Rectangle));
+        // The bounds are taken when the CCBs are written: every element is written again
+        groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+    }
+
+    // Stores the accumulator
+    groupCel->dirty = dirty;
+
+    // Returns success
+    return 1;
+}
+
+// Reports the rectangles a CCB leaves and reaches
+void GroupCelDirtyQuad(GroupCel *groupCel, Rectangle *bounds16, Quad2D *viewQuad) {
+
+    // If the group is visible
+    if (groupCel->visible == 1) {
+        // Where the CCB was drawn
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+
+    // Bounds of the new quad
+    Quad2DBounds(viewQuad, bounds16);
+
+    // If the group is visible
+    if (groupCel->visible == 1) {
+        // Where the CCB is drawn now
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+}
+
+// Reports the whole area of the GroupCel
+void GroupCelDirtyGroup(GroupCel *groupCel) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+
+    // If the group isn't tracked
+    if (groupCel->dirty == NULL) {
+        // Nothing to report
+        return;
+    }
+
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // Its single CCB covers it
+        GroupCelDirtyAddF16(groupCel->dirty, &groupCel->flat->bounds);
+        return;
+    }
+
+    // Each element configured
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        GroupCelDirtyAddF16(groupCel->dirty, &groupCel->dirtyBounds[celIndex]);
+    }
+}
+
+// Reports the rectangles a CCB leaves and reaches when the camera pans
+void GroupCelDirtyPan(GroupCel *groupCel, Rectangle *bounds16, frac16 panX, frac16 panY) {
+
+    // If the group is visible
+    if (groupCel->visible == 1) {
+        // Where the CCB was drawn
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+
+    // The bounds follow the CCB
+    bounds16->topLeft.x -= panX;
+    bounds16->topLeft.y -= panY;
+    bounds16->bottomRight.x -= panX;
+    bounds16->bottomRight.y -= panY;
+
+    // If the group is visible
+    if (groupCel->visible == 1) {
+        // Where the CCB is drawn now
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+}
+
+// Keeps the screen bounds of each element, filled by the update
+int32 GroupCelProjections(GroupCel *groupCel, int32 enable) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelProjections()*\n"); }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the projections must not be kept anymore
+    if (enable == 0) {
+        // If there are projections
+        if (groupCel->projections != NULL) {
+            // Free the memory used for the projections
+            FreeMem(groupCel->projections, groupCel->celsCount * sizeof(Rectangle));
+            groupCel->projections = NULL;
+        }
+        // Returns success
+        return 1;
+    }
+
+    // If it's a grid
+    if (groupCel->cels == NULL){
+        // Returns an error
+        printf("Error : GroupCel projections need a list of elements.\n");
+        return -1;
+    }
+
+    // If the projections are already kept
+    if (groupCel->projections != NULL) {
+        // Nothing to do
+        return 1;
+    }
+
+    // Allocates memory for the projections of the elements
+    groupCel->projections = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+    // If it's a failure
+    if (groupCel->projections == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel projections.\n");
+        return -1;
+    }
+
+    // No element projected yet
+    memset(groupCel->projections, 0, (size_t)groupCel->celsCount * sizeof(Rectangle));
+    // The projections are taken when the CCBs are written: every element is written again
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Returns success
+    return 1;
+}
+
+// Smallest rectangle on screen holding the whole GroupCel in 16.16
+int32 GroupCelProjectionBounds(GroupCel *groupCel, Rectangle *bounds) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Number of elements held
+    uint32 heldCount = 0;
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the group is flattened
+    if (groupCel->flat != NULL) {
+        // Its single CCB holds it
+        CelProjection(&groupCel->flat->cel, bounds);
+        return 1;
+    }
+
+    // If the projections aren't kept
+    if (groupCel->projections == NULL){
+        // Returns an error
+        printf("Error : GroupCel projections not kept, see GroupCelProjections().\n");
+        return -1;
+    }
+
+    // Each element configured
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // The first one gives the bounds, the others grow them
+        if (heldCount == 0) {
+            *bounds = groupCel->projections[celIndex];
+        } else {
+            if (groupCel->projections[celIndex].topLeft.x < bounds->topLeft.x) { bounds->topLeft.x = groupCel->projections[celIndex].topLeft.x; }
+            if (groupCel->projections[celIndex].topLeft.y < bounds->topLeft.y) { bounds->topLeft.y = groupCel->projections[celIndex].topLeft.y; }
+            if (groupCel->projections[celIndex].bottomRight.x > bounds->bottomRight.x) { bounds->bottomRight.x = groupCel->projections[celIndex].bottomRight.x; }
+            if (groupCel->projections[celIndex].bottomRight.y > bounds->bottomRight.y) { bounds->bottomRight.y = groupCel->projections[celIndex].bottomRight.y; }
+        }
+        heldCount++;
+    }
+
+    // Returns 1 if an element was held, 0 if the group is empty
+    return (heldCount > 0) ? 1 : 0;
+}
@@ -41,14 +41,124 @@
 **      of Cels, you need to point to the main CCB. To add other Cels afterward,
 **      you must continue the linking from the CCB of the last added Cel.
 **
+**    - Each GroupCel keeps its first (cel) and last (tail) CCB. GroupCelLinkAfter() splices
+**      the whole chain after a CCB of a display list, GroupCelUnlink() takes it out and
+**      GroupCelSetVisible() hides or shows it, each in O(1) whatever the element count.
+**      Groups following each other are linked after the tail of the previous group; one
+**      that gets another chain linked right before it must be unlinked and linked again.
+**      Configuring the elements of a linked group relinks the ends of its chain.
+**
+**    - The elements are drawn in the order of their indexes until a draw order is used
+**      (GroupCelDrawOrder()). GroupCelBringToFront(), GroupCelSendToBack() and
+**      GroupCelMoveBefore() then relink a few ccb_NextPtr in O(1). Depth keys can also be
+**      given to the elements: the stable sort starts from the current order, so a list
+**      that is nearly sorted costs close to a single pass.
+**
+**    - The occlusion pass (GroupCelOcclusion()) sets CCB_SKIP on the elements fully
+**      covered by an opaque element drawn after them, for the frame. Only the elements
+**      declared opaque (GroupCelElementSetOpaque()) and written as axis-aligned
+**      rectangles hide others. The bounds are taken when the CCBs are written, and the
+**      test is conservative: an element is skipped only if every pixel it can draw is
+**      drawn again. The pass runs at the update only when a CCB, an opacity or the
+**      draw order changed. The CCB_SKIP flag of the elements must then be left to it.
+**
+**    - A static group can be flattened (GroupCelFlatten()): its elements are drawn once
+**      into an offscreen bitmap, and a single CCB reading it takes the place of the chain
+**      in the display list. Moving, stretching or rotating the group then writes one CCB.
+**      The bitmap is the frame of the group: what the elements draw outside of it is cut.
+**      Any change of an element (position, CCB, frame of an animation) renders the bitmap
+**      again at the next update, which costs more than drawing the chain: only groups that
+**      rarely change are worth flattening. The bitmap takes width x height x 2 bytes of VRAM.
+**
+**    - An element can be given a LOD chain (GroupCelElementLod()): Cels pre-scaled from
+**      its full resolution, each smaller than the previous one. When its CCB is written,
+**      the smallest level that still has a source pixel for each pixel drawn is copied
+**      into it (source data, PLUT, preambles, dimension), like a frame of an animation.
+**      The element keeps the frame of its full resolution. A minified group then reads
+**      and fills less. An animated element can't have a chain, and a new CCB drops it.
+**
+**    - Once given a GroupCelDirty (GroupCelSetDirty()), a visible group reports the
+**      bounds of each CCB it writes, before and after, and those of the frames of its
+**      animations. Showing, hiding, linking or flattening it reports its whole area.
+**      The bounds come from the quads in 16.16 and follow the pans of the camera.
+**
+**    - GroupCelProjections() keeps the screen bounds of each element in 16.16, taken
+**      from the quads the update maps the CCBs to and shifted by the pans of the camera.
+**      They aren't updated while the group is flattened. CelProjection() gives the same
+**      bounds from any CCB, HDDX/HDDY included.
+**
+**    - A GroupCel created by GroupCelInstantiate() owns CCB headers taken from a
+**      GroupCelPool. They share the source data and PLUTs of the template, which
+**      must therefore stay loaded as long as its instances exist.
+**
+**    - With GROUPCEL_STORAGE_COMPACT set to 1, the elements store their positions on
+**      16 bits and the transformations read the dimension the element keeps instead
+**      of its CCB: 12 bytes per element instead of 16 on the 3DO. That is no less than
+**      an element holding only a 16.16 position and the CCB pointer: the 4 bytes saved
+**      are those of the dimension both modes keep to detect a resize, and the
+**      reciprocals add 12 bytes per element in both modes. GroupCelMemoryReport()
+**      compares the three layouts. Positions outside -32768..32767 are clamped. A
+**      change of size of a CCB is detected by the next update.
+**
+**    - A grid GroupCel (GroupCelGridInitialization()) holds tiles of equal size laid out
+**      in columns and rows. Their positions are implied by their index, and the
+**      stretching and rotation are computed once per lattice vertex, each vertex being
+**      shared by up to four tiles. Element functions don't apply to a grid.
+**
+**    - Stretching and rotation stay applied after a move: GroupCelUpdate() recomputes
+**      them as long as the frame is stretched or the angle isn't 0.
+**
+**    - An element can be given an AnimSpriteCel animation with GroupCelElementAnimation().
+**      GroupCelUpdateElapsed() then advances the frames, swaps the source data in the
+**      element's CCB and recomputes the elements whose dimension changed, in the same
+**      traversal as the transformations. The animation isn't copied and must stay loaded.
+**
+**    - Each element keeps the last dimension seen of its CCB and its reciprocals, so the
+**      projection of a CCB needs no division. When the size of a CCB is changed outside
+**      the group (a TextCel rewritten, for example), the next update recomputes it, even
+**      without any transformation: GroupCelRevalidate(), which it then calls, recomputes
+**      only the elements whose dimension changed, a grid or a flattened group as a whole.
+**
+**    - GroupCelQuadCache() keeps the last quad written in each CCB. An element whose
+**      quad didn't change since the last update is skipped, its CCB is left untouched.
+**      The CCBs' projection fields must then only be written by the group.
+**
+**    - The setters (GroupCelSetPosition(), GroupCelStretch(), GroupCelRotate(),
+**      GroupCelElementSetPosition()) only request an update when the value changes, so
+**      they can be called every frame. The epoch of the group changes each time one of
+**      its CCBs is written: a system caching bounds or hit tests compares it with the
+**      epoch it saw last to know if the group moved.
+**
+**    - Groups attached to a GroupCelCamera are seen through it: the camera position is
+**      subtracted when the CCBs are written. Moving the camera doesn't mark the groups
+**      as transformed, their next update only adds the displacement to each CCB. Several
+**      cameras can be used, one per layer for example.
+**
+**    - A camera can also zoom about a focal point on screen (GroupCelCameraZoom()). The
+**      zoom is applied after the stretching and rotation of each group, to the corners
+**      of each element or to the lattice vertices of a grid, during the same update.
+**      Changing the zoom recomputes the elements of the groups; a pan stays an add.
+**
+**    - Positions, angles and pivots are kept in 16.16 (GroupCelSetPositionF16(),
+**      GroupCelElementSetPositionF16(), GroupCelRotateF16()): a group moving by a fraction
+**      of a pixel per frame doesn't accumulate rounding in the caller. The integer setters
+**      convert once and delegate to them. In compact storage the element positions stay
+**      int16 and are rounded to the pixel.
+**
 **    - When a GroupCel is initialized, it must be deleted using GroupCelCleanup().
-**      Associated elements must be deleted independently.
+**      Associated elements must be deleted independently, except when they were
+**      loaded from a bundle: the block holding them is then freed with the group.
 **
 **  Structure Roles :
 **
 **    GroupCelList
-**      - position : Position of the element within the GroupCel
+**      - position : Position of the element within the GroupCel (16.16 in wide storage)
 **      - cel : Element's CCB
+**      - width, height : Last dimension seen of the CCB, read by the transformations in compact storage
+**
+**    GroupCelElement
+**      - celReference : Index of the element's CCB in the table of cels
+**      - positionX, positionY : Position of the element within the GroupCel
 **
 **    GroupCel
 **      - cel : Active CCB displayed on screen
@@ -57,9 +167,82 @@
 **      - stretching : Storage for stretch parameters
 **      - rotationAngle : Storage for rotation angle
 **      - rotationPivot : Storage for rotation pivot point
+**      - position16, rotationAngle16, rotationPivot16 : Position, angle and pivot in 16.16
 **      - transformations : Flags to determine transformations to apply
 **      - celsCount : Total number of Cels in the GroupCel
 **      - cels : Dynamic array of "GroupCelList"
+**      - data : Block holding the elements' data when loaded from a bundle
+**      - dataSize : Size of the block in bytes
+**      - pool : Pool providing the CCB headers of an instance
+**      - gridColumns, gridRows : Size of the grid in tiles (0 outside grid mode)
+**      - tileSize : Size of a tile
+**      - tiles : Array of the tiles' CCBs, row by row
+**      - lattice : Two rows of lattice vertices used by the update
+**      - animations : Animation states of the elements, allocated with the first animation
+**      - lods : LOD chains of the elements, allocated with the first chain
+**      - lodSwaps : Number of level swaps since the creation
+**      - reciprocals : Reciprocals of the dimension of each element
+**      - tileReciprocals : Reciprocals shared by the tiles of a grid
+**      - tileDimension : Last dimension of a tile seen by the shared reciprocals
+**      - quads : Last quad written in each CCB (NULL when the quad cache is disabled)
+**      - quadHits, quadMisses : Writes skipped and done by the quad cache
+**      - epoch : Transform epoch, changes each time a CCB of the group is written
+**      - camera : Camera the group is seen through (NULL when none)
+**      - cameraOffset : Offset of the camera already applied in the CCBs
+**      - cameraPan : Offset scaled by the zoom already applied in the CCBs, in 16.16
+**      - cameraZoom, cameraFocus : Zoom and focal point of the camera already applied in the CCBs
+**      - tail : Last CCB of the group's chain
+**      - previous : CCB of the display list the group follows (NULL when not linked)
+**      - visible : Visibility, 1 when the chain is in the display list
+**      - order : Draw order of the elements (NULL when it follows the indexes)
+**      - orderFirst, orderLast : First and last elements of the draw order
+**      - depthSort : Sort by depth at each update (1 = yes)
+**      - depthChanged : A depth key changed since the last sort
+**      - bounds : Bounds of each element as written in its CCB (NULL when the occlusion pass is disabled)
+**      - occlusion : Occlusion flags of each element (opaque, aligned, hidden)
+**      - occluders : Opaque aligned elements in the draw order, listed by the pass
+**      - occlusionEpoch, occlusionChanged : Epoch seen by the last pass, and a change of opacity or order since
+**      - occludedCount : Number of elements hidden by the last pass
+**      - flat : Pre-rendered CCB drawn instead of the elements (NULL when not flattened)
+**      - dirty : Accumulator of the dirty rectangles (NULL when not tracked)
+**      - dirtyBounds : Bounds of each element as written in its CCB, for the dirty rectangles
+**      - projections : Screen bounds of each element, kept by the update (NULL when not kept)
+**
+**    GroupCelAnimation
+**      - anim : Animation of the element
+**      - frameIndex : Index of the frame shown
+**      - frameDuration : Duration of a frame, in the unit of the elapsed time
+**      - elapsed : Time elapsed in the current frame
+**
+**    GroupCelCamera
+**      - position : Position of the camera in the scene
+**      - zoom : Zoom in 16.16 (GROUPCEL_ZOOM_ONE = no zoom)
+**      - focus : Focal point of the zoom on screen
+**
+**    GroupCelOrder
+**      - previous, next : Elements drawn before and after (GROUPCEL_ORDER_NONE at the ends)
+**      - depth : Depth key, the greatest are drawn last
+**
+**    GroupCelFlat
+**      - cel : CCB drawn instead of the elements
+**      - bitmap, buffer, bufferSize : Offscreen bitmap and its pixels in video memory
+**      - width, height : Dimension of the bitmap
+**      - reciprocals : Reciprocals of the dimension of the CCB
+**      - bounds : Bounds of the CCB, for the dirty rectangles
+**
+**    GroupCelLod
+**      - levels : Pre-scaled Cels, the full resolution first
+**      - levelsCount : Number of levels
+**      - level : Level shown
+**
+**    GroupCelTransform
+**      - Pre-computed stretching and rotation shared by all the points of an update
+**
+**    GroupCelPool
+**      - ccbs : Block of CCB headers
+**      - capacity : Total number of CCB headers
+**      - freeList : First free CCB header, chained by ccb_NextPtr
+**      - freeCount : Number of free CCB headers
 **
 **  Main Functions :
 **
@@ -72,12 +255,40 @@
 **    GroupCelElementsConfiguration()
 **      -> Defines multiple GroupCel elements in one pass using variadic arguments.
 **
+**    GroupCelElementsTableConfiguration()
+**      -> Defines multiple GroupCel elements from a constant table of descriptors.
+**         Validates the whole table once, links the chain in one pass and
+**         updates all positions at the end.
+**
+**    GroupCelInstantiate()
+**      -> Creates a GroupCel from a template. Only the CCB headers are copied, from a
+**         pool: the source data and PLUTs of the template are shared.
+**
+**    GroupCelPoolInitialization()
+**      -> Creates a pool of CCB headers for the instances.
+**
+**    GroupCelPoolCleanup()
+**      -> Frees the memory used by the pool.
+**
+**    GroupCelGridInitialization()
+**      -> Initializes a grid GroupCel from its columns, rows and tile size.
+**
+**    GroupCelGridTileConfiguration()
+**      -> Defines the tile at a column and a row of the grid.
+**         A call to GroupCelUpdate() is necessary to apply the changes.
+**
+**    GroupCelGridTilesConfiguration()
+**      -> Defines all the tiles of the grid from a table of CCBs, row by row.
+**
 **    GroupCelMove()
 **      -> Moves the GroupCel using relative values from its current position.
 **
 **    GroupCelSetPosition()
 **      -> Moves the GroupCel using absolute values.
 **
+**    GroupCelSetPositionF16()
+**      -> Moves the GroupCel using absolute values in 16.16.
+**
 **    GroupCelElementMove()
 **      -> Moves an element within the GroupCel using relative values from its current position.
 **         A call to GroupCelUpdate() is necessary to apply the changes.
@@ -86,6 +297,16 @@
 **      -> Moves an element within the GroupCel using absolute values within the GroupCel's frame.
 **         A call to GroupCelUpdate() is necessary to apply the changes.
 **
+**    GroupCelElementSetPositionF16()
+**      -> Moves an element within the GroupCel using absolute values in 16.16.
+**         A call to GroupCelUpdate() is necessary to apply the changes.
+**
+**    GroupCelElementAnimation()
+**      -> Gives an element an animation and the duration of its frames (NULL stops it).
+**
+**    GroupCelQuadCache()
+**      -> Enables or disables the cache skipping the elements whose quad didn't change.
+**
 **    GroupCelStretch()
 **      -> Stretches the GroupCel by modifying the four corners of the frame using absolute values.
 **         A call to GroupCelUpdate() is necessary to apply the changes.
@@ -94,15 +315,124 @@
 **      -> Rotates the GroupCel by specifying an angle and pivot using absolute values.
 **         A call to GroupCelUpdate() is necessary to apply the changes.
 **
+**    GroupCelRotateF16()
+**      -> Rotates the GroupCel with an angle and a pivot in 16.16.
+**         A call to GroupCelUpdate() is necessary to apply the changes.
+**
 **    GroupCelUpdate()
 **      -> Updates the elements within the GroupCel.
 **
+**    GroupCelUpdateElapsed()
+**      -> Advances the animations by the elapsed time and updates the elements in a single traversal.
+**
+**    GroupCelRevalidate()
+**      -> Recomputes only the elements whose CCB changed size since the last update, the whole
+**         grid if a tile did, and renders a flattened group again if an element did.
+**
 **    GroupCelElementUpdatePosition()
 **      -> Internal function applying position modifications.
 **
 **    GroupCelUpdateTransformations()
 **      -> Internal function applying stretch and rotation modifications.
 **
+**    GroupCelElementUpdateTransform()
+**      -> Internal function applying the transformations of the group to one element.
+**
+**    GroupCelElementAnimationAdvance() / GroupCelElementAnimationFrame()
+**      -> Internal functions advancing an animation and showing a frame in the element's CCB.
+**
+**    GroupCelGridUpdate()
+**      -> Internal function placing the tiles of a grid from the shared lattice vertices.
+**
+**    GroupCelTransformPreparation() / GroupCelTransformPoint()
+**      -> Internal functions pre-computing the transformations and applying them to a point.
+**
+**    GroupCelFrameInitialization()
+**      -> Internal function initializing the frame shared by both kinds of GroupCel.
+**
+**    GroupCelElementResized() / GroupCelElementCommit()
+**      -> Internal functions detecting a change of dimension and writing the projection of an element.
+**
+**    GroupCelIsStretched()
+**      -> Internal function indicating if the frame of the GroupCel is stretched.
+**
+**    GroupCelPoolAllocation() / GroupCelPoolRelease()
+**      -> Internal functions taking and giving back CCB headers of a pool.
+**
+**    GroupCelElementStore()
+**      -> Internal function storing an element in the list, in the wide or compact format.
+**
+**    GroupCelMemoryReport()
+**      -> Displays the memory used by the elements in both storage modes, against the baseline layout.
+**
+**    GroupCelQuadCacheReport()
+**      -> Displays the hits and misses of the quad cache and returns the hit rate.
+**
+**    GroupCelCameraInitialization() / GroupCelCameraCleanup()
+**      -> Creates and deletes a camera.
+**
+**    GroupCelCameraMove() / GroupCelCameraSetPosition()
+**      -> Moves the camera using relative or absolute values.
+**         The groups attached to it follow at their next GroupCelUpdate().
+**
+**    GroupCelCameraZoom()
+**      -> Zooms the camera about a focal point on screen.
+**         The groups attached to it are recomputed at their next GroupCelUpdate().
+**
+**    GroupCelSetCamera()
+**      -> Attaches a GroupCel to a camera (NULL detaches it).
+**
+**    GroupCelCameraPan()
+**      -> Internal function adding the displacement of the camera to each CCB of a group.
+**
+**    GroupCelCameraPoint()
+**      -> Internal function applying the offset and the zoom of the camera to a point.
+**
+**    GroupCelLinkAfter() / GroupCelUnlink()
+**      -> Splices the whole GroupCel after a CCB of a display list, or out of it, in O(1).
+**
+**    GroupCelSetVisible()
+**      -> Hides or shows the GroupCel by splicing its chain out of or back into its display list.
+**
+**    GroupCelSpliceIn() / GroupCelSpliceOut()
+**      -> Internal functions relinking the CCB before the group and the tail of the group.
+**
+**    GroupCelChainRelink()
+**      -> Internal function relinking a linked GroupCel whose elements were configured again.
+**
+**    GroupCelDrawOrder()
+**      -> Manages the draw order of the elements, sorted by depth at each update or not.
+**
+**    GroupCelBringToFront() / GroupCelSendToBack() / GroupCelMoveBefore()
+**      -> Moves an element in the draw order by relinking its CCB in O(1).
+**
+**    GroupCelElementSetDepth() / GroupCelDrawOrderSort()
+**      -> Gives an element a depth key and sorts the draw order by depth.
+**
+**    GroupCelOcclusion()
+**      -> Enables or disables the pass skipping the elements hidden by opaque elements.
+**
+**    GroupCelElementSetOpaque()
+**      -> Declares an element opaque: it hides the elements it covers entirely.
+**
+**    GroupCelOcclusionUpdate() / GroupCelOcclusionBounds() / GroupCelOcclusionCovers()
+**      -> Internal functions running the pass, keeping the bounds and testing a cover.
+**
+**    GroupCelFlatten()
+**      -> Draws the elements once into a bitmap shown by a single CCB, or brings back the chain.
+**
+**    GroupCelElementsChanged()
+**      -> Renders a flattened group again at the next update.
+**
+**    GroupCelElementLod()
+**      -> Gives an element pre-scaled Cels, swapped from the size of its projection.
+**
+**    GroupCelSetDirty()
+**      -> Reports to a GroupCelDirty where the CCBs were and where they are after each change.
+**
+**    GroupCelProjections() / GroupCelProjectionBounds()
+**      -> Keeps the screen bounds of each element at no cost, and gives those of the group.
+**
 **    GroupCelCleanup()
 **      -> Frees the memory used by the GroupCel structure.
 **
@@ -112,6 +442,12 @@
 #include "graphics.h"
 // Point2D, Quad2D
 #include "Geometry.h"
+// CelQuadMapReciprocals
+#include "CelQuadMap.h"
+// ANIM, AnimFrame
+#include "animutils.h"
+// GroupCelDirty
+#include "GroupCelDirty.h"
 // int32
 #include "types.h"
 
@@ -128,19 +464,192 @@
 #define GROUPCEL_FLAG_STRETCH (1 << 1)
 // bit-2 -> rotation
 #define GROUPCEL_FLAG_ROTATE (1 << 2)
+// bit-3 -> elements of a flattened group
+#define GROUPCEL_FLAG_ELEMENTS (1 << 3)
+
+// Camera zoom
+// 1.0 in 16.16 -> no zoom
+#define GROUPCEL_ZOOM_ONE (1 << 16)
+
+// PIXC of a flattened group
+// Opaque: the pixels of the bitmap are copied as they are
+#define GROUPCEL_FLAT_PIXC 0x1F001F00
+
+// Bounds of an angle in 256 units in 16.16
+#define GROUPCEL_ANGLE_MASK ((256 << 16) - 1)
+
+// No element in the draw order
+#define GROUPCEL_ORDER_NONE (-1)
+
+// Flags of an element for the occlusion pass
+// bit-0 -> opaque, set by GroupCelElementSetOpaque()
+#define GROUPCEL_OCCLUSION_OPAQUE (1 << 0)
+// bit-1 -> quad written as an axis-aligned rectangle
+#define GROUPCEL_OCCLUSION_ALIGNED (1 << 1)
+// bit-2 -> CCB skipped by the pass
+#define GROUPCEL_OCCLUSION_HIDDEN (1 << 2)
+// Margin for the rounding of a CCB in 16.16 (1/256 pixel)
+#define GROUPCEL_OCCLUSION_MARGIN (1 << 8)
+// Smallest integer above a 16.16 value
+#define GROUPCEL_CEIL_F16(value) (((value) + 0xFFFF) >> 16)
+
+// Storage of the elements
+// 0 -> 16.16 positions, dimension read from the CCB
+// 1 -> int16 positions, dimension read from the cache
+// Both keep the last dimension seen of the CCB to detect a resize
+#ifndef GROUPCEL_STORAGE_COMPACT
+#define GROUPCEL_STORAGE_COMPACT 0
+#endif
 
 typedef struct {
-    // Position
+    // Position in 16.16
     Point2D position;
     // Cel's CCB
     CCB *cel;
-} GroupCelList;
+    // Last dimension seen
+    uint16 width;
+    uint16 height;
+} GroupCelListWide;
+
+typedef struct {
+    // Cel's CCB
+    CCB *cel;
+    // Position
+    Point2D16 position;
+    // Last dimension seen
+    uint16 width;
+    uint16 height;
+} GroupCelListCompact;
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+typedef GroupCelListCompact GroupCelList;
+// Dimension of an element
+#define GROUPCEL_ELEMENT_WIDTH(element) ((int32)(element)->width)
+#define GROUPCEL_ELEMENT_HEIGHT(element) ((int32)(element)->height)
+// Position of an element in 16.16
+#define GROUPCEL_ELEMENT_X16(element) ((frac16)(element)->position.x << 16)
+#define GROUPCEL_ELEMENT_Y16(element) ((frac16)(element)->position.y << 16)
+// 16.16 position as the element stores it, rounded to the pixel
+#define GROUPCEL_POSITION_F16(value16) ((frac16)(((value16) + (1 << 15)) & ~0xFFFF))
+// Bounds of a local position
+#define GROUPCEL_POSITION_MIN (-32768)
+#define GROUPCEL_POSITION_MAX 32767
+#else
+typedef GroupCelListWide GroupCelList;
+// Dimension of an element
+#define GROUPCEL_ELEMENT_WIDTH(element) ((element)->cel->ccb_Width)
+#define GROUPCEL_ELEMENT_HEIGHT(element) ((element)->cel->ccb_Height)
+// Position of an element in 16.16
+#define GROUPCEL_ELEMENT_X16(element) ((element)->position.x)
+#define GROUPCEL_ELEMENT_Y16(element) ((element)->position.y)
+// 16.16 position as the element stores it
+#define GROUPCEL_POSITION_F16(value16) (value16)
+#endif
+// Dimension of an element in its frame: the full resolution of its LOD chain when it has one
+#define GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex) ((((groupCel)->lods != NULL) && ((groupCel)->lods[celIndex].levels != NULL)) ? (int32)(groupCel)->lods[celIndex].levels[0]->ccb_Width : (int32)GROUPCEL_ELEMENT_WIDTH(&(groupCel)->cels[celIndex]))
+#define GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex) ((((groupCel)->lods != NULL) && ((groupCel)->lods[celIndex].levels != NULL)) ? (int32)(groupCel)->lods[celIndex].levels[0]->ccb_Height : (int32)GROUPCEL_ELEMENT_HEIGHT(&(groupCel)->cels[celIndex]))
+
+typedef struct {
+    // Index of the CCB in the table of cels
+    uint32 celReference;
+    // Position
+    int32 positionX;
+    int32 positionY;
+} GroupCelElement;
+
+typedef struct {
+    // Block of CCB headers
+    CCB *ccbs;
+    // Total number of CCB headers
+    uint32 capacity;
+    // First free CCB header (chained by ccb_NextPtr)
+    CCB *freeList;
+    // Number of free CCB headers
+    uint32 freeCount;
+} GroupCelPool;
+
+typedef struct {
+    // Position in 16.16
+    Point2D position16;
+    // Transformations to apply (1 = yes)
+    int32 doStretch;
+    int32 doRotate;
+    // Inverse width/height in 16.16
+    int32 invW;
+    int32 invH;
+    // Corner A, vectors B and C, term D in 16.16
+    Point2D corner16;
+    Point2D vectorB16;
+    Point2D vectorC16;
+    Point2D delta16;
+    // Sine and cosine in 16.16
+    int32 sinus16;
+    int32 cosinus16;
+    // Pivot relative to the group in 16.16
+    Point2D rotationPivot16;
+} GroupCelTransform;
+
+typedef struct {
+    // Animation (NULL when the element isn't animated)
+    ANIM *anim;
+    // Index of the frame shown
+    int32 frameIndex;
+    // Duration of a frame, in the unit of the elapsed time
+    int32 frameDuration;
+    // Time elapsed in the current frame
+    int32 elapsed;
+} GroupCelAnimation;
+
+typedef struct {
+    // Pre-scaled Cels, the full resolution first (NULL without chain)
+    CCB **levels;
+    // Number of levels
+    uint32 levelsCount;
+    // Level shown
+    uint32 level;
+} GroupCelLod;
+
+typedef struct {
+    // Position of the camera in the scene
+    Point2D position;
+    // Zoom in 16.16 (GROUPCEL_ZOOM_ONE = no zoom)
+    frac16 zoom;
+    // Focal point of the zoom on screen
+    Point2D focus;
+} GroupCelCamera;
+
+typedef struct {
+    // Elements drawn before and after (GROUPCEL_ORDER_NONE at the ends)
+    int32 previous;
+    int32 next;
+    // Depth key, the greatest are drawn last
+    int32 depth;
+} GroupCelOrder;
+
+typedef struct {
+    // CCB drawn instead of the elements
+    CCB cel;
+    // Offscreen bitmap the elements are drawn into
+    Item bitmap;
+    // Pixels of the bitmap in video memory
+    void *buffer;
+    int32 bufferSize;
+    // Dimension of the bitmap
+    int32 width;
+    int32 height;
+    // Reciprocals of the dimension of the CCB
+    CelQuadMapReciprocals reciprocals;
+    // Bounds of the CCB in 16.16, for the dirty rectangles
+    Rectangle bounds;
+} GroupCelFlat;
 
 typedef struct {
     // Main CCB of the group
     CCB *cel;
     // Position
     Point2D position;
+    // Position in 16.16 (position holds its integer part)
+    Point2D position16;
     // Dimension
     Point2D size;
     // Stretch quadrilateral in pixels (local 0..x, 0..y)
@@ -150,12 +659,91 @@ typedef struct {
     uint32 rotationAngle;
     // -> Absolute pivot in pixels
     Point2D rotationPivot;
+    // Angle and pivot in 16.16 (rotationAngle and rotationPivot hold their integer parts)
+    frac16 rotationAngle16;
+    Point2D rotationPivot16;
     // Transformations to apply (move = bit-0, stretch = bit-1, rotate = bit-2)
     int32 transformations;  
     // Total number of cels
     uint32 celsCount;
     // Array of cels
     GroupCelList *cels;
+    // Block holding the elements' data when loaded from a bundle
+    void *data;
+    // Size of the block in bytes
+    int32 dataSize;
+    // Pool providing the CCB headers of an instance
+    GroupCelPool *pool;
+    // Grid (0 columns when the positions are stored per element)
+    uint32 gridColumns;
+    uint32 gridRows;
+    // Dimension of a tile
+    Point2D tileSize;
+    // Array of tiles, row by row
+    CCB **tiles;
+    // Two rows of lattice vertices shared by the tiles
+    Point2D *lattice;
+    // Animation states of the elements (NULL when none is animated)
+    GroupCelAnimation *animations;
+    // LOD chains of the elements (NULL when no element has one)
+    GroupCelLod *lods;
+    // Number of level swaps since the creation
+    uint32 lodSwaps;
+    // Reciprocals of the dimension of each element
+    CelQuadMapReciprocals *reciprocals;
+    // Reciprocals shared by the tiles of a grid
+    CelQuadMapReciprocals tileReciprocals;
+    // Last dimension of a tile seen by the shared reciprocals
+    Point2D tileDimension;
+    // Last quad committed by each element (NULL when the cache is disabled)
+    Quad2D *quads;
+    // Commits skipped and done by the quad cache
+    uint32 quadHits;
+    uint32 quadMisses;
+    // Transform epoch, changes each time a CCB of the group is written
+    uint32 epoch;
+    // Camera the group is seen through (NULL when none)
+    GroupCelCamera *camera;
+    // Offset of the camera already applied in the CCBs
+    Point2D cameraOffset;
+    // Offset scaled by the zoom already applied in the CCBs, in 16.16
+    Point2D cameraPan;
+    // Zoom and focal point of the camera already applied in the CCBs
+    frac16 cameraZoom;
+    Point2D cameraFocus;
+    // Last CCB of the group's chain
+    CCB *tail;
+    // CCB of the display list the group follows (NULL when not linked)
+    CCB *previous;
+    // Visibility (1 = the chain is in the display list)
+    int32 visible;
+    // Draw order of the elements (NULL when it follows the indexes)
+    GroupCelOrder *order;
+    // First and last elements of the draw order
+    int32 orderFirst;
+    int32 orderLast;
+    // Sort by depth at each update (1 = yes) and key changed since the last sort
+    int32 depthSort;
+    int32 depthChanged;
+    // Bounds of each element as written in its CCB in 16.16 (NULL when the occlusion pass is disabled)
+    Rectangle *bounds;
+    // Occlusion flags of each element
+    uint8 *occlusion;
+    // Opaque aligned elements in the draw order, listed by the pass
+    int32 *occluders;
+    // Epoch seen by the last pass, and a change of opacity or order since
+    uint32 occlusionEpoch;
+    int32 occlusionChanged;
+    // Number of elements hidden by the last pass
+    uint32 occludedCount;
+    // Pre-rendered CCB drawn instead of the elements (NULL when not flattened)
+    GroupCelFlat *flat;
+    // Accumulator of the dirty rectangles (NULL when not tracked)
+    GroupCelDirty *dirty;
+    // Bounds of each element as written in its CCB in 16.16, for the dirty rectangles
+    Rectangle *dirtyBounds;
+    // Screen bounds of each element in 16.16, kept by the update (NULL when not kept)
+    Rectangle *projections;
 } GroupCel;
 
 // Reference to the global context
@@ -167,30 +755,207 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
 int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel, uint32 positionX, uint32 positionY);
 // Configuration of multiple cels in a GroupCel
 int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...);
+// Configuration of multiple cels in a GroupCel from a table of descriptors
+int32 GroupCelElementsTableConfiguration(GroupCel *groupCel, const GroupCelElement *elements, uint32 elementsCount, CCB **cels, uint32 celsCount);
+// Initialization of a grid GroupCel
+GroupCel *GroupCelGridInitialization(int32 positionX, int32 positionY, uint32 columns, uint32 rows, uint32 tileSizeX, uint32 tileSizeY);
+// Configuration of a tile in a grid GroupCel
+int32 GroupCelGridTileConfiguration(GroupCel *groupCel, uint32 column, uint32 row, CCB *cel);
+// Configuration of all the tiles of a grid GroupCel
+int32 GroupCelGridTilesConfiguration(GroupCel *groupCel, CCB **cels, uint32 celsCount);
+// Creation of a GroupCel sharing the source data of a template
+GroupCel *GroupCelInstantiate(GroupCel *templateGroupCel, GroupCelPool *pool, int32 positionX, int32 positionY);
 
 // Moves the GroupCel
 void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY);
 // Sets the position of the GroupCel
 void GroupCelSetPosition(GroupCel *groupCel, int32 positionX, int32 positionY);
+// Sets the position of the GroupCel in 16.16
+void GroupCelSetPositionF16(GroupCel *groupCel, frac16 positionX16, frac16 positionY16);
 
 // Moves an element within the GroupCel
 void GroupCelElementMove(GroupCel *groupCel, int32 celIndex, int32 moveX, int32 moveY);
 // Sets the position of a cel in the GroupCel
 void GroupCelElementSetPosition(GroupCel *groupCel, int32 celIndex, int32 positionX, int32 positionY);
+// Sets the position of a cel within the GroupCel in 16.16
+void GroupCelElementSetPositionF16(GroupCel *groupCel, int32 celIndex, frac16 positionX16, frac16 positionY16);
+
+// Animation of an element of the GroupCel
+int32 GroupCelElementAnimation(GroupCel *groupCel, uint32 celIndex, ANIM *anim, int32 frameDuration);
+// Enables or disables the quad cache of the elements
+int32 GroupCelQuadCache(GroupCel *groupCel, int32 enable);
 
 // Stretches the group based on its 4 corner coordinates in pixels
 void GroupCelStretch(GroupCel *groupCel, int32 point1X, int32 point1Y, int32 point2X, int32 point2Y, int32 point3X, int32 point3Y, int32 point4X, int32 point4Y);
 // Rotates the group by an angle in 256 units
 void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY);
+// Rotates the group by an angle in 256 units in 16.16
+void GroupCelRotateF16(GroupCel *groupCel, frac16 angle16, frac16 pivotX16, frac16 pivotY16);
 
 // Updates elements within the GroupCel
 void GroupCelUpdate(GroupCel *groupCel);
+// Advances the animations and updates the elements inside the GroupCel
+void GroupCelUpdateElapsed(GroupCel *groupCel, int32 elapsed);
+// Recomputes only the elements whose dimension changed
+int32 GroupCelRevalidate(GroupCel *groupCel);
 // Applies the position to the Cel's CCB
 void GroupCelElementUpdatePosition(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Applies the transformations of the group to the Cel's CCB
+void GroupCelElementUpdateTransform(GroupCel *groupCel, int32 celIndex, GroupCelTransform *transform, Quad2D *quadMap);
 // Applies Stretch and Rotate transformations to the CCBs of the Cels
 void GroupCelUpdateTransformations(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap);
+// Detects a change of dimension of an element
+int32 GroupCelElementResized(GroupCel *groupCel, int32 celIndex);
+// Writes the projection of an element in its CCB
+void GroupCelElementCommit(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Advances the animation of an element
+int32 GroupCelElementAnimationAdvance(GroupCel *groupCel, uint32 celIndex, int32 elapsed);
+// Shows a frame of the animation in the element's CCB
+int32 GroupCelElementAnimationFrame(GroupCel *groupCel, uint32 celIndex, int32 frameIndex);
+// Chain of pre-scaled Cels of an element
+int32 GroupCelElementLod(GroupCel *groupCel, uint32 celIndex, CCB **levels, uint32 levelsCount);
+// Picks the level of an element from its projected quad
+int32 GroupCelElementLodSelect(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Shows a level of the chain in the element's CCB
+void GroupCelElementLodLevel(GroupCel *groupCel, int32 celIndex, uint32 level);
+// Length of an edge in 16.16
+frac16 GroupCelEdgeLength(Point2D *point0, Point2D *point1);
+
+// Applies the position and the transformations to the tiles of a grid
+void GroupCelGridUpdate(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap);
+// Prepares the transformation of the local points of the GroupCel
+void GroupCelTransformPreparation(GroupCel *groupCel, int32 doStretch, int32 doRotate, GroupCelTransform *transform);
+// Transforms a local point of the GroupCel into a screen point in 16.16
+void GroupCelTransformPoint(GroupCelTransform *transform, frac16 localX16, frac16 localY16, Point2D *point16);
+
+// Initialization of the frame of a GroupCel
+void GroupCelFrameInitialization(GroupCel *groupCel, int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY);
+// Is the frame of the GroupCel stretched
+int32 GroupCelIsStretched(GroupCel *groupCel);
+// Stores an element in the list (clamps the position in compact mode)
+void GroupCelElementStore(GroupCelList *element, CCB *cel, frac16 positionX16, frac16 positionY16);
+// Displays the memory used by the elements in both storage modes
+int32 GroupCelMemoryReport(GroupCel *groupCel);
+// Displays the hits of the quad cache
+int32 GroupCelQuadCacheReport(GroupCel *groupCel);
 
 // Deletes the GroupCel
 int32 GroupCelCleanup(GroupCel *groupCel);
 
+// Initialization of a pool of CCB headers
+GroupCelPool *GroupCelPoolInitialization(uint32 capacity);
+// Takes a CCB header from the pool
+CCB *GroupCelPoolAllocation(GroupCelPool *pool);
+// Gives a CCB header back to the pool
+void GroupCelPoolRelease(GroupCelPool *pool, CCB *cel);
+// Deletes the pool
+int32 GroupCelPoolCleanup(GroupCelPool *pool);
+
+// Initialization of a camera
+GroupCelCamera *GroupCelCameraInitialization(int32 positionX, int32 positionY);
+// Moves the camera
+void GroupCelCameraMove(GroupCelCamera *camera, int32 moveX, int32 moveY);
+// Sets the position of the camera
+void GroupCelCameraSetPosition(GroupCelCamera *camera, int32 positionX, int32 positionY);
+// Zooms the camera about a focal point
+void GroupCelCameraZoom(GroupCelCamera *camera, frac16 zoom, int32 focusX, int32 focusY);
+// Attaches a GroupCel to a camera
+int32 GroupCelSetCamera(GroupCel *groupCel, GroupCelCamera *camera);
+// Moves the CCBs of a GroupCel by the displacement of its camera
+void GroupCelCameraPan(GroupCel *groupCel);
+// Applies the camera of a GroupCel to a point in 16.16
+void GroupCelCameraPoint(GroupCel *groupCel, Point2D *point16);
+// Deletes the camera
+int32 GroupCelCameraCleanup(GroupCelCamera *camera);
+
+// Shows or hides a GroupCel in its display list
+int32 GroupCelSetVisible(GroupCel *groupCel, int32 visible);
+// Links a GroupCel after a CCB of a display list
+int32 GroupCelLinkAfter(GroupCel *groupCel, CCB *previous);
+// Takes a GroupCel out of its display list
+int32 GroupCelUnlink(GroupCel *groupCel);
+// Splices the chain of a GroupCel after its CCB
+int32 GroupCelSpliceIn(GroupCel *groupCel);
+// Splices the chain of a GroupCel out of the list
+int32 GroupCelSpliceOut(GroupCel *groupCel);
+// CCB rendered after a Cel
+CCB *GroupCelChainNext(CCB *cel);
+// Links a Cel to the next one or ends the list on it
+void GroupCelChainLink(CCB *cel, CCB *next);
+// Relinks a GroupCel in its display list after the ends of its chain changed
+void GroupCelChainRelink(GroupCel *groupCel, CCB *follower);
+
+// Draw order of the elements of a GroupCel
+int32 GroupCelDrawOrder(GroupCel *groupCel, int32 depthSort);
+// Depth key of an element
+int32 GroupCelElementSetDepth(GroupCel *groupCel, uint32 celIndex, int32 depth);
+// Draws an element above all the others
+int32 GroupCelBringToFront(GroupCel *groupCel, uint32 celIndex);
+// Draws an element below all the others
+int32 GroupCelSendToBack(GroupCel *groupCel, uint32 celIndex);
+// Draws an element just before another
+int32 GroupCelMoveBefore(GroupCel *groupCel, uint32 celIndex, uint32 beforeIndex);
+// Sorts the draw order by depth
+int32 GroupCelDrawOrderSort(GroupCel *groupCel);
+// Allocates the draw order from the order of the indexes
+int32 GroupCelDrawOrderAllocation(GroupCel *groupCel);
+// Checks that an element can be reordered
+int32 GroupCelDrawOrderCheck(GroupCel *groupCel, uint32 celIndex);
+// Takes an element out of the draw order
+void GroupCelDrawOrderRemove(GroupCel *groupCel, int32 celIndex, CCB *follower);
+// Inserts an element in the draw order before another one
+void GroupCelDrawOrderInsert(GroupCel *groupCel, int32 celIndex, int32 beforeIndex, CCB *follower);
+// Gives an element of the draw order a new CCB
+void GroupCelDrawOrderReplace(GroupCel *groupCel, int32 celIndex);
+// Links the CCB of an element to the next one in the draw order
+void GroupCelDrawOrderLink(GroupCel *groupCel, int32 celIndex, CCB *follower);
+// Updates the first and last CCB of a group from the draw order
+void GroupCelDrawOrderEnds(GroupCel *groupCel);
+// Deletes the draw order
+void GroupCelDrawOrderCleanup(GroupCel *groupCel);
+
+// Enables or disables the occlusion pass
+int32 GroupCelOcclusion(GroupCel *groupCel, int32 enable);
+// Tells if an element hides what is drawn behind it
+int32 GroupCelElementSetOpaque(GroupCel *groupCel, uint32 celIndex, int32 opaque);
+// Skips the elements covered by an opaque aligned element drawn after them
+void GroupCelOcclusionUpdate(GroupCel *groupCel);
+// Keeps the bounds of an element as written in its CCB
+void GroupCelOcclusionBounds(GroupCel *groupCel, int32 celIndex, Quad2D *viewQuad);
+// Tells if an aligned occluder covers every pixel an element can draw
+int32 GroupCelOcclusionCovers(Rectangle *occluder, Rectangle *element);
+// Shows an element hidden by the occlusion pass
+void GroupCelOcclusionShow(GroupCel *groupCel, int32 celIndex);
+// Deletes the occlusion pass
+void GroupCelOcclusionCleanup(GroupCel *groupCel);
+
+// Flattens the GroupCel into a single pre-rendered CCB
+int32 GroupCelFlatten(GroupCel *groupCel, int32 enable);
+// Tells a flattened GroupCel that its elements changed
+void GroupCelElementsChanged(GroupCel *groupCel);
+// First CCB drawn for the GroupCel
+CCB *GroupCelChainFirst(GroupCel *groupCel);
+// Last CCB drawn for the GroupCel
+CCB *GroupCelChainLast(GroupCel *groupCel);
+// Advances the animations and places the flattened CCB
+void GroupCelFlattenUpdate(GroupCel *groupCel, int32 elapsed, int32 doStretch, int32 doRotate);
+// Draws the elements into the offscreen bitmap
+int32 GroupCelFlattenRender(GroupCel *groupCel);
+// Deletes the flattened CCB
+int32 GroupCelFlattenCleanup(GroupCel *groupCel);
+
+// Gives the GroupCel the accumulator of the dirty rectangles
+int32 GroupCelSetDirty(GroupCel *groupCel, GroupCelDirty *dirty);
+// Reports the rectangles a CCB leaves and reaches
+void GroupCelDirtyQuad(GroupCel *groupCel, Rectangle *bounds16, Quad2D *viewQuad);
+// Reports the whole area of the GroupCel
+void GroupCelDirtyGroup(GroupCel *groupCel);
+// Reports the rectangles a CCB leaves and reaches when the camera pans
+void GroupCelDirtyPan(GroupCel *groupCel, Rectangle *bounds16, frac16 panX, frac16 panY);
+
+// Keeps the screen bounds of each element, filled by the update
+int32 GroupCelProjections(GroupCel *groupCel, int32 enable);
+// Smallest rectangle on screen holding the whole GroupCel
+int32 GroupCelProjectionBounds(GroupCel *groupCel, Rectangle *bounds);
+
 #endif // GROUPCEL_H
\ No newline at end of file
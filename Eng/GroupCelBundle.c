@@ -0,0 +1,326 @@
+
+#include "GroupCelBundle.h"
+
+// GroupCelLayoutInstantiate()
+#include "GroupCelLayout.h"
+// AllocMem(), FreeMem(), MEMTYPE_CEL
+#include "mem.h"
+// DeleteItem()
+#include "item.h"
+// printf()
+#include "stdio.h"
+
+// Reads a bundle and creates the GroupCel
+GroupCel *GroupCelBundleLoad(char *filename) {
+
+    // Stream reading the bundle
+    GroupCelBundleStream stream;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+    // State of the stream
+    int32 result = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleLoad()*\n"); }
+
+    // Reads the whole bundle in one sequential read
+    if (GroupCelBundleStreamStart(&stream, filename, 0) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelBundleStreamStart()\n");
+        return NULL;
+    }
+
+    // Waits for the end of the read
+    while ((result = GroupCelBundleStreamContinue(&stream, &groupCel)) == 0) {
+        WaitReadDoneBlockFile(stream.ioRequest);
+    }
+
+    // If it's a failure
+    if (result < 0) {
+        // Returns an error
+        printf("Error <- GroupCelBundleStreamContinue()\n");
+        return NULL;
+    }
+
+    // Returns the created GroupCel
+    return groupCel;
+}
+
+// Starts streaming a bundle in chunks
+int32 GroupCelBundleStreamStart(GroupCelBundleStream *stream, char *filename, int32 chunkSize) {
+
+    // Size of a block of the device
+    int32 blockSize = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamStart()*\n"); }
+
+    // If the parameters are unknown
+    if ((stream == NULL) || (filename == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel bundle unknown.\n");
+        return -1;
+    }
+
+    // Nothing allocated yet
+    stream->ioRequest = -1;
+    stream->data = NULL;
+    stream->offset = 0;
+
+    // Opens the file
+    if (OpenBlockFile(filename, &stream->file) < 0) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Size of the bundle rounded up to the device's blocks
+    stream->dataSize = GetBlockFileSize(&stream->file);
+    blockSize = GetBlockFileBlockSize(&stream->file);
+    stream->bufferSize = ((stream->dataSize + blockSize - 1) / blockSize) * blockSize;
+
+    // Corrects parameters
+    // Chunks are whole blocks, 0 reads the whole bundle at once
+    chunkSize = ((chunkSize + blockSize - 1) / blockSize) * blockSize;
+    stream->chunkSize = ((chunkSize <= 0) || (chunkSize > stream->bufferSize)) ? stream->bufferSize : chunkSize;
+
+    // Allocates a single block for the whole bundle
+    stream->data = (uint8 *)AllocMem(stream->bufferSize, MEMTYPE_CEL);
+    // If it's a failure
+    if (stream->data == NULL) {
+        GroupCelBundleStreamAbort(stream);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for %s.\n", filename);
+        return -1;
+    }
+
+    // Creates the I/O request
+    stream->ioRequest = CreateBlockFileIOReq(stream->file.fDevice, 0);
+    // If it's a failure
+    if (stream->ioRequest < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Displays an error message
+        printf("Error : Failed to create I/O request for %s.\n", filename);
+        return -1;
+    }
+
+    // Queues the first chunk
+    if (AsynchReadBlockFile(&stream->file, stream->ioRequest, stream->data, stream->chunkSize, 0) < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Displays an error message
+        printf("Error : Failed to read %s.\n", filename);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Polls the stream
+int32 GroupCelBundleStreamContinue(GroupCelBundleStream *stream, GroupCel **groupCel) {
+
+    // Size of the next chunk
+    int32 chunkSize = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamContinue()*\n"); }
+
+    // If the stream is unknown
+    if ((stream == NULL) || (stream->data == NULL) || (groupCel == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel bundle stream unknown.\n");
+        return -1;
+    }
+
+    // If the current chunk is still being read
+    if (ReadDoneBlockFile(stream->ioRequest) == 0) {
+        // Comes back later
+        return 0;
+    }
+
+    // If the read of the chunk failed
+    if (WaitReadDoneBlockFile(stream->ioRequest) < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Returns an error
+        printf("Error : Failed to read GroupCel bundle.\n");
+        return -1;
+    }
+
+    // Next chunk
+    stream->offset += stream->chunkSize;
+
+    // If there is something left to read
+    if (stream->offset < stream->bufferSize) {
+        // Queues the next chunk
+        chunkSize = stream->bufferSize - stream->offset;
+        chunkSize = (chunkSize < stream->chunkSize) ? chunkSize : stream->chunkSize;
+        if (AsynchReadBlockFile(&stream->file, stream->ioRequest, stream->data + stream->offset, chunkSize, stream->offset) < 0) {
+            GroupCelBundleStreamAbort(stream);
+            // Returns an error
+            printf("Error : Failed to read GroupCel bundle.\n");
+            return -1;
+        }
+        // Comes back later
+        return 0;
+    }
+
+    // Frees the I/O resources
+    DeleteItem(stream->ioRequest);
+    stream->ioRequest = -1;
+    CloseBlockFile(&stream->file);
+
+    // Creates the GroupCel, which now owns the block
+    *groupCel = GroupCelBundleInstantiate(stream->data, stream->dataSize, stream->bufferSize);
+    // If it's a failure
+    if (*groupCel == NULL) {
+        FreeMem(stream->data, stream->bufferSize);
+        stream->data = NULL;
+        // Returns an error
+        printf("Error <- GroupCelBundleInstantiate()\n");
+        return -1;
+    }
+    stream->data = NULL;
+
+    // Returns success
+    return 1;
+}
+
+// Stops a stream
+void GroupCelBundleStreamAbort(GroupCelBundleStream *stream) {
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamAbort()*\n"); }
+
+    // If the stream is unknown
+    if (stream == NULL) {
+        // Returns an error
+        printf("Error : GroupCel bundle stream unknown.\n");
+        return;
+    }
+
+    // If a request exists
+    if (stream->ioRequest >= 0) {
+        // Deleting the request aborts the pending read
+        DeleteItem(stream->ioRequest);
+        stream->ioRequest = -1;
+        CloseBlockFile(&stream->file);
+    }
+
+    // If the block exists
+    if (stream->data != NULL) {
+        FreeMem(stream->data, stream->bufferSize);
+        stream->data = NULL;
+    }
+}
+
+// Fixes up the CCBs of a bundle in memory and creates the GroupCel
+GroupCel *GroupCelBundleInstantiate(void *data, int32 dataSize, int32 bufferSize) {
+
+    // Header of the bundle
+    GroupCelBundleHeader *header = (GroupCelBundleHeader *)data;
+    // Table of CCB addresses
+    CCB **cels = NULL;
+    // Table of sizes
+    GroupCelBundleSizes *sizes = NULL;
+    // Current CCB
+    CCB *cel = NULL;
+    // Offsets of its pixel data and of its PLUT
+    uint32 pixelsOffset = 0;
+    uint32 plutOffset = 0;
+    // Index to iterate through CCBs
+    uint32 celIndex = 0;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleInstantiate()*\n"); }
+
+    // If the bundle is unknown or too small
+    if ((data == NULL) || (dataSize < (int32)sizeof(GroupCelBundleHeader))) {
+        // Returns an error
+        printf("Error : GroupCel bundle unknown.\n");
+        return NULL;
+    }
+
+    // If it's not a bundle of a known version
+    if ((header->magic != GROUPCEL_BUNDLE_MAGIC) || (header->version != GROUPCEL_BUNDLE_VERSION) || (header->dataSize > (uint32)dataSize)) {
+        // Returns an error
+        printf("Error : GroupCel bundle version unknown.\n");
+        return NULL;
+    }
+
+    // If the tables are not word aligned
+    if (((header->celsOffset | header->sizesOffset | header->referencesOffset | header->layoutOffset) & 3) != 0) {
+        // Returns an error
+        printf("Error : GroupCel bundle misaligned.\n");
+        return NULL;
+    }
+
+    // If the tables or the layout are outside the bundle
+    if ((GroupCelBundleInside(header->celsOffset, header->celsCount, GROUPCEL_BUNDLE_CCB_SIZE, header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->sizesOffset, header->celsCount, GROUPCEL_BUNDLE_SIZES_SIZE, header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->referencesOffset, header->celsCount, sizeof(CCB *), header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->layoutOffset, 1, header->layoutSize, header->dataSize) == 0)) {
+        // Returns an error
+        printf("Error : GroupCel bundle truncated.\n");
+        return NULL;
+    }
+
+    // Table of CCB addresses
+    cels = (CCB **)((uint8 *)data + header->referencesOffset);
+    // Table of sizes
+    sizes = (GroupCelBundleSizes *)((uint8 *)data + header->sizesOffset);
+
+    // Fixes up each CCB in place
+    for (celIndex = 0; celIndex < header->celsCount; celIndex++) {
+
+        cel = (CCB *)((uint8 *)data + header->celsOffset + celIndex * GROUPCEL_BUNDLE_CCB_SIZE);
+
+        pixelsOffset = (uint32)cel->ccb_SourcePtr;
+        plutOffset = (uint32)cel->ccb_PLUTPtr;
+
+        // If the pixel data or the PLUT of the Cel are empty or outside the bundle
+        if ((pixelsOffset == 0) || (sizes[celIndex].pixelsSize == 0) ||
+            (GroupCelBundleInside(pixelsOffset, 1, sizes[celIndex].pixelsSize, header->dataSize) == 0) ||
+            ((plutOffset != 0) && ((sizes[celIndex].plutSize == 0) || (GroupCelBundleInside(plutOffset, 1, sizes[celIndex].plutSize, header->dataSize) == 0)))) {
+            // Returns an error
+            printf("Error : GroupCel bundle Cel %u truncated.\n", celIndex);
+            return NULL;
+        }
+
+        // Offsets become absolute addresses in the block
+        cel->ccb_SourcePtr = (CelData *)((uint8 *)data + pixelsOffset);
+        cel->ccb_PLUTPtr = (plutOffset != 0) ? (void *)((uint8 *)data + plutOffset) : NULL;
+        cel->ccb_Flags |= CCB_SPABS | CCB_PPABS | CCB_NPABS | CCB_LAST;
+        // Without PLUT, nothing to load
+        if (cel->ccb_PLUTPtr == NULL) { cel->ccb_Flags &= ~CCB_LDPLUT; }
+        cel->ccb_NextPtr = NULL;
+
+        // Stores the address for the layout
+        cels[celIndex] = cel;
+    }
+
+    // Creates the GroupCel from the layout
+    groupCel = GroupCelLayoutInstantiate((uint8 *)data + header->layoutOffset, header->layoutSize, cels, header->celsCount);
+    // If it's a failure
+    if (groupCel == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelLayoutInstantiate()\n");
+        return NULL;
+    }
+
+    // The group owns the block: a single free at cleanup
+    groupCel->data = data;
+    groupCel->dataSize = bufferSize;
+
+    // Returns the created GroupCel
+    return groupCel;
+}
+
+// Tells if a range of items lies inside the bundle
+int32 GroupCelBundleInside(uint32 offset, uint32 count, uint32 itemSize, uint32 dataSize) {
+
+    // If the range starts after the end of the bundle
+    if (offset > dataSize) { return 0; }
+
+    // If the items don't fit in what is left, compared by division to never wrap
+    if ((itemSize != 0) && (count > (dataSize - offset) / itemSize)) { return 0; }
+
+    // The range lies inside
+    return 1;
+}
@@ -0,0 +1,154 @@
+#ifndef GROUPCEL_BUNDLE_H
+#define GROUPCEL_BUNDLE_H
+
+/******************************************************************************
+**
+**  GroupCelBundle - Packed assets of a GroupCel
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  This module packs the CCBs, PLUTs and pixel data of all the elements of a
+**  GroupCel, together with its layout, in a single file.
+**
+**  The bundle is loaded in a single allocation, either with one sequential
+**  read or streamed asynchronously in chunks. The CCBs are fixed up in place
+**  to point into that block, so the GroupCel and all its elements are freed
+**  at once by GroupCelCleanup().
+**
+**  Important notes:
+**
+**    - All the words of the bundle are stored in big-endian, the native order
+**      of the 3DO. Each CCB is stored as the 17 words of the CCB structure,
+**      where ccb_SourcePtr and ccb_PLUTPtr hold offsets from the start of the
+**      bundle (0 for no PLUT).
+**
+**    - The size of the pixel data and of the PLUT of each Cel is stored next to
+**      its CCB. The loader checks that each range lies inside the bundle before
+**      fixing up the pointers, so a corrupted file is rejected instead of
+**      pointing the cel engine outside the block.
+**
+**    - The layout is a GroupCelLayout whose cel references are indexes in the
+**      table of CCBs of the bundle.
+**
+**    - The bundle reserves one 32-bit slot per cel, filled by the loader with
+**      the address of the CCB. The layout is instantiated from this table.
+**
+**    - The elements belong to the bundle: they must not be unloaded separately.
+**
+**    - The host tool writes the bundle with GroupCelBundleWrite(), declared in
+**      GroupCelBundleWriter.h. This header needs the SDK, that one doesn't: they
+**      share only GroupCelBundleFormat.h.
+**
+**  File format :
+**
+**    GroupCelBundleHeader
+**      - magic : 'GCBD'
+**      - version : Version of the format
+**      - dataSize : Size of the bundle in bytes
+**      - celsCount : Number of CCBs
+**      - celsOffset : Offset of the table of CCBs
+**      - sizesOffset : Offset of the table of sizes
+**      - referencesOffset : Offset of the table of CCB addresses
+**      - layoutOffset : Offset of the GroupCelLayout
+**      - layoutSize : Size of the GroupCelLayout in bytes
+**
+**    CCB[celsCount] - 17 words each
+**    GroupCelBundleSizes[celsCount] - pixel data and PLUT sizes in bytes
+**    Addresses[celsCount] - 32-bit slots filled on load
+**    GroupCelLayout
+**    PLUTs and pixel data, word aligned
+**
+**  Main Functions :
+**
+**    GroupCelBundleLoad()
+**      -> Reads a bundle with one sequential read and creates the GroupCel.
+**
+**    GroupCelBundleStreamStart()
+**      -> Starts streaming a bundle asynchronously in chunks.
+**
+**    GroupCelBundleStreamContinue()
+**      -> Polls the stream, queues the next chunk and creates the GroupCel at the end.
+**
+**    GroupCelBundleStreamAbort()
+**      -> Stops a stream and frees its resources.
+**
+**    GroupCelBundleInstantiate()
+**      -> Fixes up the CCBs of a bundle in memory and creates the GroupCel.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// BlockFile
+#include "blockfile.h"
+// int32
+#include "types.h"
+// GROUPCEL_BUNDLE_MAGIC, GROUPCEL_BUNDLE_VERSION, GROUPCEL_BUNDLE_CCB_SIZE, GROUPCEL_BUNDLE_SIZES_SIZE
+#include "GroupCelBundleFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_BUNDLE 0
+
+typedef struct {
+    // Identifier of the file
+    uint32 magic;
+    // Version of the format
+    uint32 version;
+    // Size of the bundle in bytes
+    uint32 dataSize;
+    // Number of CCBs
+    uint32 celsCount;
+    // Offset of the table of CCBs
+    uint32 celsOffset;
+    // Offset of the table of sizes
+    uint32 sizesOffset;
+    // Offset of the table of CCB addresses
+    uint32 referencesOffset;
+    // Offset and size of the layout
+    uint32 layoutOffset;
+    uint32 layoutSize;
+} GroupCelBundleHeader;
+
+typedef struct {
+    // Size of the pixel data in bytes
+    uint32 pixelsSize;
+    // Size of the PLUT in bytes (0 for no PLUT)
+    uint32 plutSize;
+} GroupCelBundleSizes;
+
+typedef struct {
+    // File
+    BlockFile file;
+    // I/O request
+    Item ioRequest;
+    // Block receiving the bundle
+    uint8 *data;
+    // Size of the bundle in bytes
+    int32 dataSize;
+    // Size of the block, rounded up to the device's blocks
+    int32 bufferSize;
+    // Size of a chunk, multiple of the device's blocks
+    int32 chunkSize;
+    // Offset of the chunk being read
+    int32 offset;
+} GroupCelBundleStream;
+
+// Reads a bundle and creates the GroupCel
+GroupCel *GroupCelBundleLoad(char *filename);
+
+// Starts streaming a bundle in chunks (0 = whole bundle in one read)
+int32 GroupCelBundleStreamStart(GroupCelBundleStream *stream, char *filename, int32 chunkSize);
+// Polls the stream (returns 0 while reading, 1 once the GroupCel is created, -1 on error)
+int32 GroupCelBundleStreamContinue(GroupCelBundleStream *stream, GroupCel **groupCel);
+// Stops a stream
+void GroupCelBundleStreamAbort(GroupCelBundleStream *stream);
+
+// Fixes up the CCBs of a bundle in memory and creates the GroupCel
+GroupCel *GroupCelBundleInstantiate(void *data, int32 dataSize, int32 bufferSize);
+// Tells if a range of items lies inside the bundle
+int32 GroupCelBundleInside(uint32 offset, uint32 count, uint32 itemSize, uint32 dataSize);
+
+#endif // GROUPCEL_BUNDLE_H
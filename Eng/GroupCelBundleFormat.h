@@ -0,0 +1,28 @@
+#ifndef GROUPCEL_BUNDLE_FORMAT_H
+#define GROUPCEL_BUNDLE_FORMAT_H
+
+/******************************************************************************
+**
+**  GroupCelBundleFormat - Identifiers and sizes of the GroupCel bundle file
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The loader (GroupCelBundle.h) and the host writer (GroupCelBundleWriter.h)
+**  both include this header. It includes nothing, so the host tool doesn't
+**  need the headers of the SDK to agree with the loader.
+**
+******************************************************************************/
+
+// Identifier of the file ('GCBD')
+#define GROUPCEL_BUNDLE_MAGIC 0x47434244
+// Version of the format
+#define GROUPCEL_BUNDLE_VERSION 2
+// Size of the header in the bundle (9 words)
+#define GROUPCEL_BUNDLE_HEADER_SIZE (9 * 4)
+// Size of a CCB in the bundle (17 words)
+#define GROUPCEL_BUNDLE_CCB_SIZE (17 * 4)
+// Size of the sizes of a Cel in the bundle (2 words)
+#define GROUPCEL_BUNDLE_SIZES_SIZE (2 * 4)
+
+#endif // GROUPCEL_BUNDLE_FORMAT_H
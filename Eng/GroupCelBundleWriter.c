@@ -0,0 +1,279 @@
+
+#include "GroupCelBundleWriter.h"
+
+// fopen(), fread(), fwrite(), printf()
+#include "stdio.h"
+// malloc(), free()
+#include "stdlib.h"
+// memset()
+#include "string.h"
+
+// Chunks of a Cel file
+#define GROUPCEL_BUNDLE_CHUNK_CCB 0x43434220
+#define GROUPCEL_BUNDLE_CHUNK_PLUT 0x504C5554
+#define GROUPCEL_BUNDLE_CHUNK_PDAT 0x50444154
+
+typedef struct {
+    // Content of the Cel file
+    unsigned char *file;
+    long fileSize;
+    // 17 words of the CCB
+    uint32_t ccb[17];
+    // PLUT in the file
+    unsigned char *plut;
+    uint32_t plutSize;
+    uint32_t plutOffset;
+    // Pixel data in the file
+    unsigned char *pixels;
+    uint32_t pixelsSize;
+    uint32_t pixelsOffset;
+} GroupCelBundleSource;
+
+// Reads a big-endian word
+static uint32_t GroupCelBundleReadWord(unsigned char *bytes) {
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+// Writes a word in big-endian
+static int32_t GroupCelBundleWriteWord(FILE *file, uint32_t word) {
+
+    // Bytes of the word
+    unsigned char bytes[4];
+
+    // Most significant byte first
+    bytes[0] = (unsigned char)(word >> 24);
+    bytes[1] = (unsigned char)(word >> 16);
+    bytes[2] = (unsigned char)(word >> 8);
+    bytes[3] = (unsigned char)word;
+
+    // Returns 1 on success, 0 otherwise
+    return (fwrite(bytes, 1, 4, file) == 4) ? 1 : 0;
+}
+
+// Writes bytes padded to the next word
+static int32_t GroupCelBundleWriteBytes(FILE *file, const unsigned char *bytes, uint32_t size) {
+
+    // Padding
+    unsigned char padding[4] = {0};
+
+    // Bytes then padding
+    if ((size > 0) && (fwrite(bytes, 1, size, file) != size)) { return 0; }
+    if ((size & 3) && (fwrite(padding, 1, 4 - (size & 3), file) != 4 - (size & 3))) { return 0; }
+
+    // Returns success
+    return 1;
+}
+
+// Reads a Cel file and finds its chunks
+static int32_t GroupCelBundleReadCel(char *filename, GroupCelBundleSource *source) {
+
+    // File
+    FILE *file = NULL;
+    // Current chunk
+    long offset = 0;
+    uint32_t chunkType = 0;
+    uint32_t chunkSize = 0;
+    // Index to iterate through the CCB words
+    uint32_t wordIndex = 0;
+
+    // Opens the file
+    file = fopen(filename, "rb");
+    // If it's a failure
+    if (file == NULL) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Reads the whole file
+    fseek(file, 0, SEEK_END);
+    source->fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    source->file = (unsigned char *)malloc((size_t)source->fileSize);
+    if ((source->file == NULL) || (fread(source->file, 1, (size_t)source->fileSize, file) != (size_t)source->fileSize)) {
+        fclose(file);
+        // Returns an error
+        printf("Error : Failed to read %s.\n", filename);
+        return -1;
+    }
+    fclose(file);
+
+    // Walks through the chunks
+    while (offset + 8 <= source->fileSize) {
+
+        chunkType = GroupCelBundleReadWord(source->file + offset);
+        chunkSize = GroupCelBundleReadWord(source->file + offset + 4);
+
+        // If the chunk is truncated
+        if ((chunkSize < 8) || (offset + (long)chunkSize > source->fileSize)) {
+            // Returns an error
+            printf("Error : Cel file %s truncated.\n", filename);
+            return -1;
+        }
+
+        switch (chunkType) {
+            // Identifier, size, version then the 17 words of the CCB
+            case GROUPCEL_BUNDLE_CHUNK_CCB:
+                if (chunkSize < 12 + 17 * 4) { break; }
+                for (wordIndex = 0; wordIndex < 17; wordIndex++) {
+                    source->ccb[wordIndex] = GroupCelBundleReadWord(source->file + offset + 12 + wordIndex * 4);
+                }
+                break;
+            // Identifier, size, number of entries then the entries
+            case GROUPCEL_BUNDLE_CHUNK_PLUT:
+                if (chunkSize < 12) { break; }
+                source->plut = source->file + offset + 12;
+                source->plutSize = chunkSize - 12;
+                break;
+            // Identifier, size then the pixels
+            case GROUPCEL_BUNDLE_CHUNK_PDAT:
+                source->pixels = source->file + offset + 8;
+                source->pixelsSize = chunkSize - 8;
+                break;
+            // Other chunks are ignored
+            default:
+                break;
+        }
+
+        // Next chunk
+        offset += (long)chunkSize;
+    }
+
+    // If the Cel is incomplete
+    if ((source->ccb[15] == 0) || (source->pixels == NULL) || (source->pixelsSize == 0)) {
+        // Returns an error
+        printf("Error : Cel file %s has no CCB or pixels.\n", filename);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Writes a bundle (host)
+int32_t GroupCelBundleWrite(const char *filename, char **celFilenames, uint32_t celsCount, const void *layout, uint32_t layoutSize) {
+
+    // Cels to pack
+    GroupCelBundleSource *sources = NULL;
+    // Offsets in the bundle
+    uint32_t celsOffset = 0;
+    uint32_t sizesOffset = 0;
+    uint32_t referencesOffset = 0;
+    uint32_t layoutOffset = 0;
+    uint32_t dataSize = 0;
+    // Index to iterate through Cels and words
+    uint32_t celIndex = 0;
+    uint32_t wordIndex = 0;
+    // File
+    FILE *file = NULL;
+    // Result of the writes
+    int32_t written = 1;
+
+    if (DEBUG_GROUPCEL_BUNDLE_WRITER == 1) { printf("*GroupCelBundleWrite()*\n"); }
+
+    // If the parameters are unknown
+    if ((filename == NULL) || (celFilenames == NULL) || (celsCount == 0) || (layout == NULL) || (layoutSize == 0)) {
+        // Returns an error
+        printf("Error : GroupCel bundle unknown.\n");
+        return -1;
+    }
+
+    // Reads all the Cels
+    sources = (GroupCelBundleSource *)malloc(celsCount * sizeof(GroupCelBundleSource));
+    if (sources == NULL) {
+        // Returns an error
+        printf("Error : Failed to allocate memory for GroupCel bundle.\n");
+        return -1;
+    }
+    memset(sources, 0, celsCount * sizeof(GroupCelBundleSource));
+    for (celIndex = 0; celIndex < celsCount; celIndex++) {
+        if (GroupCelBundleReadCel(celFilenames[celIndex], &sources[celIndex]) < 0) {
+            written = 0;
+            break;
+        }
+    }
+
+    // Places the tables, the layout then the data of each Cel, word aligned
+    if (written == 1) {
+        celsOffset = GROUPCEL_BUNDLE_HEADER_SIZE;
+        sizesOffset = celsOffset + celsCount * GROUPCEL_BUNDLE_CCB_SIZE;
+        referencesOffset = sizesOffset + celsCount * GROUPCEL_BUNDLE_SIZES_SIZE;
+        layoutOffset = referencesOffset + celsCount * 4;
+        dataSize = layoutOffset + ((layoutSize + 3) & ~3);
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            sources[celIndex].plutOffset = (sources[celIndex].plutSize != 0) ? dataSize : 0;
+            dataSize += (sources[celIndex].plutSize + 3) & ~3;
+            sources[celIndex].pixelsOffset = dataSize;
+            dataSize += (sources[celIndex].pixelsSize + 3) & ~3;
+        }
+        file = fopen(filename, "wb");
+        if (file == NULL) {
+            printf("Error : Failed to open %s.\n", filename);
+            written = 0;
+        }
+    }
+
+    // Writes the bundle
+    if (written == 1) {
+
+        // Header
+        written &= GroupCelBundleWriteWord(file, GROUPCEL_BUNDLE_MAGIC);
+        written &= GroupCelBundleWriteWord(file, GROUPCEL_BUNDLE_VERSION);
+        written &= GroupCelBundleWriteWord(file, dataSize);
+        written &= GroupCelBundleWriteWord(file, celsCount);
+        written &= GroupCelBundleWriteWord(file, celsOffset);
+        written &= GroupCelBundleWriteWord(file, sizesOffset);
+        written &= GroupCelBundleWriteWord(file, referencesOffset);
+        written &= GroupCelBundleWriteWord(file, layoutOffset);
+        written &= GroupCelBundleWriteWord(file, layoutSize);
+
+        // CCBs, the source and PLUT pointers hold offsets in the bundle
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            sources[celIndex].ccb[1] = 0;
+            sources[celIndex].ccb[2] = sources[celIndex].pixelsOffset;
+            sources[celIndex].ccb[3] = sources[celIndex].plutOffset;
+            for (wordIndex = 0; wordIndex < 17; wordIndex++) {
+                written &= GroupCelBundleWriteWord(file, sources[celIndex].ccb[wordIndex]);
+            }
+        }
+
+        // Sizes of the pixel data and of the PLUT, checked by the loader
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteWord(file, sources[celIndex].pixelsSize);
+            written &= GroupCelBundleWriteWord(file, sources[celIndex].plutSize);
+        }
+
+        // Slots of the CCB addresses
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteWord(file, 0);
+        }
+
+        // Layout
+        written &= GroupCelBundleWriteBytes(file, (const unsigned char *)layout, layoutSize);
+
+        // PLUT and pixels of each Cel
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteBytes(file, sources[celIndex].plut, sources[celIndex].plutSize);
+            written &= GroupCelBundleWriteBytes(file, sources[celIndex].pixels, sources[celIndex].pixelsSize);
+        }
+
+        // Closes the file
+        if (fclose(file) != 0) { written = 0; }
+    }
+
+    // Frees the Cel files
+    for (celIndex = 0; celIndex < celsCount; celIndex++) {
+        if (sources[celIndex].file != NULL) { free(sources[celIndex].file); }
+    }
+    free(sources);
+
+    // If a step failed
+    if (written == 0) {
+        // Returns an error
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
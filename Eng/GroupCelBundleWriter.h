@@ -0,0 +1,34 @@
+#ifndef GROUPCEL_BUNDLE_WRITER_H
+#define GROUPCEL_BUNDLE_WRITER_H
+
+/******************************************************************************
+**
+**  GroupCelBundleWriter - Writer of GroupCel bundles (host)
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The host tool includes this header instead of GroupCelBundle.h. It only
+**  needs the standard C library: the sizes and offsets use its own
+**  fixed-width types, and each word is written byte by byte in big-endian,
+**  whatever the order of the host.
+**
+**  Main Functions :
+**
+**    GroupCelBundleWrite()
+**      -> Writes a bundle from Cel files and a layout file already in memory.
+**
+******************************************************************************/
+
+// int32_t, uint32_t
+#include "stdint.h"
+// GROUPCEL_BUNDLE_MAGIC, GROUPCEL_BUNDLE_VERSION, GROUPCEL_BUNDLE_HEADER_SIZE, GROUPCEL_BUNDLE_CCB_SIZE, GROUPCEL_BUNDLE_SIZES_SIZE
+#include "GroupCelBundleFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_BUNDLE_WRITER 0
+
+// Writes a bundle
+int32_t GroupCelBundleWrite(const char *filename, char **celFilenames, uint32_t celsCount, const void *layout, uint32_t layoutSize);
+
+#endif // GROUPCEL_BUNDLE_WRITER_H
@@ -0,0 +1,501 @@
+
+#include "GroupCelCollision.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// MulSF16(), Convert32_F16()
+#include "operamath.h"
+// printf()
+#include "stdio.h"
+
+// Initialization of the module
+GroupCelCollision *GroupCelCollisionInitialization(uint32 capacity) {
+
+    // Module
+    GroupCelCollision *collision = NULL;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionInitialization()*\n"); }
+
+    // Corrects parameters
+    // Minimum = 2 groups
+    capacity = (capacity > 2) ? capacity : 2;
+
+    // Allocates memory for the module
+    collision = (GroupCelCollision *)AllocMem(sizeof(GroupCelCollision), MEMTYPE_DRAM);
+    // If it's a failure
+    if (collision == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCelCollision.\n");
+        return NULL;
+    }
+
+    // Allocates memory for the entries and their order
+    collision->entries = (GroupCelCollisionEntry *)AllocMem(capacity * sizeof(GroupCelCollisionEntry), MEMTYPE_DRAM);
+    collision->order = (uint32 *)AllocMem(capacity * sizeof(uint32), MEMTYPE_DRAM);
+    // If it's a failure
+    if ((collision->entries == NULL) || (collision->order == NULL)) {
+        // Frees previously allocated memory
+        if (collision->entries != NULL) { FreeMem(collision->entries, capacity * sizeof(GroupCelCollisionEntry)); }
+        if (collision->order != NULL) { FreeMem(collision->order, capacity * sizeof(uint32)); }
+        FreeMem(collision, sizeof(GroupCelCollision));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCelCollision entries.\n");
+        return NULL;
+    }
+    collision->capacity = capacity;
+
+    // No group registered yet
+    collision->entriesCount = 0;
+    collision->candidatesCount = 0;
+    collision->hitsCount = 0;
+
+    // Returns the created module
+    return collision;
+}
+
+// Registers a GroupCel
+int32 GroupCelCollisionAdd(GroupCelCollision *collision, GroupCel *groupCel, uint32 mask) {
+
+    // Entry of the group
+    GroupCelCollisionEntry *entry = NULL;
+    // Index to iterate through entries
+    uint32 entryIndex = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionAdd()*\n"); }
+
+    // If the module or the group is unknown
+    if ((collision == NULL) || (groupCel == NULL)) {
+        // Returns an error
+        printf("Error : GroupCelCollision or GroupCel unknown.\n");
+        return -1;
+    }
+
+    // If the group is already registered
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        if (collision->entries[entryIndex].groupCel == groupCel) {
+            // Only its mask changes
+            collision->entries[entryIndex].mask = mask;
+            return 1;
+        }
+    }
+
+    // If there is no entry left
+    if (collision->entriesCount >= collision->capacity) {
+        // Returns an error
+        printf("Error : GroupCelCollision full (%u groups).\n", collision->capacity);
+        return -1;
+    }
+
+    // Fills the entry, its quad is taken at the next query
+    entry = &collision->entries[collision->entriesCount];
+    entry->groupCel = groupCel;
+    entry->mask = mask;
+    entry->epoch = groupCel->epoch + 1;
+
+    // The new entry goes at the end of the order, the next sort places it
+    collision->order[collision->entriesCount] = collision->entriesCount;
+    collision->entriesCount++;
+
+    // Returns success
+    return 1;
+}
+
+// Takes a GroupCel out
+int32 GroupCelCollisionRemove(GroupCelCollision *collision, GroupCel *groupCel) {
+
+    // Index of the entry of the group and of the last entry
+    uint32 removedIndex = 0;
+    uint32 lastIndex = 0;
+    // Index to iterate through the order
+    uint32 orderIndex = 0;
+    uint32 keptCount = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionRemove()*\n"); }
+
+    // If the module or the group is unknown
+    if ((collision == NULL) || (groupCel == NULL)) {
+        // Returns an error
+        printf("Error : GroupCelCollision or GroupCel unknown.\n");
+        return -1;
+    }
+
+    // Finds the entry of the group
+    for (removedIndex = 0; removedIndex < collision->entriesCount; removedIndex++) {
+        if (collision->entries[removedIndex].groupCel == groupCel) { break; }
+    }
+    // If the group isn't registered
+    if (removedIndex == collision->entriesCount) {
+        // Returns an error
+        printf("Error : GroupCel not registered in GroupCelCollision.\n");
+        return -1;
+    }
+
+    // The last entry takes its place
+    lastIndex = collision->entriesCount - 1;
+    collision->entries[removedIndex] = collision->entries[lastIndex];
+    collision->entriesCount--;
+
+    // The order keeps its sort: the removed entry leaves it and the last one is renamed
+    for (orderIndex = 0; orderIndex <= lastIndex; orderIndex++) {
+        if (collision->order[orderIndex] == removedIndex) { continue; }
+        collision->order[keptCount] = (collision->order[orderIndex] == lastIndex) ? removedIndex : collision->order[orderIndex];
+        keptCount++;
+    }
+
+    // Returns success
+    return 1;
+}
+
+// Calls a function for each pair of groups overlapping
+int32 GroupCelCollisionQuery(GroupCelCollision *collision, GroupCelCollisionHit hit, void *context) {
+
+    // Index to iterate through entries
+    uint32 entryIndex = 0;
+    // Indexes in the order of the sweep
+    uint32 orderIndex = 0;
+    uint32 nextIndex = 0;
+    // Entries compared
+    GroupCelCollisionEntry *entry1 = NULL;
+    GroupCelCollisionEntry *entry2 = NULL;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionQuery()*\n"); }
+
+    // If the module is unknown
+    if (collision == NULL) {
+        // Returns an error
+        printf("Error : GroupCelCollision unknown.\n");
+        return -1;
+    }
+
+    // Takes again the quads of the groups whose placement changed
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        entry1 = &collision->entries[entryIndex];
+        if (entry1->epoch == entry1->groupCel->epoch) { continue; }
+        GroupCelCollisionGroupQuad(entry1->groupCel, &entry1->quad);
+        Quad2DBounds(&entry1->quad, &entry1->bounds);
+        entry1->epoch = entry1->groupCel->epoch;
+    }
+
+    // Sorts the entries by the left edge of their bounds, nearly sorted since the last query
+    GroupCelCollisionSort(collision);
+
+    // Sweeps the entries from left to right
+    collision->candidatesCount = 0;
+    collision->hitsCount = 0;
+    for (orderIndex = 0; orderIndex < collision->entriesCount; orderIndex++) {
+        entry1 = &collision->entries[collision->order[orderIndex]];
+        // Only the next entries starting before the right edge can overlap it
+        for (nextIndex = orderIndex + 1; nextIndex < collision->entriesCount; nextIndex++) {
+            entry2 = &collision->entries[collision->order[nextIndex]];
+            if (entry2->bounds.topLeft.x > entry1->bounds.bottomRight.x) { break; }
+            // If the groups don't share a layer
+            if ((entry1->mask & entry2->mask) == 0) { continue; }
+            // If the bounds don't overlap vertically
+            if ((entry2->bounds.topLeft.y > entry1->bounds.bottomRight.y) || (entry1->bounds.topLeft.y > entry2->bounds.bottomRight.y)) { continue; }
+            collision->candidatesCount++;
+            // If the quads overlap
+            if (GroupCelCollisionQuads(&entry1->quad, &entry2->quad) == 1) {
+                collision->hitsCount++;
+                if (hit != NULL) { hit(context, entry1->groupCel, entry2->groupCel); }
+            }
+        }
+    }
+
+    // Returns the number of pairs overlapping
+    return (int32)collision->hitsCount;
+}
+
+// Tests two groups
+int32 GroupCelCollisionGroups(GroupCel *groupCel1, GroupCel *groupCel2) {
+
+    // Quads of the groups
+    Quad2D quad1;
+    Quad2D quad2;
+
+    // If a group is unknown
+    if ((groupCel1 == NULL) || (groupCel2 == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    // Tests the quads of the groups
+    GroupCelCollisionGroupQuad(groupCel1, &quad1);
+    GroupCelCollisionGroupQuad(groupCel2, &quad2);
+
+    // Returns 1 if the groups overlap, 0 otherwise
+    return GroupCelCollisionQuads(&quad1, &quad2);
+}
+
+// Calls a function for each pair of elements overlapping
+int32 GroupCelCollisionElements(GroupCel *groupCel1, GroupCel *groupCel2, GroupCelCollisionElementHit hit, void *context) {
+
+    // Indexes to iterate through the CCBs of the groups
+    uint32 celIndex1 = 0;
+    uint32 celIndex2 = 0;
+    // Number of CCBs of the groups
+    uint32 celsCount1 = 0;
+    uint32 celsCount2 = 0;
+    // CCBs of the two groups
+    CCB *cel1 = NULL;
+    CCB *cel2 = NULL;
+    // Quad and bounds of a CCB of the first group
+    Quad2D quad1;
+    Rectangle bounds1;
+    // Quad and bounds of a CCB of the second group
+    Quad2D quad2;
+    Rectangle bounds2;
+    // Number of pairs overlapping
+    int32 hitsCount = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionElements()*\n"); }
+
+    // If a group is unknown
+    if ((groupCel1 == NULL) || (groupCel2 == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return -1;
+    }
+
+    celsCount1 = GroupCelCollisionCelsCount(groupCel1);
+    celsCount2 = GroupCelCollisionCelsCount(groupCel2);
+
+    // Each CCB of the first group
+    for (celIndex1 = 0; celIndex1 < celsCount1; celIndex1++) {
+        cel1 = GroupCelCollisionCel(groupCel1, celIndex1);
+        if (cel1 == NULL) { continue; }
+        CelProjectionQuad(cel1, &quad1);
+        Quad2DBounds(&quad1, &bounds1);
+        // Against each CCB of the second group
+        for (celIndex2 = 0; celIndex2 < celsCount2; celIndex2++) {
+            cel2 = GroupCelCollisionCel(groupCel2, celIndex2);
+            if (cel2 == NULL) { continue; }
+            CelProjectionQuad(cel2, &quad2);
+            Quad2DBounds(&quad2, &bounds2);
+            // The bounds reject most pairs before the separating axes
+            if (RectanglesIntersection(&bounds1, &bounds2) == 0) { continue; }
+            if (GroupCelCollisionQuads(&quad1, &quad2) == 0) { continue; }
+            hitsCount++;
+            if (hit != NULL) { hit(context, (groupCel1->flat != NULL) ? GROUPCEL_COLLISION_FLAT : (int32)celIndex1, (groupCel2->flat != NULL) ? GROUPCEL_COLLISION_FLAT : (int32)celIndex2); }
+        }
+    }
+
+    // Returns the number of pairs overlapping
+    return hitsCount;
+}
+
+// Displays the pairs tested and found by the last query
+int32 GroupCelCollisionReport(GroupCelCollision *collision) {
+
+    // Index to iterate through entries
+    uint32 entryIndex = 0;
+    // Entry displayed
+    GroupCelCollisionEntry *entry = NULL;
+    // Number of pairs of groups
+    uint32 pairsCount = 0;
+
+    // If the module is unknown
+    if (collision == NULL) {
+        // Returns an error
+        printf("Error : GroupCelCollision unknown.\n");
+        return -1;
+    }
+
+    // Displays the totals
+    pairsCount = (collision->entriesCount * (collision->entriesCount - 1)) / 2;
+    if (collision->entriesCount == 0) { pairsCount = 0; }
+    printf("GroupCelCollision : %u groups, %u pairs, %u kept by the sweep, %u overlapping\n", collision->entriesCount, pairsCount, collision->candidatesCount, collision->hitsCount);
+
+    // Displays the groups in the order of the sweep
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        entry = &collision->entries[collision->order[entryIndex]];
+        printf("  %u mask %08x : %d,%d -> %d,%d\n", collision->order[entryIndex], entry->mask, entry->bounds.topLeft.x >> 16, entry->bounds.topLeft.y >> 16, entry->bounds.bottomRight.x >> 16, entry->bounds.bottomRight.y >> 16);
+    }
+
+    // Returns the number of pairs overlapping
+    return (int32)collision->hitsCount;
+}
+
+// Deletes the module
+int32 GroupCelCollisionCleanup(GroupCelCollision *collision) {
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionCleanup()*\n"); }
+
+    // If the module is unknown
+    if (collision == NULL) {
+        // Returns an error
+        printf("Error : GroupCelCollision unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used for the entries, their order and the module
+    FreeMem(collision->entries, collision->capacity * sizeof(GroupCelCollisionEntry));
+    FreeMem(collision->order, collision->capacity * sizeof(uint32));
+    FreeMem(collision, sizeof(GroupCelCollision));
+
+    // Returns success
+    return 1;
+}
+
+// Quad holding the elements of a group, on screen in 16.16
+void GroupCelCollisionGroupQuad(GroupCel *groupCel, Quad2D *quad) {
+
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Rectangle holding the elements in the group, in 16.16
+    frac16 left = 0;
+    frac16 top = 0;
+    frac16 right = 0;
+    frac16 bottom = 0;
+    // Corners of an element in 16.16
+    frac16 elementLeft = 0;
+    frac16 elementTop = 0;
+    // Number of elements held
+    uint32 heldCount = 0;
+    // Transformation of the group
+    GroupCelTransform transform;
+
+    // If it's a grid
+    if (groupCel->cels == NULL) {
+        // The tiles cover the grid
+        right = Convert32_F16(groupCel->gridColumns * groupCel->tileSize.x);
+        bottom = Convert32_F16(groupCel->gridRows * groupCel->tileSize.y);
+    } else {
+        // Each element configured, at the frame of its full resolution
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (groupCel->cels[celIndex].cel == NULL) { continue; }
+            elementLeft = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+            elementTop = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+            if ((heldCount == 0) || (elementLeft < left)) { left = elementLeft; }
+            if ((heldCount == 0) || (elementTop < top)) { top = elementTop; }
+            elementLeft += Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+            elementTop += Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+            if ((heldCount == 0) || (elementLeft > right)) { right = elementLeft; }
+            if ((heldCount == 0) || (elementTop > bottom)) { bottom = elementTop; }
+            heldCount++;
+        }
+    }
+
+    // Transforms the 4 corners like the update, the elements stay inside their quad
+    GroupCelTransformPreparation(groupCel, GroupCelIsStretched(groupCel), (groupCel->rotationAngle16 != 0) ? 1 : 0, &transform);
+    GroupCelTransformPoint(&transform, left, top, &quad->topLeft);
+    GroupCelTransformPoint(&transform, right, top, &quad->topRight);
+    GroupCelTransformPoint(&transform, right, bottom, &quad->bottomRight);
+    GroupCelTransformPoint(&transform, left, bottom, &quad->bottomLeft);
+
+    // Moves the quad into the view of the camera
+    GroupCelCameraPoint(groupCel, &quad->topLeft);
+    GroupCelCameraPoint(groupCel, &quad->topRight);
+    GroupCelCameraPoint(groupCel, &quad->bottomRight);
+    GroupCelCameraPoint(groupCel, &quad->bottomLeft);
+}
+
+// Sorts the entries by the left edge of their bounds
+void GroupCelCollisionSort(GroupCelCollision *collision) {
+
+    // Indexes to iterate through the order
+    uint32 orderIndex = 0;
+    uint32 searchIndex = 0;
+    // Entry moved
+    uint32 entryIndex = 0;
+
+    // Insertion sort: each entry only moves past the ones that crossed it since the last query
+    for (orderIndex = 1; orderIndex < collision->entriesCount; orderIndex++) {
+        entryIndex = collision->order[orderIndex];
+        searchIndex = orderIndex;
+        while ((searchIndex > 0) && (collision->entries[collision->order[searchIndex - 1]].bounds.topLeft.x > collision->entries[entryIndex].bounds.topLeft.x)) {
+            collision->order[searchIndex] = collision->order[searchIndex - 1];
+            searchIndex--;
+        }
+        collision->order[searchIndex] = entryIndex;
+    }
+}
+
+// Tells if two quads overlap
+int32 GroupCelCollisionQuads(Quad2D *quad1, Quad2D *quad2) {
+
+    // The quads overlap if no edge of either one separates them
+    if (GroupCelCollisionSeparated(quad1, quad2) == 1) { return 0; }
+    if (GroupCelCollisionSeparated(quad2, quad1) == 1) { return 0; }
+
+    // Returns 1 if the quads overlap
+    return 1;
+}
+
+// Tells if an edge of the first quad separates the two quads
+int32 GroupCelCollisionSeparated(Quad2D *quad1, Quad2D *quad2) {
+
+    // Corners of the quads
+    Point2D *corners1[4];
+    Point2D *corners2[4];
+    // Index to iterate through edges and corners
+    int32 edgeIndex = 0;
+    int32 cornerIndex = 0;
+    // Normal to the edge in 16.16
+    frac16 axisX = 0;
+    frac16 axisY = 0;
+    // Projections of the quads on the normal
+    frac16 projection = 0;
+    frac16 minimum1 = 0;
+    frac16 maximum1 = 0;
+    frac16 minimum2 = 0;
+    frac16 maximum2 = 0;
+
+    corners1[0] = &quad1->topLeft;
+    corners1[1] = &quad1->topRight;
+    corners1[2] = &quad1->bottomRight;
+    corners1[3] = &quad1->bottomLeft;
+    corners2[0] = &quad2->topLeft;
+    corners2[1] = &quad2->topRight;
+    corners2[2] = &quad2->bottomRight;
+    corners2[3] = &quad2->bottomLeft;
+
+    // Each edge of the first quad
+    for (edgeIndex = 0; edgeIndex < 4; edgeIndex++) {
+
+        // Normal to the edge
+        axisX = corners1[(edgeIndex + 1) & 3]->y - corners1[edgeIndex]->y;
+        axisY = corners1[edgeIndex]->x - corners1[(edgeIndex + 1) & 3]->x;
+        // If the edge is a point
+        if ((axisX == 0) && (axisY == 0)) { continue; }
+        // Scales the normal down to 1.0 at most, so that the products stay in 32 bits
+        while ((axisX > (1 << 16)) || (axisX < -(1 << 16)) || (axisY > (1 << 16)) || (axisY < -(1 << 16))) {
+            axisX >>= 1;
+            axisY >>= 1;
+        }
+
+        // Projects the corners relative to the first one, to keep the values small
+        for (cornerIndex = 0; cornerIndex < 4; cornerIndex++) {
+            projection = MulSF16(corners1[cornerIndex]->x - corners1[0]->x, axisX) + MulSF16(corners1[cornerIndex]->y - corners1[0]->y, axisY);
+            if ((cornerIndex == 0) || (projection < minimum1)) { minimum1 = projection; }
+            if ((cornerIndex == 0) || (projection > maximum1)) { maximum1 = projection; }
+            projection = MulSF16(corners2[cornerIndex]->x - corners1[0]->x, axisX) + MulSF16(corners2[cornerIndex]->y - corners1[0]->y, axisY);
+            if ((cornerIndex == 0) || (projection < minimum2)) { minimum2 = projection; }
+            if ((cornerIndex == 0) || (projection > maximum2)) { maximum2 = projection; }
+        }
+
+        // If the projections don't overlap, the edge separates the quads
+        if ((maximum1 < minimum2) || (maximum2 < minimum1)) { return 1; }
+    }
+
+    // Returns 0 if no edge separates the quads
+    return 0;
+}
+
+// Number of CCBs of a group
+uint32 GroupCelCollisionCelsCount(GroupCel *groupCel) {
+
+    // A flattened group is drawn as a single CCB
+    if (groupCel->flat != NULL) { return 1; }
+    // A grid has a CCB per tile, a list one per element
+    return (groupCel->cels == NULL) ? groupCel->gridColumns * groupCel->gridRows : groupCel->celsCount;
+}
+
+// CCB of an index of a group (NULL when none)
+CCB *GroupCelCollisionCel(GroupCel *groupCel, uint32 celIndex) {
+
+    // A flattened group is drawn as a single CCB
+    if (groupCel->flat != NULL) { return &groupCel->flat->cel; }
+    // A tile of a grid or an element of a list
+    return (groupCel->cels == NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel;
+}
@@ -0,0 +1,153 @@
+#ifndef GROUPCEL_COLLISION_H
+#define GROUPCEL_COLLISION_H
+
+/******************************************************************************
+**
+**  GroupCelCollision - Overlaps between transformed GroupCels
+**
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  Testing rotated or stretched groups with RectanglesIntersection() on
+**  their axis-aligned bounds reports overlaps where their corners only come
+**  close. This module keeps, for each registered group, the quad its
+**  transform gives to the rectangle holding its elements, and tests the quads
+**  along the separating axes of their edges.
+**
+**  A query first sorts the groups by the left edge of their bounds, nearly
+**  sorted already from the last frame, and sweeps them: only the pairs whose
+**  bounds overlap on both axes reach the separating-axis test (sweep and
+**  prune). The elements of two colliding groups can then be tested pair by
+**  pair with the quads of their CCBs.
+**
+**  Important notes:
+**
+**    - The quad of a group is taken again only when its epoch changed, with
+**      the transform and the camera the update uses. The quads of the
+**      elements come from their CCBs (CelProjectionQuad()), so the groups
+**      must be updated before a query.
+**
+**    - A stretched quad can be bent by its bilinear term: it is tested as the
+**      polygon of its 4 corners, which holds it. A concave quad may report an
+**      overlap close to its hollow, never miss one.
+**
+**    - Only the pairs whose masks share a bit are tested. The coordinates are
+**      in 16.16 on screen: two groups spanning more than 16384 pixels together
+**      are beyond the range of the test.
+**
+**    - The entries are taken from a block allocated once with the module, the
+**      number of groups is therefore bounded by its capacity.
+**
+**  Structure Roles :
+**
+**    GroupCelCollisionEntry
+**      - groupCel : Group tested
+**      - mask : Collision layers of the group, pairs sharing a bit are tested
+**      - quad : Transformed quad holding the elements, on screen in 16.16
+**      - bounds : Bounds of the quad
+**      - epoch : Epoch of the group when the quad was taken
+**
+**    GroupCelCollision
+**      - entries, entriesCount, capacity : Registered groups
+**      - order : Entries sorted by the left edge of their bounds
+**      - candidatesCount : Pairs kept by the sweep during the last query
+**      - hitsCount : Pairs found overlapping during the last query
+**
+**  Main Functions :
+**
+**    GroupCelCollisionInitialization()
+**      -> Creates the module for a maximum number of groups.
+**
+**    GroupCelCollisionAdd() / GroupCelCollisionRemove()
+**      -> Registers a GroupCel with its mask, and takes it out.
+**
+**    GroupCelCollisionQuery()
+**      -> Calls a function for each pair of registered groups overlapping.
+**
+**    GroupCelCollisionGroups()
+**      -> Tests two groups, registered or not.
+**
+**    GroupCelCollisionElements()
+**      -> Calls a function for each pair of elements of two groups overlapping.
+**
+**    GroupCelCollisionReport()
+**      -> Displays the pairs tested and found by the last query.
+**
+**    GroupCelCollisionCleanup()
+**      -> Frees the memory used by the module.
+**
+******************************************************************************/
+
+// GroupCel
+#include "GroupCel.h"
+// Quad2D, Rectangle
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_COLLISION 0
+
+// Index given to the flattened CCB of a group by GroupCelCollisionElements()
+#define GROUPCEL_COLLISION_FLAT (-1)
+
+// Function called for each pair of groups overlapping
+typedef void (*GroupCelCollisionHit)(void *context, GroupCel *groupCel1, GroupCel *groupCel2);
+// Function called for each pair of elements overlapping
+typedef void (*GroupCelCollisionElementHit)(void *context, int32 celIndex1, int32 celIndex2);
+
+typedef struct {
+    // Group tested
+    GroupCel *groupCel;
+    // Collision layers of the group, pairs sharing a bit are tested
+    uint32 mask;
+    // Transformed quad holding the elements, on screen in 16.16
+    Quad2D quad;
+    // Bounds of the quad
+    Rectangle bounds;
+    // Epoch of the group when the quad was taken
+    uint32 epoch;
+} GroupCelCollisionEntry;
+
+typedef struct {
+    // Registered groups
+    GroupCelCollisionEntry *entries;
+    uint32 entriesCount;
+    uint32 capacity;
+    // Entries sorted by the left edge of their bounds
+    uint32 *order;
+    // Pairs kept by the sweep and found overlapping during the last query
+    uint32 candidatesCount;
+    uint32 hitsCount;
+} GroupCelCollision;
+
+// Initialization of the module
+GroupCelCollision *GroupCelCollisionInitialization(uint32 capacity);
+// Registers a GroupCel
+int32 GroupCelCollisionAdd(GroupCelCollision *collision, GroupCel *groupCel, uint32 mask);
+// Takes a GroupCel out
+int32 GroupCelCollisionRemove(GroupCelCollision *collision, GroupCel *groupCel);
+// Calls a function for each pair of groups overlapping
+int32 GroupCelCollisionQuery(GroupCelCollision *collision, GroupCelCollisionHit hit, void *context);
+// Tests two groups
+int32 GroupCelCollisionGroups(GroupCel *groupCel1, GroupCel *groupCel2);
+// Calls a function for each pair of elements overlapping
+int32 GroupCelCollisionElements(GroupCel *groupCel1, GroupCel *groupCel2, GroupCelCollisionElementHit hit, void *context);
+// Displays the last query
+int32 GroupCelCollisionReport(GroupCelCollision *collision);
+// Deletes the module
+int32 GroupCelCollisionCleanup(GroupCelCollision *collision);
+
+// Quad holding the elements of a group, on screen in 16.16
+void GroupCelCollisionGroupQuad(GroupCel *groupCel, Quad2D *quad);
+// Sorts the entries by the left edge of their bounds
+void GroupCelCollisionSort(GroupCelCollision *collision);
+// Tells if two quads overlap
+int32 GroupCelCollisionQuads(Quad2D *quad1, Quad2D *quad2);
+// Tells if an edge of the first quad separates the two quads
+int32 GroupCelCollisionSeparated(Quad2D *quad1, Quad2D *quad2);
+// Number of CCBs of a group and CCB of an index
+uint32 GroupCelCollisionCelsCount(GroupCel *groupCel);
+CCB *GroupCelCollisionCel(GroupCel *groupCel, uint32 celIndex);
+
+#endif // GROUPCEL_COLLISION_H
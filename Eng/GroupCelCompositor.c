@@ -0,0 +1,259 @@
+
+#include "GroupCelCompositor.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialization of a compositor
+GroupCelCompositor *GroupCelCompositorInitialization(uint32 layersCount, uint32 capacity) {
+
+    // Compositor
+    GroupCelCompositor *compositor = NULL;
+    // Index to iterate through layers and entries
+    uint32 index = 0;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorInitialization()*\n"); }
+
+    // Corrects parameters
+    // Minimum = 1 layer and 1 entry
+    layersCount = (layersCount > 1) ? layersCount : 1;
+    capacity = (capacity > 1) ? capacity : 1;
+
+    // Allocates memory for the compositor
+    compositor = (GroupCelCompositor *)AllocMem(sizeof(GroupCelCompositor), MEMTYPE_DRAM);
+    // If it's a failure
+    if (compositor == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel compositor.\n");
+        return NULL;
+    }
+
+    // Allocates memory for the layers and the entries, their anchors are read by the Cel Engine
+    compositor->layers = (GroupCelCompositorLayer *)AllocMem(layersCount * sizeof(GroupCelCompositorLayer), MEMTYPE_DRAM);
+    compositor->entries = (GroupCelCompositorEntry *)AllocMem(capacity * sizeof(GroupCelCompositorEntry), MEMTYPE_DRAM);
+    // If it's a failure
+    if ((compositor->layers == NULL) || (compositor->entries == NULL)) {
+        // Frees previously allocated memory
+        if (compositor->layers != NULL) { FreeMem(compositor->layers, layersCount * sizeof(GroupCelCompositorLayer)); }
+        if (compositor->entries != NULL) { FreeMem(compositor->entries, capacity * sizeof(GroupCelCompositorEntry)); }
+        FreeMem(compositor, sizeof(GroupCelCompositor));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel compositor layers.\n");
+        return NULL;
+    }
+
+    // Empty layers
+    memset(compositor->layers, 0, (size_t)layersCount * sizeof(GroupCelCompositorLayer));
+    compositor->layersCount = layersCount;
+
+    // For each layer
+    for (index = 0; index < layersCount; index++) {
+        // Empty CCB skipped by the Cel Engine, its next pointer is absolute
+        compositor->layers[index].anchor.ccb_Flags = CCB_SKIP | CCB_NPABS;
+        // Informs the Cel Engine that the next layer follows
+        if (index > 0) { LinkCel(&compositor->layers[index - 1].anchor, &compositor->layers[index].anchor); }
+    }
+    // The last layer ends the list
+    GroupCelChainLink(&compositor->layers[layersCount - 1].anchor, NULL);
+    // The list starts with the first layer
+    compositor->head = &compositor->layers[0].anchor;
+
+    // Chains all the entries in the free list
+    memset(compositor->entries, 0, (size_t)capacity * sizeof(GroupCelCompositorEntry));
+    for (index = 0; index < capacity - 1; index++) {
+        compositor->entries[index].next = &compositor->entries[index + 1];
+    }
+    compositor->entries[capacity - 1].next = NULL;
+    compositor->capacity = capacity;
+    compositor->freeList = &compositor->entries[0];
+    compositor->freeCount = capacity;
+
+    // Returns the created compositor
+    return compositor;
+}
+
+// Links a GroupCel on top of a layer
+GroupCelCompositorEntry *GroupCelCompositorAdd(GroupCelCompositor *compositor, uint32 layer, GroupCel *groupCel) {
+
+    // Entry of the group
+    GroupCelCompositorEntry *entry = NULL;
+    // Layer of the group
+    GroupCelCompositorLayer *compositorLayer = NULL;
+    // Last CCB of the layer
+    CCB *previous = NULL;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorAdd()*\n"); }
+
+    // If the compositor is unknown
+    if (compositor == NULL){
+        // Returns an error
+        printf("Error : GroupCel compositor unknown.\n");
+        return NULL;
+    }
+
+    // If the group is unknown
+    if (groupCel == NULL){
+        // Returns an error
+        printf("Error : GroupCel unknown.\n");
+        return NULL;
+    }
+
+    // If the layer doesn't exist
+    if (layer >= compositor->layersCount) {
+        // Returns an error
+        printf("Error : GroupCel compositor layer %u out of %u layers.\n", layer, compositor->layersCount);
+        return NULL;
+    }
+
+    // If there is no free entry
+    if (compositor->freeList == NULL) {
+        // Returns an error
+        printf("Error : GroupCel compositor full (%u entries).\n", compositor->capacity);
+        return NULL;
+    }
+
+    // Takes the first free entry
+    entry = compositor->freeList;
+    compositorLayer = &compositor->layers[layer];
+
+    // Empty CCB skipped by the Cel Engine, its next pointer is absolute
+    memset(&entry->anchor, 0, sizeof(CCB));
+    entry->anchor.ccb_Flags = CCB_SKIP | CCB_NPABS;
+
+    // The anchor goes after the last CCB of the layer
+    previous = (compositorLayer->last != NULL) ? GroupCelCompositorEntryEnd(compositorLayer->last) : &compositorLayer->anchor;
+    GroupCelChainLink(&entry->anchor, GroupCelChainNext(previous));
+    LinkCel(previous, &entry->anchor);
+
+    // The group goes after its anchor
+    if (GroupCelLinkAfter(groupCel, &entry->anchor) < 0) {
+        // Takes the anchor out again
+        GroupCelChainLink(previous, GroupCelChainNext(&entry->anchor));
+        // Returns an error
+        printf("Error <- GroupCelLinkAfter()\n");
+        return NULL;
+    }
+
+    // The entry is in use
+    compositor->freeList = entry->next;
+    compositor->freeCount--;
+
+    // Adds the entry on top of the layer
+    entry->groupCel = groupCel;
+    entry->layer = layer;
+    entry->previous = compositorLayer->last;
+    entry->next = NULL;
+    if (compositorLayer->last == NULL) { compositorLayer->first = entry; } else { compositorLayer->last->next = entry; }
+    compositorLayer->last = entry;
+
+    // Returns the entry of the group
+    return entry;
+}
+
+// Takes the GroupCel of an entry out of the display list
+int32 GroupCelCompositorRemove(GroupCelCompositor *compositor, GroupCelCompositorEntry *entry) {
+
+    // Layer of the group
+    GroupCelCompositorLayer *compositorLayer = NULL;
+    // CCB drawn before the anchor
+    CCB *previous = NULL;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorRemove()*\n"); }
+
+    // If the compositor is unknown
+    if (compositor == NULL){
+        // Returns an error
+        printf("Error : GroupCel compositor unknown.\n");
+        return -1;
+    }
+
+    // If the entry isn't used by a group
+    if ((entry == NULL) || (entry->groupCel == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel compositor entry unknown.\n");
+        return -1;
+    }
+
+    compositorLayer = &compositor->layers[entry->layer];
+
+    // Takes the group out after its anchor
+    if (GroupCelUnlink(entry->groupCel) < 0) {
+        // Returns an error
+        printf("Error <- GroupCelUnlink()\n");
+        return -1;
+    }
+
+    // The CCB before the anchor goes straight to the one following it
+    previous = (entry->previous != NULL) ? GroupCelCompositorEntryEnd(entry->previous) : &compositorLayer->anchor;
+    GroupCelChainLink(previous, GroupCelChainNext(&entry->anchor));
+
+    // Joins the neighbours in the layer
+    if (entry->previous == NULL) { compositorLayer->first = entry->next; } else { entry->previous->next = entry->next; }
+    if (entry->next == NULL) { compositorLayer->last = entry->previous; } else { entry->next->previous = entry->previous; }
+
+    // Gives the entry back
+    entry->groupCel = NULL;
+    entry->previous = NULL;
+    entry->next = compositor->freeList;
+    compositor->freeList = entry;
+    compositor->freeCount++;
+
+    // Returns success
+    return 1;
+}
+
+// Draws all the layers
+int32 GroupCelCompositorDraw(GroupCelCompositor *compositor, Item bitmapItem) {
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorDraw()*\n"); }
+
+    // If the compositor is unknown
+    if (compositor == NULL){
+        // Returns an error
+        printf("Error : GroupCel compositor unknown.\n");
+        return -1;
+    }
+
+    // A single call for the whole list
+    return DrawCels(bitmapItem, compositor->head);
+}
+
+// Last CCB of an entry in the display list
+CCB *GroupCelCompositorEntryEnd(GroupCelCompositorEntry *entry) {
+
+    // A hidden group leaves only its anchor in the list
+    return (entry->groupCel->visible == 1) ? GroupCelChainLast(entry->groupCel) : &entry->anchor;
+}
+
+// Deletes the compositor
+int32 GroupCelCompositorCleanup(GroupCelCompositor *compositor) {
+
+    // Index to iterate through entries
+    uint32 index = 0;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorCleanup()*\n"); }
+
+    // If the compositor is unknown
+    if (compositor == NULL){
+        // Returns an error
+        printf("Error : GroupCel compositor unknown.\n");
+        return -1;
+    }
+
+    // Takes the groups still linked out of the list, they stay usable
+    for (index = 0; index < compositor->capacity; index++) {
+        if (compositor->entries[index].groupCel != NULL) { GroupCelUnlink(compositor->entries[index].groupCel); }
+    }
+
+    // Free the memory used by the layers, the entries and the compositor
+    FreeMem(compositor->layers, compositor->layersCount * sizeof(GroupCelCompositorLayer));
+    FreeMem(compositor->entries, compositor->capacity * sizeof(GroupCelCompositorEntry));
+    FreeMem(compositor, sizeof(GroupCelCompositor));
+
+    // Returns success
+    return 1;
+}
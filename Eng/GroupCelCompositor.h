@@ -0,0 +1,140 @@
+#ifndef GROUPCEL_COMPOSITOR_H
+#define GROUPCEL_COMPOSITOR_H
+
+/******************************************************************************
+**
+**  GroupCelCompositor - Layers of GroupCels linked into a single display list
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  This module keeps many GroupCels in ordered layers (background, world,
+**  HUD...) and links all their chains into one continuous list of CCBs. The
+**  whole scene is drawn by a single call to DrawCels() from the head of the
+**  list.
+**
+**  Each layer starts with an empty CCB, and each group is preceded by one:
+**  these anchors are skipped by the Cel Engine and never move. Adding or
+**  removing a group only relinks the CCBs around its place, whatever the
+**  number of layers and groups.
+**
+**  Important notes:
+**
+**    - A group is added on top of its layer: it is drawn after the groups
+**      already in the layer and before the next layer.
+**
+**    - A group of the compositor can still be hidden and shown with
+**      GroupCelSetVisible() and reordered with its draw order: its anchor keeps
+**      its place in the list. It must not be unlinked or linked elsewhere while
+**      it is in the compositor, and must be removed before being deleted.
+**
+**    - The entries are taken from a block allocated once with the compositor,
+**      the number of groups is therefore bounded by its capacity.
+**
+**  Structure Roles :
+**
+**    GroupCelCompositorEntry
+**      - anchor : Empty CCB in front of the group, skipped by the Cel Engine
+**      - groupCel : Group drawn after the anchor
+**      - layer : Layer of the group
+**      - previous, next : Entries drawn before and after in the layer (next chains the free entries)
+**
+**    GroupCelCompositorLayer
+**      - anchor : Empty CCB starting the layer, skipped by the Cel Engine
+**      - first, last : First and last entries of the layer
+**
+**    GroupCelCompositor
+**      - layers : Array of layers, drawn in order
+**      - layersCount : Number of layers
+**      - entries : Block of entries
+**      - capacity : Total number of entries
+**      - freeList : First free entry
+**      - freeCount : Number of free entries
+**      - head : First CCB of the display list, given to DrawCels()
+**
+**  Main Functions :
+**
+**    GroupCelCompositorInitialization()
+**      -> Creates the compositor with its layers and a block of entries.
+**
+**    GroupCelCompositorAdd()
+**      -> Links a GroupCel on top of a layer in O(1) and returns its entry.
+**
+**    GroupCelCompositorRemove()
+**      -> Takes the GroupCel of an entry out of the display list in O(1).
+**
+**    GroupCelCompositorDraw()
+**      -> Draws all the layers with a single call to DrawCels().
+**
+**    GroupCelCompositorEntryEnd()
+**      -> Internal function giving the last CCB of an entry in the display list.
+**
+**    GroupCelCompositorCleanup()
+**      -> Frees the memory used by the compositor.
+**
+******************************************************************************/
+
+// CCB, DrawCels()
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_COMPOSITOR 0
+
+typedef struct GroupCelCompositorEntry {
+    // Empty CCB in front of the group, skipped by the Cel Engine
+    CCB anchor;
+    // Group drawn after the anchor
+    GroupCel *groupCel;
+    // Layer of the group
+    uint32 layer;
+    // Entries drawn before and after in the layer (next chains the free entries)
+    struct GroupCelCompositorEntry *previous;
+    struct GroupCelCompositorEntry *next;
+} GroupCelCompositorEntry;
+
+typedef struct {
+    // Empty CCB starting the layer, skipped by the Cel Engine
+    CCB anchor;
+    // First and last entries of the layer
+    GroupCelCompositorEntry *first;
+    GroupCelCompositorEntry *last;
+} GroupCelCompositorLayer;
+
+typedef struct {
+    // Array of layers, drawn in order
+    GroupCelCompositorLayer *layers;
+    // Number of layers
+    uint32 layersCount;
+    // Block of entries
+    GroupCelCompositorEntry *entries;
+    // Total number of entries
+    uint32 capacity;
+    // First free entry (chained by next)
+    GroupCelCompositorEntry *freeList;
+    // Number of free entries
+    uint32 freeCount;
+    // First CCB of the display list, given to DrawCels()
+    CCB *head;
+} GroupCelCompositor;
+
+// Initialization of a compositor
+GroupCelCompositor *GroupCelCompositorInitialization(uint32 layersCount, uint32 capacity);
+
+// Links a GroupCel on top of a layer
+GroupCelCompositorEntry *GroupCelCompositorAdd(GroupCelCompositor *compositor, uint32 layer, GroupCel *groupCel);
+// Takes the GroupCel of an entry out of the display list
+int32 GroupCelCompositorRemove(GroupCelCompositor *compositor, GroupCelCompositorEntry *entry);
+// Draws all the layers
+int32 GroupCelCompositorDraw(GroupCelCompositor *compositor, Item bitmapItem);
+
+// Last CCB of an entry in the display list
+CCB *GroupCelCompositorEntryEnd(GroupCelCompositorEntry *entry);
+
+// Deletes the compositor
+int32 GroupCelCompositorCleanup(GroupCelCompositor *compositor);
+
+#endif // GROUPCEL_COMPOSITOR_H
@@ -0,0 +1,304 @@
+
+#include "GroupCelDirty.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Initialization of an accumulator
+GroupCelDirty *GroupCelDirtyInitialization(int32 width, int32 height, uint32 regionsCapacity) {
+
+    // Accumulator
+    GroupCelDirty *dirty = NULL;
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyInitialization()*\n"); }
+
+    // If the screen is empty
+    if ((width <= 0) || (height <= 0)) {
+        // Returns an error
+        printf("Error : GroupCelDirty screen %d x %d is empty.\n", width, height);
+        return NULL;
+    }
+
+    // Corrects parameters
+    // Minimum = 1 region
+    regionsCapacity = (regionsCapacity > 1) ? regionsCapacity : 1;
+
+    // Allocates memory for the accumulator
+    dirty = (GroupCelDirty *)AllocMem(sizeof(GroupCelDirty), MEMTYPE_DRAM);
+    // If it's a failure
+    if (dirty == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCelDirty.\n");
+        return NULL;
+    }
+
+    // Allocates memory for the regions
+    dirty->regions = (Rectangle *)AllocMem(regionsCapacity * sizeof(Rectangle), MEMTYPE_DRAM);
+    // If it's a failure
+    if (dirty->regions == NULL) {
+        // Frees previously allocated memory
+        FreeMem(dirty, sizeof(GroupCelDirty));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCelDirty regions.\n");
+        return NULL;
+    }
+    dirty->regionsCapacity = regionsCapacity;
+
+    // Screen the regions are clipped to
+    dirty->screen.topLeft.x = 0;
+    dirty->screen.topLeft.y = 0;
+    dirty->screen.bottomRight.x = width;
+    dirty->screen.bottomRight.y = height;
+
+    // Nothing to redraw yet
+    GroupCelDirtyClear(dirty);
+
+    // Returns the created accumulator
+    return dirty;
+}
+
+// Adds a rectangle in pixels and merges it into the regions
+void GroupCelDirtyAdd(GroupCelDirty *dirty, Rectangle *rectangle) {
+
+    // Rectangle clipped to the screen, then grown by the merges
+    Rectangle added;
+    // Union with a region
+    Rectangle merged;
+    // Index to iterate through regions
+    uint32 regionIndex = 0;
+    // Region the closest to the rectangle when the list is full
+    uint32 closestIndex = 0;
+    // Pixels a union covers and pixels it wastes
+    uint32 areaUnion = 0;
+    uint32 waste = 0;
+    uint32 closestWaste = 0;
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyAdd()*\n"); }
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return;
+    }
+
+    // If the whole screen is already drawn again
+    if (dirty->full == 1) {
+        // Nothing to add
+        return;
+    }
+
+    // Clips the rectangle to the screen
+    added = *rectangle;
+    if (added.topLeft.x < dirty->screen.topLeft.x) { added.topLeft.x = dirty->screen.topLeft.x; }
+    if (added.topLeft.y < dirty->screen.topLeft.y) { added.topLeft.y = dirty->screen.topLeft.y; }
+    if (added.bottomRight.x > dirty->screen.bottomRight.x) { added.bottomRight.x = dirty->screen.bottomRight.x; }
+    if (added.bottomRight.y > dirty->screen.bottomRight.y) { added.bottomRight.y = dirty->screen.bottomRight.y; }
+
+    // If nothing is left on screen
+    if ((added.topLeft.x >= added.bottomRight.x) || (added.topLeft.y >= added.bottomRight.y)) {
+        // Nothing to add
+        return;
+    }
+    dirty->addedCount++;
+
+    // Merges the rectangle with each region whose union wastes few pixels
+    regionIndex = 0;
+    while (regionIndex < dirty->regionsCount) {
+        GroupCelDirtyUnion(&dirty->regions[regionIndex], &added, &merged);
+        areaUnion = GroupCelDirtyRectangleArea(&merged);
+        waste = areaUnion - (GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]) + GroupCelDirtyRectangleArea(&added) - GroupCelDirtyOverlap(&dirty->regions[regionIndex], &added));
+        // If the union is cheap
+        if (waste <= (areaUnion >> GROUPCEL_DIRTY_WASTE_SHIFT)) {
+            // The region becomes the rectangle, which is compared to all the regions again
+            GroupCelDirtyRemove(dirty, regionIndex);
+            added = merged;
+            regionIndex = 0;
+            continue;
+        }
+        regionIndex++;
+    }
+
+    // If the list is full
+    if (dirty->regionsCount >= dirty->regionsCapacity) {
+        // Finds the region whose union with the rectangle wastes the fewest pixels
+        for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+            GroupCelDirtyUnion(&dirty->regions[regionIndex], &added, &merged);
+            waste = GroupCelDirtyRectangleArea(&merged) - (GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]) + GroupCelDirtyRectangleArea(&added) - GroupCelDirtyOverlap(&dirty->regions[regionIndex], &added));
+            if ((regionIndex == 0) || (waste < closestWaste)) {
+                closestIndex = regionIndex;
+                closestWaste = waste;
+            }
+        }
+        // Merges them
+        GroupCelDirtyUnion(&dirty->regions[closestIndex], &added, &added);
+        GroupCelDirtyRemove(dirty, closestIndex);
+    }
+
+    // Adds the region
+    dirty->regions[dirty->regionsCount] = added;
+    dirty->regionsCount++;
+}
+
+// Adds a rectangle in 16.16, rounded outwards to whole pixels
+void GroupCelDirtyAddF16(GroupCelDirty *dirty, Rectangle *rectangle16) {
+
+    // Rectangle in pixels
+    Rectangle rectangle;
+
+    // The pixels touched by the rectangle, even partly
+    rectangle.topLeft.x = rectangle16->topLeft.x >> 16;
+    rectangle.topLeft.y = rectangle16->topLeft.y >> 16;
+    rectangle.bottomRight.x = (rectangle16->bottomRight.x + 0xFFFF) >> 16;
+    rectangle.bottomRight.y = (rectangle16->bottomRight.y + 0xFFFF) >> 16;
+
+    GroupCelDirtyAdd(dirty, &rectangle);
+}
+
+// Marks the whole screen to be drawn again
+void GroupCelDirtyFull(GroupCelDirty *dirty) {
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return;
+    }
+
+    // A single region covers the screen
+    dirty->regions[0] = dirty->screen;
+    dirty->regionsCount = 1;
+    dirty->full = 1;
+}
+
+// Empties the regions once the frame is drawn
+void GroupCelDirtyClear(GroupCelDirty *dirty) {
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return;
+    }
+
+    // Nothing to redraw
+    dirty->regionsCount = 0;
+    dirty->addedCount = 0;
+    dirty->full = 0;
+}
+
+// Pixels covered by the regions, the overlaps counted once per region
+uint32 GroupCelDirtyArea(GroupCelDirty *dirty) {
+
+    // Index to iterate through regions
+    uint32 regionIndex = 0;
+    // Sum of the areas
+    uint32 area = 0;
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return 0;
+    }
+
+    for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+        area += GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]);
+    }
+
+    // Returns the pixels to redraw
+    return area;
+}
+
+// Displays the regions and the part of the screen they cover
+int32 GroupCelDirtyReport(GroupCelDirty *dirty) {
+
+    // Index to iterate through regions
+    uint32 regionIndex = 0;
+    // Pixels of the regions and of the screen
+    uint32 area = 0;
+    uint32 screenArea = 0;
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return -1;
+    }
+
+    // Displays the totals
+    area = GroupCelDirtyArea(dirty);
+    screenArea = GroupCelDirtyRectangleArea(&dirty->screen);
+    printf("GroupCelDirty : %u regions from %u rectangles, %u pixels (%u%% of the screen)%s\n", dirty->regionsCount, dirty->addedCount, area, (area * 100) / screenArea, (dirty->full == 1) ? ", full" : "");
+
+    // Displays the regions
+    for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+        printf("  %d,%d -> %d,%d\n", dirty->regions[regionIndex].topLeft.x, dirty->regions[regionIndex].topLeft.y, dirty->regions[regionIndex].bottomRight.x, dirty->regions[regionIndex].bottomRight.y);
+    }
+
+    // Returns the pixels to redraw
+    return (int32)area;
+}
+
+// Deletes the accumulator
+int32 GroupCelDirtyCleanup(GroupCelDirty *dirty) {
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyCleanup()*\n"); }
+
+    // If the accumulator is unknown
+    if (dirty == NULL) {
+        // Returns an error
+        printf("Error : GroupCelDirty unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used for the regions and the accumulator
+    FreeMem(dirty->regions, dirty->regionsCapacity * sizeof(Rectangle));
+    FreeMem(dirty, sizeof(GroupCelDirty));
+
+    // Returns success
+    return 1;
+}
+
+// Area of a rectangle in pixels
+uint32 GroupCelDirtyRectangleArea(Rectangle *rectangle) {
+
+    return (uint32)(rectangle->bottomRight.x - rectangle->topLeft.x) * (uint32)(rectangle->bottomRight.y - rectangle->topLeft.y);
+}
+
+// Area shared by two rectangles in pixels
+uint32 GroupCelDirtyOverlap(Rectangle *rectangle1, Rectangle *rectangle2) {
+
+    // Intersection of the rectangles
+    Rectangle overlap;
+
+    overlap.topLeft.x = (rectangle1->topLeft.x > rectangle2->topLeft.x) ? rectangle1->topLeft.x : rectangle2->topLeft.x;
+    overlap.topLeft.y = (rectangle1->topLeft.y > rectangle2->topLeft.y) ? rectangle1->topLeft.y : rectangle2->topLeft.y;
+    overlap.bottomRight.x = (rectangle1->bottomRight.x < rectangle2->bottomRight.x) ? rectangle1->bottomRight.x : rectangle2->bottomRight.x;
+    overlap.bottomRight.y = (rectangle1->bottomRight.y < rectangle2->bottomRight.y) ? rectangle1->bottomRight.y : rectangle2->bottomRight.y;
+
+    // If the rectangles don't overlap
+    if ((overlap.topLeft.x >= overlap.bottomRight.x) || (overlap.topLeft.y >= overlap.bottomRight.y)) {
+        return 0;
+    }
+
+    return GroupCelDirtyRectangleArea(&overlap);
+}
+
+// Smallest rectangle holding two rectangles
+void GroupCelDirtyUnion(Rectangle *rectangle1, Rectangle *rectangle2, Rectangle *result) {
+
+    result->topLeft.x = (rectangle1->topLeft.x < rectangle2->topLeft.x) ? rectangle1->topLeft.x : rectangle2->topLeft.x;
+    result->topLeft.y = (rectangle1->topLeft.y < rectangle2->topLeft.y) ? rectangle1->topLeft.y : rectangle2->topLeft.y;
+    result->bottomRight.x = (rectangle1->bottomRight.x > rectangle2->bottomRight.x) ? rectangle1->bottomRight.x : rectangle2->bottomRight.x;
+    result->bottomRight.y = (rectangle1->bottomRight.y > rectangle2->bottomRight.y) ? rectangle1->bottomRight.y : rectangle2->bottomRight.y;
+}
+
+// Removes a region, the last one takes its place
+void GroupCelDirtyRemove(GroupCelDirty *dirty, uint32 regionIndex) {
+
+    dirty->regionsCount--;
+    dirty->regions[regionIndex] = dirty->regions[dirty->regionsCount];
+}
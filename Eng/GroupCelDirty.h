@@ -0,0 +1,117 @@
+#ifndef GROUPCEL_DIRTY_H
+#define GROUPCEL_DIRTY_H
+
+/******************************************************************************
+**
+**  GroupCelDirty - Regions of the screen to redraw in a frame
+**
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  A screen with a static background doesn't need to be drawn again entirely
+**  when only a few GroupCels move or animate. This module gathers, for a
+**  frame, the rectangles the groups report when their CCBs change: where the
+**  elements were and where they are now. The rectangles are merged as they
+**  come into a small list of regions, so that the renderer only restores the
+**  background and draws the Cels again inside these regions.
+**
+**  A rectangle is merged with the regions whose union with it wastes few
+**  pixels, and with the closest region when the list is full: the number of
+**  regions stays bounded whatever the number of rectangles added.
+**
+**  Important notes:
+**
+**    - The regions are in pixels, clipped to the screen, with bottomRight
+**      excluded. The rectangles reported by the groups come from the quads of
+**      their CCBs in 16.16, rounded outwards.
+**
+**    - A group reports its rectangles only once GroupCelSetDirty() gave it
+**      the accumulator, and only while it is visible. The accumulator must
+**      be cleared (GroupCelDirtyClear()) once the frame is drawn.
+**
+**    - The regions can overlap when their union would waste too many pixels.
+**      Drawing a region again after another one stays correct: it restores
+**      and draws everything inside it.
+**
+**  Structure Roles :
+**
+**    GroupCelDirty
+**      - screen : Screen the regions are clipped to
+**      - regions, regionsCount, regionsCapacity : Regions to redraw
+**      - addedCount : Number of rectangles added since the last clear
+**      - full : 1 when the whole screen must be drawn again
+**
+**  Main Functions :
+**
+**    GroupCelDirtyInitialization()
+**      -> Creates an accumulator for a screen size and a maximum number of regions.
+**
+**    GroupCelDirtyAdd() / GroupCelDirtyAddF16()
+**      -> Adds a rectangle in pixels or in 16.16 and merges it into the regions.
+**
+**    GroupCelDirtyFull()
+**      -> Marks the whole screen to be drawn again.
+**
+**    GroupCelDirtyClear()
+**      -> Empties the regions once the frame is drawn.
+**
+**    GroupCelDirtyReport()
+**      -> Displays the regions and the part of the screen they cover.
+**
+**    GroupCelDirtyCleanup()
+**      -> Frees the memory used by the accumulator.
+**
+******************************************************************************/
+
+// Rectangle
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_DIRTY 0
+
+// Pixels a union may waste, as a shift of its area
+// 2 -> a quarter of the union
+#define GROUPCEL_DIRTY_WASTE_SHIFT 2
+
+typedef struct {
+    // Screen the regions are clipped to
+    Rectangle screen;
+    // Regions to redraw in pixels, bottomRight excluded
+    Rectangle *regions;
+    uint32 regionsCount;
+    uint32 regionsCapacity;
+    // Number of rectangles added since the last clear
+    uint32 addedCount;
+    // 1 when the whole screen must be drawn again
+    int32 full;
+} GroupCelDirty;
+
+// Initialization of an accumulator
+GroupCelDirty *GroupCelDirtyInitialization(int32 width, int32 height, uint32 regionsCapacity);
+// Adds a rectangle in pixels
+void GroupCelDirtyAdd(GroupCelDirty *dirty, Rectangle *rectangle);
+// Adds a rectangle in 16.16, rounded outwards
+void GroupCelDirtyAddF16(GroupCelDirty *dirty, Rectangle *rectangle16);
+// Marks the whole screen to be drawn again
+void GroupCelDirtyFull(GroupCelDirty *dirty);
+// Empties the regions
+void GroupCelDirtyClear(GroupCelDirty *dirty);
+// Pixels covered by the regions
+uint32 GroupCelDirtyArea(GroupCelDirty *dirty);
+// Displays the regions
+int32 GroupCelDirtyReport(GroupCelDirty *dirty);
+// Deletes the accumulator
+int32 GroupCelDirtyCleanup(GroupCelDirty *dirty);
+
+// Area of a rectangle in pixels
+uint32 GroupCelDirtyRectangleArea(Rectangle *rectangle);
+// Area shared by two rectangles in pixels
+uint32 GroupCelDirtyOverlap(Rectangle *rectangle1, Rectangle *rectangle2);
+// Smallest rectangle holding two rectangles
+void GroupCelDirtyUnion(Rectangle *rectangle1, Rectangle *rectangle2, Rectangle *result);
+// Removes a region, the last one takes its place
+void GroupCelDirtyRemove(GroupCelDirty *dirty, uint32 regionIndex);
+
+#endif // GROUPCEL_DIRTY_H
@@ -0,0 +1,188 @@
+
+#include "GroupCelLayout.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// OpenBlockFile(), AsynchReadBlockFile()
+#include "blockfile.h"
+// DeleteItem()
+#include "item.h"
+// printf()
+#include "stdio.h"
+
+// Reads a whole file in a single I/O operation
+static void *GroupCelLayoutReadFile(char *filename, int32 *fileSize, int32 *bufferSize) {
+
+    // File
+    BlockFile blockFile;
+    // I/O request
+    Item ioRequest = 0;
+    // Size of a block of the device
+    int32 blockSize = 0;
+    // Buffer receiving the file
+    void *buffer = NULL;
+
+    // Opens the file
+    if (OpenBlockFile(filename, &blockFile) < 0) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return NULL;
+    }
+
+    // Size of the file rounded up to the device's blocks
+    *fileSize = GetBlockFileSize(&blockFile);
+    blockSize = GetBlockFileBlockSize(&blockFile);
+    *bufferSize = ((*fileSize + blockSize - 1) / blockSize) * blockSize;
+
+    // Allocates memory for the whole file
+    buffer = AllocMem(*bufferSize, MEMTYPE_DRAM);
+    // If it's a failure
+    if (buffer == NULL) {
+        CloseBlockFile(&blockFile);
+        // Displays an error message
+        printf("Error : Failed to allocate memory for %s.\n", filename);
+        return NULL;
+    }
+
+    // Creates the I/O request
+    ioRequest = CreateBlockFileIOReq(blockFile.fDevice, 0);
+    // If it's a failure
+    if (ioRequest < 0) {
+        FreeMem(buffer, *bufferSize);
+        CloseBlockFile(&blockFile);
+        // Displays an error message
+        printf("Error : Failed to create I/O request for %s.\n", filename);
+        return NULL;
+    }
+
+    // Reads the whole file at once
+    if ((AsynchReadBlockFile(&blockFile, ioRequest, buffer, *bufferSize, 0) < 0) || (WaitReadDoneBlockFile(ioRequest) < 0)) {
+        DeleteItem(ioRequest);
+        FreeMem(buffer, *bufferSize);
+        CloseBlockFile(&blockFile);
+        // Displays an error message
+        printf("Error : Failed to read %s.\n", filename);
+        return NULL;
+    }
+
+    // Frees the I/O resources
+    DeleteItem(ioRequest);
+    CloseBlockFile(&blockFile);
+
+    // Returns the content of the file
+    return buffer;
+}
+
+// Reads a layout file and creates the GroupCel
+GroupCel *GroupCelLayoutLoad(char *filename, CCB **cels, uint32 celsCount) {
+
+    // Content of the file
+    void *layout = NULL;
+    int32 layoutSize = 0;
+    int32 bufferSize = 0;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_LAYOUT == 1) { printf("*GroupCelLayoutLoad()*\n"); }
+
+    // If the filename is unknown
+    if (filename == NULL) {
+        // Returns an error
+        printf("Error : GroupCel layout filename unknown.\n");
+        return NULL;
+    }
+
+    // Reads the whole file in a single I/O operation
+    layout = GroupCelLayoutReadFile(filename, &layoutSize, &bufferSize);
+    // If it's a failure
+    if (layout == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelLayoutReadFile()\n");
+        return NULL;
+    }
+
+    // Creates the GroupCel
+    groupCel = GroupCelLayoutInstantiate(layout, (uint32)layoutSize, cels, celsCount);
+
+    // The layout is no longer needed
+    FreeMem(layout, bufferSize);
+
+    // Returns the created GroupCel
+    return groupCel;
+}
+
+// Creates the GroupCel from a layout in memory
+GroupCel *GroupCelLayoutInstantiate(void *layout, uint32 layoutSize, CCB **cels, uint32 celsCount) {
+
+    // Header of the layout
+    GroupCelLayoutHeader *header = (GroupCelLayoutHeader *)layout;
+    // Table of elements following the header
+    GroupCelElement *elements = NULL;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_LAYOUT == 1) { printf("*GroupCelLayoutInstantiate()*\n"); }
+
+    // If the layout is unknown or too small
+    if ((layout == NULL) || (layoutSize < sizeof(GroupCelLayoutHeader))) {
+        // Returns an error
+        printf("Error : GroupCel layout unknown.\n");
+        return NULL;
+    }
+
+    // If it's not a layout of a known version
+    if ((header->magic != GROUPCEL_LAYOUT_MAGIC) || (header->version != GROUPCEL_LAYOUT_VERSION)) {
+        // Returns an error
+        printf("Error : GroupCel layout version unknown.\n");
+        return NULL;
+    }
+
+    // If the table of elements is truncated, compared without multiplying so a huge count can't wrap
+    if (header->elementsCount > (layoutSize - sizeof(GroupCelLayoutHeader)) / sizeof(GroupCelElement)) {
+        // Returns an error
+        printf("Error : GroupCel layout truncated.\n");
+        return NULL;
+    }
+
+    // The table of elements follows the header
+    elements = (GroupCelElement *)(header + 1);
+
+    // Creates the GroupCel
+    groupCel = GroupCelInitialization(header->position.x, header->position.y, header->size.x, header->size.y, header->celsCount);
+    // If it fails
+    if (groupCel == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    // Stores the elements and links them in a single pass
+    if (GroupCelElementsTableConfiguration(groupCel, elements, header->elementsCount, cels, celsCount) < 0) {
+        GroupCelCleanup(groupCel);
+        // Returns an error
+        printf("Error <- GroupCelElementsTableConfiguration()\n");
+        return NULL;
+    }
+
+    // Stretching
+    groupCel->stretching = header->stretching;
+    // If the frame is stretched
+    if (GroupCelIsStretched(groupCel) == 1) {
+        // Activates stretching
+        groupCel->transformations |= GROUPCEL_FLAG_STRETCH;
+    }
+
+    // Rotation
+    GroupCelRotate(groupCel, header->rotationAngle % 256, header->rotationPivot.x, header->rotationPivot.y);
+    // If the group is rotated
+    if (groupCel->rotationAngle != 0) {
+        // Activates rotation
+        groupCel->transformations |= GROUPCEL_FLAG_ROTATE;
+    }
+
+    // Applies the transformations of the layout
+    GroupCelUpdate(groupCel);
+
+    // Returns the created GroupCel
+    return groupCel;
+}
@@ -0,0 +1,97 @@
+#ifndef GROUPCEL_LAYOUT_H
+#define GROUPCEL_LAYOUT_H
+
+/******************************************************************************
+**
+**  GroupCelLayout - Binary layout file of a GroupCel
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  This module describes a GroupCel in a compact binary file authored by a
+**  tool on the host: position, size, stretch, rotation and the table of
+**  elements (cel references and local positions).
+**
+**  The loader reads the whole file in a single I/O operation and builds the
+**  GroupCel and its links without any per-element setup call.
+**
+**  Important notes:
+**
+**    - All the words of the file are stored in big-endian, the native order
+**      of the 3DO. The loader uses the data in place without conversion.
+**
+**    - The cel references are indexes in the table of CCBs given to the loader.
+**      The Cels themselves are not part of the layout.
+**
+**    - The host tool writes the file with GroupCelLayoutWrite(), declared in
+**      GroupCelLayoutWriter.h. This header needs the SDK, that one doesn't: they
+**      share only GroupCelLayoutFormat.h.
+**
+**  File format :
+**
+**    GroupCelLayoutHeader
+**      - magic : 'GCLY'
+**      - version : Version of the format
+**      - position : Position of the GroupCel
+**      - size : Size of the GroupCel
+**      - stretching : Stretch quadrilateral in pixels (local 0..x, 0..y)
+**      - rotationAngle : Rotation angle in 256 units
+**      - rotationPivot : Absolute rotation pivot in pixels
+**      - celsCount : Total number of Cels in the GroupCel
+**      - elementsCount : Number of "GroupCelElement" following the header
+**
+**    GroupCelElement[elementsCount]
+**      - celReference : Index of the element's CCB in the table of cels
+**      - positionX, positionY : Position of the element within the GroupCel
+**
+**  Main Functions :
+**
+**    GroupCelLayoutLoad()
+**      -> Reads a layout file in a single I/O operation and creates the GroupCel.
+**
+**    GroupCelLayoutInstantiate()
+**      -> Creates the GroupCel from a layout already in memory.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel, GroupCelElement
+#include "GroupCel.h"
+// Point2D, Quad2D
+#include "Geometry.h"
+// int32
+#include "types.h"
+// GROUPCEL_LAYOUT_MAGIC, GROUPCEL_LAYOUT_VERSION
+#include "GroupCelLayoutFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_LAYOUT 0
+
+typedef struct {
+    // Identifier of the file
+    uint32 magic;
+    // Version of the format
+    uint32 version;
+    // Position
+    Point2D position;
+    // Dimension
+    Point2D size;
+    // Stretch quadrilateral in pixels (local 0..x, 0..y)
+    Quad2D stretching;
+    // Rotation angle in 256 units
+    uint32 rotationAngle;
+    // Absolute rotation pivot in pixels
+    Point2D rotationPivot;
+    // Total number of cels
+    uint32 celsCount;
+    // Number of elements following the header
+    uint32 elementsCount;
+} GroupCelLayoutHeader;
+
+// Reads a layout file and creates the GroupCel
+GroupCel *GroupCelLayoutLoad(char *filename, CCB **cels, uint32 celsCount);
+// Creates the GroupCel from a layout in memory
+GroupCel *GroupCelLayoutInstantiate(void *layout, uint32 layoutSize, CCB **cels, uint32 celsCount);
+
+#endif // GROUPCEL_LAYOUT_H
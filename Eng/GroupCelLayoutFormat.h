@@ -0,0 +1,22 @@
+#ifndef GROUPCEL_LAYOUT_FORMAT_H
+#define GROUPCEL_LAYOUT_FORMAT_H
+
+/******************************************************************************
+**
+**  GroupCelLayoutFormat - Identifiers of the GroupCel layout file
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The loader (GroupCelLayout.h) and the host writer (GroupCelLayoutWriter.h)
+**  both include this header. It includes nothing, so the host tool doesn't
+**  need the headers of the SDK to agree with the loader.
+**
+******************************************************************************/
+
+// Identifier of the file ('GCLY')
+#define GROUPCEL_LAYOUT_MAGIC 0x47434C59
+// Version of the format
+#define GROUPCEL_LAYOUT_VERSION 1
+
+#endif // GROUPCEL_LAYOUT_FORMAT_H
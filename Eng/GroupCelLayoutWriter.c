@@ -0,0 +1,98 @@
+
+#include "GroupCelLayoutWriter.h"
+
+// fopen(), fwrite(), printf()
+#include "stdio.h"
+
+// Writes a word in big-endian
+static int32_t GroupCelLayoutWriteWord(FILE *file, uint32_t word) {
+
+    // Bytes of the word
+    unsigned char bytes[4];
+
+    // Most significant byte first
+    bytes[0] = (unsigned char)(word >> 24);
+    bytes[1] = (unsigned char)(word >> 16);
+    bytes[2] = (unsigned char)(word >> 8);
+    bytes[3] = (unsigned char)word;
+
+    // Returns 1 on success, 0 otherwise
+    return (fwrite(bytes, 1, 4, file) == 4) ? 1 : 0;
+}
+
+// Writes a layout file (host)
+int32_t GroupCelLayoutWrite(const char *filename, const GroupCelLayoutDescription *description, const GroupCelLayoutEntry *elements) {
+
+    // File
+    FILE *file = NULL;
+    // Index to iterate through elements
+    uint32_t celIndex = 0;
+    // Result of the writes
+    int32_t written = 1;
+
+    if (DEBUG_GROUPCEL_LAYOUT_WRITER == 1) { printf("*GroupCelLayoutWrite()*\n"); }
+
+    // If the parameters are unknown
+    if ((filename == NULL) || (description == NULL) || (elements == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel layout unknown.\n");
+        return -1;
+    }
+
+    // If the table doesn't fit in the group
+    if ((description->elementsCount == 0) || (description->elementsCount > description->celsCount)) {
+        // Returns an error
+        printf("Error : GroupCel table of %u elements doesn't fit %u cels.\n", description->elementsCount, description->celsCount);
+        return -1;
+    }
+
+    // Opens the file
+    file = fopen(filename, "wb");
+    // If it's a failure
+    if (file == NULL) {
+        // Returns an error
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Header
+    written &= GroupCelLayoutWriteWord(file, GROUPCEL_LAYOUT_MAGIC);
+    written &= GroupCelLayoutWriteWord(file, GROUPCEL_LAYOUT_VERSION);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->position.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->position.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->size.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->size.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topLeft.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topLeft.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topRight.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topRight.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomRight.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomRight.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomLeft.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomLeft.y);
+    written &= GroupCelLayoutWriteWord(file, description->rotationAngle);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->rotationPivot.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->rotationPivot.y);
+    written &= GroupCelLayoutWriteWord(file, description->celsCount);
+    written &= GroupCelLayoutWriteWord(file, description->elementsCount);
+
+    // Table of elements
+    for (celIndex = 0; celIndex < description->elementsCount; celIndex++) {
+        written &= GroupCelLayoutWriteWord(file, elements[celIndex].celReference);
+        written &= GroupCelLayoutWriteWord(file, (uint32_t)elements[celIndex].positionX);
+        written &= GroupCelLayoutWriteWord(file, (uint32_t)elements[celIndex].positionY);
+    }
+
+    // Closes the file
+    if (fclose(file) != 0) { written = 0; }
+
+    // If a write failed
+    if (written == 0) {
+        // Returns an error
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Returns success
+    return 1;
+}
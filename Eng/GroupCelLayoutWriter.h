@@ -0,0 +1,94 @@
+#ifndef GROUPCEL_LAYOUT_WRITER_H
+#define GROUPCEL_LAYOUT_WRITER_H
+
+/******************************************************************************
+**
+**  GroupCelLayoutWriter - Writer of GroupCel layout files (host)
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The host tool includes this header instead of GroupCelLayout.h. It only
+**  needs the standard C library: the description of the group uses its own
+**  fixed-width types, and each word is written byte by byte in big-endian,
+**  whatever the order of the host.
+**
+**  Structure Roles :
+**
+**    GroupCelLayoutPoint
+**      - x, y : Coordinates in pixels
+**
+**    GroupCelLayoutQuad
+**      - topLeft, topRight, bottomRight, bottomLeft : Corners in pixels
+**
+**    GroupCelLayoutDescription
+**      - position : Position of the GroupCel
+**      - size : Size of the GroupCel
+**      - stretching : Stretch quadrilateral in pixels (local 0..x, 0..y)
+**      - rotationAngle : Rotation angle in 256 units
+**      - rotationPivot : Absolute rotation pivot in pixels
+**      - celsCount : Total number of Cels in the GroupCel
+**      - elementsCount : Number of "GroupCelLayoutEntry" in the table (1 to celsCount)
+**
+**    GroupCelLayoutEntry
+**      - celReference : Index of the element's CCB in the table of cels
+**      - positionX, positionY : Position of the element within the GroupCel
+**
+**  Main Functions :
+**
+**    GroupCelLayoutWrite()
+**      -> Writes a layout file read by GroupCelLayoutLoad().
+**
+******************************************************************************/
+
+// int32_t, uint32_t
+#include "stdint.h"
+// GROUPCEL_LAYOUT_MAGIC, GROUPCEL_LAYOUT_VERSION
+#include "GroupCelLayoutFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_LAYOUT_WRITER 0
+
+typedef struct {
+    // Coordinates in pixels
+    int32_t x;
+    int32_t y;
+} GroupCelLayoutPoint;
+
+typedef struct {
+    // Corners in pixels
+    GroupCelLayoutPoint topLeft;
+    GroupCelLayoutPoint topRight;
+    GroupCelLayoutPoint bottomRight;
+    GroupCelLayoutPoint bottomLeft;
+} GroupCelLayoutQuad;
+
+typedef struct {
+    // Position
+    GroupCelLayoutPoint position;
+    // Dimension
+    GroupCelLayoutPoint size;
+    // Stretch quadrilateral in pixels (local 0..x, 0..y)
+    GroupCelLayoutQuad stretching;
+    // Rotation angle in 256 units
+    uint32_t rotationAngle;
+    // Absolute rotation pivot in pixels
+    GroupCelLayoutPoint rotationPivot;
+    // Total number of cels
+    uint32_t celsCount;
+    // Number of elements in the table
+    uint32_t elementsCount;
+} GroupCelLayoutDescription;
+
+typedef struct {
+    // Index of the CCB in the table of cels
+    uint32_t celReference;
+    // Position
+    int32_t positionX;
+    int32_t positionY;
+} GroupCelLayoutEntry;
+
+// Writes a layout file
+int32_t GroupCelLayoutWrite(const char *filename, const GroupCelLayoutDescription *description, const GroupCelLayoutEntry *elements);
+
+#endif // GROUPCEL_LAYOUT_WRITER_H
@@ -0,0 +1,341 @@
+
+#include "GroupCelScroll.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM, MEMTYPE_CEL
+#include "mem.h"
+// memmove()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialization of a scrolling view
+GroupCelScroll *GroupCelScrollInitialization(int32 positionX, int32 positionY, uint32 viewSizeX, uint32 viewSizeY, const uint16 *map, uint32 mapColumns, uint32 mapRows, CCB **tileset, uint32 tilesetCount) {
+
+    // Scrolling view
+    GroupCelScroll *scroll = NULL;
+    // Table of the window's CCBs
+    CCB **cels = NULL;
+    // Size of the window in tiles
+    uint32 columns = 0;
+    uint32 rows = 0;
+    // Size of a tile
+    uint32 tileSizeX = 0;
+    uint32 tileSizeY = 0;
+    // Index to iterate through the window
+    uint32 column = 0;
+    uint32 row = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollInitialization()*\n"); }
+
+    // If the map or the tileset is unknown
+    if ((map == NULL) || (tileset == NULL) || (tilesetCount == 0) || (tileset[0] == NULL)) {
+        // Returns an error
+        printf("Error : GroupCel scroll map unknown.\n");
+        return NULL;
+    }
+
+    // The first Cel of the tileset gives the size of the tiles
+    tileSizeX = tileset[0]->ccb_Width;
+    tileSizeY = tileset[0]->ccb_Height;
+
+    // Corrects parameters
+    // Minimum tile = 1 x 1 pixel
+    tileSizeX = (tileSizeX > 1) ? tileSizeX : 1;
+    tileSizeY = (tileSizeY > 1) ? tileSizeY : 1;
+    // Minimum view = 1 x 1 pixel
+    viewSizeX = (viewSizeX > 1) ? viewSizeX : 1;
+    viewSizeY = (viewSizeY > 1) ? viewSizeY : 1;
+    // Minimum map = 1 x 1 tile
+    mapColumns = (mapColumns > 1) ? mapColumns : 1;
+    mapRows = (mapRows > 1) ? mapRows : 1;
+
+    // The window covers the view plus one column and one row
+    columns = (viewSizeX + tileSizeX - 1) / tileSizeX + 1;
+    rows = (viewSizeY + tileSizeY - 1) / tileSizeY + 1;
+
+    // Allocates memory for the view
+    scroll = (GroupCelScroll *)AllocMem(sizeof(GroupCelScroll), MEMTYPE_DRAM);
+    // If it's a failure
+    if (scroll == NULL) {
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel scroll.\n");
+        return NULL;
+    }
+
+    // Map and tileset
+    scroll->map = map;
+    scroll->mapColumns = mapColumns;
+    scroll->mapRows = mapRows;
+    scroll->tileset = tileset;
+    scroll->tilesetCount = tilesetCount;
+    // View
+    scroll->position.x = positionX;
+    scroll->position.y = positionY;
+    scroll->viewSize.x = viewSizeX;
+    scroll->viewSize.y = viewSizeY;
+    // Top left of the map
+    scroll->scroll.x = 0;
+    scroll->scroll.y = 0;
+    scroll->origin.x = 0;
+    scroll->origin.y = 0;
+
+    // Creates the grid GroupCel of the window
+    scroll->groupCel = GroupCelGridInitialization(positionX, positionY, columns, rows, tileSizeX, tileSizeY);
+    // Allocates a single block for the CCBs of the window
+    scroll->ccbs = (CCB *)AllocMem(columns * rows * sizeof(CCB), MEMTYPE_CEL);
+    // Allocates the table used to configure the grid
+    cels = (CCB **)AllocMem(columns * rows * sizeof(CCB *), MEMTYPE_DRAM);
+    // If it's a failure
+    if ((scroll->groupCel == NULL) || (scroll->ccbs == NULL) || (cels == NULL)) {
+        // Frees previously allocated memory
+        if (scroll->groupCel != NULL) { GroupCelCleanup(scroll->groupCel); }
+        if (scroll->ccbs != NULL) { FreeMem(scroll->ccbs, columns * rows * sizeof(CCB)); }
+        if (cels != NULL) { FreeMem(cels, columns * rows * sizeof(CCB *)); }
+        FreeMem(scroll, sizeof(GroupCelScroll));
+        // Displays an error message
+        printf("Error : Failed to allocate memory for GroupCel scroll window.\n");
+        return NULL;
+    }
+
+    // For each tile of the window
+    for (row = 0; row < rows; row++) {
+        for (column = 0; column < columns; column++) {
+            // Copies the header of the first Cel of the tileset
+            cels[row * columns + column] = &scroll->ccbs[row * columns + column];
+            *cels[row * columns + column] = *tileset[0];
+            // Shows the map tile
+            GroupCelScrollTileSource(scroll, cels[row * columns + column], (int32)column, (int32)row);
+        }
+    }
+
+    // Links the window once and places the tiles
+    if (GroupCelGridTilesConfiguration(scroll->groupCel, cels, columns * rows) < 0) {
+        // Frees previously allocated memory
+        FreeMem(cels, columns * rows * sizeof(CCB *));
+        GroupCelScrollCleanup(scroll);
+        // Returns an error
+        printf("Error <- GroupCelGridTilesConfiguration()\n");
+        return NULL;
+    }
+
+    // The last CCB of the window ends the chain
+    cels[columns * rows - 1]->ccb_NextPtr = NULL;
+    cels[columns * rows - 1]->ccb_Flags |= CCB_LAST;
+
+    // Frees the table, the grid keeps its own
+    FreeMem(cels, columns * rows * sizeof(CCB *));
+
+    // Returns the created view
+    return scroll;
+}
+
+// Scrolls the view
+void GroupCelScrollMove(GroupCelScroll *scroll, int32 moveX, int32 moveY) {
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollMove()*\n"); }
+
+    // If the view is unknown
+    if (scroll == NULL){
+        // Returns an error
+        printf("Error : GroupCel scroll unknown.\n");
+        return;
+    }
+
+    // Modifies the position of the view in the map
+    GroupCelScrollSetPosition(scroll, scroll->scroll.x + moveX, scroll->scroll.y + moveY);
+}
+
+// Sets the position of the view in the map
+void GroupCelScrollSetPosition(GroupCelScroll *scroll, int32 scrollX, int32 scrollY) {
+
+    // Size of a tile
+    int32 tileSizeX = 0;
+    int32 tileSizeY = 0;
+    // Map tile to show in the first tile of the window
+    int32 originX = 0;
+    int32 originY = 0;
+    // Index to iterate through the window
+    uint32 column = 0;
+    uint32 row = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollSetPosition()*\n"); }
+
+    // If the view is unknown
+    if (scroll == NULL){
+        // Returns an error
+        printf("Error : GroupCel scroll unknown.\n");
+        return;
+    }
+
+    // Size of a tile
+    tileSizeX = scroll->groupCel->tileSize.x;
+    tileSizeY = scroll->groupCel->tileSize.y;
+
+    // Keeps the view inside the map
+    scrollX = (scrollX < (int32)(scroll->mapColumns * tileSizeX) - scroll->viewSize.x) ? scrollX : (int32)(scroll->mapColumns * tileSizeX) - scroll->viewSize.x;
+    scrollY = (scrollY < (int32)(scroll->mapRows * tileSizeY) - scroll->viewSize.y) ? scrollY : (int32)(scroll->mapRows * tileSizeY) - scroll->viewSize.y;
+    scrollX = (scrollX > 0) ? scrollX : 0;
+    scrollY = (scrollY > 0) ? scrollY : 0;
+
+    // Applies the changes
+    scroll->scroll.x = scrollX;
+    scroll->scroll.y = scrollY;
+
+    // Map tile under the top left of the view
+    originX = scrollX / tileSizeX;
+    originY = scrollY / tileSizeY;
+
+    // If the view jumped further than the window
+    if ((originX - scroll->origin.x >= (int32)scroll->groupCel->gridColumns) || (scroll->origin.x - originX >= (int32)scroll->groupCel->gridColumns) ||
+        (originY - scroll->origin.y >= (int32)scroll->groupCel->gridRows) || (scroll->origin.y - originY >= (int32)scroll->groupCel->gridRows)) {
+        // Every tile of the window shows a new map tile
+        scroll->origin.x = originX;
+        scroll->origin.y = originY;
+        for (row = 0; row < scroll->groupCel->gridRows; row++) {
+            for (column = 0; column < scroll->groupCel->gridColumns; column++) {
+                GroupCelScrollTileSource(scroll, scroll->groupCel->tiles[row * scroll->groupCel->gridColumns + column], originX + (int32)column, originY + (int32)row);
+            }
+        }
+        // The tiles changed places: the grid must be placed again, even if its position doesn't change
+        scroll->groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    // Otherwise
+    } else {
+        // Recycles one column per tile boundary crossed
+        while (scroll->origin.x < originX) { GroupCelScrollRecycleColumn(scroll, 1); }
+        while (scroll->origin.x > originX) { GroupCelScrollRecycleColumn(scroll, -1); }
+        // Recycles one row per tile boundary crossed
+        while (scroll->origin.y < originY) { GroupCelScrollRecycleRow(scroll, 1); }
+        while (scroll->origin.y > originY) { GroupCelScrollRecycleRow(scroll, -1); }
+    }
+
+    // The scrolling inside a tile moves the whole window
+    GroupCelSetPosition(scroll->groupCel, scroll->position.x - (scrollX - originX * tileSizeX), scroll->position.y - (scrollY - originY * tileSizeY));
+}
+
+// Moves the first or last column of the window to the other side
+void GroupCelScrollRecycleColumn(GroupCelScroll *scroll, int32 direction) {
+
+    // Grid of the window
+    GroupCel *groupCel = scroll->groupCel;
+    // First tile of the current row
+    CCB **tiles = NULL;
+    // Tile that scrolled off
+    CCB *cel = NULL;
+    // Index to iterate through the rows
+    uint32 row = 0;
+
+    // Map tile shown by the first tile of the window
+    scroll->origin.x += direction;
+    // The tiles change places: the grid must be placed again, even if its position doesn't change
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // For each row of the window
+    for (row = 0; row < groupCel->gridRows; row++) {
+        tiles = &groupCel->tiles[row * groupCel->gridColumns];
+        // If the view moves right
+        if (direction > 0) {
+            // The first tile goes to the end of the row
+            cel = tiles[0];
+            memmove(&tiles[0], &tiles[1], (groupCel->gridColumns - 1) * sizeof(CCB *));
+            tiles[groupCel->gridColumns - 1] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)groupCel->gridColumns - 1, scroll->origin.y + (int32)row);
+        // Otherwise
+        } else {
+            // The last tile goes to the start of the row
+            cel = tiles[groupCel->gridColumns - 1];
+            memmove(&tiles[1], &tiles[0], (groupCel->gridColumns - 1) * sizeof(CCB *));
+            tiles[0] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x, scroll->origin.y + (int32)row);
+        }
+    }
+}
+
+// Moves the first or last row of the window to the other side
+void GroupCelScrollRecycleRow(GroupCelScroll *scroll, int32 direction) {
+
+    // Grid of the window
+    GroupCel *groupCel = scroll->groupCel;
+    // Tile that scrolled off
+    CCB *cel = NULL;
+    // Index to iterate through the window
+    uint32 column = 0;
+    uint32 row = 0;
+
+    // Map tile shown by the first tile of the window
+    scroll->origin.y += direction;
+    // The tiles change places: the grid must be placed again, even if its position doesn't change
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // For each column of the window
+    for (column = 0; column < groupCel->gridColumns; column++) {
+        // If the view moves down
+        if (direction > 0) {
+            // The top tile goes to the bottom of the column
+            cel = groupCel->tiles[column];
+            for (row = 0; row < groupCel->gridRows - 1; row++) {
+                groupCel->tiles[row * groupCel->gridColumns + column] = groupCel->tiles[(row + 1) * groupCel->gridColumns + column];
+            }
+            groupCel->tiles[(groupCel->gridRows - 1) * groupCel->gridColumns + column] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)column, scroll->origin.y + (int32)groupCel->gridRows - 1);
+        // Otherwise
+        } else {
+            // The bottom tile goes to the top of the column
+            cel = groupCel->tiles[(groupCel->gridRows - 1) * groupCel->gridColumns + column];
+            for (row = groupCel->gridRows - 1; row > 0; row--) {
+                groupCel->tiles[row * groupCel->gridColumns + column] = groupCel->tiles[(row - 1) * groupCel->gridColumns + column];
+            }
+            groupCel->tiles[column] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)column, scroll->origin.y);
+        }
+    }
+}
+
+// Gives a tile of the window the source data of a map tile
+void GroupCelScrollTileSource(GroupCelScroll *scroll, CCB *cel, int32 mapColumn, int32 mapRow) {
+
+    // Index of the tile in the tileset
+    uint32 tileIndex = GROUPCEL_SCROLL_EMPTY;
+
+    // If the map tile exists
+    if ((mapColumn >= 0) && (mapColumn < (int32)scroll->mapColumns) && (mapRow >= 0) && (mapRow < (int32)scroll->mapRows)) {
+        tileIndex = scroll->map[mapRow * scroll->mapColumns + mapColumn];
+    }
+
+    // If the cell is empty
+    if (tileIndex >= scroll->tilesetCount) {
+        // The Cel Engine skips the tile
+        cel->ccb_Flags |= CCB_SKIP;
+        return;
+    }
+
+    // Swaps the source data and the PLUT
+    cel->ccb_SourcePtr = scroll->tileset[tileIndex]->ccb_SourcePtr;
+    cel->ccb_PLUTPtr = scroll->tileset[tileIndex]->ccb_PLUTPtr;
+    cel->ccb_Flags &= ~CCB_SKIP;
+}
+
+// Deletes the view
+int32 GroupCelScrollCleanup(GroupCelScroll *scroll) {
+
+    // Size of the window in tiles
+    uint32 tilesCount = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollCleanup()*\n"); }
+
+    // If the view doesn't exist
+    if (scroll == NULL){
+        // Display an error
+        printf("Error : GroupCel scroll unknown.\n");
+        return -1;
+    }
+
+    // Free the memory used for the grid then for the CCBs of the window
+    tilesCount = scroll->groupCel->celsCount;
+    GroupCelCleanup(scroll->groupCel);
+    FreeMem(scroll->ccbs, tilesCount * sizeof(CCB));
+    // Free the memory used for the view
+    FreeMem(scroll, sizeof(GroupCelScroll));
+
+    // Return success
+    return 1;
+}
@@ -0,0 +1,131 @@
+#ifndef GROUPCEL_SCROLL_H
+#define GROUPCEL_SCROLL_H
+
+/******************************************************************************
+**
+**  GroupCelScroll - Scrolling view of a tile map built on a grid GroupCel
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  This module displays a large tile map through a window of tiles just
+**  bigger than the view: one extra column and one extra row. Only the CCBs
+**  of this window exist, and each one is given the source data of the map
+**  tile it currently shows.
+**
+**  When the view crosses a tile boundary, the column or row that scrolled off
+**  is moved to the other side of the window and only its CCBs receive new
+**  source data. The scrolling inside a tile is a move of the grid GroupCel.
+**  Memory and cost per frame depend on the size of the view, not the map.
+**
+**  Important notes:
+**
+**    - The map is an array of tile indexes, row by row, in the tileset.
+**      GROUPCEL_SCROLL_EMPTY leaves a cell empty. The map and the tileset are
+**      not copied: they must stay loaded as long as the view exists.
+**
+**    - All the Cels of the tileset must share the size and the format of the
+**      first one: only their source data and PLUT are swapped into the window.
+**
+**    - The CCBs of the window are linked once and the chain is never rebuilt:
+**      the tiles don't overlap, so the drawing order doesn't matter. The last
+**      CCB of the window ends the chain.
+**
+**    - Each change of the scroll must be applied by calling GroupCelUpdate()
+**      on the GroupCel of the view.
+**
+**  Structure Roles :
+**
+**    GroupCelScroll
+**      - groupCel : Grid GroupCel displaying the window
+**      - ccbs : Block of CCBs of the window
+**      - map : Tile indexes of the map, row by row
+**      - mapColumns, mapRows : Size of the map in tiles
+**      - tileset : CCBs providing the source data of the tiles
+**      - tilesetCount : Number of CCBs in the tileset
+**      - position : Position of the view on screen
+**      - viewSize : Size of the view in pixels
+**      - scroll : Position of the view in the map in pixels
+**      - origin : Map tile shown by the first tile of the window
+**
+**  Main Functions :
+**
+**    GroupCelScrollInitialization()
+**      -> Creates the view, its window of tiles, and shows the top left of the map.
+**
+**    GroupCelScrollMove()
+**      -> Scrolls the view using relative values.
+**
+**    GroupCelScrollSetPosition()
+**      -> Scrolls the view using absolute values in the map.
+**
+**    GroupCelScrollRecycleColumn() / GroupCelScrollRecycleRow()
+**      -> Internal functions moving the column or row that scrolled off to the
+**         other side of the window.
+**
+**    GroupCelScrollTileSource()
+**      -> Internal function giving a tile of the window the source data of a map tile.
+**
+**    GroupCelScrollCleanup()
+**      -> Frees the memory used by the view.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// Point2D
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_SCROLL 0
+
+// Empty cell of the map
+#define GROUPCEL_SCROLL_EMPTY 0xFFFF
+
+typedef struct {
+    // Grid GroupCel displaying the window
+    GroupCel *groupCel;
+    // Block of CCBs of the window
+    CCB *ccbs;
+    // Tile indexes of the map, row by row
+    const uint16 *map;
+    // Size of the map in tiles
+    uint32 mapColumns;
+    uint32 mapRows;
+    // CCBs providing the source data of the tiles
+    CCB **tileset;
+    // Number of CCBs in the tileset
+    uint32 tilesetCount;
+    // Position of the view on screen
+    Point2D position;
+    // Size of the view in pixels
+    Point2D viewSize;
+    // Position of the view in the map in pixels
+    Point2D scroll;
+    // Map tile shown by the first tile of the window
+    Point2D origin;
+} GroupCelScroll;
+
+// Initialization of a scrolling view
+GroupCelScroll *GroupCelScrollInitialization(int32 positionX, int32 positionY, uint32 viewSizeX, uint32 viewSizeY, const uint16 *map, uint32 mapColumns, uint32 mapRows, CCB **tileset, uint32 tilesetCount);
+
+// Scrolls the view
+void GroupCelScrollMove(GroupCelScroll *scroll, int32 moveX, int32 moveY);
+// Sets the position of the view in the map
+void GroupCelScrollSetPosition(GroupCelScroll *scroll, int32 scrollX, int32 scrollY);
+
+// Moves the first or last column of the window to the other side
+void GroupCelScrollRecycleColumn(GroupCelScroll *scroll, int32 direction);
+// Moves the first or last row of the window to the other side
+void GroupCelScrollRecycleRow(GroupCelScroll *scroll, int32 direction);
+// Gives a tile of the window the source data of a map tile
+void GroupCelScrollTileSource(GroupCelScroll *scroll, CCB *cel, int32 mapColumn, int32 mapRow);
+
+// Deletes the view
+int32 GroupCelScrollCleanup(GroupCelScroll *scroll);
+
+#endif // GROUPCEL_SCROLL_H
@@ -0,0 +1,124 @@
+// CelOverdraw
+#include "CelOverdraw.h"
+// GroupCel
+#include "GroupCel.h"
+// printf()
+#include "stdio.h"
+// memset()
+#include "string.h"
+
+// Size of the screen
+#define OVERDRAW_WIDTH 64
+#define OVERDRAW_HEIGHT 48
+// Elements of a group: 2 x 2 Cels of 16 x 12 pixels
+#define OVERDRAW_CELS_COUNT 4
+#define OVERDRAW_CEL_WIDTH 16
+#define OVERDRAW_CEL_HEIGHT 12
+// Number of lines of each ranking
+#define OVERDRAW_LINES 8
+// Number of Cels the scene occludes: the one under the cover
+#define OVERDRAW_OCCLUDED 1
+
+// Places an axis-aligned Cel of width x height pixels at (x, y)
+static void OverdrawCelInitialization(CCB *cel, int32 x, int32 y, int32 width, int32 height, uint32 flags) {
+
+    memset(cel, 0, sizeof(CCB));
+    cel->ccb_Flags = flags | CCB_LAST;
+    cel->ccb_XPos = x << 16;
+    cel->ccb_YPos = y << 16;
+    cel->ccb_HDX = 1 << 20;
+    cel->ccb_VDY = 1 << 16;
+    cel->ccb_Width = width;
+    cel->ccb_Height = height;
+}
+
+// Creates a group of 2 x 2 transparent elements at (x, y)
+static GroupCel *OverdrawGroupInitialization(CCB *cels, int32 x, int32 y) {
+
+    // Group created
+    GroupCel *groupCel = NULL;
+    // Index to iterate through elements
+    int32 celIndex = 0;
+
+    groupCel = GroupCelInitialization(x, y, OVERDRAW_CEL_WIDTH * 2, OVERDRAW_CEL_HEIGHT * 2, OVERDRAW_CELS_COUNT);
+    // If it's a failure
+    if (groupCel == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    for (celIndex = 0; celIndex < OVERDRAW_CELS_COUNT; celIndex++) {
+        OverdrawCelInitialization(&cels[celIndex], 0, 0, OVERDRAW_CEL_WIDTH, OVERDRAW_CEL_HEIGHT, 0);
+        GroupCelElementConfiguration(groupCel, celIndex, &cels[celIndex], (celIndex & 1) * OVERDRAW_CEL_WIDTH, (celIndex >> 1) * OVERDRAW_CEL_HEIGHT);
+    }
+
+    return groupCel;
+}
+
+// Analyses a scene of two groups over an opaque background, with a Cel hidden by
+// an opaque cover, prints the report and writes the heatmap to the file given
+int main(int argc, char **argv) {
+
+    // Heatmap written
+    char *filename = "overdraw.ppm";
+    // Background, Cel hidden and its cover
+    CCB background;
+    CCB hidden;
+    CCB cover;
+    // Elements of the groups
+    CCB axisCels[OVERDRAW_CELS_COUNT];
+    CCB rotatedCels[OVERDRAW_CELS_COUNT];
+    // Groups: one axis-aligned, one rotated over it
+    GroupCel *axis = NULL;
+    GroupCel *rotated = NULL;
+    // Analysis
+    CelOverdraw *overdraw = NULL;
+    // Number of Cels occluded
+    int32 occludedCount = 0;
+
+    // Arguments : [heatmap]
+    if (argc > 1) { filename = argv[1]; }
+
+    // Opaque background covering the screen, then the groups
+    OverdrawCelInitialization(&background, 0, 0, OVERDRAW_WIDTH, OVERDRAW_HEIGHT, CCB_BGND);
+    axis = OverdrawGroupInitialization(axisCels, 6, 6);
+    rotated = OverdrawGroupInitialization(rotatedCels, 22, 14);
+    if ((axis == NULL) || (rotated == NULL)) { return 1; }
+    GroupCelRotate(rotated, 32, 22 + OVERDRAW_CEL_WIDTH, 14 + OVERDRAW_CEL_HEIGHT);
+    GroupCelUpdate(axis);
+    GroupCelUpdate(rotated);
+
+    // A transparent Cel, then an opaque Cel covering it whole
+    OverdrawCelInitialization(&hidden, 48, 32, 10, 10, 0);
+    OverdrawCelInitialization(&cover, 46, 30, 16, 16, CCB_BGND);
+
+    // Display list: background, groups, hidden Cel, cover
+    GroupCelLinkAfter(axis, &background);
+    GroupCelLinkAfter(rotated, axis->tail);
+    LinkCel(rotated->tail, &hidden);
+    LinkCel(&hidden, &cover);
+
+    // Analysis of the screen with both groups
+    overdraw = CelOverdrawInitialization(OVERDRAW_WIDTH, OVERDRAW_HEIGHT, 2);
+    // If it's a failure
+    if (overdraw == NULL) {
+        // Returns an error
+        printf("Error <- CelOverdrawInitialization()\n");
+        return 1;
+    }
+    CelOverdrawAddGroup(overdraw, axis);
+    CelOverdrawAddGroup(overdraw, rotated);
+
+    CelOverdrawAnalyze(overdraw, &background);
+    occludedCount = CelOverdrawReport(overdraw, OVERDRAW_LINES);
+    if (CelOverdrawWriteHeatmap(overdraw, filename) < 0) { occludedCount = -1; }
+
+    // Deletes the groups, the last one linked first
+    CelOverdrawCleanup(overdraw);
+    GroupCelCleanup(rotated);
+    GroupCelCleanup(axis);
+
+    // Returns 1 if the Cel under the cover isn't the only one occluded
+    return (occludedCount == OVERDRAW_OCCLUDED) ? 0 : 1;
+}
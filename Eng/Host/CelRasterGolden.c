@@ -0,0 +1,174 @@
+// CelRaster
+#include "CelRaster.h"
+// CelQuadMap(), CelQuadMapReciprocal()
+#include "CelQuadMap.h"
+// RotatePoint2D(), Quad2D
+#include "Geometry.h"
+// printf(), sprintf()
+#include "stdio.h"
+// strcmp()
+#include "string.h"
+
+// Size of the framebuffer
+#define GOLDEN_WIDTH 96
+#define GOLDEN_HEIGHT 80
+// Elements of a group: a grid of 3 x 2 Cels of 12 x 10 pixels
+#define GOLDEN_COLUMNS 3
+#define GOLDEN_ROWS 2
+#define GOLDEN_CEL_WIDTH 12
+#define GOLDEN_CEL_HEIGHT 10
+// Sine and cosine of 30 degrees in 16.16 format
+#define GOLDEN_SIN30 32768
+#define GOLDEN_COS30 56756
+// Background of the framebuffer
+#define GOLDEN_BACKGROUND 0x202020
+
+typedef struct {
+    // Name of the reference image
+    char *name;
+    // Corners of the group in pixels (top left, top right, bottom right, bottom left)
+    int32 x[4];
+    int32 y[4];
+    // Rotation of 30 degrees around the center of the group
+    int32 rotate;
+    // 1 to map the elements with CelQuadMapReciprocal()
+    int32 reciprocal;
+} GoldenScene;
+
+// Axis-aligned, rotated and bilinear-stretched group
+static const GoldenScene goldenScenes[3] = {
+    { "axis", { 13, 83, 83, 13 }, { 21, 21, 59, 59 }, 0, 0 },
+    { "rotated", { 12, 84, 84, 12 }, { 20, 20, 60, 60 }, 1, 0 },
+    { "stretched", { 20, 76, 90, 6 }, { 10, 14, 70, 66 }, 0, 1 }
+};
+
+// Point of the group at (column / GOLDEN_COLUMNS, row / GOLDEN_ROWS), bilinear in 16.16 format
+static void GoldenGroupPoint(int32 *x, int32 *y, int32 column, int32 row, Point2D *point) {
+
+    // Weights of the corners, over GOLDEN_COLUMNS * GOLDEN_ROWS
+    long long weightTopLeft = (long long)(GOLDEN_COLUMNS - column) * (GOLDEN_ROWS - row);
+    long long weightTopRight = (long long)column * (GOLDEN_ROWS - row);
+    long long weightBottomRight = (long long)column * row;
+    long long weightBottomLeft = (long long)(GOLDEN_COLUMNS - column) * row;
+
+    point->x = (int32)(((x[0] * weightTopLeft + x[1] * weightTopRight + x[2] * weightBottomRight + x[3] * weightBottomLeft) << 16) / (GOLDEN_COLUMNS * GOLDEN_ROWS));
+    point->y = (int32)(((y[0] * weightTopLeft + y[1] * weightTopRight + y[2] * weightBottomRight + y[3] * weightBottomLeft) << 16) / (GOLDEN_COLUMNS * GOLDEN_ROWS));
+}
+
+// Maps the elements of a scene on its group and links them into a list
+static void GoldenSceneBuild(const GoldenScene *scene, CCB *cels) {
+
+    // Corners of the group in pixels
+    int32 x[4];
+    int32 y[4];
+    // Center of the group
+    int32 centerX = 0;
+    int32 centerY = 0;
+    // Quad of an element in 16.16 format
+    Quad2D quad;
+    // Reciprocals of the dimension of the elements
+    CelQuadMapReciprocals reciprocals;
+    // Index to iterate through corners and elements
+    int32 corner = 0;
+    int32 column = 0;
+    int32 row = 0;
+    CCB *cel = NULL;
+
+    // Corners of the group, rotated around its center
+    centerX = (scene->x[0] + scene->x[2]) / 2;
+    centerY = (scene->y[0] + scene->y[2]) / 2;
+    for (corner = 0; corner < 4; corner++) {
+        x[corner] = scene->x[corner];
+        y[corner] = scene->y[corner];
+        if (scene->rotate != 0) { RotatePoint2D(scene->x[corner], scene->y[corner], centerX, centerY, GOLDEN_SIN30, GOLDEN_COS30, &x[corner], &y[corner]); }
+    }
+
+    // Each element covers its cell of the group
+    memset(cels, 0, GOLDEN_COLUMNS * GOLDEN_ROWS * sizeof(CCB));
+    for (row = 0; row < GOLDEN_ROWS; row++) {
+        for (column = 0; column < GOLDEN_COLUMNS; column++) {
+
+            cel = &cels[row * GOLDEN_COLUMNS + column];
+            cel->ccb_Width = GOLDEN_CEL_WIDTH;
+            cel->ccb_Height = GOLDEN_CEL_HEIGHT;
+            cel->ccb_Flags = CCB_LAST;
+
+            GoldenGroupPoint(x, y, column, row, &quad.topLeft);
+            GoldenGroupPoint(x, y, column + 1, row, &quad.topRight);
+            GoldenGroupPoint(x, y, column + 1, row + 1, &quad.bottomRight);
+            GoldenGroupPoint(x, y, column, row + 1, &quad.bottomLeft);
+
+            if (scene->reciprocal != 0) {
+                CelQuadMapReciprocalsInitialization(cel, &reciprocals);
+                CelQuadMapReciprocal(cel, &quad, &reciprocals);
+            } else {
+                CelQuadMap(cel, &quad);
+            }
+
+            // Links the previous element to this one
+            if (cel != cels) { LinkCel(cel - 1, cel); }
+        }
+    }
+}
+
+// Draws each scene and compares it with its reference image, or writes it with -write
+int main(int argc, char **argv) {
+
+    // Folder of the reference images
+    char *folder = "Golden";
+    // 1 to write the reference images instead of comparing
+    int32 write = 0;
+    // Elements of the group
+    CCB cels[GOLDEN_COLUMNS * GOLDEN_ROWS];
+    // Framebuffer
+    CelRaster *raster = NULL;
+    // Reference image
+    char filename[256];
+    // Index to iterate through arguments and scenes
+    int32 argument = 0;
+    int32 scene = 0;
+    // Number of pixels differing
+    int32 differences = 0;
+    // Number of scenes failing
+    int32 failures = 0;
+
+    // Arguments : [-write] [folder]
+    for (argument = 1; argument < argc; argument++) {
+        if (strcmp(argv[argument], "-write") == 0) { write = 1; } else { folder = argv[argument]; }
+    }
+
+    // Creates the framebuffer
+    raster = CelRasterInitialization(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    // If it's a failure
+    if (raster == NULL) {
+        // Returns an error
+        printf("Error <- CelRasterInitialization()\n");
+        return 1;
+    }
+
+    for (scene = 0; scene < 3; scene++) {
+
+        // Draws the group
+        GoldenSceneBuild(&goldenScenes[scene], cels);
+        CelRasterClear(raster, GOLDEN_BACKGROUND);
+        CelRasterDrawCels(raster, cels);
+        sprintf(filename, "%s/%s.ppm", folder, goldenScenes[scene].name);
+
+        // Writes the reference image
+        if (write == 1) {
+            if (CelRasterWritePPM(raster, filename) < 0) { failures++; }
+            printf("%s : written\n", filename);
+            continue;
+        }
+
+        // Compares with the reference image, exactly
+        differences = CelRasterCompare(raster, filename, 0);
+        if (differences != 0) { failures++; }
+        printf("%s : %s (%d pixels differ)\n", filename, (differences == 0) ? "ok" : "FAILED", differences);
+    }
+
+    CelRasterCleanup(raster);
+
+    // Returns 1 if a scene failed
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,127 @@
+// GroupCel
+#include "GroupCel.h"
+// Convert32_F16()
+#include "operamath.h"
+// printf()
+#include "stdio.h"
+// memset()
+#include "string.h"
+
+// Elements of the template: 2 x 2 Cels of 16 x 8 pixels
+#define CHECK_CELS_COUNT 4
+#define CHECK_CEL_WIDTH 16
+#define CHECK_CEL_HEIGHT 8
+// Position of the template and offset of the second instance
+#define CHECK_POSITION_X 40
+#define CHECK_POSITION_Y 30
+#define CHECK_OFFSET_X 10
+#define CHECK_OFFSET_Y 5
+
+// Compares the CCBs of an instance with those of its template, offset by (offsetX, offsetY) pixels
+static int32 CheckInstance(char *name, GroupCel *templateGroupCel, GroupCel *instance, int32 offsetX, int32 offsetY) {
+
+    // CCBs compared
+    CCB *cel = NULL;
+    CCB *instanceCel = NULL;
+    // Index to iterate through elements
+    uint32 celIndex = 0;
+    // Number of elements differing
+    int32 failures = 0;
+
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+
+        cel = templateGroupCel->cels[celIndex].cel;
+        instanceCel = instance->cels[celIndex].cel;
+
+        // The instance has its own header, with the same projection moved by the offset
+        if ((instanceCel == cel) ||
+            (instanceCel->ccb_SourcePtr != cel->ccb_SourcePtr) ||
+            (instanceCel->ccb_XPos != cel->ccb_XPos + Convert32_F16(offsetX)) ||
+            (instanceCel->ccb_YPos != cel->ccb_YPos + Convert32_F16(offsetY)) ||
+            (instanceCel->ccb_HDX != cel->ccb_HDX) || (instanceCel->ccb_HDY != cel->ccb_HDY) ||
+            (instanceCel->ccb_VDX != cel->ccb_VDX) || (instanceCel->ccb_VDY != cel->ccb_VDY) ||
+            (instanceCel->ccb_HDDX != cel->ccb_HDDX) || (instanceCel->ccb_HDDY != cel->ccb_HDDY)) {
+            printf("%s : element %u differs\n", name, celIndex);
+            printf("  template : X %d Y %d HDX %d HDY %d VDX %d VDY %d HDDX %d HDDY %d\n", cel->ccb_XPos, cel->ccb_YPos, cel->ccb_HDX, cel->ccb_HDY, cel->ccb_VDX, cel->ccb_VDY, cel->ccb_HDDX, cel->ccb_HDDY);
+            printf("  instance : X %d Y %d HDX %d HDY %d VDX %d VDY %d HDDX %d HDDY %d\n", instanceCel->ccb_XPos, instanceCel->ccb_YPos, instanceCel->ccb_HDX, instanceCel->ccb_HDY, instanceCel->ccb_VDX, instanceCel->ccb_VDY, instanceCel->ccb_HDDX, instanceCel->ccb_HDDY);
+            failures++;
+        }
+    }
+
+    printf("%s : %s\n", name, (failures == 0) ? "ok" : "FAILED");
+    return failures;
+}
+
+// Instantiates a plain, a stretched and a rotated template and compares the CCBs
+int main(void) {
+
+    // Source data shared by the Cels
+    static CelData pixels[CHECK_CEL_WIDTH * CHECK_CEL_HEIGHT / 2];
+    // Cels of the template
+    CCB cels[CHECK_CELS_COUNT];
+    // Template, instances and their pool
+    GroupCel *templateGroupCel = NULL;
+    GroupCel *instance = NULL;
+    GroupCelPool *pool = NULL;
+    // Index to iterate through Cels and transformations
+    int32 celIndex = 0;
+    int32 transformation = 0;
+    // Names of the transformations
+    char *names[3] = { "plain", "stretched", "rotated" };
+    char name[64];
+    // Number of checks failing
+    int32 failures = 0;
+
+    // Pool of the instances
+    pool = GroupCelPoolInitialization(CHECK_CELS_COUNT * 2);
+    if (pool == NULL) {
+        // Returns an error
+        printf("Error <- GroupCelPoolInitialization()\n");
+        return 1;
+    }
+
+    for (transformation = 0; transformation < 3; transformation++) {
+
+        // Cels of 16 x 8 pixels sharing their source data
+        memset(cels, 0, sizeof(cels));
+        for (celIndex = 0; celIndex < CHECK_CELS_COUNT; celIndex++) {
+            cels[celIndex].ccb_SourcePtr = pixels;
+            cels[celIndex].ccb_Width = CHECK_CEL_WIDTH;
+            cels[celIndex].ccb_Height = CHECK_CEL_HEIGHT;
+            cels[celIndex].ccb_HDX = 1 << 20;
+            cels[celIndex].ccb_VDY = 1 << 16;
+        }
+
+        // Template of 2 x 2 elements
+        templateGroupCel = GroupCelInitialization(CHECK_POSITION_X, CHECK_POSITION_Y, CHECK_CEL_WIDTH * 2, CHECK_CEL_HEIGHT * 2, CHECK_CELS_COUNT);
+        if (templateGroupCel == NULL) {
+            // Returns an error
+            printf("Error <- GroupCelInitialization()\n");
+            return 1;
+        }
+        for (celIndex = 0; celIndex < CHECK_CELS_COUNT; celIndex++) {
+            GroupCelElementConfiguration(templateGroupCel, celIndex, &cels[celIndex], (celIndex & 1) * CHECK_CEL_WIDTH, (celIndex >> 1) * CHECK_CEL_HEIGHT);
+        }
+        if (transformation == 1) { GroupCelStretch(templateGroupCel, 0, 0, 40, 4, 36, 20, -4, 16); }
+        if (transformation == 2) { GroupCelRotate(templateGroupCel, 32, CHECK_POSITION_X + CHECK_CEL_WIDTH, CHECK_POSITION_Y + CHECK_CEL_HEIGHT); }
+        GroupCelUpdate(templateGroupCel);
+
+        // Instance on the template, then moved by an offset
+        instance = GroupCelInstantiate(templateGroupCel, pool, CHECK_POSITION_X, CHECK_POSITION_Y);
+        sprintf(name, "%s instance", names[transformation]);
+        failures += (instance != NULL) ? CheckInstance(name, templateGroupCel, instance, 0, 0) : 1;
+        if (instance != NULL) { GroupCelCleanup(instance); }
+
+        instance = GroupCelInstantiate(templateGroupCel, pool, CHECK_POSITION_X + CHECK_OFFSET_X, CHECK_POSITION_Y + CHECK_OFFSET_Y);
+        sprintf(name, "%s instance moved", names[transformation]);
+        failures += (instance != NULL) ? CheckInstance(name, templateGroupCel, instance, CHECK_OFFSET_X, CHECK_OFFSET_Y) : 1;
+        if (instance != NULL) { GroupCelCleanup(instance); }
+
+        GroupCelCleanup(templateGroupCel);
+    }
+
+    GroupCelPoolCleanup(pool);
+
+    // Returns 1 if a check failed
+    return (failures == 0) ? 0 : 1;
+}
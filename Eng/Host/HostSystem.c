@@ -0,0 +1,47 @@
+
+// AllocMem(), FreeMem()
+#include "mem.h"
+// CreateItem(), DeleteItem()
+#include "item.h"
+// DrawCels()
+#include "graphics.h"
+// calloc(), free()
+#include "stdlib.h"
+
+// Allocates a block, cleared
+void *AllocMem(int32 size, uint32 type) {
+
+    // The type of memory doesn't matter on the host
+    (void)type;
+    return calloc(1, (size_t)size);
+}
+
+// Frees a block
+void FreeMem(void *block, int32 size) {
+
+    (void)size;
+    free(block);
+}
+
+// Creates an item (always fails on the host)
+Item CreateItem(int32 type, TagArg *tags) {
+
+    (void)type;
+    (void)tags;
+    return -1;
+}
+
+// Deletes an item
+Err DeleteItem(Item item) {
+
+    (void)item;
+    return 0;
+}
+
+// Draws a list of CCBs into a bitmap (does nothing on the host)
+int32 DrawCels(Item bitmap, CCB *ccb) {
+
+    (void)bitmap;
+    (void)ccb;
+    return 0;
+}
@@ -0,0 +1,36 @@
+#ifndef HOST_ANIMUTILS_H
+#define HOST_ANIMUTILS_H
+
+/******************************************************************************
+**
+**  animutils.h - Animations of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  Only the structures read by GroupCel are defined. The host build doesn't
+**  load animations: a host check builds its frames in code.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+typedef struct AnimFrame {
+    // CCB, PLUT and pixels of the frame
+    CCB *af_CCB;
+    char *af_PLUT;
+    char *af_pix;
+    int32 reserved;
+} AnimFrame;
+
+typedef struct ANIM {
+    // Number of frames and current frame in 16.16 format
+    int32 num_Frames;
+    frac16 cur_Frame;
+    int32 num_Alloced_Frames;
+    // Frames
+    AnimFrame *pentries;
+} ANIM;
+
+#endif // HOST_ANIMUTILS_H
@@ -0,0 +1,26 @@
+#ifndef HOST_CELUTILS_H
+#define HOST_CELUTILS_H
+
+/******************************************************************************
+**
+**  celutils.h - Cel utilities of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  Only declared: the host build doesn't load Cel files, a host check builds
+**  its CCBs in code.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+// Loads a Cel file
+CCB *LoadCel(char *filename, uint32 type);
+// Unloads a Cel
+void UnloadCel(CCB *cel);
+// Copies a Cel
+CCB *CloneCel(CCB *cel, int32 options);
+
+#endif // HOST_CELUTILS_H
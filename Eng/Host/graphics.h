@@ -0,0 +1,91 @@
+#ifndef HOST_GRAPHICS_H
+#define HOST_GRAPHICS_H
+
+/******************************************************************************
+**
+**  graphics.h - CCB of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The CCB keeps the order of the words of the Cel Engine. On a 64-bit host
+**  the pointers are wider, so a CCB here must not be read from a file or a
+**  bundle: the host build only fills it in code.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Source data of a Cel
+typedef uint32 CelData;
+
+typedef struct CCB {
+    // Flags
+    uint32 ccb_Flags;
+    // Next CCB, source data and PLUT
+    struct CCB *ccb_NextPtr;
+    CelData *ccb_SourcePtr;
+    void *ccb_PLUTPtr;
+    // Position in 16.16 format
+    int32 ccb_XPos;
+    int32 ccb_YPos;
+    // Horizontal step in 12.20 format
+    int32 ccb_HDX;
+    int32 ccb_HDY;
+    // Vertical step in 16.16 format
+    int32 ccb_VDX;
+    int32 ccb_VDY;
+    // Change of the horizontal step per row in 12.20 format
+    int32 ccb_HDDX;
+    int32 ccb_HDDY;
+    // Pixel processor control and preambles
+    uint32 ccb_PIXC;
+    uint32 ccb_PRE0;
+    uint32 ccb_PRE1;
+    // Dimension in pixels
+    int32 ccb_Width;
+    int32 ccb_Height;
+} CCB;
+
+// Flags of the CCB
+#define CCB_SKIP 0x80000000
+#define CCB_LAST 0x40000000
+#define CCB_NPABS 0x20000000
+#define CCB_SPABS 0x10000000
+#define CCB_PPABS 0x08000000
+#define CCB_LDSIZE 0x04000000
+#define CCB_LDPRS 0x02000000
+#define CCB_LDPPMP 0x01000000
+#define CCB_LDPLUT 0x00800000
+#define CCB_CCBPRE 0x00400000
+#define CCB_YOXY 0x00200000
+#define CCB_ACW 0x00040000
+#define CCB_ACCW 0x00020000
+#define CCB_PACKED 0x00000200
+#define CCB_BGND 0x00000020
+#define CCB_NOBLK 0x00000010
+
+// Preambles of an uncoded 16-bit linear Cel
+#define PRE0_BPP_16 0x00000006
+#define PRE0_LINEAR 0x00000010
+#define PRE0_VCNT_SHIFT 6
+#define PRE1_TLHPCNT_SHIFT 0
+#define PRE1_LRFORM 0x00000800
+#define PRE1_TLLSB_PDC0 0x00001000
+#define PRE1_WOFFSET10_SHIFT 16
+
+// Type of a bitmap item and tags of its creation
+#define TYPE_BITMAP 5
+#define CBM_TAG_DONE 0
+#define CBM_TAG_WIDTH 11
+#define CBM_TAG_HEIGHT 12
+#define CBM_TAG_BUFFER 13
+
+// Draws a list of CCBs into a bitmap (does nothing on the host)
+int32 DrawCels(Item bitmap, CCB *ccb);
+
+// Links a CCB to the next one
+#define LinkCel(ccb, next) { (ccb)->ccb_NextPtr = (next); (ccb)->ccb_Flags &= ~CCB_LAST; }
+
+#endif // HOST_GRAPHICS_H
@@ -0,0 +1,24 @@
+#ifndef HOST_ITEM_H
+#define HOST_ITEM_H
+
+/******************************************************************************
+**
+**  item.h - Items of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  There is no kernel on the host: CreateItem() always fails, so what needs a
+**  bitmap (GroupCelFlatten()) reports an error instead of drawing.
+**
+******************************************************************************/
+
+// Item, TagArg
+#include "types.h"
+
+// Creates an item (always fails on the host)
+Item CreateItem(int32 type, TagArg *tags);
+// Deletes an item
+Err DeleteItem(Item item);
+
+#endif // HOST_ITEM_H
@@ -0,0 +1,30 @@
+#ifndef HOST_MEM_H
+#define HOST_MEM_H
+
+/******************************************************************************
+**
+**  mem.h - Memory of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  AllocMem() clears the block like MEMTYPE_FILL with 0 would, so a host check
+**  never reads an uninitialized field. The types of memory are ignored.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Types of memory
+#define MEMTYPE_DRAM 0x00000001
+#define MEMTYPE_VRAM 0x00000002
+#define MEMTYPE_CEL 0x00000004
+#define MEMTYPE_FILL 0x00000008
+
+// Allocates a block, cleared
+void *AllocMem(int32 size, uint32 type);
+// Frees a block
+void FreeMem(void *block, int32 size);
+
+#endif // HOST_MEM_H
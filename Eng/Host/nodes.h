@@ -0,0 +1,19 @@
+#ifndef HOST_NODES_H
+#define HOST_NODES_H
+
+/******************************************************************************
+**
+**  nodes.h - Nodes of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+******************************************************************************/
+
+// Identifier of a type of node in a subsystem
+#define MKNODEID(subsystem, type) (((subsystem) << 8) | (type))
+
+// Subsystem of the graphics
+#define NODE_GRAPHICS 1
+
+#endif // HOST_NODES_H
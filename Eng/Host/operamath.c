@@ -0,0 +1,33 @@
+
+#include "operamath.h"
+
+// sin(), cos(), floor()
+#include "math.h"
+
+// Product in 16.16 format
+frac16 MulSF16(frac16 a, frac16 b) {
+
+    // Upper bits of the 64-bit product, rounded down
+    return (frac16)(((int64_t)a * b) >> 16);
+}
+
+// Product in 2.30 format
+frac30 MulSF30(frac30 a, frac30 b) {
+
+    // Upper bits of the 64-bit product, rounded down
+    return (frac30)(((int64_t)a * b) >> 30);
+}
+
+// Sine in 16.16 format, of an angle in 16.16 format where 256 is a turn
+frac16 SinF16(frac16 angle) {
+
+    // Rounded to the nearest
+    return (frac16)floor(sin((double)angle * 3.14159265358979323846 / (128.0 * 65536.0)) * 65536.0 + 0.5);
+}
+
+// Cosine in 16.16 format, of an angle in 16.16 format where 256 is a turn
+frac16 CosF16(frac16 angle) {
+
+    // Rounded to the nearest
+    return (frac16)floor(cos((double)angle * 3.14159265358979323846 / (128.0 * 65536.0)) * 65536.0 + 0.5);
+}
@@ -0,0 +1,33 @@
+#ifndef HOST_OPERAMATH_H
+#define HOST_OPERAMATH_H
+
+/******************************************************************************
+**
+**  operamath.h - Fixed point of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  MulSF16() and MulSF30() keep the upper bits of the 64-bit product, so they
+**  round down like the ARM routines of the SDK. SinF16() and CosF16() round
+**  the sine of the C library to the nearest. They are defined in operamath.c
+**  of this folder.
+**
+******************************************************************************/
+
+// frac16, frac30
+#include "types.h"
+
+// Conversions between integers and 16.16 format
+#define Convert32_F16(x) ((int32)(x) << 16)
+#define ConvertF16_32(x) ((int32)(x) >> 16)
+
+// Product in 16.16 format
+frac16 MulSF16(frac16 a, frac16 b);
+// Product in 2.30 format
+frac30 MulSF30(frac30 a, frac30 b);
+// Sine and cosine in 16.16 format, of an angle in 16.16 format where 256 is a turn
+frac16 SinF16(frac16 angle);
+frac16 CosF16(frac16 angle);
+
+#endif // HOST_OPERAMATH_H
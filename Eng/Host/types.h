@@ -0,0 +1,49 @@
+#ifndef HOST_TYPES_H
+#define HOST_TYPES_H
+
+/******************************************************************************
+**
+**  types.h - Types of the 3DO SDK for the host build
+**  
+**  Author : Christophe Geoffroy (Topper) - MIT License
+**  Last updated : 10-19-2026
+**
+**  The host build (Makefile of this folder) puts this folder before the
+**  sources in the include path, so CelRaster, CelQuadMap, Geometry, GroupCel
+**  and CelOverdraw build with a standard C compiler, without the SDK. Only the
+**  types they use are defined, with the sizes they have on the 3DO.
+**
+******************************************************************************/
+
+// int8_t ... uint32_t
+#include "stdint.h"
+// va_list, included by types.h on the 3DO
+#include "stdarg.h"
+
+// Integers
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+
+// Fixed point in 16.16 and 2.30 formats
+typedef int32 frac16;
+typedef int32 frac30;
+
+// Item of the kernel and error code
+typedef int32 Item;
+typedef int32 Err;
+
+// Tag of the creation of an item
+typedef struct TagArg {
+    uint32 ta_Tag;
+    void *ta_Arg;
+} TagArg;
+
+// Booleans
+#define TRUE 1
+#define FALSE 0
+
+#endif // HOST_TYPES_H
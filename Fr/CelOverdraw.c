@@ -0,0 +1,463 @@
+
+#include "CelOverdraw.h"
+
+// malloc(), realloc(), free(), qsort()
+#include "stdlib.h"
+// printf()
+#include "stdio.h"
+
+// Couleurs de la carte de chaleur par profondeur de surdessin, la dernière pour 7 et plus
+static const uint32 CelOverdrawHeatmapColors[8] = {
+    0x000000, 0x203080, 0x20A040, 0xA0C020, 0xE0E020, 0xF08020, 0xE02020, 0xFFFFFF
+};
+
+// Contexte de la projection d'un Cel dans l'analyse
+typedef struct {
+    // Analyse
+    CelOverdraw *overdraw;
+    // Position du Cel dans la liste
+    int32 index;
+} CelOverdrawContext;
+
+// Compte un pixel écrit par un Cel
+static void CelOverdrawCoverPlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel projeté
+    CelOverdrawContext *plot = (CelOverdrawContext *)context;
+    CelOverdraw *overdraw = plot->overdraw;
+    // Index du pixel
+    int32 pixel = y * overdraw->width + x;
+
+    // Seule la position à l'écran compte
+    (void)u;
+    (void)v;
+
+    // Coût de remplissage du Cel
+    overdraw->cels[plot->index].covered++;
+    overdraw->fills++;
+
+    // Profondeur de surdessin du pixel
+    if (overdraw->depth[pixel] == 0) { overdraw->touched++; }
+    if (overdraw->depth[pixel] < 0xFFFF) { overdraw->depth[pixel]++; }
+    if (overdraw->depth[pixel] > overdraw->depthMax) { overdraw->depthMax = overdraw->depth[pixel]; }
+
+    // Un Cel opaque cache les pixels des Cels projetés avant lui
+    if (overdraw->cels[plot->index].opaque == 1) { overdraw->front[pixel] = plot->index; }
+}
+
+// Compte un pixel d'un Cel encore visible à la fin de la liste
+static void CelOverdrawVisiblePlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel projeté
+    CelOverdrawContext *plot = (CelOverdrawContext *)context;
+    CelOverdraw *overdraw = plot->overdraw;
+
+    // Seule la position à l'écran compte
+    (void)u;
+    (void)v;
+
+    // Visible si aucun Cel opaque n'a été projeté dessus ensuite
+    if (overdraw->front[y * overdraw->width + x] <= plot->index) { overdraw->cels[plot->index].visible++; }
+}
+
+// Classe les Cels par coût de remplissage, le plus coûteux en premier
+static int CelOverdrawCompareCels(const void *first, const void *second) {
+
+    // Cels comparés
+    const CelOverdrawCel *celA = *(const CelOverdrawCel **)first;
+    const CelOverdrawCel *celB = *(const CelOverdrawCel **)second;
+
+    if (celA->covered != celB->covered) { return (celA->covered > celB->covered) ? -1 : 1; }
+    // Même coût : ordre de la liste
+    return (celA < celB) ? -1 : ((celA > celB) ? 1 : 0);
+}
+
+// Classe les groupes par coût de remplissage, le plus coûteux en premier
+static int CelOverdrawCompareGroups(const void *first, const void *second) {
+
+    // Groupes comparés
+    const CelOverdrawGroup *groupA = *(const CelOverdrawGroup **)first;
+    const CelOverdrawGroup *groupB = *(const CelOverdrawGroup **)second;
+
+    if (groupA->covered != groupB->covered) { return (groupA->covered > groupB->covered) ? -1 : 1; }
+    // Même coût : ordre d'ajout
+    return (groupA < groupB) ? -1 : ((groupA > groupB) ? 1 : 0);
+}
+
+// Initialisation d'une analyse
+CelOverdraw *CelOverdrawInitialization(int32 width, int32 height, int32 groupsCapacity) {
+
+    // Analyse
+    CelOverdraw *overdraw = NULL;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawInitialization()*\n"); }
+
+    // Corrige les paramètres
+    // Ecran minimum = 1 x 1 pixel
+    width = (width > 1) ? width : 1;
+    height = (height > 1) ? height : 1;
+    // Minimum 1 groupe
+    groupsCapacity = (groupsCapacity > 1) ? groupsCapacity : 1;
+
+    // Alloue la mémoire pour l'analyse
+    overdraw = (CelOverdraw *)malloc(sizeof(CelOverdraw));
+    // Si c'est un échec
+    if (overdraw == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for CelOverdraw.\n");
+        return NULL;
+    }
+
+    // Alloue la mémoire pour les pixels et les groupes
+    overdraw->depth = (uint16 *)malloc((size_t)width * height * sizeof(uint16));
+    overdraw->front = (int32 *)malloc((size_t)width * height * sizeof(int32));
+    overdraw->groups = (CelOverdrawGroup *)malloc((size_t)groupsCapacity * sizeof(CelOverdrawGroup));
+    // Si c'est un échec
+    if ((overdraw->depth == NULL) || (overdraw->front == NULL) || (overdraw->groups == NULL)) {
+        // Libère la mémoire précédemment allouée
+        free(overdraw->depth);
+        free(overdraw->front);
+        free(overdraw->groups);
+        free(overdraw);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for CelOverdraw pixels.\n");
+        return NULL;
+    }
+
+    overdraw->width = width;
+    overdraw->height = height;
+    overdraw->cels = NULL;
+    overdraw->celsCount = 0;
+    overdraw->celsCapacity = 0;
+    overdraw->groupsCount = 0;
+    overdraw->groupsCapacity = groupsCapacity;
+    overdraw->opaque = CelOverdrawDefaultOpaque;
+    overdraw->fills = 0;
+    overdraw->touched = 0;
+    overdraw->depthMax = 0;
+
+    // Retourne l'analyse créée
+    return overdraw;
+}
+
+// Ajoute un GroupCel à l'analyse
+int32 CelOverdrawAddGroup(CelOverdraw *overdraw, GroupCel *groupCel) {
+
+    // Groupe ajouté
+    CelOverdrawGroup *group = NULL;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawAddGroup()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((overdraw == NULL) || (groupCel == NULL)) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si tous les groupes sont utilisés
+    if (overdraw->groupsCount >= overdraw->groupsCapacity) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw full (%d groups).\n", overdraw->groupsCapacity);
+        return -1;
+    }
+
+    group = &overdraw->groups[overdraw->groupsCount];
+    group->groupCel = groupCel;
+    group->celsCount = 0;
+    group->covered = 0;
+    group->visible = 0;
+    group->occludedCount = 0;
+
+    // Retourne l'index du groupe
+    return overdraw->groupsCount++;
+}
+
+// Test par défaut d'un Cel opaque
+int32 CelOverdrawDefaultOpaque(CCB *ccb, int32 cel) {
+
+    // Seuls les drapeaux du CCB comptent
+    (void)cel;
+
+    // Sans CCB_BGND, les pixels de valeur 0 sont transparents
+    return ((ccb->ccb_Flags & CCB_BGND) != 0) ? 1 : 0;
+}
+
+// Mesure la couverture, le surdessin et le masquage d'une liste de CCB
+int32 CelOverdrawAnalyze(CelOverdraw *overdraw, CCB *ccb) {
+
+    // CCB courant
+    CCB *current = NULL;
+    // Nombre de Cels dans la liste
+    int32 celsCount = 0;
+    // Cels de la liste
+    CelOverdrawCel *cels = NULL;
+    CelOverdrawCel *cel = NULL;
+    // Groupe d'un Cel
+    CelOverdrawGroup *group = NULL;
+    // Cel projeté
+    CelOverdrawContext plot;
+    // Index pour parcourir les pixels, les Cels et les groupes
+    int32 index = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawAnalyze()*\n"); }
+
+    // Si l'analyse est inconnue
+    if (overdraw == NULL) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw unknow.\n");
+        return -1;
+    }
+
+    // Compte les Cels projetés, en suivant la chaîne comme le Cel Engine
+    for (current = ccb; (current != NULL) && (celsCount < CELRASTER_CELS_MAX); current = current->ccb_NextPtr) {
+        if ((current->ccb_Flags & CCB_SKIP) == 0) { celsCount++; }
+        if ((current->ccb_Flags & CCB_LAST) != 0) { break; }
+    }
+
+    // Si le tableau des Cels est trop petit
+    if (celsCount > overdraw->celsCapacity) {
+        // Réalloue la mémoire pour les Cels
+        cels = (CelOverdrawCel *)realloc(overdraw->cels, (size_t)celsCount * sizeof(CelOverdrawCel));
+        // Si c'est un échec
+        if (cels == NULL) {
+            // Affiche un message d'erreur
+            printf("Error : Failed to allocate memory for CelOverdraw Cels.\n");
+            return -1;
+        }
+        overdraw->cels = cels;
+        overdraw->celsCapacity = celsCount;
+    }
+
+    // Efface l'analyse précédente
+    for (index = 0; index < overdraw->width * overdraw->height; index++) {
+        overdraw->depth[index] = 0;
+        overdraw->front[index] = -1;
+    }
+    overdraw->celsCount = celsCount;
+    overdraw->fills = 0;
+    overdraw->touched = 0;
+    overdraw->depthMax = 0;
+
+    // Enregistre les Cels projetés, dans l'ordre de la liste
+    index = 0;
+    for (current = ccb; (current != NULL) && (index < celsCount); current = current->ccb_NextPtr) {
+        if ((current->ccb_Flags & CCB_SKIP) == 0) {
+            cel = &overdraw->cels[index++];
+            cel->ccb = current;
+            cel->covered = 0;
+            cel->visible = 0;
+            cel->opaque = (overdraw->opaque(current, index - 1) != 0) ? 1 : 0;
+            CelOverdrawFindElement(overdraw, cel);
+        }
+        if ((current->ccb_Flags & CCB_LAST) != 0) { break; }
+    }
+
+    // Première passe : coût de remplissage, profondeur de surdessin et dernier Cel opaque de chaque pixel
+    plot.overdraw = overdraw;
+    for (plot.index = 0; plot.index < celsCount; plot.index++) {
+        CelRasterCoverage(overdraw->cels[plot.index].ccb, overdraw->width, overdraw->height, CelOverdrawCoverPlot, &plot);
+    }
+
+    // Deuxième passe : pixels de chaque Cel non cachés par un Cel opaque projeté après lui
+    for (plot.index = 0; plot.index < celsCount; plot.index++) {
+        CelRasterCoverage(overdraw->cels[plot.index].ccb, overdraw->width, overdraw->height, CelOverdrawVisiblePlot, &plot);
+    }
+
+    // Rassemble les chiffres des groupes
+    for (index = 0; index < overdraw->groupsCount; index++) {
+        group = &overdraw->groups[index];
+        group->celsCount = 0;
+        group->covered = 0;
+        group->visible = 0;
+        group->occludedCount = 0;
+    }
+    for (index = 0; index < celsCount; index++) {
+        cel = &overdraw->cels[index];
+        if (cel->group < 0) { continue; }
+        group = &overdraw->groups[cel->group];
+        group->celsCount++;
+        group->covered += cel->covered;
+        group->visible += cel->visible;
+        if ((cel->covered > 0) && (cel->visible == 0)) { group->occludedCount++; }
+    }
+
+    // Retourne le nombre de Cels analysés
+    return celsCount;
+}
+
+// Trouve le groupe et l'élément d'un Cel
+void CelOverdrawFindElement(CelOverdraw *overdraw, CelOverdrawCel *cel) {
+
+    // Groupe cherché
+    GroupCel *groupCel = NULL;
+    // Index pour parcourir les groupes et les éléments
+    int32 groupIndex = 0;
+    uint32 celIndex = 0;
+
+    cel->group = -1;
+    cel->element = -1;
+
+    // Cherche le Cel dans les éléments ou les tuiles de chaque groupe
+    for (groupIndex = 0; groupIndex < overdraw->groupsCount; groupIndex++) {
+        groupCel = overdraw->groups[groupIndex].groupCel;
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (((groupCel->tiles != NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel) == cel->ccb) {
+                cel->group = groupIndex;
+                cel->element = (int32)celIndex;
+                return;
+            }
+        }
+    }
+}
+
+// Enregistre la profondeur de surdessin de chaque pixel en image PPM
+int32 CelOverdrawWriteHeatmap(CelOverdraw *overdraw, char *filename) {
+
+    // Image de la carte de chaleur
+    CelRaster *raster = NULL;
+    // Couleur d'un pixel
+    uint32 color = 0;
+    // Index pour parcourir les pixels
+    int32 index = 0;
+    // Résultat de l'enregistrement
+    int32 result = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawWriteHeatmap()*\n"); }
+
+    // Si l'analyse est inconnue
+    if (overdraw == NULL) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw unknow.\n");
+        return -1;
+    }
+
+    // Crée l'image
+    raster = CelRasterInitialization(overdraw->width, overdraw->height);
+    // Si c'est un échec
+    if (raster == NULL) {
+        // Retourne une erreur
+        printf("Error <- CelRasterInitialization()\n");
+        return -1;
+    }
+
+    // Colore chaque pixel selon sa profondeur de surdessin
+    for (index = 0; index < overdraw->width * overdraw->height; index++) {
+        color = CelOverdrawHeatmapColors[(overdraw->depth[index] < 7) ? overdraw->depth[index] : 7];
+        raster->pixels[index * 3] = (uint8)(color >> 16);
+        raster->pixels[index * 3 + 1] = (uint8)(color >> 8);
+        raster->pixels[index * 3 + 2] = (uint8)color;
+    }
+
+    // Enregistre l'image
+    result = CelRasterWritePPM(raster, filename);
+
+    // Supprime l'image
+    CelRasterCleanup(raster);
+
+    return result;
+}
+
+// Affiche les totaux et les groupes et Cels classés par coût de remplissage
+int32 CelOverdrawReport(CelOverdraw *overdraw, int32 linesCount) {
+
+    // Groupes et Cels classés
+    CelOverdrawGroup **groups = NULL;
+    CelOverdrawCel **cels = NULL;
+    CelOverdrawCel *cel = NULL;
+    // Cels masqués et les pixels qu'ils écrivent pour rien
+    int32 occludedCount = 0;
+    int32 occludedFills = 0;
+    // Index pour parcourir les groupes et les Cels
+    int32 index = 0;
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawReport()*\n"); }
+
+    // Si l'analyse est inconnue
+    if (overdraw == NULL) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw unknow.\n");
+        return -1;
+    }
+
+    // Alloue la mémoire pour les classements
+    groups = (CelOverdrawGroup **)malloc((size_t)(overdraw->groupsCount + 1) * sizeof(CelOverdrawGroup *));
+    cels = (CelOverdrawCel **)malloc((size_t)(overdraw->celsCount + 1) * sizeof(CelOverdrawCel *));
+    // Si c'est un échec
+    if ((groups == NULL) || (cels == NULL)) {
+        // Libère la mémoire précédemment allouée
+        free(groups);
+        free(cels);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for CelOverdraw report.\n");
+        return -1;
+    }
+
+    // Cels masqués
+    for (index = 0; index < overdraw->celsCount; index++) {
+        cel = &overdraw->cels[index];
+        cels[index] = cel;
+        if ((cel->covered > 0) && (cel->visible == 0)) {
+            occludedCount++;
+            occludedFills += cel->covered;
+        }
+    }
+    for (index = 0; index < overdraw->groupsCount; index++) { groups[index] = &overdraw->groups[index]; }
+
+    // Classe les groupes et les Cels par coût de remplissage
+    qsort(groups, (size_t)overdraw->groupsCount, sizeof(CelOverdrawGroup *), CelOverdrawCompareGroups);
+    qsort(cels, (size_t)overdraw->celsCount, sizeof(CelOverdrawCel *), CelOverdrawCompareCels);
+
+    // Affiche les totaux
+    printf("CelOverdraw : %d Cels, %d groups, screen %d x %d\n", overdraw->celsCount, overdraw->groupsCount, overdraw->width, overdraw->height);
+    printf("  pixels written : %d (%.2f per pixel of the screen)\n", overdraw->fills, (double)overdraw->fills / (overdraw->width * overdraw->height));
+    printf("  overdraw depth : %.2f average on %d pixels written, %d max\n", (overdraw->touched > 0) ? (double)overdraw->fills / overdraw->touched : 0.0, overdraw->touched, overdraw->depthMax);
+    printf("  occluded Cels : %d (%d pixels written for nothing)\n", occludedCount, occludedFills);
+
+    // Affiche les groupes classés
+    printf("  groups by fill cost :\n");
+    printf("    %4s %6s %5s %9s %9s %7s %8s\n", "rank", "group", "cels", "written", "visible", "hidden", "occluded");
+    for (index = 0; (index < overdraw->groupsCount) && (index < linesCount); index++) {
+        printf("    %4d %6d %5d %9d %9d %6d%% %8d\n", index + 1, (int32)(groups[index] - overdraw->groups), groups[index]->celsCount, groups[index]->covered, groups[index]->visible,
+            (groups[index]->covered > 0) ? (int32)(((double)(groups[index]->covered - groups[index]->visible) * 100) / groups[index]->covered) : 0, groups[index]->occludedCount);
+    }
+
+    // Affiche les Cels classés
+    printf("  Cels by fill cost :\n");
+    printf("    %4s %5s %6s %7s %9s %9s\n", "rank", "cel", "group", "element", "written", "visible");
+    for (index = 0; (index < overdraw->celsCount) && (index < linesCount); index++) {
+        cel = cels[index];
+        printf("    %4d %5d %6d %7d %9d %9d%s%s\n", index + 1, (int32)(cel - overdraw->cels), cel->group, cel->element, cel->covered, cel->visible,
+            (cel->opaque == 1) ? " opaque" : "", ((cel->covered > 0) && (cel->visible == 0)) ? " occluded" : "");
+    }
+
+    // Libère la mémoire utilisée par les classements
+    free(groups);
+    free(cels);
+
+    // Retourne le nombre de Cels masqués
+    return occludedCount;
+}
+
+// Supprime l'analyse
+int32 CelOverdrawCleanup(CelOverdraw *overdraw) {
+
+    if (DEBUG_CELOVERDRAW == 1) { printf("*CelOverdrawCleanup()*\n"); }
+
+    // Si l'analyse est inconnue
+    if (overdraw == NULL) {
+        // Retourne une erreur
+        printf("Error : CelOverdraw unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée par les pixels, les Cels, les groupes et l'analyse
+    free(overdraw->depth);
+    free(overdraw->front);
+    free(overdraw->cels);
+    free(overdraw->groups);
+    free(overdraw);
+
+    // Retourne un succès
+    return 1;
+}
@@ -0,0 +1,174 @@
+#ifndef CELOVERDRAW_H
+#define CELOVERDRAW_H
+
+/******************************************************************************
+**
+**  CelOverdraw - Surdessin et coût de remplissage d'une liste de CCB (hôte)
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Le Cel Engine est limité par le nombre de pixels qu'il écrit. Ce module les
+**  mesure sur l'hôte pour une liste de CCB, avec la géométrie de CelRaster :
+**  pour chaque Cel, les pixels écran qu'il couvre (son coût de remplissage) et
+**  les pixels encore visibles à la fin de la liste ; pour chaque pixel, le
+**  nombre de Cels projetés dessus (sa profondeur de surdessin). Un Cel couvert
+**  entièrement par des Cels opaques projetés après lui est signalé comme
+**  masqué : il coûte son remplissage et ne montre rien.
+**
+**  Les GroupCels ajoutés à l'analyse rassemblent les chiffres de leurs
+**  éléments, pour que le rapport classe les groupes à aplatir ou à éliminer.
+**
+**  Notes importantes :
+**
+**    - Les données source ne sont pas décodées. Un Cel cache ce qui est derrière
+**      lui selon une fonction CelOverdrawOpaque ; celle par défaut ne se fie qu'à
+**      CCB_BGND, les Cels sans pixels transparents. Un jeu qui sait quels
+**      graphismes sont opaques donne sa propre fonction.
+**
+**    - Un Cel appartient à un groupe quand il est l'un de ses éléments ou de
+**      ses tuiles. Les groupes doivent être ajoutés et configurés avant
+**      CelOverdrawAnalyze().
+**
+**    - Ce module est destiné à l'outil hôte, mais il lit les éléments et les
+**      tuiles des groupes : il inclut GroupCel.h et a donc besoin des entêtes
+**      du SDK (graphics.h, animutils.h, types.h...) sur l'hôte, contrairement
+**      à CelRaster seul. La compilation sur l'hôte (Host/) les fournit, et son
+**      CelOverdrawGolden vérifie le rapport et la carte d'une scène.
+**
+**  Rôle des structures :
+**
+**    CelOverdrawCel
+**      - ccb : CCB du Cel
+**      - group, element : Groupe et élément du Cel, ou -1
+**      - covered : Pixels écran écrits par le Cel (coût de remplissage)
+**      - visible : Pixels non cachés par un Cel opaque projeté après lui
+**      - opaque : 1 si le Cel cache ce qui est derrière lui
+**
+**    CelOverdrawGroup
+**      - groupCel : Groupe analysé
+**      - celsCount : Nombre de Cels du groupe dans la liste
+**      - covered, visible : Sommes des Cels du groupe
+**      - occludedCount : Nombre de Cels du groupe entièrement masqués
+**
+**    CelOverdraw
+**      - width, height : Taille de l'écran en pixels
+**      - depth : Nombre de Cels projetés sur chaque pixel
+**      - front : Dernier Cel opaque projeté sur chaque pixel, ou -1
+**      - cels, celsCount, celsCapacity : Cels de la dernière liste analysée
+**      - groups, groupsCount, groupsCapacity : Groupes ajoutés à l'analyse
+**      - opaque : Fonction indiquant si un Cel est opaque
+**      - fills : Nombre total de pixels écrits
+**      - touched : Nombre de pixels écrits au moins une fois
+**      - depthMax : Plus grande profondeur de surdessin
+**
+**  Fonctions principales :
+**
+**    CelOverdrawInitialization()
+**      -> Crée une analyse pour une taille d'écran et un nombre de groupes.
+**
+**    CelOverdrawAddGroup()
+**      -> Ajoute un GroupCel dont les éléments sont rassemblés dans le rapport.
+**
+**    CelOverdrawAnalyze()
+**      -> Mesure la couverture, le surdessin et le masquage d'une liste de CCB.
+**
+**    CelOverdrawWriteHeatmap()
+**      -> Enregistre la profondeur de surdessin de chaque pixel en image PPM.
+**
+**    CelOverdrawReport()
+**      -> Affiche les totaux et les groupes et Cels classés par coût de remplissage.
+**
+**    CelOverdrawCleanup()
+**      -> Libère la mémoire utilisée par l'analyse.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// CelRasterCoverage()
+#include "CelRaster.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_CELOVERDRAW 0
+
+// Indique si un Cel cache ce qui est derrière lui, cel est sa position dans la liste
+typedef int32 (*CelOverdrawOpaque)(CCB *ccb, int32 cel);
+
+typedef struct {
+    // CCB du Cel
+    CCB *ccb;
+    // Groupe et élément du Cel, ou -1
+    int32 group;
+    int32 element;
+    // Pixels écran écrits par le Cel (coût de remplissage)
+    int32 covered;
+    // Pixels non cachés par un Cel opaque projeté après lui
+    int32 visible;
+    // 1 si le Cel cache ce qui est derrière lui
+    int32 opaque;
+} CelOverdrawCel;
+
+typedef struct {
+    // Groupe analysé
+    GroupCel *groupCel;
+    // Nombre de Cels du groupe dans la liste
+    int32 celsCount;
+    // Sommes des Cels du groupe
+    int32 covered;
+    int32 visible;
+    // Nombre de Cels du groupe entièrement masqués
+    int32 occludedCount;
+} CelOverdrawGroup;
+
+typedef struct {
+    // Taille de l'écran en pixels
+    int32 width;
+    int32 height;
+    // Nombre de Cels projetés sur chaque pixel
+    uint16 *depth;
+    // Dernier Cel opaque projeté sur chaque pixel, ou -1
+    int32 *front;
+    // Cels de la dernière liste analysée
+    CelOverdrawCel *cels;
+    int32 celsCount;
+    int32 celsCapacity;
+    // Groupes ajoutés à l'analyse
+    CelOverdrawGroup *groups;
+    int32 groupsCount;
+    int32 groupsCapacity;
+    // Fonction indiquant si un Cel est opaque
+    CelOverdrawOpaque opaque;
+    // Nombre total de pixels écrits
+    int32 fills;
+    // Nombre de pixels écrits au moins une fois
+    int32 touched;
+    // Plus grande profondeur de surdessin
+    int32 depthMax;
+} CelOverdraw;
+
+// Initialisation d'une analyse
+CelOverdraw *CelOverdrawInitialization(int32 width, int32 height, int32 groupsCapacity);
+// Ajoute un GroupCel à l'analyse
+int32 CelOverdrawAddGroup(CelOverdraw *overdraw, GroupCel *groupCel);
+// Test par défaut d'un Cel opaque
+int32 CelOverdrawDefaultOpaque(CCB *ccb, int32 cel);
+
+// Mesure la couverture, le surdessin et le masquage d'une liste de CCB
+int32 CelOverdrawAnalyze(CelOverdraw *overdraw, CCB *ccb);
+// Trouve le groupe et l'élément d'un Cel
+void CelOverdrawFindElement(CelOverdraw *overdraw, CelOverdrawCel *cel);
+
+// Enregistre la profondeur de surdessin de chaque pixel en image PPM
+int32 CelOverdrawWriteHeatmap(CelOverdraw *overdraw, char *filename);
+// Affiche les totaux et les groupes et Cels classés par coût de remplissage
+int32 CelOverdrawReport(CelOverdraw *overdraw, int32 linesCount);
+
+// Supprime l'analyse
+int32 CelOverdrawCleanup(CelOverdraw *overdraw);
+
+#endif // CELOVERDRAW_H
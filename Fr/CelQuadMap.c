@@ -1,6 +1,8 @@
 
 #include "CelQuadMap.h"
 
+// MulSF30()
+#include "operamath.h"
 // printf()
 #include "stdio.h"
 
@@ -49,4 +51,35 @@ void CelQuadMap(CCB *ccb, Quad2D *quadMap) {
     ccb->ccb_YPos = quadMap->topLeft.y;
 
     ccb->ccb_Flags |= CCB_LDSIZE | CCB_LDPRS;
-}
\ No newline at end of file
+}
+
+// Calcule les inverses de la dimension d'un CCB
+void CelQuadMapReciprocalsInitialization(CCB *ccb, CelQuadMapReciprocals *reciprocals) {
+
+    // Inverses en virgule fixe 2.30 (0 lorsque la dimension est vide)
+    reciprocals->inverseWidth = (ccb->ccb_Width > 0) ? (1 << 30) / ccb->ccb_Width : 0;
+    reciprocals->inverseHeight = (ccb->ccb_Height > 0) ? (1 << 30) / ccb->ccb_Height : 0;
+    reciprocals->inverseArea = ((ccb->ccb_Width > 0) && (ccb->ccb_Height > 0)) ? (1 << 30) / (ccb->ccb_Width * ccb->ccb_Height) : 0;
+}
+
+// Applique une transformation à un CCB à partir d'un quadrilatère en 16.16 et des inverses de sa dimension
+void CelQuadMapReciprocal(CCB *ccb, Quad2D *quadMap, CelQuadMapReciprocals *reciprocals) {
+
+    // HDX/HDY en 12.20
+    ccb->ccb_HDX = MulSF30((quadMap->topRight.x - quadMap->topLeft.x) << 4, reciprocals->inverseWidth);
+    ccb->ccb_HDY = MulSF30((quadMap->topRight.y - quadMap->topLeft.y) << 4, reciprocals->inverseWidth);
+
+    // VDX/VDY en 16.16
+    ccb->ccb_VDX = MulSF30(quadMap->bottomLeft.x - quadMap->topLeft.x, reciprocals->inverseHeight);
+    ccb->ccb_VDY = MulSF30(quadMap->bottomLeft.y - quadMap->topLeft.y, reciprocals->inverseHeight);
+
+    // HDDX/HDDY en 12.20
+    ccb->ccb_HDDX = MulSF30(((quadMap->topLeft.x + quadMap->bottomRight.x) - (quadMap->topRight.x + quadMap->bottomLeft.x)) << 4, reciprocals->inverseArea);
+    ccb->ccb_HDDY = MulSF30(((quadMap->topLeft.y + quadMap->bottomRight.y) - (quadMap->topRight.y + quadMap->bottomLeft.y)) << 4, reciprocals->inverseArea);
+
+    ccb->ccb_XPos = quadMap->topLeft.x;
+    ccb->ccb_YPos = quadMap->topLeft.y;
+
+    // Active les flags de chargement de taille et de perspective
+    ccb->ccb_Flags |= CCB_LDSIZE | CCB_LDPRS;
+}
@@ -20,7 +20,24 @@
 // int32
 #include "types.h"
 
+typedef struct CelQuadMapReciprocals {
+    // Inverses de la largeur, de la hauteur et de l'aire en 2.30
+    frac30 inverseWidth;
+    frac30 inverseHeight;
+    frac30 inverseArea;
+} CelQuadMapReciprocals;
+
 // Applique une transformation d'un CCB en fonction d'un quadrilatère en 16.16 
 void CelQuadMap(CCB *ccb, Quad2D *quadMap);
 
+// Calcule les inverses de la dimension d'un CCB
+void CelQuadMapReciprocalsInitialization(CCB *ccb, CelQuadMapReciprocals *reciprocals);
+
+// Applique une transformation à un CCB à partir d'un quadrilatère en 16.16 et des inverses de sa dimension
+// -> Des multiplications au lieu de divisions : MulSF30() arrondit vers le bas là où CelQuadMap() tronque vers zéro,
+//    et les inverses sont tronqués. Chaque champ peut finir 1 LSB sous celui de CelQuadMap(), jamais au-dessus,
+//    tant que son écart (décalé de 4 pour HDX/HDY et HDDX/HDDY) reste sous 2^30 en valeur absolue.
+//    1 LSB de HDDX/HDDY déplace le dernier pixel du Cel de Width * Height / 2^20 pixel au plus.
+void CelQuadMapReciprocal(CCB *ccb, Quad2D *quadMap, CelQuadMapReciprocals *reciprocals);
+
 #endif // CELQUADMAP_H
\ No newline at end of file
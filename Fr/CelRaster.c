@@ -0,0 +1,429 @@
+
+#include "CelRaster.h"
+
+// malloc(), free()
+#include "stdlib.h"
+// ceil(), floor()
+#include "math.h"
+// fopen(), fwrite(), fread(), printf()
+#include "stdio.h"
+
+// Couleurs des Cels pour la source par défaut, par position dans la liste
+static const uint32 CelRasterPalette[8] = {
+    0xE04040, 0x40C040, 0x4060E0, 0xE0C040, 0xC040C0, 0x40C0C0, 0xE08040, 0x8080E0
+};
+
+// Contexte du tracé d'un Cel dans le framebuffer
+typedef struct {
+    // Framebuffer
+    CelRaster *raster;
+    // Cel projeté et sa position dans la liste
+    CCB *ccb;
+    int32 cel;
+} CelRasterDrawContext;
+
+// Ecrit la couleur d'un pixel source dans le framebuffer
+static void CelRasterDrawPlot(void *context, int32 x, int32 y, int32 u, int32 v) {
+
+    // Cel projeté
+    CelRasterDrawContext *draw = (CelRasterDrawContext *)context;
+    // Couleur du pixel source
+    uint32 color = draw->raster->source(draw->ccb, draw->cel, u, v);
+    // Pixel du framebuffer
+    uint8 *pixel = &draw->raster->pixels[(y * draw->raster->width + x) * 3];
+
+    pixel[0] = (uint8)(color >> 16);
+    pixel[1] = (uint8)(color >> 8);
+    pixel[2] = (uint8)color;
+}
+
+// Initialisation d'un framebuffer
+CelRaster *CelRasterInitialization(int32 width, int32 height) {
+
+    // Framebuffer
+    CelRaster *raster = NULL;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterInitialization()*\n"); }
+
+    // Corrige les paramètres
+    // Framebuffer minimum = 1 x 1 pixel
+    width = (width > 1) ? width : 1;
+    height = (height > 1) ? height : 1;
+
+    // Alloue la mémoire pour le framebuffer
+    raster = (CelRaster *)malloc(sizeof(CelRaster));
+    // Si c'est un échec
+    if (raster == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for CelRaster.\n");
+        return NULL;
+    }
+
+    // Alloue la mémoire pour les pixels
+    raster->pixels = (uint8 *)malloc((size_t)width * height * 3);
+    // Si c'est un échec
+    if (raster->pixels == NULL) {
+        // Libère la mémoire précédemment allouée
+        free(raster);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for CelRaster pixels.\n");
+        return NULL;
+    }
+
+    raster->width = width;
+    raster->height = height;
+    raster->source = CelRasterDefaultSource;
+    raster->celsCount = 0;
+
+    // Fond noir
+    CelRasterClear(raster, 0x000000);
+
+    // Retourne le framebuffer créé
+    return raster;
+}
+
+// Remplit le framebuffer d'une couleur
+void CelRasterClear(CelRaster *raster, uint32 color) {
+
+    // Index pour parcourir les pixels
+    int32 index = 0;
+
+    for (index = 0; index < raster->width * raster->height; index++) {
+        raster->pixels[index * 3] = (uint8)(color >> 16);
+        raster->pixels[index * 3 + 1] = (uint8)(color >> 8);
+        raster->pixels[index * 3 + 2] = (uint8)color;
+    }
+}
+
+// Projette une liste de CCB
+int32 CelRasterDrawCels(CelRaster *raster, CCB *ccb) {
+
+    // Position du Cel dans la liste
+    int32 cel = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterDrawCels()*\n"); }
+
+    // Si le framebuffer est inconnu
+    if (raster == NULL){
+        // Retourne une erreur
+        printf("Error : CelRaster unknow.\n");
+        return -1;
+    }
+
+    // Suit la chaîne comme le Cel Engine
+    for (cel = 0; (ccb != NULL) && (cel < CELRASTER_CELS_MAX); cel++) {
+
+        // Un Cel ignoré n'est pas projeté mais son pointeur suivant est suivi
+        if ((ccb->ccb_Flags & CCB_SKIP) == 0) { CelRasterDrawCel(raster, ccb, cel); }
+
+        // Le dernier Cel termine la liste
+        if ((ccb->ccb_Flags & CCB_LAST) != 0) { cel++; break; }
+        ccb = ccb->ccb_NextPtr;
+    }
+
+    // Si la chaîne ne s'est pas terminée
+    if (cel >= CELRASTER_CELS_MAX) {
+        // Affiche un avertissement
+        printf("Warning : CelRaster list longer than %d Cels, looping chain?\n", CELRASTER_CELS_MAX);
+    }
+
+    // Retourne le nombre de Cels visités
+    raster->celsCount = cel;
+    return cel;
+}
+
+// Projette un seul CCB
+int32 CelRasterDrawCel(CelRaster *raster, CCB *ccb, int32 cel) {
+
+    // Cel projeté
+    CelRasterDrawContext draw;
+
+    // Si le framebuffer ou le CCB est inconnu
+    if ((raster == NULL) || (ccb == NULL)){
+        // Retourne une erreur
+        printf("Error : CelRaster CCB unknow.\n");
+        return -1;
+    }
+
+    // Trace chaque pixel couvert avec la couleur de son pixel source
+    draw.raster = raster;
+    draw.ccb = ccb;
+    draw.cel = cel;
+    CelRasterCoverage(ccb, raster->width, raster->height, CelRasterDrawPlot, &draw);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Couleur par défaut d'un pixel source
+uint32 CelRasterDefaultSource(CCB *ccb, int32 cel, int32 u, int32 v) {
+
+    // Couleur du Cel
+    uint32 color = CelRasterPalette[cel & 7];
+
+    // Seule la position du Cel dans la liste choisit la couleur
+    (void)ccb;
+
+    // La première rangée et la première colonne sont blanches : elles montrent l'orientation
+    if ((u == 0) || (v == 0)) { return 0xFFFFFF; }
+
+    // Un damier montre chaque pixel source
+    if (((u + v) & 1) != 0) { color = (color >> 1) & 0x7F7F7F; }
+
+    return color;
+}
+
+// Appelle une fonction pour chaque pixel écran couvert par un CCB, dans width x height
+void CelRasterCoverage(CCB *ccb, int32 width, int32 height, CelRasterPlot plot, void *context) {
+
+    // Pixel source
+    int32 u = 0;
+    int32 v = 0;
+    // Coins du pixel source (u, v), (u + 1, v), (u + 1, v + 1), (u, v + 1)
+    double cornerX[4];
+    double cornerY[4];
+    // Triangle
+    double triangleX[3];
+    double triangleY[3];
+
+    // Pour chaque pixel source
+    for (v = 0; v < ccb->ccb_Height; v++) {
+        for (u = 0; u < ccb->ccb_Width; u++) {
+
+            // Coins du quadrilatère
+            CelRasterCorner(ccb, u, v, &cornerX[0], &cornerY[0]);
+            CelRasterCorner(ccb, u + 1, v, &cornerX[1], &cornerY[1]);
+            CelRasterCorner(ccb, u + 1, v + 1, &cornerX[2], &cornerY[2]);
+            CelRasterCorner(ccb, u, v + 1, &cornerX[3], &cornerY[3]);
+
+            // Deux triangles partageant la diagonale (u, v) - (u + 1, v + 1)
+            triangleX[0] = cornerX[0]; triangleY[0] = cornerY[0];
+            triangleX[1] = cornerX[1]; triangleY[1] = cornerY[1];
+            triangleX[2] = cornerX[2]; triangleY[2] = cornerY[2];
+            CelRasterTriangle(triangleX, triangleY, width, height, u, v, plot, context);
+            triangleX[1] = cornerX[2]; triangleY[1] = cornerY[2];
+            triangleX[2] = cornerX[3]; triangleY[2] = cornerY[3];
+            CelRasterTriangle(triangleX, triangleY, width, height, u, v, plot, context);
+        }
+    }
+}
+
+// Coin (u, v) d'un CCB en unités de 2^-20 pixel
+void CelRasterCorner(CCB *ccb, int32 u, int32 v, double *x, double *y) {
+
+    // XPos/YPos et VDX/VDY sont en 16.16, HDX/HDY et HDDX/HDDY en 12.20
+    *x = (double)((long long)ccb->ccb_XPos * 16 + (long long)v * ccb->ccb_VDX * 16 + (long long)u * ccb->ccb_HDX + (long long)u * v * ccb->ccb_HDDX);
+    *y = (double)((long long)ccb->ccb_YPos * 16 + (long long)v * ccb->ccb_VDY * 16 + (long long)u * ccb->ccb_HDY + (long long)u * v * ccb->ccb_HDDY);
+}
+
+// Appelle une fonction pour chaque pixel écran dont le centre est dans un triangle
+void CelRasterTriangle(double *x, double *y, int32 width, int32 height, int32 u, int32 v, CelRasterPlot plot, void *context) {
+
+    // Un pixel et un demi-pixel en unités de 2^-20
+    const double one = 1048576.0;
+    const double half = 524288.0;
+    // Double de l'aire signée
+    double area = 0;
+    // Echange de deux sommets
+    double swap = 0;
+    // Boîte englobante en pixels
+    int32 left = 0;
+    int32 top = 0;
+    int32 right = 0;
+    int32 bottom = 0;
+    // Pixel écran et son centre
+    int32 screenX = 0;
+    int32 screenY = 0;
+    double centerX = 0;
+    double centerY = 0;
+    // Arêtes et leurs valeurs au centre
+    int32 edge = 0;
+    int32 inside = 0;
+    double value = 0;
+    double edgeX = 0;
+    double edgeY = 0;
+
+    // Oriente le triangle pour que l'intérieur soit du côté positif de chaque arête
+    area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+    // Un triangle plat ne couvre rien
+    if (area == 0) { return; }
+    if (area < 0) {
+        swap = x[1]; x[1] = x[2]; x[2] = swap;
+        swap = y[1]; y[1] = y[2]; y[2] = swap;
+    }
+
+    // Pixels dont le centre peut être à l'intérieur, limités au framebuffer
+    left = (int32)ceil(((x[0] < x[1] ? (x[0] < x[2] ? x[0] : x[2]) : (x[1] < x[2] ? x[1] : x[2])) - half) / one);
+    right = (int32)floor(((x[0] > x[1] ? (x[0] > x[2] ? x[0] : x[2]) : (x[1] > x[2] ? x[1] : x[2])) - half) / one);
+    top = (int32)ceil(((y[0] < y[1] ? (y[0] < y[2] ? y[0] : y[2]) : (y[1] < y[2] ? y[1] : y[2])) - half) / one);
+    bottom = (int32)floor(((y[0] > y[1] ? (y[0] > y[2] ? y[0] : y[2]) : (y[1] > y[2] ? y[1] : y[2])) - half) / one);
+    left = (left > 0) ? left : 0;
+    top = (top > 0) ? top : 0;
+    right = (right < width - 1) ? right : width - 1;
+    bottom = (bottom < height - 1) ? bottom : height - 1;
+
+    // Pour chaque pixel candidat
+    for (screenY = top; screenY <= bottom; screenY++) {
+        centerY = screenY * one + half;
+        for (screenX = left; screenX <= right; screenX++) {
+            centerX = screenX * one + half;
+
+            // Teste le centre avec les trois arêtes
+            inside = 1;
+            for (edge = 0; (edge < 3) && (inside == 1); edge++) {
+                edgeX = x[(edge + 1) % 3] - x[edge];
+                edgeY = y[(edge + 1) % 3] - y[edge];
+                value = edgeX * (centerY - y[edge]) - edgeY * (centerX - x[edge]);
+                // Un centre sur une arête n'appartient qu'aux arêtes haute et gauche
+                if ((value < 0) || ((value == 0) && !((edgeY < 0) || ((edgeY == 0) && (edgeX > 0))))) { inside = 0; }
+            }
+
+            // Si le centre est à l'intérieur
+            if (inside == 1) { plot(context, screenX, screenY, u, v); }
+        }
+    }
+}
+
+// Enregistre le framebuffer en image PPM
+int32 CelRasterWritePPM(CelRaster *raster, char *filename) {
+
+    // Fichier
+    FILE *file = NULL;
+    // Taille des pixels en octets
+    size_t size = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterWritePPM()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((raster == NULL) || (filename == NULL)) {
+        // Retourne une erreur
+        printf("Error : CelRaster unknow.\n");
+        return -1;
+    }
+
+    // Ouvre le fichier
+    file = fopen(filename, "wb");
+    // Si c'est un échec
+    if (file == NULL) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // PPM binaire : entête puis les pixels RGB rangée par rangée
+    size = (size_t)raster->width * raster->height * 3;
+    fprintf(file, "P6\n%d %d\n255\n", raster->width, raster->height);
+    if (fwrite(raster->pixels, 1, size, file) != size) {
+        // Ferme le fichier
+        fclose(file);
+        // Retourne une erreur
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Ferme le fichier
+    fclose(file);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Compte les pixels différant d'une image PPM de plus d'une tolérance
+int32 CelRasterCompare(CelRaster *raster, char *filename, int32 tolerance) {
+
+    // Fichier
+    FILE *file = NULL;
+    // Entête de l'image
+    char magic[3] = {0};
+    int32 width = 0;
+    int32 height = 0;
+    int32 maximum = 0;
+    // Pixel lu dans l'image
+    uint8 pixel[3];
+    // Index pour parcourir les pixels et les canaux
+    int32 index = 0;
+    int32 channel = 0;
+    // Différence d'un canal
+    int32 difference = 0;
+    // Nombre de pixels différents
+    int32 differences = 0;
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterCompare()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((raster == NULL) || (filename == NULL)) {
+        // Retourne une erreur
+        printf("Error : CelRaster unknow.\n");
+        return -1;
+    }
+
+    // Ouvre le fichier
+    file = fopen(filename, "rb");
+    // Si c'est un échec
+    if (file == NULL) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Lit l'entête, écrit par CelRasterWritePPM()
+    if ((fscanf(file, "%2s %d %d %d", magic, &width, &height, &maximum) != 4) || (magic[0] != 'P') || (magic[1] != '6') || (maximum != 255) || (fgetc(file) == EOF)) {
+        // Ferme le fichier
+        fclose(file);
+        // Retourne une erreur
+        printf("Error : %s isn't a binary PPM image.\n", filename);
+        return -1;
+    }
+
+    // Si la taille diffère
+    if ((width != raster->width) || (height != raster->height)) {
+        // Ferme le fichier
+        fclose(file);
+        // Retourne une erreur
+        printf("Error : %s is %d x %d, the framebuffer %d x %d.\n", filename, width, height, raster->width, raster->height);
+        return -1;
+    }
+
+    // Compare chaque pixel
+    for (index = 0; index < width * height; index++) {
+        // Si l'image est tronquée
+        if (fread(pixel, 1, 3, file) != 3) {
+            // Ferme le fichier
+            fclose(file);
+            // Retourne une erreur
+            printf("Error : %s is truncated.\n", filename);
+            return -1;
+        }
+        // Le pixel diffère si l'un de ses canaux dépasse la tolérance
+        for (channel = 0; channel < 3; channel++) {
+            difference = (int32)raster->pixels[index * 3 + channel] - (int32)pixel[channel];
+            if ((difference > tolerance) || (difference < -tolerance)) { differences++; break; }
+        }
+    }
+
+    // Ferme le fichier
+    fclose(file);
+
+    // Retourne le nombre de pixels différents
+    return differences;
+}
+
+// Supprime le framebuffer
+int32 CelRasterCleanup(CelRaster *raster) {
+
+    if (DEBUG_CELRASTER == 1) { printf("*CelRasterCleanup()*\n"); }
+
+    // Si le framebuffer est inconnu
+    if (raster == NULL){
+        // Retourne une erreur
+        printf("Error : CelRaster unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée par les pixels et le framebuffer
+    free(raster->pixels);
+    free(raster);
+
+    // Retourne un succès
+    return 1;
+}
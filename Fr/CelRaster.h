@@ -0,0 +1,139 @@
+#ifndef CELRASTER_H
+#define CELRASTER_H
+
+/******************************************************************************
+**
+**  CelRaster - Rasteriseur logiciel de référence des listes de CCB (hôte)
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Ce module projette une liste de CCB dans un framebuffer RGB sur l'hôte, en
+**  suivant les champs écrits par CelQuadMap : XPos/YPos, HDX/HDY, VDX/VDY,
+**  HDDX/HDDY, CCB_SKIP, CCB_LAST et la chaîne ccb_NextPtr. Le résultat peut être
+**  enregistré en image PPM et comparé à une image de référence, un changement
+**  dans la projection ou dans ses arrondis est donc visible sans matériel 3DO.
+**
+**  Chaque pixel source (u, v) d'un Cel est le quadrilatère entre les coins
+**  (u, v) et (u + 1, v + 1), avec :
+**
+**    x = XPos + v * VDX + u * (HDX + v * HDDX)
+**    y = YPos + v * VDY + u * (HDY + v * HDDY)
+**
+**  calculés exactement en unités de 2^-20 pixel. Un pixel écran est projeté
+**  quand son centre est dans le quadrilatère, avec une règle haut-gauche sur
+**  les arêtes pour que deux pixels source voisins ne projettent jamais le même
+**  pixel écran.
+**
+**  Notes importantes :
+**
+**    - Les données source ne sont pas décodées : la couleur d'un pixel source
+**      vient d'une fonction CelRasterSource. Celle par défaut mélange une couleur
+**      par Cel avec la première rangée et la première colonne en blanc et un
+**      damier, ce qui montre l'orientation et les bords de chaque Cel. Le mélange
+**      PIXC n'est pas modélisé, le dernier Cel projeté l'emporte.
+**
+**    - La chaîne ccb_NextPtr est suivie comme des pointeurs absolus, tels
+**      qu'écrits par LinkCel(). Le parcours s'arrête après CELRASTER_CELS_MAX Cels
+**      pour survivre à une chaîne qui boucle.
+**
+**    - Ce module est destiné à l'outil hôte. Il prend le CCB et ses types dans
+**      graphics.h et types.h : Host/ en contient des versions pour l'hôte, avec
+**      operamath.h pour CelQuadMap et Geometry, et un Makefile qui les compile
+**      avec un compilateur C standard. CelRasterCoverage() est la géométrie
+**      partagée avec les outils d'analyse.
+**
+**    - Host/CelRasterGolden dessine un groupe aligné sur les axes, un groupe
+**      tourné et un groupe étiré en bilinéaire, et les compare avec les images
+**      de Host/Golden (make test). Après un changement vérifié à l'oeil, make
+**      golden les écrit à nouveau.
+**
+**  Rôle des structures :
+**
+**    CelRaster
+**      - width, height : Taille du framebuffer en pixels
+**      - pixels : Framebuffer RGB, 3 octets par pixel, rangée par rangée
+**      - source : Fonction donnant la couleur d'un pixel source
+**      - celsCount : Nombre de Cels projetés par le dernier CelRasterDrawCels()
+**
+**  Fonctions principales :
+**
+**    CelRasterInitialization()
+**      -> Crée un framebuffer avec la source par défaut.
+**
+**    CelRasterClear()
+**      -> Remplit le framebuffer d'une couleur.
+**
+**    CelRasterDrawCels()
+**      -> Projette une liste de CCB en suivant la chaîne ccb_NextPtr.
+**
+**    CelRasterDrawCel()
+**      -> Projette un seul CCB.
+**
+**    CelRasterCoverage()
+**      -> Appelle une fonction pour chaque pixel écran couvert par chaque pixel source d'un CCB.
+**
+**    CelRasterWritePPM() / CelRasterCompare()
+**      -> Enregistre le framebuffer en image PPM, ou compte les pixels qui en diffèrent.
+**
+**    CelRasterCleanup()
+**      -> Libère la mémoire utilisée par le framebuffer.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_CELRASTER 0
+
+// Nombre maximum de Cels suivis dans une liste
+#define CELRASTER_CELS_MAX 65536
+
+// Couleur d'un pixel source (0xRRGGBB), cel est sa position dans la liste
+typedef uint32 (*CelRasterSource)(CCB *ccb, int32 cel, int32 u, int32 v);
+// Pixel écran (x, y) couvert par le pixel source (u, v)
+typedef void (*CelRasterPlot)(void *context, int32 x, int32 y, int32 u, int32 v);
+
+typedef struct {
+    // Taille du framebuffer en pixels
+    int32 width;
+    int32 height;
+    // Framebuffer RGB, 3 octets par pixel, rangée par rangée
+    uint8 *pixels;
+    // Fonction donnant la couleur d'un pixel source
+    CelRasterSource source;
+    // Nombre de Cels projetés par le dernier CelRasterDrawCels()
+    int32 celsCount;
+} CelRaster;
+
+// Initialisation d'un framebuffer
+CelRaster *CelRasterInitialization(int32 width, int32 height);
+// Remplit le framebuffer d'une couleur
+void CelRasterClear(CelRaster *raster, uint32 color);
+
+// Projette une liste de CCB
+int32 CelRasterDrawCels(CelRaster *raster, CCB *ccb);
+// Projette un seul CCB
+int32 CelRasterDrawCel(CelRaster *raster, CCB *ccb, int32 cel);
+// Couleur par défaut d'un pixel source
+uint32 CelRasterDefaultSource(CCB *ccb, int32 cel, int32 u, int32 v);
+
+// Appelle une fonction pour chaque pixel écran couvert par un CCB, dans width x height
+void CelRasterCoverage(CCB *ccb, int32 width, int32 height, CelRasterPlot plot, void *context);
+// Coin (u, v) d'un CCB en unités de 2^-20 pixel
+void CelRasterCorner(CCB *ccb, int32 u, int32 v, double *x, double *y);
+// Appelle une fonction pour chaque pixel écran dont le centre est dans un triangle
+void CelRasterTriangle(double *x, double *y, int32 width, int32 height, int32 u, int32 v, CelRasterPlot plot, void *context);
+
+// Enregistre le framebuffer en image PPM
+int32 CelRasterWritePPM(CelRaster *raster, char *filename);
+// Compte les pixels différant d'une image PPM de plus d'une tolérance
+int32 CelRasterCompare(CelRaster *raster, char *filename, int32 tolerance);
+
+// Supprime le framebuffer
+int32 CelRasterCleanup(CelRaster *raster);
+
+#endif // CELRASTER_H
@@ -1,6 +1,8 @@
 
 // Définitions des arguments
 #include "DefinitionsArguments.h"
+// GroupCel
+#include "GroupCel.h"
 // LoadCel()
 #include "celutils.h"
 // Point2D, Quad2D
@@ -8,11 +10,19 @@
 // printf()
 #include "stdio.h"
 
+// Eléments du GroupCel (celReference, positionX, positionY)
+static const GroupCelElement groupCelElements[] = {
+    { 0, 0, 0 },
+    { 1, 0, 0 }
+};
+
 int32 main(){
 	
 	// Cel
 	CCB *cel_1 = NULL;
 	CCB *cel_2 = NULL;
+	// Table des Cels référencés par les éléments
+	CCB *cels[2] = {NULL};
 	// GroupCel
 	GroupCel *groupCel = NULL;
 	
@@ -58,20 +68,14 @@ int32 main(){
 		return -1;
 	}	
 	
+	// Table des Cels
+	cels[0] = cel_1;
+	cels[1] = cel_2;
+
 	// Configure le GroupCel
-	printf("-> GroupCelElementsConfiguration()\n");
-	if (GroupCelElementsConfiguration(
-		// GroupCel
-		groupCel,
-		// Début de la liste
-		LIST_START,
-		// celIndex, CCB, positionX, positionY
-		0, cel_1, 0, 0,
-		1, cel_2, 0, 0,
-		// Fin de la liste
-		LIST_END
-	) == 0) {
-		printf("Error <- GroupCelElementsConfiguration()\n");
+	printf("-> GroupCelElementsTableConfiguration()\n");
+	if (GroupCelElementsTableConfiguration(groupCel, groupCelElements, 2, cels, 2) < 0) {
+		printf("Error <- GroupCelElementsTableConfiguration()\n");
 		return -1;
 	}	
 	
@@ -192,6 +192,29 @@ int32 RectanglesIntersection(Rectangle *rectangle1, Rectangle *rectangle2) {
 
 }
 
+// Plus petit rectangle contenant les 4 coins d'un quad
+// -> Modifie directement les valeurs du rectangle
+void Quad2DBounds(Quad2D *quad, Rectangle *rectangle) {
+
+    // Coins du quad
+    Point2D *corners[4];
+    // Index pour parcourir les coins
+    int32 cornerIndex = 0;
+
+    corners[0] = &quad->topLeft;
+    corners[1] = &quad->topRight;
+    corners[2] = &quad->bottomRight;
+    corners[3] = &quad->bottomLeft;
+    rectangle->topLeft = quad->topLeft;
+    rectangle->bottomRight = quad->topLeft;
+    for (cornerIndex = 1; cornerIndex < 4; cornerIndex++) {
+        if (corners[cornerIndex]->x < rectangle->topLeft.x) { rectangle->topLeft.x = corners[cornerIndex]->x; }
+        if (corners[cornerIndex]->y < rectangle->topLeft.y) { rectangle->topLeft.y = corners[cornerIndex]->y; }
+        if (corners[cornerIndex]->x > rectangle->bottomRight.x) { rectangle->bottomRight.x = corners[cornerIndex]->x; }
+        if (corners[cornerIndex]->y > rectangle->bottomRight.y) { rectangle->bottomRight.y = corners[cornerIndex]->y; }
+    }
+}
+
 // Etirement d'un Cel selon un multiplicateur
 // -> Modifie directement les valeurs ccb_HDX et ccb_VDY du Cel
 void CelScale(CCB *cel, int32 scaleX, int32 scaleY) {
@@ -296,46 +319,50 @@ void CelFlipVertical(CCB *cel, int32 flip, uint32 correction) {
 	cel->ccb_VDY *= flip;
 }
 
-// Retourne le rectangle occup  l'cran par le Cel transform
-// -> Modifie directement les valeurs du rectangle 
+// Retourne le rectangle occup  l'cran par le Cel transform en 16.16 (pas en pixels), HDDX/HDDY compris
+// -> Modifie directement les valeurs du rectangle, en 16.16
 void CelProjection(CCB *cel, Rectangle *rectangle) {
 
-    // Les coefficients (en virgule fixe)
-    int32 hdx = cel->ccb_HDX; // 12.20
-    int32 hdy = cel->ccb_HDY; // 12.20
-    int32 vdx = cel->ccb_VDX; // 16.16
-    int32 vdy = cel->ccb_VDY; // 16.16
+    // Coins du Cel  l'cran
+    Quad2D quad;
 
-    // Coin 1 : origine
-    int32 px0 = cel->ccb_XPos;
-    int32 py0 = cel->ccb_YPos;
+    // Le Cel reste  l'intrieur de ses 4 coins, mme quand les termes bilinaires le courbent
+    CelProjectionQuad(cel, &quad);
 
-    // Coin 2 : dplacement en X (largeur)
-    int32 px1 = cel->ccb_XPos + ((hdx * cel->ccb_Width) >> 20);
-    int32 py1 = cel->ccb_YPos + ((hdy * cel->ccb_Width) >> 20);
+    // Cherche les min/max pour envelopper le Cel
+    Quad2DBounds(&quad, rectangle);
+}
 
-    // Coin 3 : dplacement en Y (hauteur)
-    int32 px2 = cel->ccb_XPos + ((vdx * cel->ccb_Height) >> 16);
-    int32 py2 = cel->ccb_YPos + ((vdy * cel->ccb_Height) >> 16);
+// Retourne les 4 coins  l'cran du Cel transform en 16.16, HDDX/HDDY compris
+// -> Modifie directement les valeurs du quad
+void CelProjectionQuad(CCB *cel, Quad2D *quad) {
 
-    // Coin 4 : dplacement en X + Y (diagonale)
-    int32 px3 = cel->ccb_XPos + ((hdx * cel->ccb_Width) >> 20) + ((vdx * cel->ccb_Height) >> 16);
-    int32 py3 = cel->ccb_YPos + ((hdy * cel->ccb_Width) >> 20) + ((vdy * cel->ccb_Height) >> 16);
+    // Le Cel Engine ajoute HDDX/HDDY  HDX/HDY aprs chaque ligne : pas de la dernire ligne (12.20)
+    int32 hdxLast = cel->ccb_HDX + (cel->ccb_HDDX * cel->ccb_Height);
+    int32 hdyLast = cel->ccb_HDY + (cel->ccb_HDDY * cel->ccb_Height);
 
-    // Cherche les min/max pour envelopper le Cel
-    int32 minX = px0, maxX = px0;
-    int32 minY = py0, maxY = py0;
+    // Coin 1 : origine
+    quad->topLeft.x = cel->ccb_XPos;
+    quad->topLeft.y = cel->ccb_YPos;
+
+    // Coin 2 : dplacement en X (largeur) le long de la premire ligne
+    quad->topRight.x = cel->ccb_XPos + CelProjectionStep(cel->ccb_HDX, cel->ccb_Width);
+    quad->topRight.y = cel->ccb_YPos + CelProjectionStep(cel->ccb_HDY, cel->ccb_Width);
 
-    if (px1 < minX) minX = px1; if (px1 > maxX) maxX = px1;
-    if (px2 < minX) minX = px2; if (px2 > maxX) maxX = px2;
-    if (px3 < minX) minX = px3; if (px3 > maxX) maxX = px3;
+    // Coin 4 : dplacement en Y (hauteur), VDX/VDY sont dj en 16.16
+    quad->bottomLeft.x = cel->ccb_XPos + (cel->ccb_VDX * cel->ccb_Height);
+    quad->bottomLeft.y = cel->ccb_YPos + (cel->ccb_VDY * cel->ccb_Height);
+
+    // Coin 3 : dplacement en X (largeur) le long de la dernire ligne
+    quad->bottomRight.x = quad->bottomLeft.x + CelProjectionStep(hdxLast, cel->ccb_Width);
+    quad->bottomRight.y = quad->bottomLeft.y + CelProjectionStep(hdyLast, cel->ccb_Width);
+}
 
-    if (py1 < minY) minY = py1; if (py1 > maxY) maxY = py1;
-    if (py2 < minY) minY = py2; if (py2 > maxY) maxY = py2;
-    if (py3 < minY) minY = py3; if (py3 > maxY) maxY = py3;
+// Se dplace d'un nombre de pixels selon un pas en 12.20, en 16.16 sans dpassement
+// -> Retourne le dcalage en 16.16
+int32 CelProjectionStep(int32 step, int32 count) {
 
-    rectangle->topLeft.x = minX;
-    rectangle->topLeft.y = minY;
-    rectangle->bottomRight.x = maxX;
-    rectangle->bottomRight.y = maxY;
+    // Le pas multipli par le nombre dpasse le 12.20 au-del de 2048 pixels : la partie 16.16
+    // et les 4 bits les plus faibles du pas sont multiplis  part, la somme reste exacte
+    return ((step >> 4) * count) + (((step & 15) * count) >> 4);
 }
@@ -19,6 +19,11 @@ typedef struct Point2D {
 	int32 y;
 } Point2D;
 
+typedef struct Point2D16 {
+    int16 x;
+    int16 y;
+} Point2D16;
+
 typedef struct Quad2D {
 	Point2D	topLeft;
 	Point2D	topRight;
@@ -68,6 +73,10 @@ int32 Point2DInRectangle(Rectangle *rectangle, Point2D *point);
 // -> Retourne 1 si les rectangles se chevauchent, 0 si ce n'est pas le cas
 int32 RectanglesIntersection(Rectangle *rectangle1, Rectangle *rectangle2);
 
+// Plus petit rectangle contenant les 4 coins d'un quad
+// -> Modifie directement les valeurs du rectangle
+void Quad2DBounds(Quad2D *quad, Rectangle *rectangle);
+
 /* Manipulation de Cel */
 
 // Etirement d'un Cel selon un multiplicateur
@@ -90,8 +99,16 @@ void CelFlipHorizontal(CCB *cel, int32 flip, uint32 correction);
 // -> Modifie directement les valeurs ccb_VDY et ccb_YPos du Cel
 void CelFlipVertical(CCB *cel, int32 flip, uint32 correction);
 
-// Retourne le rectangle occupé à l'écran par le Cel transformé
-// -> Modifie directement les valeurs du rectangle 
+// Retourne le rectangle occupé à l'écran par le Cel transformé en 16.16 (pas en pixels), HDDX/HDDY compris
+// -> Modifie directement les valeurs du rectangle, en 16.16
 void CelProjection(CCB *cel, Rectangle *rectangle);
 
+// Retourne les 4 coins à l'écran du Cel transformé en 16.16, HDDX/HDDY compris
+// -> Modifie directement les valeurs du quad
+void CelProjectionQuad(CCB *cel, Quad2D *quad);
+
+// Se déplace d'un nombre de pixels selon un pas en 12.20, en 16.16 sans dépassement
+// -> Retourne le décalage en 16.16
+int32 CelProjectionStep(int32 step, int32 count);
+
 #endif // LIBRARY_GEOMETRY_H
\ No newline at end of file
@@ -5,19 +5,119 @@
 #include "DefinitionsArguments.h"
 // AllocMem(), FreeMem(), MEMTYPE_DRAM
 #include "mem.h"
+// CreateItem(), DeleteItem()
+#include "item.h"
+// MKNODEID(), NODE_GRAPHICS
+#include "nodes.h"
 // CloneCel
 #include "celutils.h"
-// memset()
+// memset(), memcmp()
 #include "string.h"
 // CelQuadMap
 #include "CelQuadMap.h"
 // Point2D, Quad2D
 #include "Geometry.h"
-// Convert32_F16, ConvertF16_32
+// Convert32_F16, ConvertF16_32, MulSF16
 #include "operamath.h"
 // printf()
 #include "stdio.h"
 
+// Initialisation du cadre d'un GroupCel
+void GroupCelFrameInitialization(GroupCel *groupCel, int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY) {
+
+	// Position du groupe
+	groupCel->position.x = positionX;
+	groupCel->position.y = positionY;
+	groupCel->position16.x = Convert32_F16(positionX);
+	groupCel->position16.y = Convert32_F16(positionY);
+	// Dimension du groupe
+	groupCel->size.x = sizeX;
+	groupCel->size.y = sizeY;
+
+    // Quadrilatère destiné à recevoir les étirements
+    groupCel->stretching.topLeft.x = 0;
+	groupCel->stretching.topLeft.y = 0;
+    groupCel->stretching.topRight.x = sizeX;
+	groupCel->stretching.topRight.y = 0;
+    groupCel->stretching.bottomRight.x = sizeX;
+	groupCel->stretching.bottomRight.y = sizeY;
+    groupCel->stretching.bottomLeft.x = 0;
+	groupCel->stretching.bottomLeft.y = sizeY;  
+	
+	// Rotation
+	groupCel->rotationAngle = 0;
+	groupCel->rotationPivot.x = 0;
+	groupCel->rotationPivot.y = 0;
+	groupCel->rotationAngle16 = 0;
+	groupCel->rotationPivot16.x = 0;
+	groupCel->rotationPivot16.y = 0;
+
+    // Aucune donnée de paquet
+    groupCel->data = NULL;
+    groupCel->dataSize = 0;
+    // Aucune réserve
+    groupCel->pool = NULL;
+    // Aucune transformation en attente
+    groupCel->transformations = 0;
+    // Aucune grille
+    groupCel->gridColumns = 0;
+    groupCel->gridRows = 0;
+    groupCel->tileSize.x = 0;
+    groupCel->tileSize.y = 0;
+    groupCel->tiles = NULL;
+    groupCel->lattice = NULL;
+    // Aucune animation
+    groupCel->animations = NULL;
+    // Pas de chaîne LOD
+    groupCel->lods = NULL;
+    groupCel->lodSwaps = 0;
+    // Aucun inverse
+    groupCel->reciprocals = NULL;
+    groupCel->tileDimension.x = 0;
+    groupCel->tileDimension.y = 0;
+    // Aucun cache de quadrilatères
+    groupCel->quads = NULL;
+    groupCel->quadHits = 0;
+    groupCel->quadMisses = 0;
+    // Aucun CCB écrit pour l'instant
+    groupCel->epoch = 0;
+    // Aucune caméra
+    groupCel->camera = NULL;
+    groupCel->cameraOffset.x = 0;
+    groupCel->cameraOffset.y = 0;
+    groupCel->cameraPan.x = 0;
+    groupCel->cameraPan.y = 0;
+    groupCel->cameraZoom = GROUPCEL_ZOOM_ONE;
+    groupCel->cameraFocus.x = 0;
+    groupCel->cameraFocus.y = 0;
+    // Pas encore de chaîne
+    groupCel->cel = NULL;
+    groupCel->tail = NULL;
+    // Pas dans une liste d'affichage
+    groupCel->previous = NULL;
+    groupCel->visible = 1;
+    // Ordre de projection des index
+    groupCel->order = NULL;
+    groupCel->orderFirst = GROUPCEL_ORDER_NONE;
+    groupCel->orderLast = GROUPCEL_ORDER_NONE;
+    groupCel->depthSort = 0;
+    groupCel->depthChanged = 0;
+    // Pas de passe d'occultation
+    groupCel->bounds = NULL;
+    groupCel->occlusion = NULL;
+    groupCel->occluders = NULL;
+    groupCel->occlusionEpoch = 0;
+    groupCel->occlusionChanged = 0;
+    groupCel->occludedCount = 0;
+    // Pas aplati
+    groupCel->flat = NULL;
+    // Aucun rectangle à redessiner
+    groupCel->dirty = NULL;
+    groupCel->dirtyBounds = NULL;
+    // Aucune projection gardée
+    groupCel->projections = NULL;
+}
+
 // Initialisation d'un GroupCel
 GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY, uint32 celsCount) {
 
@@ -42,27 +142,8 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
 	sizeX = (sizeX > 1) ? sizeX : 1;
 	sizeY = (sizeY > 1) ? sizeY : 1;
 	
-	// Position du groupe
-	groupCel->position.x = positionX;
-	groupCel->position.y = positionY;
-	// Dimension du groupe
-	groupCel->size.x = sizeX;
-	groupCel->size.y = sizeY;
-
-    // Quadrilatère destiné à recevoir les étirements
-    groupCel->stretching.topLeft.x = 0;
-	groupCel->stretching.topLeft.y = 0;
-    groupCel->stretching.topRight.x = sizeX;
-	groupCel->stretching.topRight.y = 0;
-    groupCel->stretching.bottomRight.x = sizeX;
-	groupCel->stretching.bottomRight.y = sizeY;
-    groupCel->stretching.bottomLeft.x = 0;
-	groupCel->stretching.bottomLeft.y = sizeY;  
-	
-	// Rotation
-	groupCel->rotationAngle = 0;
-	groupCel->rotationPivot.x = 0;
-	groupCel->rotationPivot.y = 0;
+    // Cadre du groupe
+    GroupCelFrameInitialization(groupCel, positionX, positionY, sizeX, sizeY);
 
 	// Nombre total de cels
 	groupCel->celsCount = celsCount;
@@ -81,6 +162,20 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
     // Initialise les valeurs des cels à 0 
     memset(groupCel->cels, 0, (size_t)celsCount * sizeof(GroupCelList));
 
+    // Alloue de la mémoire pour les inverses des éléments
+    groupCel->reciprocals = (CelQuadMapReciprocals *)AllocMem(celsCount * sizeof(CelQuadMapReciprocals), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (groupCel->reciprocals == NULL) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(groupCel->cels, celsCount * sizeof(GroupCelList));
+        FreeMem(groupCel, sizeof(GroupCel));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel reciprocals.\n");
+        return NULL;
+    }
+    // Aucune dimension vue pour l'instant
+    memset(groupCel->reciprocals, 0, (size_t)celsCount * sizeof(CelQuadMapReciprocals));
+
 	// Retourne le GroupCel créé
     return groupCel;
 }
@@ -90,6 +185,8 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
 
 	// Quadrilatère pour la projection du Cel en 16.16
 	Quad2D quadMap = {0};
+	// CCB suivant le groupe dans sa liste d'affichage
+	CCB *follower = NULL;
 	
 	if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementConfiguration()*\n"); }	
 
@@ -122,13 +219,24 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
 		celIndex = groupCel->celsCount - 1; 
 	}
 
+    // CCB suivant le groupe, pris sur le tail avant qu'il ne change
+    if (groupCel->previous != NULL) { follower = GroupCelChainNext(groupCel->tail); }
+
+    // Montre le CCB précédent si la passe d'occultation l'a caché
+    if (groupCel->occlusion != NULL) { GroupCelOcclusionShow(groupCel, celIndex); }
+    // Le nouveau CCB supprime la chaîne LOD du précédent
+    if (groupCel->lods != NULL) { memset(&groupCel->lods[celIndex], 0, sizeof(GroupCelLod)); }
     // Stocke le cel dans la liste
-    groupCel->cels[celIndex].position.x = positionX;
-    groupCel->cels[celIndex].position.y = positionY;
-    groupCel->cels[celIndex].cel = (CCB *)cel;
+    GroupCelElementStore(&groupCel->cels[celIndex], (CCB *)cel, Convert32_F16(positionX), Convert32_F16(positionY));
+    // Oublie le quadrilatère écrit dans le CCB précédent
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
 	
+	// Si l'ordre de projection est géré
+	if (groupCel->order != NULL) {
+		// Le nouveau CCB prend la place de l'élément dans celui-ci
+		GroupCelDrawOrderReplace(groupCel, celIndex);
 	// Si c'est le premier Cel de la liste
-	if(celIndex == 0){
+	} else if(celIndex == 0){
 		// Mets à jour le CCB principal du groupe
 		groupCel->cel = groupCel->cels[celIndex].cel;
 	// Sinon
@@ -136,9 +244,23 @@ int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel
 		// Indique au Cel Engine que c'est le Cel suivant à rendre
 		LinkCel(groupCel->cels[celIndex - 1].cel, groupCel->cels[celIndex].cel);
 	}
+    // Si l'ordre de projection n'est pas géré
+    if (groupCel->order == NULL) {
+        // Si aucun élément configuré ne suit, le Cel termine la chaîne du groupe
+        if ((celIndex == groupCel->celsCount - 1) || (groupCel->cels[celIndex + 1].cel == NULL)) {
+            groupCel->tail = groupCel->cels[celIndex].cel;
+        // Sinon, le nouveau CCB continue sur l'élément configuré après lui
+        } else {
+            LinkCel(groupCel->cels[celIndex].cel, groupCel->cels[celIndex + 1].cel);
+        }
+        // Si le groupe est déjà dans une liste d'affichage, relie les extrémités de sa chaîne
+        GroupCelChainRelink(groupCel, follower);
+    }
 
 	// Mets à jour la position dans le CCB du Cel
 	GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
+	// Un groupe aplati projette de nouveau ses éléments
+	GroupCelElementsChanged(groupCel);
 	
 	// Retourne un succès
 	return 1;
@@ -180,7 +302,7 @@ int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...) {
 		positionY = va_arg(args, uint32);
 
 		// Configuration d'une frame d'un sprite
-		if (DEBUG_GROUPCEL_SETUP == 1) { printf("-> GroupCelElementConfiguration(%p, %u, %p, %u, %u)\n", groupCel, celIndex, cel, positionX, positionY); }
+		if (DEBUG_GROUPCEL_SETUP == 1) { printf("-> GroupCelElementConfiguration(%p, %u, %p, %u, %u)\n", (void *)groupCel, celIndex, (void *)cel, positionX, positionY); }
 		if (GroupCelElementConfiguration(groupCel, celIndex, cel, positionX, positionY) < 0) {
 			// Fin de la liste des arguments 
 			va_end(args);
@@ -197,6 +319,388 @@ int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...) {
     return 1;
 }
 
+// Configuration des cels d'un GroupCel à partir d'une table de descripteurs
+int32 GroupCelElementsTableConfiguration(GroupCel *groupCel, const GroupCelElement *elements, uint32 elementsCount, CCB **cels, uint32 celsCount) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Quadrilatère pour la projection du Cel en 16.16
+    Quad2D quadMap = {0};
+    // CCB suivant le groupe dans sa liste d'affichage
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementsTableConfiguration()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si la liste de Cels est inconnue
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel list unknow.\n");
+        return -1;
+    }
+
+    // Si la table de descripteurs ou la table de Cels est inconnue
+    if ((elements == NULL) || (cels == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel table unknow.\n");
+        return -1;
+    }
+
+    // Si la table ne tient pas dans le groupe
+    if ((elementsCount == 0) || (elementsCount > groupCel->celsCount)) {
+        // Retourne une erreur
+        printf("Error : GroupCel table of %u elements doesn't fit %u cels.\n", elementsCount, groupCel->celsCount);
+        return -1;
+    }
+
+    // Valide la table entière avant de modifier le groupe
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        // Si la référence est hors limites ou si le Cel est inconnu
+        if ((elements[celIndex].celReference >= celsCount) || (cels[elements[celIndex].celReference] == NULL)) {
+            // Retourne une erreur
+            printf("Error : GroupCel element %u references an unknown Cel.\n", celIndex);
+            return -1;
+        }
+    }
+
+    // CCB suivant le groupe, pris sur le tail avant qu'il ne change
+    if (groupCel->previous != NULL) { follower = GroupCelChainNext(groupCel->tail); }
+
+    // Une nouvelle table ramène l'ordre des index
+    GroupCelDrawOrderCleanup(groupCel);
+
+    // Stocke les Cels dans la liste et les lie en une seule passe
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        // Montre le CCB précédent si la passe d'occultation l'a caché
+        if (groupCel->occlusion != NULL) { GroupCelOcclusionShow(groupCel, celIndex); }
+        // Le nouveau CCB supprime la chaîne LOD du précédent
+        if (groupCel->lods != NULL) { memset(&groupCel->lods[celIndex], 0, sizeof(GroupCelLod)); }
+        GroupCelElementStore(&groupCel->cels[celIndex], cels[elements[celIndex].celReference], Convert32_F16(elements[celIndex].positionX), Convert32_F16(elements[celIndex].positionY));
+        // Oublie le quadrilatère écrit dans le CCB précédent
+        if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+        // Indique au Cel Engine que c'est le Cel suivant à rendre
+        if (celIndex > 0) { LinkCel(groupCel->cels[celIndex - 1].cel, groupCel->cels[celIndex].cel); }
+    }
+
+    // Si un élément configuré auparavant suit la table
+    if ((elementsCount < groupCel->celsCount) && (groupCel->cels[elementsCount].cel != NULL)) {
+        // Garde la chaîne continue
+        LinkCel(groupCel->cels[elementsCount - 1].cel, groupCel->cels[elementsCount].cel);
+    }
+
+    // Mets à jour le CCB principal du groupe
+    groupCel->cel = groupCel->cels[0].cel;
+    // La chaîne se termine sur le dernier élément configuré sans trou
+    celIndex = elementsCount;
+    while ((celIndex < groupCel->celsCount) && (groupCel->cels[celIndex].cel != NULL)) { celIndex++; }
+    groupCel->tail = groupCel->cels[celIndex - 1].cel;
+    // Si le groupe est déjà dans une liste d'affichage, relie les extrémités de sa chaîne
+    GroupCelChainRelink(groupCel, follower);
+
+    // Mets à jour les positions dans les CCB des Cels en un seul lot
+    for (celIndex = 0; celIndex < elementsCount; celIndex++) {
+        GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
+    }
+    // Un groupe aplati projette de nouveau ses éléments
+    GroupCelElementsChanged(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Initialisation d'un GroupCel en grille
+GroupCel *GroupCelGridInitialization(int32 positionX, int32 positionY, uint32 columns, uint32 rows, uint32 tileSizeX, uint32 tileSizeY) {
+
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelGridInitialization()*\n"); }
+
+    // Alloue de la mémoire pour le GroupCel
+    groupCel = (GroupCel *)AllocMem(sizeof(GroupCel), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (groupCel == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel.\n");
+        return NULL;
+    }
+
+    // Corrige les paramètres
+    // Grille minimum = 1 x 1 tuile
+    columns = (columns > 1) ? columns : 1;
+    rows = (rows > 1) ? rows : 1;
+    // Tuile minimum = 1 x 1 pixel
+    tileSizeX = (tileSizeX > 1) ? tileSizeX : 1;
+    tileSizeY = (tileSizeY > 1) ? tileSizeY : 1;
+
+    // Le cadre englobe toute la grille
+    GroupCelFrameInitialization(groupCel, positionX, positionY, columns * tileSizeX, rows * tileSizeY);
+
+    // Grille
+    groupCel->gridColumns = columns;
+    groupCel->gridRows = rows;
+    groupCel->tileSize.x = tileSizeX;
+    groupCel->tileSize.y = tileSizeY;
+    // Nombre total de tuiles
+    groupCel->celsCount = columns * rows;
+    // Les positions découlent de l'index : aucune liste d'éléments
+    groupCel->cels = NULL;
+
+    // Alloue de la mémoire pour le tableau de tuiles
+    groupCel->tiles = (CCB **)AllocMem(groupCel->celsCount * sizeof(CCB *), MEMTYPE_DRAM);
+    // Alloue de la mémoire pour deux rangées de sommets du treillis
+    groupCel->lattice = (Point2D *)AllocMem(2 * (columns + 1) * sizeof(Point2D), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if ((groupCel->tiles == NULL) || (groupCel->lattice == NULL)) {
+        // Libère la mémoire précédemment allouée
+        if (groupCel->tiles != NULL) { FreeMem(groupCel->tiles, groupCel->celsCount * sizeof(CCB *)); }
+        if (groupCel->lattice != NULL) { FreeMem(groupCel->lattice, 2 * (columns + 1) * sizeof(Point2D)); }
+        FreeMem(groupCel, sizeof(GroupCel));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel grid.\n");
+        return NULL;
+    }
+
+    // Aucune tuile pour l'instant
+    memset(groupCel->tiles, 0, (size_t)groupCel->celsCount * sizeof(CCB *));
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
+
+// Configuration d'une tuile d'un GroupCel en grille
+int32 GroupCelGridTileConfiguration(GroupCel *groupCel, uint32 column, uint32 row, CCB *cel) {
+
+    // Index de la tuile
+    uint32 tileIndex = 0;
+    // Index pour chercher les tuiles voisines
+    int32 searchIndex = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelGridTileConfiguration()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe n'est pas une grille
+    if (groupCel->tiles == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel grid unknow.\n");
+        return -1;
+    }
+
+    // Si le Cel est inconnu
+    if (cel == NULL){
+        // Retourne une erreur
+        printf("Error : Cel unknow.\n");
+        return -1;
+    }
+
+    // Si la tuile est hors de la grille
+    if ((column >= groupCel->gridColumns) || (row >= groupCel->gridRows)) {
+        // Retourne une erreur
+        printf("Error : GroupCel tile (%u, %u) outside the %u x %u grid.\n", column, row, groupCel->gridColumns, groupCel->gridRows);
+        return -1;
+    }
+
+    // Stocke le Cel dans la grille
+    tileIndex = row * groupCel->gridColumns + column;
+    groupCel->tiles[tileIndex] = cel;
+
+    // Lie le Cel après la tuile configurée précédente
+    for (searchIndex = (int32)tileIndex - 1; searchIndex >= 0; searchIndex--) {
+        if (groupCel->tiles[searchIndex] != NULL) { break; }
+    }
+    // S'il n'y en a pas, c'est le CCB principal du groupe
+    if (searchIndex < 0) {
+        groupCel->cel = cel;
+    // Sinon
+    } else {
+        // Indique au Cel Engine que c'est le Cel suivant à rendre
+        LinkCel(groupCel->tiles[searchIndex], cel);
+    }
+
+    // Lie le Cel avant la tuile configurée suivante
+    for (searchIndex = (int32)tileIndex + 1; searchIndex < (int32)groupCel->celsCount; searchIndex++) {
+        if (groupCel->tiles[searchIndex] != NULL) {
+            LinkCel(cel, groupCel->tiles[searchIndex]);
+            break;
+        }
+    }
+    // Si aucune tuile ne suit, le Cel termine la chaîne du groupe
+    if (searchIndex == (int32)groupCel->celsCount) { groupCel->tail = cel; }
+
+    // Active le déplacement pour placer la tuile
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Configuration de toutes les tuiles d'un GroupCel en grille
+int32 GroupCelGridTilesConfiguration(GroupCel *groupCel, CCB **cels, uint32 celsCount) {
+
+    // Index pour parcourir les tuiles
+    uint32 tileIndex = 0;
+    // Dernière tuile liée
+    CCB *previousCel = NULL;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelGridTilesConfiguration()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe n'est pas une grille
+    if (groupCel->tiles == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel grid unknow.\n");
+        return -1;
+    }
+
+    // Si la table ne couvre pas la grille
+    if ((cels == NULL) || (celsCount != groupCel->celsCount)) {
+        // Retourne une erreur
+        printf("Error : GroupCel table of %u tiles doesn't fit %u tiles.\n", celsCount, groupCel->celsCount);
+        return -1;
+    }
+
+    // Stocke les tuiles rangée par rangée et les lie en une passe (une case vide vaut NULL)
+    groupCel->cel = NULL;
+    for (tileIndex = 0; tileIndex < celsCount; tileIndex++) {
+        groupCel->tiles[tileIndex] = cels[tileIndex];
+        // Si la case est vide
+        if (cels[tileIndex] == NULL) { continue; }
+        // Indique au Cel Engine que c'est le Cel suivant à rendre
+        if (previousCel == NULL) { groupCel->cel = cels[tileIndex]; } else { LinkCel(previousCel, cels[tileIndex]); }
+        previousCel = cels[tileIndex];
+    }
+    // La dernière tuile liée termine la chaîne du groupe
+    groupCel->tail = previousCel;
+
+    // Place toutes les tuiles
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    GroupCelUpdate(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Création d'un GroupCel partageant les données source d'un modèle
+GroupCel *GroupCelInstantiate(GroupCel *templateGroupCel, GroupCelPool *pool, int32 positionX, int32 positionY) {
+
+    // GroupCel
+    GroupCel *groupCel = NULL;
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Entête CCB de l'instance
+    CCB *cel = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelInstantiate()*\n"); }
+
+    // Si le modèle est inconnu
+    if ((templateGroupCel == NULL) || (templateGroupCel->cels == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel template unknow.\n");
+        return NULL;
+    }
+
+    // Si la réserve est inconnue
+    if (pool == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel pool unknow.\n");
+        return NULL;
+    }
+
+    // Si la réserve ne peut pas fournir tous les entêtes CCB
+    if (pool->freeCount < templateGroupCel->celsCount) {
+        // Retourne une erreur
+        printf("Error : GroupCel pool exhausted (%u free, %u needed).\n", pool->freeCount, templateGroupCel->celsCount);
+        return NULL;
+    }
+
+    // Valide le modèle avant de prendre quoi que ce soit dans la réserve
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+        // Si un élément du modèle n'est pas configuré
+        if (templateGroupCel->cels[celIndex].cel == NULL) {
+            // Retourne une erreur
+            printf("Error : GroupCel template element %u unknow.\n", celIndex);
+            return NULL;
+        }
+    }
+
+    // Crée le GroupCel avec le cadre du modèle
+    groupCel = GroupCelInitialization(positionX, positionY, templateGroupCel->size.x, templateGroupCel->size.y, templateGroupCel->celsCount);
+    // Si c'est un échec
+    if (groupCel == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    // Les entêtes CCB proviennent de la réserve
+    groupCel->pool = pool;
+
+    // Copie la disposition : l'étirement est local, le pivot suit le groupe
+    groupCel->stretching = templateGroupCel->stretching;
+    groupCel->rotationAngle = templateGroupCel->rotationAngle;
+    groupCel->rotationAngle16 = templateGroupCel->rotationAngle16;
+    groupCel->rotationPivot.x = templateGroupCel->rotationPivot.x + positionX - templateGroupCel->position.x;
+    groupCel->rotationPivot.y = templateGroupCel->rotationPivot.y + positionY - templateGroupCel->position.y;
+    groupCel->rotationPivot16.x = templateGroupCel->rotationPivot16.x + Convert32_F16(positionX) - templateGroupCel->position16.x;
+    groupCel->rotationPivot16.y = templateGroupCel->rotationPivot16.y + Convert32_F16(positionY) - templateGroupCel->position16.y;
+    // L'instance est vue à travers la caméra du modèle
+    groupCel->camera = templateGroupCel->camera;
+
+    // Pour chaque élément
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+
+        // Copie uniquement l'entête CCB : les données source et la PLUT sont partagées
+        cel = GroupCelPoolAllocation(pool);
+        *cel = *templateGroupCel->cels[celIndex].cel;
+        // L'instance projette les éléments cachés par la passe d'occultation du modèle
+        if ((templateGroupCel->occlusion != NULL) && ((templateGroupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0)) { cel->ccb_Flags &= ~CCB_SKIP; }
+
+        // Copie l'élément avec sa dimension en cache
+        groupCel->cels[celIndex] = templateGroupCel->cels[celIndex];
+        groupCel->cels[celIndex].cel = cel;
+        // La dimension est la même, aucun changement de taille ne calculerait les inverses : les calcule maintenant
+        CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+
+        // Indique au Cel Engine que c'est le Cel suivant à rendre
+        if (celIndex > 0) { LinkCel(groupCel->cels[celIndex - 1].cel, cel); }
+    }
+
+    // Le dernier Cel termine la chaîne de l'instance
+    cel->ccb_NextPtr = NULL;
+    cel->ccb_Flags |= CCB_LAST;
+    groupCel->tail = cel;
+
+    // Mets à jour le CCB principal du groupe
+    groupCel->cel = groupCel->cels[0].cel;
+
+    // Applique la position et les transformations du modèle
+    groupCel->transformations = GROUPCEL_FLAG_MOVE;
+    if (GroupCelIsStretched(groupCel) == 1) { groupCel->transformations |= GROUPCEL_FLAG_STRETCH; }
+    if (groupCel->rotationAngle16 != 0) { groupCel->transformations |= GROUPCEL_FLAG_ROTATE; }
+    GroupCelUpdate(groupCel);
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
+
 // Déplace le GroupCel
 void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY) {
 	
@@ -210,7 +714,7 @@ void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY) {
 	}
 	
 	// Modifie la position du GroupCel
-	GroupCelSetPosition(groupCel, groupCel->position.x + moveX, groupCel->position.y + moveY);	
+	GroupCelSetPositionF16(groupCel, groupCel->position16.x + Convert32_F16(moveX), groupCel->position16.y + Convert32_F16(moveY));
 }
 
 // Modifie la position du GroupCel
@@ -218,19 +722,36 @@ void GroupCelSetPosition(GroupCel *groupCel, int32 positionX, int32 positionY) {
 	
 	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetPosition()*\n"); }	
 	
-	// Si le groupe est inconnu
-	if (groupCel == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel unknow.\n");
-		return;
-	}
-	
-	// Applique les changements
-	groupCel->position.x = positionX;
-	groupCel->position.y = positionY;
+	// Applique la position en 16.16
+	GroupCelSetPositionF16(groupCel, Convert32_F16(positionX), Convert32_F16(positionY));
+}
+
+// Modifie la position du GroupCel en 16.16
+void GroupCelSetPositionF16(GroupCel *groupCel, frac16 positionX16, frac16 positionY16) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetPositionF16()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return;
+    }
 
-	// Active le déplacement
-	groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    // Si le GroupCel est déjà à cette position
+    if ((groupCel->position16.x == positionX16) && (groupCel->position16.y == positionY16)) {
+        // Rien à mettre à jour
+        return;
+    }
+
+    // Applique les changements, la position entière suit
+    groupCel->position16.x = positionX16;
+    groupCel->position16.y = positionY16;
+    groupCel->position.x = ConvertF16_32(positionX16);
+    groupCel->position.y = ConvertF16_32(positionY16);
+
+    // Active le déplacement
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
 }
 
 // Déplace un élément dans le GroupCel
@@ -253,7 +774,7 @@ void GroupCelElementMove(GroupCel *groupCel, int32 celIndex, int32 moveX, int32
 	}
 	
 	// Modifie la position du de l'élément dans le groupe
-	GroupCelElementSetPosition(groupCel, celIndex, groupCel->cels[celIndex].position.x + moveX, groupCel->cels[celIndex].position.y + moveY);	
+	GroupCelElementSetPositionF16(groupCel, celIndex, GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]) + Convert32_F16(moveX), GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]) + Convert32_F16(moveY));
 }
 
 // Modifie la position d'un cel du GroupCel
@@ -261,293 +782,796 @@ void GroupCelElementSetPosition(GroupCel *groupCel, int32 celIndex, int32 positi
 	
 	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetPosition()*\n"); }	
 	
-	// Si le groupe est inconnu
-	if (groupCel == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel unknow.\n");
-		return;
-	}
-	
-	// Si la liste de Cels est inconnue
-	if (groupCel->cels == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel list unknow.\n");
-		return;
-	}
-	
-	// Applique les changements
-	groupCel->cels[celIndex].position.x = positionX;
-	groupCel->cels[celIndex].position.y = positionY;
-	
-	printf("positionX : %d\n", positionX);
-	printf("positionY : %d\n", positionY);
-
-	// Active le déplacement
-	groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+	// Applique la position en 16.16
+	GroupCelElementSetPositionF16(groupCel, celIndex, Convert32_F16(positionX), Convert32_F16(positionY));
 }
 
+// Modifie la position d'un cel du GroupCel en 16.16
+void GroupCelElementSetPositionF16(GroupCel *groupCel, int32 celIndex, frac16 positionX16, frac16 positionY16) {
 
-// Etire le groupe selon ses 4 coins en pixels
-void GroupCelStretch(GroupCel *groupCel, int32 point0X, int32 point0Y, int32 point1X, int32 point1Y, int32 point2X, int32 point2Y, int32 point3X, int32 point3Y) {
-	
-	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelStretch()*\n"); }
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetPositionF16()*\n"); }
 
-	// Si le groupe est inconnu
-	if (groupCel == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel unknow.\n");
-		return;
-	}
-	
-	// Modifie les valeurs de transformation
-    groupCel->stretching.topLeft.x = point0X - groupCel->position.x;
-    groupCel->stretching.topLeft.y = point0Y - groupCel->position.y;
-    groupCel->stretching.topRight.x = point1X - groupCel->position.x;
-    groupCel->stretching.topRight.y = point1Y - groupCel->position.y;
-    groupCel->stretching.bottomRight.x = point2X - groupCel->position.x;
-    groupCel->stretching.bottomRight.y = point2Y - groupCel->position.y;
-    groupCel->stretching.bottomLeft.x = point3X - groupCel->position.x;
-    groupCel->stretching.bottomLeft.y = point3Y - groupCel->position.y;
-	
-	// Active l'étirement
-	groupCel->transformations |= GROUPCEL_FLAG_STRETCH;
-}
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return;
+    }
 
-// Tourne le groupe selon un angle en 256 unités
-void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY) {
-	
-	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRotate()*\n"); }
+    // Si la liste de Cels est inconnue
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel list unknow.\n");
+        return;
+    }
 
-	// Si le groupe est inconnu
-	if (groupCel == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel unknow.\n");
-		return;
-	}
-	
-	// Modifie l'angle en restant dans la plage [0 - 255]
-    groupCel->rotationAngle = angle % 256;
-	// Modifie les valeurs de transformation
-    groupCel->rotationPivot.x = pivotX;
-    groupCel->rotationPivot.y = pivotY;
-	
-	// Active la rotation
-	groupCel->transformations |= GROUPCEL_FLAG_ROTATE;
+    // Si l'élément est déjà à cette position, une fois celle-ci stockée
+    if ((GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]) == GROUPCEL_POSITION_F16(positionX16)) && (GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]) == GROUPCEL_POSITION_F16(positionY16))) {
+        // Rien à mettre à jour
+        return;
+    }
+
+    // Applique les changements
+    GroupCelElementStore(&groupCel->cels[celIndex], groupCel->cels[celIndex].cel, positionX16, positionY16);
+
+    // Active le déplacement
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    // Un groupe aplati projette de nouveau ses éléments
+    GroupCelElementsChanged(groupCel);
 }
 
-// Mets à jour les élément dans le GroupCel
-void GroupCelUpdate(GroupCel *groupCel) {	
-
-	// Index pour parcourir les éléments
-	int32 celIndex = 0;
-	// Indique si des transformations sont à appliquer
-	int32 doMove = 0;
-	int32 doStretch = 0;
-	int32 doRotate = 0;
-	// Quadrilatère pour la projection du Cel en 16.16
-	Quad2D quadMap = {0};
-	
-	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }	
-	
-	// Si le groupe est inconnu
-	if (groupCel == NULL){
-		// Retourne une erreur
-		printf("Error : GroupCel unknow.\n");
-		return;
-	}
+
+// Animation d'un élément du GroupCel
+int32 GroupCelElementAnimation(GroupCel *groupCel, uint32 celIndex, ANIM *anim, int32 frameDuration) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementAnimation()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si l'élément est inconnu
+    if ((groupCel->cels == NULL) || (celIndex >= groupCel->celsCount) || (groupCel->cels[celIndex].cel == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel element %u unknow.\n", celIndex);
+        return -1;
+    }
+
+    // Si l'animation n'a aucune image
+    if ((anim != NULL) && ((anim->num_Frames <= 0) || (anim->pentries == NULL))) {
+        // Retourne une erreur
+        printf("Error : GroupCel animation without frames.\n");
+        return -1;
+    }
+
+    // Si l'élément a une chaîne LOD, ses niveaux échangent déjà les données source
+    if ((anim != NULL) && (groupCel->lods != NULL) && (groupCel->lods[celIndex].levels != NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel element %u has a LOD chain.\n", celIndex);
+        return -1;
+    }
+
+    // Si c'est le premier élément animé
+    if (groupCel->animations == NULL) {
+        // Alloue de la mémoire pour les états d'animation
+        groupCel->animations = (GroupCelAnimation *)AllocMem(groupCel->celsCount * sizeof(GroupCelAnimation), MEMTYPE_DRAM);
+        // Si c'est un échec
+        if (groupCel->animations == NULL) {
+            // Affiche un message d'erreur
+            printf("Error : Failed to allocate memory for GroupCel animations.\n");
+            return -1;
+        }
+        // Aucun élément animé pour l'instant
+        memset(groupCel->animations, 0, (size_t)groupCel->celsCount * sizeof(GroupCelAnimation));
+    }
+
+    // Corrige les paramètres
+    // Durée minimum d'une image = 1
+    frameDuration = (frameDuration > 1) ? frameDuration : 1;
+
+    // Stocke l'animation (NULL l'arrête)
+    groupCel->animations[celIndex].anim = anim;
+    groupCel->animations[celIndex].frameIndex = 0;
+    groupCel->animations[celIndex].frameDuration = frameDuration;
+    groupCel->animations[celIndex].elapsed = 0;
+
+    // Si l'élément est animé
+    if (anim != NULL) {
+        // Affiche la première image et la place si sa dimension a changé
+        if (GroupCelElementAnimationFrame(groupCel, celIndex, 0) == 1) {
+            groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        }
+    }
+    // Un groupe aplati projette de nouveau ses éléments
+    GroupCelElementsChanged(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Cache des quadrilatères des éléments du GroupCel
+int32 GroupCelQuadCache(GroupCel *groupCel, int32 enable) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelQuadCache()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel quad cache needs a list of elements.\n");
+        return -1;
+    }
+
+    // Les compteurs repartent de zéro
+    groupCel->quadHits = 0;
+    groupCel->quadMisses = 0;
+
+    // Si le cache doit être désactivé
+    if (enable == 0) {
+        // S'il y a un cache
+        if (groupCel->quads != NULL) {
+            // Libère la mémoire utilisée pour les quadrilatères
+            FreeMem(groupCel->quads, groupCel->celsCount * sizeof(Quad2D));
+            groupCel->quads = NULL;
+        }
+        // Retourne un succès
+        return 1;
+    }
+
+    // Si le cache n'est pas encore alloué
+    if (groupCel->quads == NULL) {
+        // Alloue de la mémoire pour le dernier quadrilatère de chaque élément
+        groupCel->quads = (Quad2D *)AllocMem(groupCel->celsCount * sizeof(Quad2D), MEMTYPE_DRAM);
+        // Si c'est un échec
+        if (groupCel->quads == NULL) {
+            // Affiche un message d'erreur
+            printf("Error : Failed to allocate memory for GroupCel quads.\n");
+            return -1;
+        }
+        // Aucun quadrilatère écrit pour l'instant
+        memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D));
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Etire le groupe selon ses 4 coins en pixels
+void GroupCelStretch(GroupCel *groupCel, int32 point0X, int32 point0Y, int32 point1X, int32 point1Y, int32 point2X, int32 point2Y, int32 point3X, int32 point3Y) {
+
+	// Quadrilatère d'étirement local
+	Quad2D stretching;
 	
-	// Si la liste de Cels est inconnue
-	if (groupCel->cels == NULL){
+	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelStretch()*\n"); }
+
+	// Si le groupe est inconnu
+	if (groupCel == NULL){
 		// Retourne une erreur
-		printf("Error : GroupCel list unknow.\n");
+		printf("Error : GroupCel unknow.\n");
 		return;
 	}
 	
-	// Détermine si il faut appliquer un déplacement
-    doMove = (groupCel->transformations & GROUPCEL_FLAG_MOVE) != 0;
-	// Détermine si il faut appliquer un étirement
-    doStretch = (groupCel->transformations & GROUPCEL_FLAG_STRETCH) != 0;
-	// Détermine si il faut appliquer une rotation
-    doRotate = (groupCel->transformations & GROUPCEL_FLAG_ROTATE) != 0;
-	
-    // Si il n'y a aucune mise à jour à faire
-    if ((doMove == 0) && (doStretch == 0) && (doRotate == 0)) {
-		// Quitte prématurément
+	// Valeurs locales des coins
+	stretching.topLeft.x = point0X - groupCel->position.x;
+	stretching.topLeft.y = point0Y - groupCel->position.y;
+	stretching.topRight.x = point1X - groupCel->position.x;
+	stretching.topRight.y = point1Y - groupCel->position.y;
+	stretching.bottomRight.x = point2X - groupCel->position.x;
+	stretching.bottomRight.y = point2Y - groupCel->position.y;
+	stretching.bottomLeft.x = point3X - groupCel->position.x;
+	stretching.bottomLeft.y = point3Y - groupCel->position.y;
+
+	// Si le cadre a déjà ces coins
+	if (memcmp(&groupCel->stretching, &stretching, sizeof(Quad2D)) == 0) {
+		// Rien à mettre à jour
 		return;
 	}
+
+	// Modifie les valeurs de transformation
+	groupCel->stretching = stretching;
 	
-    // Si il n'y a un étirement ou une rotation
-    if ((doStretch == 1) || (doRotate == 1)) {
-		// Passe à la fonction de mise à jour complexes
-		GroupCelUpdateTransformations(groupCel, doStretch, doRotate, &quadMap);
-		// Quitte tout de suite après
-		return;
-	}
+	// Active l'étirement
+	groupCel->transformations |= GROUPCEL_FLAG_STRETCH;
+}
+
+// Tourne le groupe selon un angle en 256 unités
+void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY) {
 	
-	// Pour chaque élément
-	for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
-		// Mets à jour la position dans le CCB du Cel
-		GroupCelElementUpdatePosition(groupCel, celIndex, &quadMap);
-	}
+	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRotate()*\n"); }
 	
-	// Désactive le déplacement
-	groupCel->transformations &= ~GROUPCEL_FLAG_MOVE;	
+	// Applique la rotation en 16.16
+	GroupCelRotateF16(groupCel, Convert32_F16(angle % 256), Convert32_F16(pivotX), Convert32_F16(pivotY));
+}
+
+// Tourne le groupe selon un angle en 256 unités en 16.16
+void GroupCelRotateF16(GroupCel *groupCel, frac16 angle16, frac16 pivotX16, frac16 pivotY16) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRotateF16()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return;
+    }
+
+    // Modifie l'angle en restant dans la plage [0 - 256[
+    angle16 &= GROUPCEL_ANGLE_MASK;
+
+    // Si le GroupCel a déjà cette rotation
+    if ((groupCel->rotationAngle16 == angle16) && (groupCel->rotationPivot16.x == pivotX16) && (groupCel->rotationPivot16.y == pivotY16)) {
+        // Rien à mettre à jour
+        return;
+    }
+
+    // Modifie les valeurs de transformation, les valeurs entières suivent
+    groupCel->rotationAngle16 = angle16;
+    groupCel->rotationPivot16.x = pivotX16;
+    groupCel->rotationPivot16.y = pivotY16;
+    groupCel->rotationAngle = (uint32)ConvertF16_32(angle16);
+    groupCel->rotationPivot.x = ConvertF16_32(pivotX16);
+    groupCel->rotationPivot.y = ConvertF16_32(pivotY16);
+
+    // Active la rotation
+    groupCel->transformations |= GROUPCEL_FLAG_ROTATE;
+}
+
+// Mets à jour les élément dans le GroupCel
+void GroupCelUpdate(GroupCel *groupCel) {   
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }  
+
+    // Applique les transformations sans avancer les animations
+    GroupCelUpdateElapsed(groupCel, 0);
+}
+
+// Avance les animations et met à jour les éléments du GroupCel
+void GroupCelUpdateElapsed(GroupCel *groupCel, int32 elapsed) {
+
+    // Index pour parcourir les éléments
+    int32 celIndex = 0;
+    // Indique si des transformations sont à appliquer
+    int32 doStretch = 0;
+    int32 doRotate = 0;
+    // Indique si tous les éléments sont à recalculer
+    int32 doAll = 0;
+    // Indique si la nouvelle image d'un élément a changé sa dimension
+    int32 resized = 0;
+    // Transformation du groupe
+    GroupCelTransform transform;
+    // Quadrilatère pour la projection du Cel en 16.16
+    Quad2D quadMap = {0};
+    
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdateElapsed()*\n"); }  
+    
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return;
+    }
+    
+    // Si la liste de Cels est inconnue
+    if ((groupCel->cels == NULL) && (groupCel->tiles == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel list unknow.\n");
+        return;
+    }
+    
+    // Suit la caméra avec une addition par CCB, sans recalculer les éléments
+    GroupCelCameraPan(groupCel);
+
+    // Trie de nouveau l'ordre de projection si une clé de profondeur a changé, à partir de l'ordre actuel
+    if ((groupCel->order != NULL) && (groupCel->depthSort == 1) && (groupCel->depthChanged == 1)) { GroupCelDrawOrderSort(groupCel); }
+    
+    // Si il n'y a aucune mise à jour à faire
+    if ((groupCel->transformations == 0) && ((groupCel->animations == NULL) || (elapsed == 0))) {
+        // Un CCB redimensionné hors du groupe est quand même détecté, lui seul est replacé
+        GroupCelRevalidate(groupCel);
+        // Cache les éléments couverts depuis la dernière passe
+        GroupCelOcclusionUpdate(groupCel);
+        // Quitte prématurément
+        return;
+    }
+    
+    // L'étirement et la rotation restent appliqués une fois demandés, un simple déplacement doit les conserver
+    doStretch = ((groupCel->transformations & GROUPCEL_FLAG_STRETCH) != 0) || (GroupCelIsStretched(groupCel) == 1);
+    doRotate = ((groupCel->transformations & GROUPCEL_FLAG_ROTATE) != 0) || (groupCel->rotationAngle16 != 0);
+    
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // Son seul CCB est placé à la place des éléments
+        GroupCelFlattenUpdate(groupCel, elapsed, doStretch, doRotate);
+        // Toutes les transformations sont appliquées
+        groupCel->transformations = 0;
+        return;
+    }
+
+    // Si c'est une grille
+    if (groupCel->tiles != NULL) {
+        // Calcule les sommets partagés du treillis
+        GroupCelGridUpdate(groupCel, doStretch, doRotate, &quadMap);
+        // Toutes les transformations sont appliquées
+        groupCel->transformations = 0;
+        return;
+    }
+
+    // Pré-calculs de l'étirement et de la rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    // Une transformation du groupe déplace tous les éléments
+    doAll = (groupCel->transformations != 0) ? 1 : 0;
+    
+    // Pour chaque élément, en un seul parcours
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+
+        // Si l'élément n'est pas configuré
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+
+        // Avance l'animation : une nouvelle image peut changer la dimension du CCB
+        resized = 0;
+        if ((elapsed != 0) && (groupCel->animations != NULL) && (groupCel->animations[celIndex].anim != NULL)) {
+            resized = GroupCelElementAnimationAdvance(groupCel, celIndex, elapsed);
+        }
+
+        // Détecte un changement de dimension depuis la dernière mise à jour
+        if (GroupCelElementResized(groupCel, celIndex) == 1) { resized = 1; }
+
+        // Recalcule l'élément si le groupe a bougé ou si sa dimension a changé
+        if ((doAll == 1) || (resized == 1)) {
+            GroupCelElementUpdateTransform(groupCel, celIndex, &transform, &quadMap);
+        }
+    }
+    
+    // Toutes les transformations sont appliquées
+    groupCel->transformations = 0;
+
+    // Cache les éléments couverts par un élément opaque projeté après eux
+    GroupCelOcclusionUpdate(groupCel);
 }
 
+
 // Applique la position dans le CCB du Cel
 void GroupCelElementUpdatePosition(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
 
+    // Positions locales des coins en 16.16
+    frac16 left, top, right, bottom;
+
 	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementUpdatePosition()*\n"); }	
 	
+	// Détecte un changement de dimension fait hors du groupe
+	GroupCelElementResized(groupCel, celIndex);
+
+	// Coins de l'élément en 16.16, seule la dimension est convertie
+	left = groupCel->position16.x + GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+	top = groupCel->position16.y + GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+	right = left + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+	bottom = top + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+
 	// Crée le quadrilatère pour la projection du Cel en 16.16
-	quadMap->topLeft.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x);
-	quadMap->topLeft.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y);
-	quadMap->topRight.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width);
-	quadMap->topRight.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y);
-	quadMap->bottomRight.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width);
-	quadMap->bottomRight.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height);
-	quadMap->bottomLeft.x = Convert32_F16(groupCel->position.x + groupCel->cels[celIndex].position.x);
-	quadMap->bottomLeft.y = Convert32_F16(groupCel->position.y + groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height);
+	quadMap->topLeft.x = left;
+	quadMap->topLeft.y = top;
+	quadMap->topRight.x = right;
+	quadMap->topRight.y = top;
+	quadMap->bottomRight.x = right;
+	quadMap->bottomRight.y = bottom;
+	quadMap->bottomLeft.x = left;
+	quadMap->bottomLeft.y = bottom;
 
 	// Modifie le CCB du Cel
-	CelQuadMap(groupCel->cels[celIndex].cel, quadMap);
+	GroupCelElementCommit(groupCel, celIndex, quadMap);
+}
+
+// Applique les transformations du groupe dans le CCB du Cel
+void GroupCelElementUpdateTransform(GroupCel *groupCel, int32 celIndex, GroupCelTransform *transform, Quad2D *quadMap) {
+
+    // Positions locales des coins en 16.16
+    frac16 left, top, right, bottom;
+
+    // Coins de l'élément en 16.16, seule la dimension est convertie
+    left = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+    top = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+    right = left + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+    bottom = top + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+
+    // Transforme les 4 coins
+    GroupCelTransformPoint(transform, left, top, &quadMap->topLeft);
+    GroupCelTransformPoint(transform, right, top, &quadMap->topRight);
+    GroupCelTransformPoint(transform, right, bottom, &quadMap->bottomRight);
+    GroupCelTransformPoint(transform, left, bottom, &quadMap->bottomLeft);
+
+    // Modifie le CCB du Cel
+    GroupCelElementCommit(groupCel, celIndex, quadMap);
 }
 
 // Applique les transformations Stretch et Rotate dans le CCB des Cels
 void GroupCelUpdateTransformations(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap) {
 
-	// Index pour parcourir les éléments
-	int32 celIndex = 0;
-    // Position en 16.16
-	Point2D position16 = {0};
-    // Pré-calculs pour l'étirement
-    int32 invW, invH;              
-    int32 Ax, Ay, Bx, By, Cx, Cy;
-    int32 delta16X = 0;
-	int32 delta16Y = 0;
-    // Pré-calculs pour la rotation en 16.16
-    int32 sinus16 = 0;
-	int32 cosinus16 = 0;
-	Point2D rotationPivot16 = {0};
-    int32 rotationDelta16X = 0;
-	int32 rotationDelta16Y = 0;
-	// Positions locales des 4 coins (en int32)
-	int32 localX[4] = {0};
-	int32 localY[4] = {0};
-	// Index pour parcourir les coins
-	int32 indexCorner = 0;
-	int32 px, py, u, v, uv;
-	int32 rx, ry;	
-
-	if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdate()*\n"); }	
+    // Index pour parcourir les éléments
+    int32 celIndex = 0;
+    // Transformation du groupe
+    GroupCelTransform transform;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUpdateTransformations()*\n"); }  
+
+    // Pré-calculs de l'étirement et de la rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    
+    // Pour chaque élément
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // Si l'élément n'est pas configuré
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // Détecte un changement de dimension depuis la dernière mise à jour
+        GroupCelElementResized(groupCel, celIndex);
+        // Transforme l'élément
+        GroupCelElementUpdateTransform(groupCel, celIndex, &transform, quadMap);
+    }
+}
+
+// Applique la position et les transformations aux tuiles d'une grille
+void GroupCelGridUpdate(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap) {
+
+    // Transformation du groupe
+    GroupCelTransform transform;
+    // Rangées de sommets du treillis en 16.16
+    Point2D *previousRow = NULL;
+    Point2D *currentRow = NULL;
+    Point2D *swapRow = NULL;
+    // Index pour parcourir la grille
+    uint32 column = 0;
+    uint32 row = 0;
+    // Tuile courante
+    CCB **tile = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelGridUpdate()*\n"); }
+
+    // Pré-calculs de l'étirement et de la rotation
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+
+    // Deux rangées de sommets suffisent : chaque rangée est partagée par les tuiles au-dessus et en dessous
+    previousRow = groupCel->lattice;
+    currentRow = groupCel->lattice + groupCel->gridColumns + 1;
+
+    // Rangée supérieure du treillis
+    for (column = 0; column <= groupCel->gridColumns; column++) {
+        GroupCelTransformPoint(&transform, Convert32_F16((int32)column * groupCel->tileSize.x), 0, &previousRow[column]);
+        GroupCelCameraPoint(groupCel, &previousRow[column]);
+    }
+
+    // Pour chaque rangée de tuiles
+    tile = groupCel->tiles;
+    for (row = 1; row <= groupCel->gridRows; row++) {
+
+        // Rangée inférieure du treillis pour ces tuiles
+        for (column = 0; column <= groupCel->gridColumns; column++) {
+            GroupCelTransformPoint(&transform, Convert32_F16((int32)column * groupCel->tileSize.x), Convert32_F16((int32)row * groupCel->tileSize.y), &currentRow[column]);
+            GroupCelCameraPoint(groupCel, &currentRow[column]);
+        }
+
+        // Pour chaque tuile de la rangée
+        for (column = 0; column < groupCel->gridColumns; column++, tile++) {
+            // Si la case est vide
+            if (*tile == NULL) { continue; }
+            // Les coins sont les sommets partagés avec les tuiles voisines
+            quadMap->topLeft = previousRow[column];
+            quadMap->topRight = previousRow[column + 1];
+            quadMap->bottomRight = currentRow[column + 1];
+            quadMap->bottomLeft = currentRow[column];
+            // Rafraîchit les inverses partagés si la tuile a une autre dimension
+            if (((*tile)->ccb_Width != groupCel->tileDimension.x) || ((*tile)->ccb_Height != groupCel->tileDimension.y)) {
+                CelQuadMapReciprocalsInitialization(*tile, &groupCel->tileReciprocals);
+                groupCel->tileDimension.x = (*tile)->ccb_Width;
+                groupCel->tileDimension.y = (*tile)->ccb_Height;
+            }
+            // Modifie le CCB du Cel
+            CelQuadMapReciprocal(*tile, quadMap, &groupCel->tileReciprocals);
+        }
+
+        // La rangée inférieure devient la rangée supérieure des tuiles suivantes
+        swapRow = previousRow;
+        previousRow = currentRow;
+        currentRow = swapRow;
+    }
+
+    // Le placement du groupe a changé
+    groupCel->epoch++;
+}
+
+// Prépare la transformation des points locaux du GroupCel
+void GroupCelTransformPreparation(GroupCel *groupCel, int32 doStretch, int32 doRotate, GroupCelTransform *transform) {
 
     // Position en 16.16
-    position16.x = Convert32_F16(groupCel->position.x);
-    position16.y = Convert32_F16(groupCel->position.y);
-	
-	// Si il y a un étirement
+    transform->position16.x = groupCel->position16.x;
+    transform->position16.y = groupCel->position16.y;
+
+    // Transformations à appliquer
+    transform->doStretch = doStretch;
+    transform->doRotate = doRotate;
+    
+    // Si il y a un étirement
     if (doStretch == 1) {
-        // inverses largeur/hauteur
-        invW = (1 << 16) / groupCel->size.x;
-        invH = (1 << 16) / groupCel->size.y;
+        // Inverses largeur/hauteur
+        transform->invW = (1 << 16) / groupCel->size.x;
+        transform->invH = (1 << 16) / groupCel->size.y;
 
-        // coin A
-        Ax = Convert32_F16(groupCel->stretching.topLeft.x);
-        Ay = Convert32_F16(groupCel->stretching.topLeft.y);
+        // Coin A
+        transform->corner16.x = Convert32_F16(groupCel->stretching.topLeft.x);
+        transform->corner16.y = Convert32_F16(groupCel->stretching.topLeft.y);
 
-        // vecteurs B et C
-        Bx = Convert32_F16(groupCel->stretching.topRight.x - groupCel->stretching.topLeft.x);
-        By = Convert32_F16(groupCel->stretching.topRight.y - groupCel->stretching.topLeft.y);
-        Cx = Convert32_F16(groupCel->stretching.bottomLeft.x - groupCel->stretching.topLeft.x);
-        Cy = Convert32_F16(groupCel->stretching.bottomLeft.y - groupCel->stretching.topLeft.y);
+        // Vecteurs B et C
+        transform->vectorB16.x = Convert32_F16(groupCel->stretching.topRight.x - groupCel->stretching.topLeft.x);
+        transform->vectorB16.y = Convert32_F16(groupCel->stretching.topRight.y - groupCel->stretching.topLeft.y);
+        transform->vectorC16.x = Convert32_F16(groupCel->stretching.bottomLeft.x - groupCel->stretching.topLeft.x);
+        transform->vectorC16.y = Convert32_F16(groupCel->stretching.bottomLeft.y - groupCel->stretching.topLeft.y);
 
-        // terme D (bilinéarité)
-        delta16X = Convert32_F16(groupCel->stretching.topLeft.x + groupCel->stretching.bottomRight.x - groupCel->stretching.topRight.x - groupCel->stretching.bottomLeft.x);
-        delta16Y = Convert32_F16(groupCel->stretching.topLeft.y + groupCel->stretching.bottomRight.y - groupCel->stretching.topRight.y - groupCel->stretching.bottomLeft.y);
+        // Terme D (bilinéarité)
+        transform->delta16.x = Convert32_F16(groupCel->stretching.topLeft.x + groupCel->stretching.bottomRight.x - groupCel->stretching.topRight.x - groupCel->stretching.bottomLeft.x);
+        transform->delta16.y = Convert32_F16(groupCel->stretching.topLeft.y + groupCel->stretching.bottomRight.y - groupCel->stretching.topRight.y - groupCel->stretching.bottomLeft.y);
     }
 
-	// Si il y a une rotation
+    // Si il y a une rotation
     if (doRotate == 1) {
-		// Calcule le sinus et cosinus en 16.16
-        sinus16 = SinF16(Convert32_F16(groupCel->rotationAngle));
-        cosinus16 = CosF16(Convert32_F16(groupCel->rotationAngle));
-		// Localise le pivot
-        rotationPivot16.x = Convert32_F16(groupCel->rotationPivot.x - groupCel->position.x);
-        rotationPivot16.y = Convert32_F16(groupCel->rotationPivot.y - groupCel->position.y);
+        // Calcule le sinus et cosinus en 16.16
+        transform->sinus16 = SinF16(groupCel->rotationAngle16);
+        transform->cosinus16 = CosF16(groupCel->rotationAngle16);
+        // Localise le pivot
+        transform->rotationPivot16.x = groupCel->rotationPivot16.x - groupCel->position16.x;
+        transform->rotationPivot16.y = groupCel->rotationPivot16.y - groupCel->position16.y;
     }
-	
-	// Pour chaque élément
-	for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
-
-        // Positions locales des 4 coins (en int32)
-        localX[0] = groupCel->cels[celIndex].position.x;
-		localX[1] = groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width;
-		localX[2] = groupCel->cels[celIndex].position.x + groupCel->cels[celIndex].cel->ccb_Width;
-		localX[3] = groupCel->cels[celIndex].position.x;
-		localY[0] = groupCel->cels[celIndex].position.y;
-		localY[1] = groupCel->cels[celIndex].position.y;
-		localY[2] = groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height;
-		localY[3] = groupCel->cels[celIndex].position.y + groupCel->cels[celIndex].cel->ccb_Height;
-
-		// Pour chaque coin
-        for (indexCorner = 0; indexCorner < 4; indexCorner++) {
-			
-            // Si il y a un étirement
-            if (doStretch == 1) {
-                u = MulSF16(Convert32_F16(localX[indexCorner]), invW);
-                v = MulSF16(Convert32_F16(localY[indexCorner]), invH);
-                uv = MulSF16(u, v);
-                px = Ax + MulSF16(Bx, u) + MulSF16(Cx, v) + MulSF16(delta16X, uv);
-                py = Ay + MulSF16(By, u) + MulSF16(Cy, v) + MulSF16(delta16Y, uv);
-            } else {
-                px = Convert32_F16(localX[indexCorner]);
-                py = Convert32_F16(localY[indexCorner]);
-            }
+}
 
-            // Si il y a une rotation
-            if (doRotate == 1) {
-                rotationDelta16X = px - rotationPivot16.x;
-                rotationDelta16Y = py - rotationPivot16.y;
-                rx = MulSF16(cosinus16, rotationDelta16X) - MulSF16(sinus16, rotationDelta16Y) + rotationPivot16.x;
-                ry = MulSF16(sinus16, rotationDelta16X) + MulSF16(cosinus16, rotationDelta16Y) + rotationPivot16.y;
-            } else {
-                rx = px;
-                ry = py;
-            }
-			
-            // Translation finale + stockage
-            switch (indexCorner) {
-                case 0:
-                    quadMap->topLeft.x = position16.x + rx;
-                    quadMap->topLeft.y = position16.y + ry;
-                    break;
-                case 1:
-                    quadMap->topRight.x = position16.x + rx;
-                    quadMap->topRight.y = position16.y + ry;
-                    break;
-                case 2:
-                    quadMap->bottomRight.x = position16.x + rx;
-                    quadMap->bottomRight.y = position16.y + ry;
-                    break;
-                case 3:
-                    quadMap->bottomLeft.x = position16.x + rx;
-                    quadMap->bottomLeft.y = position16.y + ry;
-                    break;
-            }
+// Transforme un point local du GroupCel en point écran en 16.16
+void GroupCelTransformPoint(GroupCelTransform *transform, frac16 localX16, frac16 localY16, Point2D *point16) {
+
+    // Point en 16.16
+    int32 px, py, u, v, uv;
+    int32 rotationDelta16X, rotationDelta16Y;
+
+    // Si il y a un étirement
+    if (transform->doStretch == 1) {
+        u = MulSF16(localX16, transform->invW);
+        v = MulSF16(localY16, transform->invH);
+        uv = MulSF16(u, v);
+        px = transform->corner16.x + MulSF16(transform->vectorB16.x, u) + MulSF16(transform->vectorC16.x, v) + MulSF16(transform->delta16.x, uv);
+        py = transform->corner16.y + MulSF16(transform->vectorB16.y, u) + MulSF16(transform->vectorC16.y, v) + MulSF16(transform->delta16.y, uv);
+    } else {
+        px = localX16;
+        py = localY16;
+    }
+
+    // Si il y a une rotation
+    if (transform->doRotate == 1) {
+        rotationDelta16X = px - transform->rotationPivot16.x;
+        rotationDelta16Y = py - transform->rotationPivot16.y;
+        px = MulSF16(transform->cosinus16, rotationDelta16X) - MulSF16(transform->sinus16, rotationDelta16Y) + transform->rotationPivot16.x;
+        py = MulSF16(transform->sinus16, rotationDelta16X) + MulSF16(transform->cosinus16, rotationDelta16Y) + transform->rotationPivot16.y;
+    }
+
+    // Translation finale + stockage
+    point16->x = transform->position16.x + px;
+    point16->y = transform->position16.y + py;
+}
+
+// Détecte un changement de dimension d'un élément
+int32 GroupCelElementResized(GroupCel *groupCel, int32 celIndex) {
+
+    // Elément
+    GroupCelList *element = &groupCel->cels[celIndex];
+    // CCB de l'élément
+    CCB *cel = element->cel;
+
+    // Si le CCB a toujours la dernière dimension vue
+    if ((cel->ccb_Width == (int32)element->width) && (cel->ccb_Height == (int32)element->height)) {
+        // Rien ne change
+        return 0;
+    }
+
+    // Garde la nouvelle dimension et rafraîchit ses inverses
+    element->width = (uint16)cel->ccb_Width;
+    element->height = (uint16)cel->ccb_Height;
+    CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+    // Oublie le quadrilatère écrit pour la dimension précédente
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+    // Un groupe aplati projette de nouveau ses éléments
+    GroupCelElementsChanged(groupCel);
+
+    // Retourne 1 si l'élément doit être recalculé
+    return 1;
+}
+
+// Ecrit la projection d'un élément dans son CCB
+void GroupCelElementCommit(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
+
+    // Quadrilatère vu à travers la caméra
+    Quad2D viewQuad;
+
+    // Si le cache des quadrilatères est activé
+    if (groupCel->quads != NULL) {
+        // Si l'élément reçoit le même quadrilatère que la dernière fois
+        if (memcmp(&groupCel->quads[celIndex], quadMap, sizeof(Quad2D)) == 0) {
+            // Son CCB est déjà à jour
+            groupCel->quadHits++;
+            return;
+        }
+        // Garde le quadrilatère écrit
+        groupCel->quads[celIndex] = *quadMap;
+        groupCel->quadMisses++;
+    }
+
+    // Déplace le quadrilatère dans la vue de la caméra, le cache le garde dans la scène
+    viewQuad = *quadMap;
+    GroupCelCameraPoint(groupCel, &viewQuad.topLeft);
+    GroupCelCameraPoint(groupCel, &viewQuad.topRight);
+    GroupCelCameraPoint(groupCel, &viewQuad.bottomRight);
+    GroupCelCameraPoint(groupCel, &viewQuad.bottomLeft);
+
+    // Affiche le niveau de détail correspondant à la taille projetée
+    if (groupCel->lods != NULL) { GroupCelElementLodSelect(groupCel, celIndex, &viewQuad); }
+    // Signale où était l'élément et où il est maintenant
+    if (groupCel->dirty != NULL) { GroupCelDirtyQuad(groupCel, &groupCel->dirtyBounds[celIndex], &viewQuad); }
+    // Garde les limites à l'écran de l'élément
+    if (groupCel->projections != NULL) { Quad2DBounds(&viewQuad, &groupCel->projections[celIndex]); }
+
+    // Garde les limites écrites pour la passe d'occultation
+    if (groupCel->bounds != NULL) { GroupCelOcclusionBounds(groupCel, celIndex, &viewQuad); }
+
+    // Modifie le CCB du Cel sans aucune division
+    CelQuadMapReciprocal(groupCel->cels[celIndex].cel, &viewQuad, &groupCel->reciprocals[celIndex]);
+
+    // Le placement du groupe a changé
+    groupCel->epoch++;
+}
+
+// Recalcule uniquement les éléments dont la dimension a changé
+int32 GroupCelRevalidate(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments
+    int32 celIndex = 0;
+    // Nombre d'éléments recalculés
+    int32 resizedCount = 0;
+    // Étirement et rotation courants
+    int32 doStretch = 0;
+    int32 doRotate = 0;
+    // Index et pointeur pour parcourir les tuiles
+    uint32 tileIndex = 0;
+    CCB *tile = NULL;
+    // Transformation du groupe
+    GroupCelTransform transform;
+    // Quadrilatère pour la projection du Cel en 16.16
+    Quad2D quadMap = {0};
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelRevalidate()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Étirement et rotation appliqués actuellement
+    doStretch = GroupCelIsStretched(groupCel);
+    doRotate = (groupCel->rotationAngle16 != 0) ? 1 : 0;
+
+    // Si c'est une grille
+    if (groupCel->tiles != NULL) {
+        // Compte les tuiles dont la dimension diffère des inverses partagés
+        for (tileIndex = 0; tileIndex < groupCel->gridColumns * groupCel->gridRows; tileIndex++) {
+            tile = groupCel->tiles[tileIndex];
+            if ((tile != NULL) && ((tile->ccb_Width != groupCel->tileDimension.x) || (tile->ccb_Height != groupCel->tileDimension.y))) { resizedCount++; }
+        }
+        // Les tuiles partagent leurs sommets : tout le treillis est replacé
+        if (resizedCount > 0) { GroupCelGridUpdate(groupCel, doStretch, doRotate, &quadMap); }
+        // Retourne le nombre de tuiles redimensionnées
+        return resizedCount;
+    }
+
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // Compte les éléments redimensionnés, chacun demande un nouveau rendu
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if ((groupCel->cels[celIndex].cel != NULL) && (GroupCelElementResized(groupCel, celIndex) == 1)) { resizedCount++; }
+        }
+        // Les éléments sont dessinés dans le bitmap, pas placés à l'écran
+        if (resizedCount > 0) {
+            GroupCelFlattenUpdate(groupCel, 0, doStretch, doRotate);
+            groupCel->transformations &= ~GROUPCEL_FLAG_ELEMENTS;
         }
+        // Retourne le nombre d'éléments redimensionnés
+        return resizedCount;
+    }
+
+    // Pré-calculs de l'étirement et de la rotation courants
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
 
-		// Modifie le CCB du Cel
-        CelQuadMap(groupCel->cels[celIndex].cel, quadMap);
+    // Pour chaque élément
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // Si l'élément n'est pas configuré
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // Si sa dimension a changé
+        if (GroupCelElementResized(groupCel, celIndex) == 1) {
+            // Recalcule uniquement cet élément
+            GroupCelElementUpdateTransform(groupCel, celIndex, &transform, &quadMap);
+            resizedCount++;
+        }
     }
-	
-	// Désactive l'étirement
-	groupCel->transformations &= ~GROUPCEL_FLAG_STRETCH;
-	// Désactive la rotation
-	groupCel->transformations &= ~GROUPCEL_FLAG_ROTATE;
+
+    // Retourne le nombre d'éléments recalculés
+    return resizedCount;
+}
+
+// Avance l'animation d'un élément
+int32 GroupCelElementAnimationAdvance(GroupCel *groupCel, uint32 celIndex, int32 elapsed) {
+
+    // Etat d'animation de l'élément
+    GroupCelAnimation *animation = &groupCel->animations[celIndex];
+    // Nombre d'images à avancer
+    int32 framesCount = 0;
+
+    // Cumule le temps écoulé
+    animation->elapsed += elapsed;
+
+    // Si l'image courante n'est pas terminée
+    if (animation->elapsed < animation->frameDuration) {
+        // Rien ne change
+        return 0;
+    }
+
+    // Avance d'autant d'images que le temps écoulé en couvre
+    framesCount = animation->elapsed / animation->frameDuration;
+    animation->elapsed -= framesCount * animation->frameDuration;
+
+    // Affiche la nouvelle image
+    return GroupCelElementAnimationFrame(groupCel, celIndex, (animation->frameIndex + framesCount) % animation->anim->num_Frames);
+}
+
+// Affiche une image de l'animation dans le CCB de l'élément
+int32 GroupCelElementAnimationFrame(GroupCel *groupCel, uint32 celIndex, int32 frameIndex) {
+
+    // Etat d'animation de l'élément
+    GroupCelAnimation *animation = &groupCel->animations[celIndex];
+    // Image à afficher
+    AnimFrame *frame = &animation->anim->pentries[frameIndex];
+    // CCB de l'élément
+    CCB *cel = groupCel->cels[celIndex].cel;
+    // Indique si la dimension change
+    int32 resized = 0;
+
+    // Image courante
+    animation->frameIndex = frameIndex;
+
+    // Compare la dimension de l'image avec le CCB de l'élément
+    resized = ((cel->ccb_Width != frame->af_CCB->ccb_Width) || (cel->ccb_Height != frame->af_CCB->ccb_Height)) ? 1 : 0;
+
+    // Echange les données source, la PLUT et les préambules de l'image
+    cel->ccb_SourcePtr = (CelData *)frame->af_pix;
+    cel->ccb_PLUTPtr = frame->af_PLUT;
+    cel->ccb_PRE0 = frame->af_CCB->ccb_PRE0;
+    cel->ccb_PRE1 = frame->af_CCB->ccb_PRE1;
+    cel->ccb_Width = frame->af_CCB->ccb_Width;
+    cel->ccb_Height = frame->af_CCB->ccb_Height;
+
+    // La nouvelle image est dessinée à la place de la précédente
+    if ((groupCel->dirty != NULL) && (groupCel->visible == 1)) { GroupCelDirtyAddF16(groupCel->dirty, &groupCel->dirtyBounds[celIndex]); }
+
+    // Retourne 1 si l'élément doit être recalculé
+    return resized;
 }
 
+
 // Supprime le GroupCel
 int32 GroupCelCleanup(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
 		
 	if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelCleanup()*\n"); }	
 	
@@ -557,12 +1581,73 @@ int32 GroupCelCleanup(GroupCel *groupCel) {
 		printf("Error : GroupCel unknow.\n");
 		return -1;	
 	} 
+
+    // Si le groupe est dans une liste d'affichage
+    if (groupCel->previous != NULL) {
+        // L'en retire pour que la liste n'atteigne plus ses CCB
+        GroupCelUnlink(groupCel);
+    }
 	
+    // Supprime le CCB aplati
+    GroupCelFlattenCleanup(groupCel);
+    // Libère les limites des rectangles à redessiner
+    GroupCelSetDirty(groupCel, NULL);
+    // Libère les projections
+    GroupCelProjections(groupCel, 0);
+    // Montre les éléments cachés par la passe d'occultation et libère ses tableaux
+    GroupCelOcclusionCleanup(groupCel);
 	// Si il y a des cels
     if (groupCel->cels != NULL) {
+        // Si les entêtes CCB proviennent d'une réserve
+        if (groupCel->pool != NULL) {
+            // Les rend
+            for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+                if (groupCel->cels[celIndex].cel != NULL) { GroupCelPoolRelease(groupCel->pool, groupCel->cels[celIndex].cel); }
+            }
+        }
 		// Libère la mémoire utilisée pour le tableau de cels
         FreeMem(groupCel->cels, groupCel->celsCount * sizeof(GroupCelList));
         groupCel->cels = NULL;
+    }
+    // Si c'est une grille
+    if (groupCel->tiles != NULL) {
+        // Libère la mémoire utilisée pour les tuiles et le treillis
+        FreeMem(groupCel->tiles, groupCel->celsCount * sizeof(CCB *));
+        FreeMem(groupCel->lattice, 2 * (groupCel->gridColumns + 1) * sizeof(Point2D));
+        groupCel->tiles = NULL;
+        groupCel->lattice = NULL;
+    }
+    // Si des éléments sont animés
+    if (groupCel->animations != NULL) {
+        // Libère la mémoire utilisée pour les états d'animation
+        FreeMem(groupCel->animations, groupCel->celsCount * sizeof(GroupCelAnimation));
+        groupCel->animations = NULL;
+    }
+    // Si des éléments ont une chaîne LOD
+    if (groupCel->lods != NULL) {
+        // Libère la mémoire utilisée pour les chaînes LOD
+        FreeMem(groupCel->lods, groupCel->celsCount * sizeof(GroupCelLod));
+        groupCel->lods = NULL;
+    }
+    // Libère la mémoire utilisée par l'ordre de projection
+    GroupCelDrawOrderCleanup(groupCel);
+    // S'il y a des inverses
+    if (groupCel->reciprocals != NULL) {
+        // Libère la mémoire utilisée pour les inverses
+        FreeMem(groupCel->reciprocals, groupCel->celsCount * sizeof(CelQuadMapReciprocals));
+        groupCel->reciprocals = NULL;
+    }
+    // S'il y a des quadrilatères
+    if (groupCel->quads != NULL) {
+        // Libère la mémoire utilisée pour les quadrilatères
+        FreeMem(groupCel->quads, groupCel->celsCount * sizeof(Quad2D));
+        groupCel->quads = NULL;
+    }
+    // Si les données des éléments proviennent d'un paquet
+    if (groupCel->data != NULL) {
+        // Libère d'un coup le bloc contenant toutes les données des éléments
+        FreeMem(groupCel->data, groupCel->dataSize);
+        groupCel->data = NULL;
     }
 	// Libère la mémoire utilisée pour le GroupCel
     FreeMem(groupCel, sizeof(GroupCel));
@@ -574,3 +1659,1996 @@ int32 GroupCelCleanup(GroupCel *groupCel) {
 	// Retourne un succès
     return 1;
 }
+
+// Le cadre du GroupCel est-il étiré
+int32 GroupCelIsStretched(GroupCel *groupCel) {
+
+    // Compare le quadrilatère d'étirement avec le cadre
+    return ((groupCel->stretching.topLeft.x != 0) || (groupCel->stretching.topLeft.y != 0) ||
+            (groupCel->stretching.topRight.x != groupCel->size.x) || (groupCel->stretching.topRight.y != 0) ||
+            (groupCel->stretching.bottomRight.x != groupCel->size.x) || (groupCel->stretching.bottomRight.y != groupCel->size.y) ||
+            (groupCel->stretching.bottomLeft.x != 0) || (groupCel->stretching.bottomLeft.y != groupCel->size.y)) ? 1 : 0;
+}
+
+// Stocke un élément dans la liste
+void GroupCelElementStore(GroupCelList *element, CCB *cel, frac16 positionX16, frac16 positionY16) {
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+    // Arrondit la position au pixel
+    int32 positionX = ConvertF16_32(positionX16 + (1 << 15));
+    int32 positionY = ConvertF16_32(positionY16 + (1 << 15));
+#endif
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+    // Si la position ne tient pas sur 16 bits
+    if ((positionX < GROUPCEL_POSITION_MIN) || (positionX > GROUPCEL_POSITION_MAX) || (positionY < GROUPCEL_POSITION_MIN) || (positionY > GROUPCEL_POSITION_MAX)) {
+        // Affiche un avertissement
+        printf("Warning : GroupCel element position (%d, %d) out of 16-bit range. Clamped.\n", positionX, positionY);
+        // Borne la position
+        positionX = (positionX < GROUPCEL_POSITION_MIN) ? GROUPCEL_POSITION_MIN : ((positionX > GROUPCEL_POSITION_MAX) ? GROUPCEL_POSITION_MAX : positionX);
+        positionY = (positionY < GROUPCEL_POSITION_MIN) ? GROUPCEL_POSITION_MIN : ((positionY > GROUPCEL_POSITION_MAX) ? GROUPCEL_POSITION_MAX : positionY);
+    }
+    // Position
+    element->position.x = (int16)positionX;
+    element->position.y = (int16)positionY;
+#else
+    // Position
+    element->position.x = positionX16;
+    element->position.y = positionY16;
+#endif
+    // CCB du Cel
+    element->cel = cel;
+}
+
+// Affiche la mémoire utilisée par les éléments dans les deux modes de stockage
+int32 GroupCelMemoryReport(GroupCel *groupCel) {
+
+    // Taille des éléments dans chaque mode, et dans la disposition sans détection de changement de taille
+    int32 baselineSize = 0;
+    int32 wideSize = 0;
+    int32 compactSize = 0;
+    // Taille des inverses, la même dans les deux modes
+    int32 reciprocalsSize = 0;
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Taille des éléments dans chaque mode, et avec seulement une position 16.16 et le pointeur de CCB
+    baselineSize = (int32)(groupCel->celsCount * (sizeof(Point2D) + sizeof(CCB *)));
+    wideSize = (int32)(groupCel->celsCount * sizeof(GroupCelListWide));
+    compactSize = (int32)(groupCel->celsCount * sizeof(GroupCelListCompact));
+    // Inverses des éléments
+    reciprocalsSize = (groupCel->reciprocals != NULL) ? (int32)(groupCel->celsCount * sizeof(CelQuadMapReciprocals)) : 0;
+
+    // Affiche le rapport
+    printf("GroupCel : %u elements, storage %s\n", groupCel->celsCount, (GROUPCEL_STORAGE_COMPACT == 1) ? "compact" : "wide");
+    printf("  baseline : %u bytes/element (16.16 position and CCB pointer, no resize detection), %d bytes\n", (uint32)(sizeof(Point2D) + sizeof(CCB *)), baselineSize);
+    printf("  wide     : %u bytes/element (16.16 position, dimension read from the CCB), %d bytes\n", (uint32)sizeof(GroupCelListWide), wideSize);
+    printf("  compact  : %u bytes/element (int16 position, dimension read from the cache), %d bytes\n", (uint32)sizeof(GroupCelListCompact), compactSize);
+    printf("  reciprocals : %u bytes/element in both modes, %d bytes\n", (uint32)sizeof(CelQuadMapReciprocals), reciprocalsSize);
+    printf("  compact saves %d bytes on the wide mode and %d bytes on the baseline\n", wideSize - compactSize, baselineSize - compactSize);
+    printf("  with the reciprocals : %d bytes in the current mode, %d bytes for the baseline\n", (int32)(groupCel->celsCount * sizeof(GroupCelList)) + reciprocalsSize, baselineSize);
+    printf("  GroupCel structure : %u bytes\n", (uint32)sizeof(GroupCel));
+
+    // Retourne la mémoire utilisée par les éléments et leurs inverses dans le mode courant
+    return (int32)(groupCel->celsCount * sizeof(GroupCelList)) + reciprocalsSize;
+}
+
+// Affiche les succès du cache des quadrilatères
+int32 GroupCelQuadCacheReport(GroupCel *groupCel) {
+
+    // Nombre de quadrilatères écrits ou évités
+    uint32 total = 0;
+    // Taux de succès en pourcentage
+    int32 hitRate = 0;
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le cache est désactivé
+    if (groupCel->quads == NULL) {
+        // Affiche le rapport
+        printf("GroupCel quad cache : disabled\n");
+        return 0;
+    }
+
+    // Taux de succès depuis l'activation du cache
+    total = groupCel->quadHits + groupCel->quadMisses;
+    hitRate = (total > 0) ? (int32)((groupCel->quadHits * 100) / total) : 0;
+
+    // Affiche le rapport
+    printf("GroupCel quad cache : %u hits, %u misses (%d%% skipped)\n", groupCel->quadHits, groupCel->quadMisses, hitRate);
+
+    // Retourne le taux de succès en pourcentage
+    return hitRate;
+}
+
+// Initialisation d'une réserve d'entêtes CCB
+GroupCelPool *GroupCelPoolInitialization(uint32 capacity) {
+
+    // Réserve
+    GroupCelPool *pool = NULL;
+    // Index pour parcourir les entêtes CCB
+    uint32 celIndex = 0;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelPoolInitialization()*\n"); }
+
+    // Alloue de la mémoire pour la réserve
+    pool = (GroupCelPool *)AllocMem(sizeof(GroupCelPool), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (pool == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel pool.\n");
+        return NULL;
+    }
+
+    // Corrige les paramètres
+    // Nombre d'entêtes CCB minimum = 2
+    capacity = (capacity > 2) ? capacity : 2;
+
+    // Alloue un seul bloc pour tous les entêtes CCB
+    pool->ccbs = (CCB *)AllocMem(capacity * sizeof(CCB), MEMTYPE_CEL);
+    // Si c'est un échec
+    if (pool->ccbs == NULL) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(pool, sizeof(GroupCelPool));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel pool CCBs.\n");
+        return NULL;
+    }
+
+    // Chaîne tous les entêtes CCB dans la liste libre
+    for (celIndex = 0; celIndex < capacity - 1; celIndex++) {
+        pool->ccbs[celIndex].ccb_NextPtr = &pool->ccbs[celIndex + 1];
+    }
+    pool->ccbs[capacity - 1].ccb_NextPtr = NULL;
+    pool->freeList = pool->ccbs;
+    pool->capacity = capacity;
+    pool->freeCount = capacity;
+
+    // Retourne la réserve créée
+    return pool;
+}
+
+// Prend un entête CCB dans la réserve
+CCB *GroupCelPoolAllocation(GroupCelPool *pool) {
+
+    // Entête CCB
+    CCB *cel = NULL;
+
+    // Si la réserve est vide
+    if ((pool == NULL) || (pool->freeList == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel pool exhausted.\n");
+        return NULL;
+    }
+
+    // Prend le premier entête CCB libre
+    cel = pool->freeList;
+    pool->freeList = cel->ccb_NextPtr;
+    pool->freeCount--;
+
+    // Retourne l'entête CCB
+    return cel;
+}
+
+// Rend un entête CCB à la réserve
+void GroupCelPoolRelease(GroupCelPool *pool, CCB *cel) {
+
+    // Si la réserve ou l'entête CCB est inconnu
+    if ((pool == NULL) || (cel == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel pool unknow.\n");
+        return;
+    }
+
+    // Remet l'entête CCB en tête de la liste libre
+    cel->ccb_NextPtr = pool->freeList;
+    pool->freeList = cel;
+    pool->freeCount++;
+}
+
+// Supprime la réserve
+int32 GroupCelPoolCleanup(GroupCelPool *pool) {
+
+    if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelPoolCleanup()*\n"); }
+
+    // Si la réserve n'existe pas
+    if (pool == NULL){
+        // Affiche une erreur
+        printf("Error : GroupCel pool unknow.\n");
+        return -1;
+    }
+
+    // Si des instances utilisent encore des entêtes CCB
+    if (pool->freeCount != pool->capacity) {
+        // Affiche un avertissement
+        printf("Warning : GroupCel pool deleted with %u CCBs in use.\n", pool->capacity - pool->freeCount);
+    }
+
+    // Libère la mémoire utilisée pour les entêtes CCB puis pour la réserve
+    FreeMem(pool->ccbs, pool->capacity * sizeof(CCB));
+    FreeMem(pool, sizeof(GroupCelPool));
+
+    // Retourne un succès
+    return 1;
+}
+
+// Initialisation d'une caméra
+GroupCelCamera *GroupCelCameraInitialization(int32 positionX, int32 positionY) {
+
+    // Caméra
+    GroupCelCamera *camera = NULL;
+
+    if (DEBUG_GROUPCEL_INIT == 1) { printf("*GroupCelCameraInitialization()*\n"); }
+
+    // Alloue de la mémoire pour la caméra
+    camera = (GroupCelCamera *)AllocMem(sizeof(GroupCelCamera), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (camera == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel camera.\n");
+        return NULL;
+    }
+
+    // Position de la caméra dans la scène
+    camera->position.x = positionX;
+    camera->position.y = positionY;
+    // Aucun zoom
+    camera->zoom = GROUPCEL_ZOOM_ONE;
+    camera->focus.x = 0;
+    camera->focus.y = 0;
+
+    // Retourne la caméra créée
+    return camera;
+}
+
+// Déplace la caméra
+void GroupCelCameraMove(GroupCelCamera *camera, int32 moveX, int32 moveY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraMove()*\n"); }
+
+    // Si la caméra est inconnue
+    if (camera == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel camera unknow.\n");
+        return;
+    }
+
+    // Modifie la position de la caméra
+    GroupCelCameraSetPosition(camera, camera->position.x + moveX, camera->position.y + moveY);
+}
+
+// Modifie la position de la caméra
+void GroupCelCameraSetPosition(GroupCelCamera *camera, int32 positionX, int32 positionY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraSetPosition()*\n"); }
+
+    // Si la caméra est inconnue
+    if (camera == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel camera unknow.\n");
+        return;
+    }
+
+    // Applique les changements, les groupes suivent à leur prochaine mise à jour
+    camera->position.x = positionX;
+    camera->position.y = positionY;
+}
+
+// Zoome la caméra autour d'un point focal
+void GroupCelCameraZoom(GroupCelCamera *camera, frac16 zoom, int32 focusX, int32 focusY) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelCameraZoom()*\n"); }
+
+    // Si la caméra est inconnue
+    if (camera == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel camera unknow.\n");
+        return;
+    }
+
+    // Corrige les paramètres
+    // Zoom minimum = 1/256
+    zoom = (zoom > (GROUPCEL_ZOOM_ONE >> 8)) ? zoom : (GROUPCEL_ZOOM_ONE >> 8);
+
+    // Applique les changements, les groupes recalculent leurs éléments à leur prochaine mise à jour
+    camera->zoom = zoom;
+    camera->focus.x = focusX;
+    camera->focus.y = focusY;
+}
+
+// Rattache un GroupCel à une caméra
+int32 GroupCelSetCamera(GroupCel *groupCel, GroupCelCamera *camera) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelSetCamera()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Les CCB suivent la caméra (ou reviennent à la scène avec NULL) à la prochaine mise à jour
+    groupCel->camera = camera;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Déplace les CCB d'un GroupCel du déplacement de sa caméra
+void GroupCelCameraPan(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments ou les tuiles
+    uint32 celIndex = 0;
+    // Décalage, zoom et point focal que les CCB doivent avoir
+    Point2D offset = {0};
+    frac16 zoom = GROUPCEL_ZOOM_ONE;
+    Point2D focus = {0};
+    // Décalage mis à l'échelle par le zoom que les CCB doivent avoir, en 16.16
+    Point2D pan = {0};
+    // Déplacement à appliquer en 16.16
+    frac16 panX = 0;
+    frac16 panY = 0;
+    // CCB d'un élément ou d'une tuile
+    CCB *cel = NULL;
+
+    // Etat de la caméra (aucun sans caméra)
+    if (groupCel->camera != NULL) {
+        offset = groupCel->camera->position;
+        zoom = groupCel->camera->zoom;
+        focus = groupCel->camera->focus;
+    }
+
+    // Décalage mis à l'échelle par le zoom, calculé depuis le décalage entier pour que l'arrondi ne s'accumule pas d'un déplacement à l'autre
+    pan.x = Convert32_F16(offset.x);
+    pan.y = Convert32_F16(offset.y);
+    if (zoom != GROUPCEL_ZOOM_ONE) {
+        pan.x = MulSF16(pan.x, zoom);
+        pan.y = MulSF16(pan.y, zoom);
+    }
+
+    // Si le zoom ou le point focal a changé
+    if ((zoom != groupCel->cameraZoom) || (focus.x != groupCel->cameraFocus.x) || (focus.y != groupCel->cameraFocus.y)) {
+        // La nouvelle caméra est appliquée en recalculant chaque élément
+        groupCel->cameraOffset = offset;
+        groupCel->cameraPan = pan;
+        groupCel->cameraZoom = zoom;
+        groupCel->cameraFocus = focus;
+        groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        // Les quadrilatères du cache ont été écrits avec le zoom précédent
+        if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+        return;
+    }
+
+    // Si les CCB ont déjà ce décalage
+    if ((offset.x == groupCel->cameraOffset.x) && (offset.y == groupCel->cameraOffset.y)) {
+        // Rien à déplacer
+        return;
+    }
+
+    // Déplacement depuis le dernier décalage appliqué, mis à l'échelle par le zoom
+    panX = pan.x - groupCel->cameraPan.x;
+    panY = pan.y - groupCel->cameraPan.y;
+    groupCel->cameraOffset = offset;
+    groupCel->cameraPan = pan;
+
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // Son seul CCB suit la caméra
+        groupCel->flat->cel.ccb_XPos -= panX;
+        groupCel->flat->cel.ccb_YPos -= panY;
+        // Les rectangles à redessiner le suivent
+        if (groupCel->dirty != NULL) { GroupCelDirtyPan(groupCel, &groupCel->flat->bounds, panX, panY); }
+        // Le placement du groupe a changé
+        groupCel->epoch++;
+        return;
+    }
+
+    // Pour chaque CCB du groupe, une addition par coordonnée
+    for (celIndex = 0; celIndex < ((groupCel->tiles != NULL) ? groupCel->gridColumns * groupCel->gridRows : groupCel->celsCount); celIndex++) {
+        cel = (groupCel->tiles != NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel;
+        // Si l'élément ou la tuile n'est pas configuré
+        if (cel == NULL) { continue; }
+        cel->ccb_XPos -= panX;
+        cel->ccb_YPos -= panY;
+        // Les limites de la passe d'occultation suivent le CCB
+        if (groupCel->bounds != NULL) {
+            groupCel->bounds[celIndex].topLeft.x -= panX;
+            groupCel->bounds[celIndex].topLeft.y -= panY;
+            groupCel->bounds[celIndex].bottomRight.x -= panX;
+            groupCel->bounds[celIndex].bottomRight.y -= panY;
+        }
+        // Les rectangles à redessiner suivent le CCB
+        if (groupCel->dirty != NULL) { GroupCelDirtyPan(groupCel, &groupCel->dirtyBounds[celIndex], panX, panY); }
+        // La projection suit le CCB
+        if (groupCel->projections != NULL) {
+            groupCel->projections[celIndex].topLeft.x -= panX;
+            groupCel->projections[celIndex].topLeft.y -= panY;
+            groupCel->projections[celIndex].bottomRight.x -= panX;
+            groupCel->projections[celIndex].bottomRight.y -= panY;
+        }
+    }
+
+    // Le placement du groupe a changé
+    groupCel->epoch++;
+}
+
+// Applique la caméra d'un GroupCel à un point en 16.16
+void GroupCelCameraPoint(GroupCel *groupCel, Point2D *point16) {
+
+    // Si la caméra ne zoome pas
+    if (groupCel->cameraZoom == GROUPCEL_ZOOM_ONE) {
+        // La caméra ne fait que translater
+        point16->x -= Convert32_F16(groupCel->cameraOffset.x);
+        point16->y -= Convert32_F16(groupCel->cameraOffset.y);
+        return;
+    }
+
+    // Met le point à l'échelle autour du point focal
+    point16->x = MulSF16(point16->x - Convert32_F16(groupCel->cameraOffset.x + groupCel->cameraFocus.x), groupCel->cameraZoom) + Convert32_F16(groupCel->cameraFocus.x);
+    point16->y = MulSF16(point16->y - Convert32_F16(groupCel->cameraOffset.y + groupCel->cameraFocus.y), groupCel->cameraZoom) + Convert32_F16(groupCel->cameraFocus.y);
+}
+
+// Supprime la caméra
+int32 GroupCelCameraCleanup(GroupCelCamera *camera) {
+
+    if (DEBUG_GROUPCEL_CLEAN == 1) { printf("*GroupCelCameraCleanup()*\n"); }
+
+    // Si la caméra est inconnue
+    if (camera == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel camera unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée par la caméra
+    FreeMem(camera, sizeof(GroupCelCamera));
+
+    // Retourne un succès
+    return 1;
+}
+
+// Affiche ou cache le GroupCel
+int32 GroupCelSetVisible(GroupCel *groupCel, int32 visible) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSetVisible()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Toute valeur autre que 0 affiche le groupe
+    visible = (visible != 0) ? 1 : 0;
+
+    // Si la visibilité ne change pas
+    if (groupCel->visible == visible) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Si le groupe est dans une liste d'affichage
+    if (groupCel->previous != NULL) {
+        // Si le groupe est affiché
+        if (visible == 1) {
+            // Remet toute la chaîne après son CCB
+            GroupCelSpliceIn(groupCel);
+        // Sinon, retire toute la chaîne
+        } else if (GroupCelSpliceOut(groupCel) < 0) {
+            // Retourne une erreur
+            printf("Error <- GroupCelSpliceOut()\n");
+            return -1;
+        }
+    }
+
+    // Mémorise la visibilité, appliquée par GroupCelLinkAfter() s'il n'est pas encore lié
+    groupCel->visible = visible;
+    // La surface du groupe apparaît ou disparaît
+    GroupCelDirtyGroup(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Lie le GroupCel après un CCB d'une liste d'affichage
+int32 GroupCelLinkAfter(GroupCel *groupCel, CCB *previous) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelLinkAfter()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si la chaîne du groupe n'est pas configurée
+    if ((groupCel->cel == NULL) || (groupCel->tail == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel chain unknow.\n");
+        return -1;
+    }
+
+    // Si le Cel est inconnu
+    if (previous == NULL){
+        // Retourne une erreur
+        printf("Error : Cel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe est déjà dans une liste d'affichage
+    if (groupCel->previous != NULL) {
+        // L'en retire d'abord
+        if (GroupCelUnlink(groupCel) < 0) {
+            // Retourne une erreur
+            printf("Error <- GroupCelUnlink()\n");
+            return -1;
+        }
+    }
+
+    // Le groupe suit maintenant le CCB
+    groupCel->previous = previous;
+
+    // Si le groupe est visible
+    if (groupCel->visible == 1) {
+        // Insère toute la chaîne après le CCB
+        GroupCelSpliceIn(groupCel);
+        // La surface du groupe apparaît
+        GroupCelDirtyGroup(groupCel);
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Retire le GroupCel de sa liste d'affichage
+int32 GroupCelUnlink(GroupCel *groupCel) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelUnlink()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe n'est pas dans une liste d'affichage
+    if (groupCel->previous == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel display list unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe est visible, sa chaîne est dans la liste
+    if (groupCel->visible == 1) {
+        // Retire toute la chaîne
+        if (GroupCelSpliceOut(groupCel) < 0) {
+            // Retourne une erreur
+            printf("Error <- GroupCelSpliceOut()\n");
+            return -1;
+        }
+        // La surface du groupe disparaît
+        GroupCelDirtyGroup(groupCel);
+    }
+
+    // Le groupe ne suit plus aucun CCB
+    groupCel->previous = NULL;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Insère la chaîne du GroupCel après son CCB
+int32 GroupCelSpliceIn(GroupCel *groupCel) {
+
+    // Le CCB qui suivait suit maintenant le tail
+    GroupCelChainLink(GroupCelChainLast(groupCel), GroupCelChainNext(groupCel->previous));
+    // Informe le Cel Engine que le groupe est le prochain à projeter
+    LinkCel(groupCel->previous, GroupCelChainFirst(groupCel));
+
+    // Retourne un succès
+    return 1;
+}
+
+// Retire la chaîne du GroupCel de la liste
+int32 GroupCelSpliceOut(GroupCel *groupCel) {
+
+    // Si le groupe ne suit plus directement son CCB
+    if (GroupCelChainNext(groupCel->previous) != GroupCelChainFirst(groupCel)) {
+        // Retourne une erreur
+        printf("Error : GroupCel doesn't follow its CCB, another chain was linked in between.\n");
+        return -1;
+    }
+
+    // Le CCB passe maintenant directement à celui qui suit le tail
+    GroupCelChainLink(groupCel->previous, GroupCelChainNext(GroupCelChainLast(groupCel)));
+    // Le tail termine la chaîne du groupe
+    GroupCelChainLink(GroupCelChainLast(groupCel), NULL);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Relie un GroupCel dans sa liste d'affichage après un changement des extrémités de sa chaîne
+void GroupCelChainRelink(GroupCel *groupCel, CCB *follower) {
+
+    // Si la chaîne est dans une liste d'affichage et que le groupe n'est pas aplati
+    if ((groupCel->previous != NULL) && (groupCel->visible == 1) && (groupCel->flat == NULL)) {
+        // Le CCB précédant le groupe continue sur son premier élément
+        LinkCel(groupCel->previous, groupCel->cel);
+        // Le CCB qui suivait le groupe suit maintenant son tail
+        GroupCelChainLink(groupCel->tail, follower);
+    }
+}
+
+// CCB projeté après un Cel (NULL à la fin d'une liste)
+CCB *GroupCelChainNext(CCB *cel) {
+
+    // Le dernier CCB d'une liste n'a pas de suivant
+    return ((cel->ccb_Flags & CCB_LAST) != 0) ? NULL : cel->ccb_NextPtr;
+}
+
+// Lie un Cel au suivant ou termine la liste sur lui
+void GroupCelChainLink(CCB *cel, CCB *next) {
+
+    // S'il n'y a pas de CCB suivant
+    if (next == NULL) {
+        // Le Cel termine la liste
+        cel->ccb_NextPtr = NULL;
+        cel->ccb_Flags |= CCB_LAST;
+    // Sinon
+    } else {
+        // Indique au Cel Engine que c'est le Cel suivant à rendre
+        LinkCel(cel, next);
+    }
+}
+
+// Ordre de projection des éléments du GroupCel
+int32 GroupCelDrawOrder(GroupCel *groupCel, int32 depthSort) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelDrawOrder()*\n"); }
+
+    // Si l'ordre de projection ne peut pas être géré
+    if (GroupCelDrawOrderAllocation(groupCel) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderAllocation()\n");
+        return -1;
+    }
+
+    // Trie par profondeur à chaque mise à jour où une clé a changé (1 = oui)
+    groupCel->depthSort = (depthSort != 0) ? 1 : 0;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Clé de profondeur d'un élément du GroupCel
+int32 GroupCelElementSetDepth(GroupCel *groupCel, uint32 celIndex, int32 depth) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetDepth()*\n"); }
+
+    // Si l'élément n'est pas dans un ordre de projection
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // Si la clé ne change pas
+    if (groupCel->order[celIndex].depth == depth) {
+        // Rien à mettre à jour
+        return 1;
+    }
+
+    // Applique les changements
+    groupCel->order[celIndex].depth = depth;
+
+    // L'ordre doit être trié de nouveau
+    groupCel->depthChanged = 1;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Projette un élément du GroupCel au-dessus de tous les autres
+int32 GroupCelBringToFront(GroupCel *groupCel, uint32 celIndex) {
+
+    // CCB qui suit le groupe
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelBringToFront()*\n"); }
+
+    // Si l'élément n'est pas dans un ordre de projection
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // Si l'élément est déjà projeté en dernier
+    if (groupCel->order[celIndex].next == GROUPCEL_ORDER_NONE) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Déplace l'élément à la fin de la chaîne
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, GROUPCEL_ORDER_NONE, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Projette un élément du GroupCel sous tous les autres
+int32 GroupCelSendToBack(GroupCel *groupCel, uint32 celIndex) {
+
+    // CCB qui suit le groupe
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelSendToBack()*\n"); }
+
+    // Si l'élément n'est pas dans un ordre de projection
+    if (GroupCelDrawOrderCheck(groupCel, celIndex) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // Si l'élément est déjà projeté en premier
+    if (groupCel->order[celIndex].previous == GROUPCEL_ORDER_NONE) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Déplace l'élément au début de la chaîne
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, groupCel->orderFirst, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Projette un élément du GroupCel juste avant un autre
+int32 GroupCelMoveBefore(GroupCel *groupCel, uint32 celIndex, uint32 beforeIndex) {
+
+    // CCB qui suit le groupe
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelMoveBefore()*\n"); }
+
+    // Si l'un des éléments n'est pas dans un ordre de projection
+    if ((GroupCelDrawOrderCheck(groupCel, celIndex) < 0) || (GroupCelDrawOrderCheck(groupCel, beforeIndex) < 0)) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderCheck()\n");
+        return -1;
+    }
+
+    // Si l'élément est déjà à sa place
+    if ((celIndex == beforeIndex) || (groupCel->order[celIndex].next == (int32)beforeIndex)) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Déplace l'élément devant l'autre
+    follower = GroupCelChainNext(groupCel->tail);
+    GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+    GroupCelDrawOrderInsert(groupCel, celIndex, (int32)beforeIndex, follower);
+    GroupCelDrawOrderEnds(groupCel);
+
+    // Retourne un succès
+    return 1;
+}
+
+// Trie l'ordre de projection du GroupCel par profondeur
+int32 GroupCelDrawOrderSort(GroupCel *groupCel) {
+
+    // Ordre de projection des éléments
+    GroupCelOrder *order = NULL;
+    // Elément à placer et le suivant à visiter
+    int32 celIndex = 0;
+    int32 nextIndex = 0;
+    // Elément cherché en arrière et celui avant lequel insérer
+    int32 searchIndex = 0;
+    int32 beforeIndex = 0;
+    // CCB qui suit le groupe
+    CCB *follower = NULL;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelDrawOrderSort()*\n"); }
+
+    // Si l'ordre de projection n'est pas géré
+    if ((groupCel == NULL) || (groupCel->order == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel draw order unknow.\n");
+        return -1;
+    }
+
+    order = groupCel->order;
+    follower = GroupCelChainNext(groupCel->tail);
+
+    // Tri par insertion dans l'ordre actuel : une liste presque triée coûte presque un seul passage
+    for (celIndex = order[groupCel->orderFirst].next; celIndex != GROUPCEL_ORDER_NONE; celIndex = nextIndex) {
+
+        nextIndex = order[celIndex].next;
+
+        // Recule seulement sur les clés plus grandes, les clés égales gardent leur ordre
+        beforeIndex = celIndex;
+        for (searchIndex = order[celIndex].previous; (searchIndex != GROUPCEL_ORDER_NONE) && (order[searchIndex].depth > order[celIndex].depth); searchIndex = order[searchIndex].previous) {
+            beforeIndex = searchIndex;
+        }
+
+        // Si l'élément doit bouger
+        if (beforeIndex != celIndex) {
+            // Le relie devant la première clé plus grande
+            GroupCelDrawOrderRemove(groupCel, celIndex, follower);
+            GroupCelDrawOrderInsert(groupCel, celIndex, beforeIndex, follower);
+        }
+    }
+
+    // Mets à jour les extrémités de la chaîne du groupe
+    GroupCelDrawOrderEnds(groupCel);
+
+    // L'ordre est trié
+    groupCel->depthChanged = 0;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Alloue l'ordre de projection à partir de l'ordre des index
+int32 GroupCelDrawOrderAllocation(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel draw order needs a list of elements.\n");
+        return -1;
+    }
+
+    // Si l'ordre de projection est déjà alloué
+    if (groupCel->order != NULL) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Valide les éléments avant d'allouer quoi que ce soit
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        // Si un élément n'est pas configuré
+        if (groupCel->cels[celIndex].cel == NULL) {
+            // Retourne une erreur
+            printf("Error : GroupCel element %u unknow.\n", celIndex);
+            return -1;
+        }
+    }
+
+    // Alloue la mémoire pour l'ordre de projection
+    groupCel->order = (GroupCelOrder *)AllocMem(groupCel->celsCount * sizeof(GroupCelOrder), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (groupCel->order == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel draw order.\n");
+        return -1;
+    }
+
+    // Les éléments sont chaînés dans l'ordre de leurs index
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        groupCel->order[celIndex].previous = (int32)celIndex - 1;
+        groupCel->order[celIndex].next = (celIndex + 1 < groupCel->celsCount) ? (int32)celIndex + 1 : GROUPCEL_ORDER_NONE;
+        groupCel->order[celIndex].depth = 0;
+    }
+    groupCel->orderFirst = 0;
+    groupCel->orderLast = (int32)groupCel->celsCount - 1;
+    groupCel->depthChanged = 0;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Vérifie qu'un élément du GroupCel peut être réordonné
+int32 GroupCelDrawOrderCheck(GroupCel *groupCel, uint32 celIndex) {
+
+    // Si l'ordre de projection ne peut pas être géré
+    if (GroupCelDrawOrderAllocation(groupCel) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelDrawOrderAllocation()\n");
+        return -1;
+    }
+
+    // Si l'élément est inconnu
+    if (celIndex >= groupCel->celsCount) {
+        // Retourne une erreur
+        printf("Error : GroupCel element %u unknow.\n", celIndex);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Retire un élément de l'ordre de projection
+void GroupCelDrawOrderRemove(GroupCel *groupCel, int32 celIndex, CCB *follower) {
+
+    // Ordre de projection des éléments
+    GroupCelOrder *order = groupCel->order;
+    // Voisins de l'élément
+    int32 previousIndex = order[celIndex].previous;
+    int32 nextIndex = order[celIndex].next;
+
+    // Joint les voisins
+    if (previousIndex == GROUPCEL_ORDER_NONE) { groupCel->orderFirst = nextIndex; } else { order[previousIndex].next = nextIndex; }
+    if (nextIndex == GROUPCEL_ORDER_NONE) { groupCel->orderLast = previousIndex; } else { order[nextIndex].previous = previousIndex; }
+
+    // Relie le CCB projeté avant l'élément
+    if (previousIndex != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, previousIndex, follower); }
+}
+
+// Insère un élément dans l'ordre de projection avant un autre (GROUPCEL_ORDER_NONE = à la fin)
+void GroupCelDrawOrderInsert(GroupCel *groupCel, int32 celIndex, int32 beforeIndex, CCB *follower) {
+
+    // Ordre de projection des éléments
+    GroupCelOrder *order = groupCel->order;
+    // Elément projeté avant la nouvelle place
+    int32 previousIndex = (beforeIndex == GROUPCEL_ORDER_NONE) ? groupCel->orderLast : order[beforeIndex].previous;
+
+    // Place l'élément entre ses nouveaux voisins
+    order[celIndex].previous = previousIndex;
+    order[celIndex].next = beforeIndex;
+    if (previousIndex == GROUPCEL_ORDER_NONE) { groupCel->orderFirst = celIndex; } else { order[previousIndex].next = celIndex; }
+    if (beforeIndex == GROUPCEL_ORDER_NONE) { groupCel->orderLast = celIndex; } else { order[beforeIndex].previous = celIndex; }
+
+    // Relie les CCB de l'élément et de celui projeté avant lui
+    GroupCelDrawOrderLink(groupCel, celIndex, follower);
+    if (previousIndex != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, previousIndex, follower); }
+}
+
+// Donne un nouveau CCB à l'élément de l'ordre de projection
+void GroupCelDrawOrderReplace(GroupCel *groupCel, int32 celIndex) {
+
+    // CCB qui suit le groupe, pris du tail avant qu'il ne change
+    CCB *follower = GroupCelChainNext(groupCel->tail);
+
+    // Relie le nouveau CCB et celui projeté avant lui
+    GroupCelDrawOrderLink(groupCel, celIndex, follower);
+    if (groupCel->order[celIndex].previous != GROUPCEL_ORDER_NONE) { GroupCelDrawOrderLink(groupCel, groupCel->order[celIndex].previous, follower); }
+
+    // Mets à jour les extrémités de la chaîne du groupe
+    GroupCelDrawOrderEnds(groupCel);
+}
+
+// Lie le CCB d'un élément au suivant dans l'ordre de projection
+void GroupCelDrawOrderLink(GroupCel *groupCel, int32 celIndex, CCB *follower) {
+
+    // Elément suivant dans l'ordre de projection
+    int32 nextIndex = groupCel->order[celIndex].next;
+
+    // La passe d'occultation doit suivre le nouvel ordre
+    groupCel->occlusionChanged = 1;
+    // Un groupe aplati projette ses éléments dans le nouvel ordre
+    GroupCelElementsChanged(groupCel);
+    // Le dernier élément continue vers le CCB qui suit le groupe
+    GroupCelChainLink(groupCel->cels[celIndex].cel, (nextIndex == GROUPCEL_ORDER_NONE) ? follower : groupCel->cels[nextIndex].cel);
+}
+
+// Mets à jour le premier et le dernier CCB du groupe à partir de l'ordre de projection
+void GroupCelDrawOrderEnds(GroupCel *groupCel) {
+
+    // Extrémités de la chaîne du groupe
+    groupCel->cel = groupCel->cels[groupCel->orderFirst].cel;
+    groupCel->tail = groupCel->cels[groupCel->orderLast].cel;
+
+    // Si la chaîne est dans une liste d'affichage et que le groupe n'est pas aplati
+    if ((groupCel->previous != NULL) && (groupCel->visible == 1) && (groupCel->flat == NULL)) {
+        // Le CCB avant le groupe continue vers son premier élément
+        LinkCel(groupCel->previous, groupCel->cel);
+    }
+}
+
+// Supprime l'ordre de projection, la chaîne garde son ordre actuel
+void GroupCelDrawOrderCleanup(GroupCel *groupCel) {
+
+    // S'il y a un ordre de projection
+    if (groupCel->order != NULL) {
+        // Libère la mémoire utilisée par l'ordre de projection
+        FreeMem(groupCel->order, groupCel->celsCount * sizeof(GroupCelOrder));
+        groupCel->order = NULL;
+    }
+}
+
+// Active ou désactive la passe d'occultation du GroupCel
+int32 GroupCelOcclusion(GroupCel *groupCel, int32 enable) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelOcclusion()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel occlusion needs a list of elements.\n");
+        return -1;
+    }
+
+    // Si la passe doit être désactivée
+    if (enable == 0) {
+        // Montre les éléments cachés par la passe et libère ses tableaux
+        GroupCelOcclusionCleanup(groupCel);
+        // Retourne un succès
+        return 1;
+    }
+
+    // Si la passe est déjà activée
+    if (groupCel->bounds != NULL) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Alloue la mémoire pour les limites, les drapeaux et les occulteurs des éléments
+    groupCel->bounds = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+    groupCel->occlusion = (uint8 *)AllocMem(groupCel->celsCount * sizeof(uint8), MEMTYPE_DRAM);
+    groupCel->occluders = (int32 *)AllocMem(groupCel->celsCount * sizeof(int32), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if ((groupCel->bounds == NULL) || (groupCel->occlusion == NULL) || (groupCel->occluders == NULL)) {
+        // Libère la mémoire précédemment allouée
+        GroupCelOcclusionCleanup(groupCel);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel occlusion.\n");
+        return -1;
+    }
+
+    // Aucun élément n'est encore opaque ni caché
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        groupCel->bounds[celIndex].topLeft.x = 0;
+        groupCel->bounds[celIndex].topLeft.y = 0;
+        groupCel->bounds[celIndex].bottomRight.x = 0;
+        groupCel->bounds[celIndex].bottomRight.y = 0;
+        groupCel->occlusion[celIndex] = 0;
+    }
+    groupCel->occludedCount = 0;
+    groupCel->occlusionChanged = 1;
+
+    // Les limites sont prises quand les CCB sont écrits : chaque élément est écrit de nouveau
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Indique si un élément du GroupCel cache ce qui est projeté derrière lui
+int32 GroupCelElementSetOpaque(GroupCel *groupCel, uint32 celIndex, int32 opaque) {
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelElementSetOpaque()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si la passe d'occultation n'est pas activée
+    if (groupCel->occlusion == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel occlusion disabled.\n");
+        return -1;
+    }
+
+    // Si l'élément est inconnu
+    if (celIndex >= groupCel->celsCount) {
+        // Retourne une erreur
+        printf("Error : GroupCel element %u unknow.\n", celIndex);
+        return -1;
+    }
+
+    // Toute valeur autre que 0 rend l'élément opaque
+    opaque = (opaque != 0) ? GROUPCEL_OCCLUSION_OPAQUE : 0;
+
+    // Si l'opacité change
+    if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_OPAQUE) != (uint8)opaque) {
+        groupCel->occlusion[celIndex] = (uint8)((groupCel->occlusion[celIndex] & ~GROUPCEL_OCCLUSION_OPAQUE) | opaque);
+        // La prochaine mise à jour exécute de nouveau la passe
+        groupCel->occlusionChanged = 1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Saute les éléments couverts par un élément opaque aligné projeté après eux
+void GroupCelOcclusionUpdate(GroupCel *groupCel) {
+
+    // Elément dans l'ordre de projection
+    int32 celIndex = 0;
+    // Eléments opaques alignés dans l'ordre de projection
+    int32 occludersCount = 0;
+    // Premier occulteur projeté après l'élément courant
+    int32 occluderFirst = 0;
+    // Index pour parcourir les occulteurs
+    int32 occluderIndex = 0;
+    // Indique si l'élément courant est couvert
+    int32 covered = 0;
+    // CCB de l'élément
+    CCB *cel = NULL;
+
+    // Si la passe est désactivée, ou si rien n'a bougé et qu'aucune opacité ni ordre n'a changé
+    if ((groupCel->bounds == NULL) || (groupCel->flat != NULL) || ((groupCel->epoch == groupCel->occlusionEpoch) && (groupCel->occlusionChanged == 0))) {
+        // Les CCB gardent leurs drapeaux
+        return;
+    }
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelOcclusionUpdate()*\n"); }
+
+    // Liste les éléments opaques alignés, dans l'ordre de projection
+    for (celIndex = (groupCel->order != NULL) ? groupCel->orderFirst : 0; (celIndex >= 0) && (celIndex < (int32)groupCel->celsCount); celIndex = (groupCel->order != NULL) ? groupCel->order[celIndex].next : celIndex + 1) {
+        if ((groupCel->occlusion[celIndex] & (GROUPCEL_OCCLUSION_OPAQUE | GROUPCEL_OCCLUSION_ALIGNED)) == (GROUPCEL_OCCLUSION_OPAQUE | GROUPCEL_OCCLUSION_ALIGNED)) {
+            groupCel->occluders[occludersCount++] = celIndex;
+        }
+    }
+
+    // Pour chaque élément, dans l'ordre de projection
+    groupCel->occludedCount = 0;
+    for (celIndex = (groupCel->order != NULL) ? groupCel->orderFirst : 0; (celIndex >= 0) && (celIndex < (int32)groupCel->celsCount); celIndex = (groupCel->order != NULL) ? groupCel->order[celIndex].next : celIndex + 1) {
+
+        // Si l'élément n'est pas configuré
+        cel = groupCel->cels[celIndex].cel;
+        if (cel == NULL) { continue; }
+
+        // Seuls les occulteurs projetés après l'élément peuvent le cacher
+        if ((occluderFirst < occludersCount) && (groupCel->occluders[occluderFirst] == celIndex)) { occluderFirst++; }
+
+        // Cherche un occulteur couvrant tous les pixels que l'élément peut projeter
+        covered = 0;
+        for (occluderIndex = occluderFirst; (occluderIndex < occludersCount) && (covered == 0); occluderIndex++) {
+            covered = GroupCelOcclusionCovers(&groupCel->bounds[groupCel->occluders[occluderIndex]], &groupCel->bounds[celIndex]);
+        }
+
+        // Si l'élément est couvert
+        if (covered == 1) {
+            // Le Cel Engine le saute pour cette frame
+            cel->ccb_Flags |= CCB_SKIP;
+            groupCel->occlusion[celIndex] |= GROUPCEL_OCCLUSION_HIDDEN;
+            groupCel->occludedCount++;
+        // Si la passe l'a caché avant
+        } else if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0) {
+            // Le montre de nouveau
+            cel->ccb_Flags &= ~CCB_SKIP;
+            groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_HIDDEN;
+        }
+    }
+
+    // La passe est à jour avec les CCB
+    groupCel->occlusionEpoch = groupCel->epoch;
+    groupCel->occlusionChanged = 0;
+}
+
+// Garde les limites d'un élément telles qu'écrites dans son CCB
+void GroupCelOcclusionBounds(GroupCel *groupCel, int32 celIndex, Quad2D *viewQuad) {
+
+    // Limites de l'élément
+    Rectangle *bounds = &groupCel->bounds[celIndex];
+
+    // Plus petit rectangle contenant les 4 coins en 16.16
+    Quad2DBounds(viewQuad, bounds);
+
+    // Un élément ne remplit ses limites que si son quad est un rectangle aligné sur les axes
+    if ((viewQuad->topLeft.y == viewQuad->topRight.y) && (viewQuad->bottomLeft.y == viewQuad->bottomRight.y) && (viewQuad->topLeft.x == viewQuad->bottomLeft.x) && (viewQuad->topRight.x == viewQuad->bottomRight.x)) {
+        groupCel->occlusion[celIndex] |= GROUPCEL_OCCLUSION_ALIGNED;
+    } else {
+        groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_ALIGNED;
+    }
+}
+
+// Indique si un occulteur aligné couvre chaque pixel qu'un élément peut projeter
+int32 GroupCelOcclusionCovers(Rectangle *occluder, Rectangle *element) {
+
+    // Un pixel est projeté quand son centre est à l'intérieur : les limites sont comparées en centres de pixels,
+    // l'élément élargi et l'occulteur rétréci de la marge de l'arrondi du CCB
+    const frac16 half = (1 << 15);
+
+    // Colonnes et rangées projetées au plus par l'élément et au moins par l'occulteur
+    if (GROUPCEL_CEIL_F16(occluder->topLeft.x + GROUPCEL_OCCLUSION_MARGIN - half) > GROUPCEL_CEIL_F16(element->topLeft.x - GROUPCEL_OCCLUSION_MARGIN - half)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->topLeft.y + GROUPCEL_OCCLUSION_MARGIN - half) > GROUPCEL_CEIL_F16(element->topLeft.y - GROUPCEL_OCCLUSION_MARGIN - half)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->bottomRight.x - GROUPCEL_OCCLUSION_MARGIN - half) - 1 < ((element->bottomRight.x + GROUPCEL_OCCLUSION_MARGIN - half) >> 16)) { return 0; }
+    if (GROUPCEL_CEIL_F16(occluder->bottomRight.y - GROUPCEL_OCCLUSION_MARGIN - half) - 1 < ((element->bottomRight.y + GROUPCEL_OCCLUSION_MARGIN - half) >> 16)) { return 0; }
+
+    // Chaque pixel de l'élément est projeté de nouveau par l'occulteur
+    return 1;
+}
+
+// Montre un élément caché par la passe d'occultation
+void GroupCelOcclusionShow(GroupCel *groupCel, int32 celIndex) {
+
+    // Si la passe a caché l'élément
+    if ((groupCel->occlusion[celIndex] & GROUPCEL_OCCLUSION_HIDDEN) != 0) {
+        // Rend son CCB au Cel Engine
+        groupCel->cels[celIndex].cel->ccb_Flags &= ~CCB_SKIP;
+        groupCel->occlusion[celIndex] &= ~GROUPCEL_OCCLUSION_HIDDEN;
+    }
+
+    // La prochaine mise à jour exécute de nouveau la passe
+    groupCel->occlusionChanged = 1;
+}
+
+// Supprime la passe d'occultation, les éléments cachés sont montrés
+void GroupCelOcclusionCleanup(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+
+    // S'il y a des drapeaux
+    if (groupCel->occlusion != NULL) {
+        // Montre les éléments cachés par la passe
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) { GroupCelOcclusionShow(groupCel, celIndex); }
+        // Libère la mémoire utilisée pour les drapeaux
+        FreeMem(groupCel->occlusion, groupCel->celsCount * sizeof(uint8));
+        groupCel->occlusion = NULL;
+    }
+    // S'il y a des limites
+    if (groupCel->bounds != NULL) {
+        // Libère la mémoire utilisée pour les limites
+        FreeMem(groupCel->bounds, groupCel->celsCount * sizeof(Rectangle));
+        groupCel->bounds = NULL;
+    }
+    // S'il y a des occulteurs
+    if (groupCel->occluders != NULL) {
+        // Libère la mémoire utilisée pour les occulteurs
+        FreeMem(groupCel->occluders, groupCel->celsCount * sizeof(int32));
+        groupCel->occluders = NULL;
+    }
+    groupCel->occludedCount = 0;
+}
+
+// Aplatit le GroupCel en un seul CCB pré-rendu, ou ramène sa chaîne
+int32 GroupCelFlatten(GroupCel *groupCel, int32 enable) {
+
+    // CCB aplati
+    GroupCelFlat *flat = NULL;
+    // Description du bitmap
+    TagArg tags[4];
+    // Indique si le groupe est projeté dans une liste d'affichage
+    int32 displayed = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelFlatten()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si l'aplatissement doit être défait
+    if (enable == 0) {
+        // Ramène la chaîne des éléments
+        return GroupCelFlattenCleanup(groupCel);
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel flattening needs a list of elements.\n");
+        return -1;
+    }
+
+    // Si la chaîne du groupe n'est pas configurée
+    if ((groupCel->cel == NULL) || (groupCel->tail == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel chain unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe est déjà aplati
+    if (groupCel->flat != NULL) {
+        // Projette de nouveau les éléments à la mise à jour suivante
+        GroupCelElementsChanged(groupCel);
+        return 1;
+    }
+
+    // Alloue la mémoire pour le CCB aplati
+    flat = (GroupCelFlat *)AllocMem(sizeof(GroupCelFlat), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (flat == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel flat.\n");
+        return -1;
+    }
+    memset(flat, 0, sizeof(GroupCelFlat));
+
+    // Taille du rendu : le cadre, arrondi à des paires de pixels pour le format du frame buffer
+    flat->width = ((groupCel->size.x > 2) ? groupCel->size.x + 1 : 2) & ~1;
+    flat->height = ((groupCel->size.y > 2) ? groupCel->size.y + 1 : 2) & ~1;
+
+    // Alloue la mémoire vidéo pour les pixels, 16 bits chacun
+    flat->bufferSize = flat->width * flat->height * 2;
+    flat->buffer = AllocMem(flat->bufferSize, MEMTYPE_VRAM);
+    // Si c'est un échec
+    if (flat->buffer == NULL) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel flat bitmap.\n");
+        return -1;
+    }
+
+    // Crée le bitmap hors écran dans lequel les éléments sont projetés
+    tags[0].ta_Tag = CBM_TAG_WIDTH;
+    tags[0].ta_Arg = (void *)flat->width;
+    tags[1].ta_Tag = CBM_TAG_HEIGHT;
+    tags[1].ta_Arg = (void *)flat->height;
+    tags[2].ta_Tag = CBM_TAG_BUFFER;
+    tags[2].ta_Arg = flat->buffer;
+    tags[3].ta_Tag = CBM_TAG_DONE;
+    tags[3].ta_Arg = NULL;
+    flat->bitmap = CreateItem(MKNODEID(NODE_GRAPHICS, TYPE_BITMAP), tags);
+    // Si c'est un échec
+    if (flat->bitmap < 0) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(flat->buffer, flat->bufferSize);
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Affiche un message d'erreur
+        printf("Error : Failed to create the GroupCel flat bitmap.\n");
+        return -1;
+    }
+
+    // CCB 16 bits non codé lisant le bitmap au format du frame buffer (LRFORM)
+    flat->cel.ccb_Flags = CCB_LAST | CCB_NPABS | CCB_SPABS | CCB_PPABS | CCB_LDSIZE | CCB_LDPRS | CCB_LDPPMP | CCB_CCBPRE | CCB_YOXY | CCB_ACW | CCB_ACCW;
+    flat->cel.ccb_NextPtr = NULL;
+    flat->cel.ccb_SourcePtr = (CelData *)flat->buffer;
+    flat->cel.ccb_PLUTPtr = NULL;
+    flat->cel.ccb_PIXC = GROUPCEL_FLAT_PIXC;
+    flat->cel.ccb_PRE0 = PRE0_BPP_16 | PRE0_LINEAR | ((uint32)(flat->height / 2 - 1) << PRE0_VCNT_SHIFT);
+    flat->cel.ccb_PRE1 = PRE1_LRFORM | PRE1_TLLSB_PDC0 | ((uint32)(flat->width - 2) << PRE1_WOFFSET10_SHIFT) | ((uint32)(flat->width - 1) << PRE1_TLHPCNT_SHIFT);
+    flat->cel.ccb_Width = flat->width;
+    flat->cel.ccb_Height = flat->height;
+    CelQuadMapReciprocalsInitialization(&flat->cel, &flat->reciprocals);
+
+    // Si le groupe est projeté dans une liste d'affichage
+    displayed = ((groupCel->previous != NULL) && (groupCel->visible == 1)) ? 1 : 0;
+    if ((displayed == 1) && (GroupCelSpliceOut(groupCel) < 0)) {
+        // Libère la mémoire précédemment allouée
+        DeleteItem(flat->bitmap);
+        FreeMem(flat->buffer, flat->bufferSize);
+        FreeMem(flat, sizeof(GroupCelFlat));
+        // Retourne une erreur
+        printf("Error <- GroupCelSpliceOut()\n");
+        return -1;
+    }
+
+    // Les éléments laissent leur place au CCB aplati
+    GroupCelDirtyGroup(groupCel);
+
+    // Projette les éléments
+    groupCel->flat = flat;
+    if (GroupCelFlattenRender(groupCel) < 0) {
+        // Ramène la chaîne des éléments
+        GroupCelFlattenCleanup(groupCel);
+        // Retourne une erreur
+        printf("Error <- GroupCelFlattenRender()\n");
+        return -1;
+    }
+
+    // Le CCB aplati prend la place de la chaîne
+    if (displayed == 1) { GroupCelSpliceIn(groupCel); }
+
+    // Place le CCB aplati à la mise à jour suivante
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Indique à un GroupCel aplati que ses éléments ont changé
+void GroupCelElementsChanged(GroupCel *groupCel) {
+
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // La mise à jour suivante projette de nouveau les éléments
+        groupCel->transformations |= GROUPCEL_FLAG_ELEMENTS;
+    }
+}
+
+// Premier CCB projeté pour le GroupCel : son CCB aplati ou le début de sa chaîne
+CCB *GroupCelChainFirst(GroupCel *groupCel) {
+
+    return (groupCel->flat != NULL) ? &groupCel->flat->cel : groupCel->cel;
+}
+
+// Dernier CCB projeté pour le GroupCel : son CCB aplati ou le tail de sa chaîne
+CCB *GroupCelChainLast(GroupCel *groupCel) {
+
+    return (groupCel->flat != NULL) ? &groupCel->flat->cel : groupCel->tail;
+}
+
+// Avance les animations et place le CCB aplati du GroupCel
+void GroupCelFlattenUpdate(GroupCel *groupCel, int32 elapsed, int32 doStretch, int32 doRotate) {
+
+    // CCB aplati
+    GroupCelFlat *flat = groupCel->flat;
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Image affichée avant que l'animation avance
+    int32 frameIndex = 0;
+    // Transformation du groupe
+    GroupCelTransform transform;
+    // Quadrilatère pour la projection du Cel en 16.16
+    Quad2D quadMap = {0};
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelFlattenUpdate()*\n"); }
+
+    // Avance les animations : une nouvelle image change le rendu
+    if ((elapsed != 0) && (groupCel->animations != NULL)) {
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (groupCel->animations[celIndex].anim == NULL) { continue; }
+            frameIndex = groupCel->animations[celIndex].frameIndex;
+            GroupCelElementAnimationAdvance(groupCel, celIndex, elapsed);
+            if (groupCel->animations[celIndex].frameIndex != frameIndex) { groupCel->transformations |= GROUPCEL_FLAG_ELEMENTS; }
+        }
+    }
+
+    // Si un élément a changé
+    if ((groupCel->transformations & GROUPCEL_FLAG_ELEMENTS) != 0) {
+        // Projette de nouveau les éléments, le dernier rendu reste affiché en cas d'échec
+        if (GroupCelFlattenRender(groupCel) < 0) { printf("Error <- GroupCelFlattenRender()\n"); }
+        // Le nouveau rendu est dessiné à la place du précédent
+        if ((groupCel->dirty != NULL) && (groupCel->visible == 1)) { GroupCelDirtyAddF16(groupCel->dirty, &flat->bounds); }
+    }
+
+    // Le CCB aplati couvre le cadre comme un seul élément : une projection pour le groupe
+    GroupCelTransformPreparation(groupCel, doStretch, doRotate, &transform);
+    GroupCelTransformPoint(&transform, 0, 0, &quadMap.topLeft);
+    GroupCelTransformPoint(&transform, Convert32_F16(flat->width), 0, &quadMap.topRight);
+    GroupCelTransformPoint(&transform, Convert32_F16(flat->width), Convert32_F16(flat->height), &quadMap.bottomRight);
+    GroupCelTransformPoint(&transform, 0, Convert32_F16(flat->height), &quadMap.bottomLeft);
+    GroupCelCameraPoint(groupCel, &quadMap.topLeft);
+    GroupCelCameraPoint(groupCel, &quadMap.topRight);
+    GroupCelCameraPoint(groupCel, &quadMap.bottomRight);
+    GroupCelCameraPoint(groupCel, &quadMap.bottomLeft);
+
+    // Modifie le CCB aplati sans aucune division
+    CelQuadMapReciprocal(&flat->cel, &quadMap, &flat->reciprocals);
+    // Signale où était le CCB aplati et où il est maintenant
+    if (groupCel->dirty != NULL) { GroupCelDirtyQuad(groupCel, &flat->bounds, &quadMap); }
+
+    // Le placement du groupe a changé
+    groupCel->epoch++;
+}
+
+// Projette les éléments du GroupCel dans son bitmap hors écran
+int32 GroupCelFlattenRender(GroupCel *groupCel) {
+
+    // CCB aplati
+    GroupCelFlat *flat = groupCel->flat;
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // CCB de l'élément
+    CCB *cel = NULL;
+    // Quadrilatère pour la projection du Cel en 16.16
+    Quad2D quadMap = {0};
+    // Lien du tail sauvegardé pendant le rendu
+    CCB *tailNext = NULL;
+    uint32 tailLast = 0;
+    // Résultat du rendu
+    int32 result = 0;
+
+    if (DEBUG_GROUPCEL_FUNCT == 1) { printf("*GroupCelFlattenRender()*\n"); }
+
+    // Place chaque élément à sa position dans le cadre, sans transformation
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        cel = groupCel->cels[celIndex].cel;
+        // Si l'élément n'est pas configuré
+        if (cel == NULL) { continue; }
+        // Détecte un changement de dimension depuis le dernier rendu
+        GroupCelElementResized(groupCel, celIndex);
+        // Coins de l'élément dans le bitmap en 16.16
+        quadMap.topLeft.x = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+        quadMap.topLeft.y = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+        quadMap.bottomRight.x = quadMap.topLeft.x + Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+        quadMap.bottomRight.y = quadMap.topLeft.y + Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+        quadMap.topRight.x = quadMap.bottomRight.x;
+        quadMap.topRight.y = quadMap.topLeft.y;
+        quadMap.bottomLeft.x = quadMap.topLeft.x;
+        quadMap.bottomLeft.y = quadMap.bottomRight.y;
+        // Le bitmap est projeté en pleine résolution
+        if (groupCel->lods != NULL) { GroupCelElementLodSelect(groupCel, celIndex, &quadMap); }
+        CelQuadMapReciprocal(cel, &quadMap, &groupCel->reciprocals[celIndex]);
+    }
+    // Les quads du cache ont été écrits dans la scène
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Efface le bitmap : les pixels qu'aucun élément ne projette restent transparents
+    memset(flat->buffer, 0, (size_t)flat->bufferSize);
+
+    // Projette la chaîne des éléments seule, le tail terminant la liste le temps du rendu
+    tailNext = groupCel->tail->ccb_NextPtr;
+    tailLast = groupCel->tail->ccb_Flags & CCB_LAST;
+    GroupCelChainLink(groupCel->tail, NULL);
+    result = DrawCels(flat->bitmap, groupCel->cel);
+    groupCel->tail->ccb_NextPtr = tailNext;
+    groupCel->tail->ccb_Flags = (groupCel->tail->ccb_Flags & ~CCB_LAST) | tailLast;
+
+    // Si c'est un échec
+    if (result < 0) {
+        // Retourne une erreur
+        printf("Error : GroupCel flat rendering failed (%d).\n", result);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Supprime le CCB aplati, la chaîne des éléments est de nouveau projetée
+int32 GroupCelFlattenCleanup(GroupCel *groupCel) {
+
+    // CCB aplati
+    GroupCelFlat *flat = groupCel->flat;
+    // Indique si le groupe est projeté dans une liste d'affichage
+    int32 displayed = 0;
+
+    // Si le groupe n'est pas aplati
+    if (flat == NULL) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Retire le CCB aplati de la liste d'affichage
+    displayed = ((groupCel->previous != NULL) && (groupCel->visible == 1)) ? 1 : 0;
+    if ((displayed == 1) && (GroupCelSpliceOut(groupCel) < 0)) {
+        // Retourne une erreur
+        printf("Error <- GroupCelSpliceOut()\n");
+        return -1;
+    }
+
+    // Le CCB aplati laisse sa place aux éléments
+    GroupCelDirtyGroup(groupCel);
+
+    // Libère la mémoire utilisée pour le bitmap et le CCB aplati
+    DeleteItem(flat->bitmap);
+    FreeMem(flat->buffer, flat->bufferSize);
+    FreeMem(flat, sizeof(GroupCelFlat));
+    groupCel->flat = NULL;
+
+    // La chaîne des éléments reprend sa place
+    if (displayed == 1) { GroupCelSpliceIn(groupCel); }
+
+    // Les éléments ont été placés dans le bitmap : la mise à jour suivante les place dans la scène
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Chaîne de Cels pré-réduits d'un élément du GroupCel
+int32 GroupCelElementLod(GroupCel *groupCel, uint32 celIndex, CCB **levels, uint32 levelsCount) {
+
+    // Index pour parcourir les niveaux
+    uint32 level = 0;
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelElementLod()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si l'élément est inconnu
+    if ((groupCel->cels == NULL) || (celIndex >= groupCel->celsCount) || (groupCel->cels[celIndex].cel == NULL)){
+        // Retourne une erreur
+        printf("Error : GroupCel element %u unknow.\n", celIndex);
+        return -1;
+    }
+
+    // Si la chaîne doit être retirée
+    if (levels == NULL) {
+        // Si l'élément a une chaîne
+        if ((groupCel->lods != NULL) && (groupCel->lods[celIndex].levels != NULL)) {
+            // Ramène la pleine résolution
+            GroupCelElementLodLevel(groupCel, celIndex, 0);
+            groupCel->lods[celIndex].levels = NULL;
+            groupCel->lods[celIndex].levelsCount = 0;
+            // L'élément est placé de nouveau à la mise à jour suivante
+            if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+            groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        }
+        return 1;
+    }
+
+    // Valide toute la chaîne avant de modifier l'élément
+    for (level = 0; level < levelsCount; level++) {
+        // Si le niveau est inconnu
+        if (levels[level] == NULL) {
+            // Retourne une erreur
+            printf("Error : GroupCel LOD level %u unknow.\n", level);
+            return -1;
+        }
+    }
+
+    // Si la chaîne est vide
+    if (levelsCount == 0) {
+        // Retourne une erreur
+        printf("Error : GroupCel LOD chain without levels.\n");
+        return -1;
+    }
+
+    // Si l'élément est animé, ses images échangent déjà les données source
+    if ((groupCel->animations != NULL) && (groupCel->animations[celIndex].anim != NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel element %u is animated.\n", celIndex);
+        return -1;
+    }
+
+    // Si c'est le premier élément avec une chaîne
+    if (groupCel->lods == NULL) {
+        // Alloue la mémoire pour les chaînes
+        groupCel->lods = (GroupCelLod *)AllocMem(groupCel->celsCount * sizeof(GroupCelLod), MEMTYPE_DRAM);
+        // Si c'est un échec
+        if (groupCel->lods == NULL) {
+            // Affiche un message d'erreur
+            printf("Error : Failed to allocate memory for GroupCel LOD chains.\n");
+            return -1;
+        }
+        // Aucun élément avec une chaîne pour l'instant
+        memset(groupCel->lods, 0, (size_t)groupCel->celsCount * sizeof(GroupCelLod));
+    }
+
+    // Stocke la chaîne et affiche la pleine résolution
+    groupCel->lods[celIndex].levels = levels;
+    groupCel->lods[celIndex].levelsCount = levelsCount;
+    GroupCelElementLodLevel(groupCel, celIndex, 0);
+
+    // La mise à jour suivante choisit le niveau selon la taille projetée
+    if (groupCel->quads != NULL) { memset(&groupCel->quads[celIndex], 0, sizeof(Quad2D)); }
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Choisit le niveau d'un élément à partir de son quad projeté
+int32 GroupCelElementLodSelect(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap) {
+
+    // Chaîne de l'élément
+    GroupCelLod *lod = &groupCel->lods[celIndex];
+    // Dimension projetée en 16.16
+    frac16 width16 = 0;
+    frac16 height16 = 0;
+    // Longueur d'une arête en 16.16
+    frac16 length16 = 0;
+    // Niveau à afficher
+    uint32 level = 0;
+
+    // Si l'élément n'a pas de chaîne
+    if (lod->levels == NULL) {
+        // Il garde son CCB
+        return 0;
+    }
+
+    // Dimension projetée, la plus longue des arêtes opposées
+    width16 = GroupCelEdgeLength(&quadMap->topLeft, &quadMap->topRight);
+    length16 = GroupCelEdgeLength(&quadMap->bottomLeft, &quadMap->bottomRight);
+    if (length16 > width16) { width16 = length16; }
+    height16 = GroupCelEdgeLength(&quadMap->topLeft, &quadMap->bottomLeft);
+    length16 = GroupCelEdgeLength(&quadMap->topRight, &quadMap->bottomRight);
+    if (length16 > height16) { height16 = length16; }
+
+    // Plus petit niveau qui a encore un pixel source pour chaque pixel projeté
+    while ((level + 1 < lod->levelsCount) && (Convert32_F16(lod->levels[level + 1]->ccb_Width) >= width16) && (Convert32_F16(lod->levels[level + 1]->ccb_Height) >= height16)) {
+        level++;
+    }
+
+    // Si le niveau est déjà affiché
+    if (level == lod->level) {
+        // Rien ne change
+        return 0;
+    }
+
+    // Affiche le nouveau niveau
+    GroupCelElementLodLevel(groupCel, celIndex, level);
+
+    // Retourne 1 si le niveau a changé
+    return 1;
+}
+
+// Affiche un niveau de la chaîne dans le CCB de l'élément
+void GroupCelElementLodLevel(GroupCel *groupCel, int32 celIndex, uint32 level) {
+
+    // Niveau à afficher
+    CCB *source = groupCel->lods[celIndex].levels[level];
+    // CCB de l'élément
+    CCB *cel = groupCel->cels[celIndex].cel;
+
+    // Niveau actuel
+    groupCel->lods[celIndex].level = level;
+
+    // Echange les données source, la PLUT et les préambules du niveau
+    cel->ccb_SourcePtr = source->ccb_SourcePtr;
+    cel->ccb_PLUTPtr = source->ccb_PLUTPtr;
+    cel->ccb_PRE0 = source->ccb_PRE0;
+    cel->ccb_PRE1 = source->ccb_PRE1;
+    cel->ccb_Width = source->ccb_Width;
+    cel->ccb_Height = source->ccb_Height;
+
+    // La dimension vue et les inverses suivent le niveau, l'élément garde son cadre
+    groupCel->cels[celIndex].width = (uint16)cel->ccb_Width;
+    groupCel->cels[celIndex].height = (uint16)cel->ccb_Height;
+    CelQuadMapReciprocalsInitialization(cel, &groupCel->reciprocals[celIndex]);
+    groupCel->lodSwaps++;
+}
+
+// Longueur d'une arête en 16.16, jamais plus courte et au plus 12% plus longue que la longueur exacte
+frac16 GroupCelEdgeLength(Point2D *point0, Point2D *point1) {
+
+    // Différences absolues des coordonnées
+    frac16 deltaX = point1->x - point0->x;
+    frac16 deltaY = point1->y - point0->y;
+
+    if (deltaX < 0) { deltaX = -deltaX; }
+    if (deltaY < 0) { deltaY = -deltaY; }
+
+    // La plus grande différence plus la moitié de l'autre, sans racine carrée
+    return (deltaX > deltaY) ? deltaX + (deltaY >> 1) : deltaY + (deltaX >> 1);
+}
+
+// Donne au GroupCel l'accumulateur des rectangles à redessiner de l'image
+int32 GroupCelSetDirty(GroupCel *groupCel, GroupCelDirty *dirty) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelSetDirty()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le suivi doit être désactivé
+    if (dirty == NULL) {
+        // S'il y a des limites
+        if (groupCel->dirtyBounds != NULL) {
+            // Libère la mémoire utilisée pour les limites
+            FreeMem(groupCel->dirtyBounds, groupCel->celsCount * sizeof(Rectangle));
+            groupCel->dirtyBounds = NULL;
+        }
+        groupCel->dirty = NULL;
+        // Retourne un succès
+        return 1;
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel dirty rectangles need a list of elements.\n");
+        return -1;
+    }
+
+    // Si les limites n'existent pas encore
+    if (groupCel->dirtyBounds == NULL) {
+        // Alloue la mémoire pour les limites des éléments
+        groupCel->dirtyBounds = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+        // Si c'est un échec
+        if (groupCel->dirtyBounds == NULL) {
+            // Affiche un message d'erreur
+            printf("Error : Failed to allocate memory for GroupCel dirty bounds.\n");
+            return -1;
+        }
+        // Aucun élément dessiné pour l'instant
+        memset(groupCel->dirtyBounds, 0, (size_t)groupCel->celsCount * sizeof(Rectangle));
+        // Les limites sont prises quand les CCB sont écrits : chaque élément est écrit de nouveau
+        groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+        if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+    }
+
+    // Enregistre l'accumulateur
+    groupCel->dirty = dirty;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Signale les rectangles qu'un CCB quitte et atteint
+void GroupCelDirtyQuad(GroupCel *groupCel, Rectangle *bounds16, Quad2D *viewQuad) {
+
+    // Si le groupe est visible
+    if (groupCel->visible == 1) {
+        // Où le CCB était dessiné
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+
+    // Limites du nouveau quad
+    Quad2DBounds(viewQuad, bounds16);
+
+    // Si le groupe est visible
+    if (groupCel->visible == 1) {
+        // Où le CCB est dessiné maintenant
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+}
+
+// Signale toute la surface du GroupCel
+void GroupCelDirtyGroup(GroupCel *groupCel) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+
+    // Si le groupe n'est pas suivi
+    if (groupCel->dirty == NULL) {
+        // Rien à signaler
+        return;
+    }
+
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // Son CCB unique le couvre
+        GroupCelDirtyAddF16(groupCel->dirty, &groupCel->flat->bounds);
+        return;
+    }
+
+    // Chaque élément configuré
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        GroupCelDirtyAddF16(groupCel->dirty, &groupCel->dirtyBounds[celIndex]);
+    }
+}
+
+// Signale les rectangles qu'un CCB quitte et atteint quand la caméra se déplace
+void GroupCelDirtyPan(GroupCel *groupCel, Rectangle *bounds16, frac16 panX, frac16 panY) {
+
+    // Si le groupe est visible
+    if (groupCel->visible == 1) {
+        // Où le CCB était dessiné
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+
+    // Les limites suivent le CCB
+    bounds16->topLeft.x -= panX;
+    bounds16->topLeft.y -= panY;
+    bounds16->bottomRight.x -= panX;
+    bounds16->bottomRight.y -= panY;
+
+    // Si le groupe est visible
+    if (groupCel->visible == 1) {
+        // Où le CCB est dessiné maintenant
+        GroupCelDirtyAddF16(groupCel->dirty, bounds16);
+    }
+}
+
+// Garde les limites à l'écran de chaque élément, remplies par la mise à jour
+int32 GroupCelProjections(GroupCel *groupCel, int32 enable) {
+
+    if (DEBUG_GROUPCEL_SETUP == 1) { printf("*GroupCelProjections()*\n"); }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si les projections ne doivent plus être gardées
+    if (enable == 0) {
+        // S'il y a des projections
+        if (groupCel->projections != NULL) {
+            // Libère la mémoire utilisée pour les projections
+            FreeMem(groupCel->projections, groupCel->celsCount * sizeof(Rectangle));
+            groupCel->projections = NULL;
+        }
+        // Retourne un succès
+        return 1;
+    }
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel projections need a list of elements.\n");
+        return -1;
+    }
+
+    // Si les projections sont déjà gardées
+    if (groupCel->projections != NULL) {
+        // Rien à faire
+        return 1;
+    }
+
+    // Alloue la mémoire pour les projections des éléments
+    groupCel->projections = (Rectangle *)AllocMem(groupCel->celsCount * sizeof(Rectangle), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (groupCel->projections == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel projections.\n");
+        return -1;
+    }
+
+    // Aucun élément projeté pour l'instant
+    memset(groupCel->projections, 0, (size_t)groupCel->celsCount * sizeof(Rectangle));
+    // Les projections sont prises quand les CCB sont écrits : chaque élément est réécrit
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    if (groupCel->quads != NULL) { memset(groupCel->quads, 0, (size_t)groupCel->celsCount * sizeof(Quad2D)); }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Plus petit rectangle à l'écran contenant tout le GroupCel en 16.16
+int32 GroupCelProjectionBounds(GroupCel *groupCel, Rectangle *bounds) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Nombre d'éléments contenus
+    uint32 heldCount = 0;
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe est aplati
+    if (groupCel->flat != NULL) {
+        // Son CCB unique le contient
+        CelProjection(&groupCel->flat->cel, bounds);
+        return 1;
+    }
+
+    // Si les projections ne sont pas gardées
+    if (groupCel->projections == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel projections not kept, see GroupCelProjections().\n");
+        return -1;
+    }
+
+    // Chaque élément configuré
+    for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+        if (groupCel->cels[celIndex].cel == NULL) { continue; }
+        // Le premier donne les limites, les autres les agrandissent
+        if (heldCount == 0) {
+            *bounds = groupCel->projections[celIndex];
+        } else {
+            if (groupCel->projections[celIndex].topLeft.x < bounds->topLeft.x) { bounds->topLeft.x = groupCel->projections[celIndex].topLeft.x; }
+            if (groupCel->projections[celIndex].topLeft.y < bounds->topLeft.y) { bounds->topLeft.y = groupCel->projections[celIndex].topLeft.y; }
+            if (groupCel->projections[celIndex].bottomRight.x > bounds->bottomRight.x) { bounds->bottomRight.x = groupCel->projections[celIndex].bottomRight.x; }
+            if (groupCel->projections[celIndex].bottomRight.y > bounds->bottomRight.y) { bounds->bottomRight.y = groupCel->projections[celIndex].bottomRight.y; }
+        }
+        heldCount++;
+    }
+
+    // Retourne 1 si un élément est contenu, 0 si le groupe est vide
+    return (heldCount > 0) ? 1 : 0;
+}
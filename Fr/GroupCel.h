@@ -43,14 +43,132 @@
 **      de Cels, il faut pointer sur le CCB principal. Pour ajouter d'autres Cels à la suite, 
 **      il faut continuer la liaison à partir du CCB du dernier Cel ajouté.
 **
+**    - Chaque GroupCel garde son premier (cel) et son dernier (tail) CCB. GroupCelLinkAfter()
+**      insère toute la chaîne après un CCB d'une liste d'affichage, GroupCelUnlink() l'en retire
+**      et GroupCelSetVisible() la cache ou l'affiche, chacun en O(1) quel que soit le nombre
+**      d'éléments. Des groupes qui se suivent sont liés après le tail du groupe précédent ;
+**      celui devant lequel une autre chaîne est liée doit être retiré puis lié de nouveau.
+**      Configurer les éléments d'un groupe lié relie les extrémités de sa chaîne.
+**
+**    - Les éléments sont projetés dans l'ordre de leurs index tant qu'aucun ordre de projection
+**      n'est utilisé (GroupCelDrawOrder()). GroupCelBringToFront(), GroupCelSendToBack() et
+**      GroupCelMoveBefore() relient alors quelques ccb_NextPtr en O(1). Des clés de profondeur
+**      peuvent aussi être données aux éléments : le tri stable part de l'ordre actuel, une
+**      liste presque triée coûte donc presque un seul passage.
+**
+**    - La passe d'occultation (GroupCelOcclusion()) met CCB_SKIP sur les éléments
+**      entièrement couverts par un élément opaque projeté après eux, pour la frame. Seuls
+**      les éléments déclarés opaques (GroupCelElementSetOpaque()) et écrits en rectangles
+**      alignés sur les axes en cachent d'autres. Les limites sont prises quand les CCB
+**      sont écrits, et le test est prudent : un élément n'est sauté que si chaque pixel
+**      qu'il peut projeter est projeté de nouveau. La passe n'est exécutée à la mise à
+**      jour que si un CCB, une opacité ou l'ordre de projection a changé. Le drapeau
+**      CCB_SKIP des éléments doit alors lui être laissé.
+**
+**    - Un groupe statique peut être aplati (GroupCelFlatten()) : ses éléments sont projetés
+**      une fois dans un bitmap hors écran, et un seul CCB le lisant prend la place de la
+**      chaîne dans la liste d'affichage. Déplacer, étirer ou tourner le groupe n'écrit alors
+**      qu'un CCB. Le bitmap est le cadre du groupe : ce que les éléments projettent en dehors
+**      est coupé. Tout changement d'un élément (position, CCB, image d'une animation) projette
+**      de nouveau le bitmap à la mise à jour suivante, ce qui coûte plus que projeter la
+**      chaîne : seuls les groupes qui changent rarement méritent d'être aplatis. Le bitmap
+**      occupe largeur x hauteur x 2 octets de VRAM.
+**
+**    - Un élément peut recevoir une chaîne LOD (GroupCelElementLod()) : des Cels réduits
+**      à partir de sa pleine résolution, chacun plus petit que le précédent. Quand son CCB
+**      est écrit, le plus petit niveau qui a encore un pixel source pour chaque pixel
+**      projeté y est copié (données source, PLUT, préambules, dimension), comme une image
+**      d'animation. L'élément garde le cadre de sa pleine résolution. Un groupe réduit lit
+**      et remplit alors moins. Un élément animé ne peut pas avoir de chaîne, et un nouveau
+**      CCB la supprime.
+**
+**    - Une fois un GroupCelDirty donné (GroupCelSetDirty()), un groupe visible signale
+**      les limites de chaque CCB qu'il écrit, avant et après, et celles des images de ses
+**      animations. L'afficher, le cacher, le lier ou l'aplatir signale toute sa surface.
+**      Les limites viennent des quads en 16.16 et suivent les déplacements de la caméra.
+**
+**    - GroupCelProjections() garde les limites à l'écran de chaque élément en 16.16,
+**      prises sur les quads sur lesquels la mise à jour projette les CCB et décalées par
+**      les déplacements de la caméra. Elles ne sont pas mises à jour quand le groupe est
+**      aplati. CelProjection() donne les mêmes limites depuis n'importe quel CCB, HDDX/HDDY
+**      compris.
+**
+**    - Un GroupCel créé par GroupCelInstantiate() possède des entêtes CCB pris dans
+**      une GroupCelPool. Ils partagent les données source et les PLUT du modèle,
+**      qui doit donc rester chargé tant que ses instances existent.
+**
+**    - Avec GROUPCEL_STORAGE_COMPACT à 1, les éléments stockent leurs positions sur
+**      16 bits et les transformations lisent la dimension gardée par l'élément au lieu
+**      de son CCB : 12 octets par élément au lieu de 16 sur 3DO. Ce n'est pas moins
+**      qu'un élément ne gardant qu'une position 16.16 et le pointeur de CCB : les 4 octets
+**      économisés sont ceux de la dimension que les deux modes gardent pour détecter un
+**      changement de taille, et les inverses ajoutent 12 octets par élément dans les deux
+**      modes. GroupCelMemoryReport() compare les trois dispositions. Les positions hors
+**      de -32768..32767 sont bornées. Un changement de taille d'un CCB est détecté par la
+**      mise à jour suivante.
+**
+**    - Un GroupCel en grille (GroupCelGridInitialization()) contient des tuiles de même
+**      taille disposées en colonnes et rangées. Leurs positions découlent de leur index,
+**      et l'étirement et la rotation sont calculés une fois par sommet du treillis, chaque
+**      sommet étant partagé par jusqu'à quatre tuiles. Les fonctions d'éléments ne
+**      s'appliquent pas à une grille.
+**
+**    - L'étirement et la rotation restent appliqués après un déplacement : GroupCelUpdate()
+**      les recalcule tant que le cadre est étiré ou que l'angle n'est pas 0.
+**
+**    - Un élément peut recevoir une animation d'AnimSpriteCel avec GroupCelElementAnimation().
+**      GroupCelUpdateElapsed() avance alors les images, échange les données source dans le
+**      CCB de l'élément et recalcule les éléments dont la dimension a changé, dans le même
+**      parcours que les transformations. L'animation n'est pas copiée et doit rester chargée.
+**
+**    - Chaque élément garde la dernière dimension vue de son CCB et ses inverses, ainsi la
+**      projection d'un CCB ne demande aucune division. Quand la taille d'un CCB est changée
+**      hors du groupe (un TextCel réécrit, par exemple), la mise à jour suivante le recalcule,
+**      même sans transformation : GroupCelRevalidate(), qu'elle appelle alors, recalcule
+**      uniquement les éléments dont la dimension a changé, une grille ou un groupe aplati en entier.
+**
+**    - GroupCelQuadCache() garde le dernier quadrilatère écrit dans chaque CCB. Un élément
+**      dont le quadrilatère n'a pas changé depuis la dernière mise à jour est ignoré, son
+**      CCB n'est pas touché. Les champs de projection des CCB ne doivent alors être écrits
+**      que par le groupe.
+**
+**    - Les modificateurs (GroupCelSetPosition(), GroupCelStretch(), GroupCelRotate(),
+**      GroupCelElementSetPosition()) ne demandent une mise à jour que si la valeur change,
+**      ils peuvent donc être appelés à chaque image. L'époque du groupe change à chaque
+**      écriture d'un de ses CCB : un système gardant en cache des limites ou des tests de
+**      collision la compare avec la dernière époque vue pour savoir si le groupe a bougé.
+**
+**    - Les groupes rattachés à une GroupCelCamera sont vus à travers elle : la position de
+**      la caméra est soustraite à l'écriture des CCB. Déplacer la caméra ne marque pas les
+**      groupes comme transformés, leur prochaine mise à jour ajoute seulement le déplacement
+**      à chaque CCB. Plusieurs caméras peuvent être utilisées, une par couche par exemple.
+**
+**    - Une caméra peut aussi zoomer autour d'un point focal à l'écran (GroupCelCameraZoom()).
+**      Le zoom est appliqué après l'étirement et la rotation de chaque groupe, aux coins de
+**      chaque élément ou aux sommets du treillis d'une grille, pendant la même mise à jour.
+**      Changer le zoom recalcule les éléments des groupes ; un déplacement reste une addition.
+**
+**    - Les positions, angles et pivots sont gardés en 16.16 (GroupCelSetPositionF16(),
+**      GroupCelElementSetPositionF16(), GroupCelRotateF16()) : un groupe se déplaçant d'une
+**      fraction de pixel par image n'accumule pas d'arrondi chez l'appelant. Les modificateurs
+**      entiers convertissent une fois et leur délèguent. En stockage compact les positions
+**      des éléments restent en int16 et sont arrondies au pixel.
+**
 **    - Lorsqu'un GroupCel est initialisé, il doit être supprimé avec GroupCelCleanup().
-**      Les éléments qui lui sont associés doivent être supprimés indépendamment.
+**      Les éléments qui lui sont associés doivent être supprimés indépendamment, sauf
+**      s'ils ont été chargés depuis un paquet : le bloc qui les contient est alors
+**      libéré avec le groupe.
 **
 **  Rôle des structures :
 **
 **    GroupCelList
-**      - position : Position du l'élément dans le GroupCel
+**      - position : Position du l'élément dans le GroupCel (16.16 en stockage large)
 **      - cel : CCB de l'élément
+**      - width, height : Dernière dimension vue du CCB, lue par les transformations en stockage compact
+**
+**    GroupCelElement
+**      - celReference : Index du CCB de l'élément dans la table des cels
+**      - positionX, positionY : Position de l'élément dans le GroupCel
 **
 **    GroupCel
 **      - cel : CCB actif affiché à l'écran
@@ -59,9 +177,82 @@
 **      - stretching : Stockage des paramètres d'étirement
 **      - rotationAngle : Stockage de l'angle de rotation
 **      - rotationPivot : Stockage du point de pivot de rotation
+**      - position16, rotationAngle16, rotationPivot16 : Position, angle et pivot en 16.16
 **      - transformations : Flags pour déterminer les transformations à appliquer
 **      - celsCount : nombre total de Cels dans le GroupCel
 **      - cels : tableau dynamique de "GroupCelList"
+**      - data : Bloc contenant les données des éléments chargés depuis un paquet
+**      - dataSize : Taille du bloc en octets
+**      - pool : Réserve fournissant les entêtes CCB d'une instance
+**      - gridColumns, gridRows : Taille de la grille en tuiles (0 hors mode grille)
+**      - tileSize : Taille d'une tuile
+**      - tiles : Tableau des CCB des tuiles, rangée par rangée
+**      - lattice : Deux rangées de sommets du treillis utilisées par la mise à jour
+**      - animations : Etats d'animation des éléments, alloués avec la première animation
+**      - lods : Chaînes LOD des éléments, allouées avec la première chaîne
+**      - lodSwaps : Nombre de changements de niveau depuis la création
+**      - reciprocals : Inverses de la dimension de chaque élément
+**      - tileReciprocals : Inverses partagés par les tuiles d'une grille
+**      - tileDimension : Dernière dimension d'une tuile vue par les inverses partagés
+**      - quads : Dernier quadrilatère écrit dans chaque CCB (NULL si le cache est désactivé)
+**      - quadHits, quadMisses : Ecritures évitées et réalisées par le cache des quadrilatères
+**      - epoch : Epoque de transformation, change à chaque écriture d'un CCB du groupe
+**      - camera : Caméra à travers laquelle le groupe est vu (NULL si aucune)
+**      - cameraOffset : Décalage de la caméra déjà appliqué dans les CCB
+**      - cameraPan : Décalage mis à l'échelle par le zoom déjà appliqué dans les CCB, en 16.16
+**      - cameraZoom, cameraFocus : Zoom et point focal de la caméra déjà appliqués dans les CCB
+**      - tail : Dernier CCB de la chaîne du groupe
+**      - previous : CCB de la liste d'affichage que le groupe suit (NULL s'il n'est pas lié)
+**      - visible : Visibilité, 1 quand la chaîne est dans la liste d'affichage
+**      - order : Ordre de projection des éléments (NULL s'il suit les index)
+**      - orderFirst, orderLast : Premier et dernier éléments de l'ordre de projection
+**      - depthSort : Tri par profondeur à chaque mise à jour (1 = oui)
+**      - depthChanged : Une clé de profondeur a changé depuis le dernier tri
+**      - bounds : Limites de chaque élément telles qu'écrites dans son CCB (NULL quand la passe d'occultation est désactivée)
+**      - occlusion : Drapeaux d'occultation de chaque élément (opaque, aligné, caché)
+**      - occluders : Eléments opaques alignés dans l'ordre de projection, listés par la passe
+**      - occlusionEpoch, occlusionChanged : Epoque vue par la dernière passe, et un changement d'opacité ou d'ordre depuis
+**      - occludedCount : Nombre d'éléments cachés par la dernière passe
+**      - flat : CCB pré-rendu projeté à la place des éléments (NULL quand le groupe n'est pas aplati)
+**      - dirty : Accumulateur des rectangles à redessiner (NULL quand ils ne sont pas suivis)
+**      - dirtyBounds : Limites de chaque élément telles qu'écrites dans son CCB, pour les rectangles à redessiner
+**      - projections : Limites à l'écran de chaque élément, gardées par la mise à jour (NULL quand elles ne sont pas gardées)
+**
+**    GroupCelAnimation
+**      - anim : Animation de l'élément
+**      - frameIndex : Index de l'image affichée
+**      - frameDuration : Durée d'une image, dans l'unité du temps écoulé
+**      - elapsed : Temps écoulé dans l'image courante
+**
+**    GroupCelCamera
+**      - position : Position de la caméra dans la scène
+**      - zoom : Zoom en 16.16 (GROUPCEL_ZOOM_ONE = aucun zoom)
+**      - focus : Point focal du zoom à l'écran
+**
+**    GroupCelOrder
+**      - previous, next : Eléments projetés avant et après (GROUPCEL_ORDER_NONE aux extrémités)
+**      - depth : Clé de profondeur, les plus grandes sont projetées en dernier
+**
+**    GroupCelFlat
+**      - cel : CCB projeté à la place des éléments
+**      - bitmap, buffer, bufferSize : Bitmap hors écran et ses pixels en mémoire vidéo
+**      - width, height : Dimension du bitmap
+**      - reciprocals : Inverses de la dimension du CCB
+**      - bounds : Limites du CCB, pour les rectangles à redessiner
+**
+**    GroupCelLod
+**      - levels : Cels pré-réduits, la pleine résolution en premier
+**      - levelsCount : Nombre de niveaux
+**      - level : Niveau affiché
+**
+**    GroupCelTransform
+**      - Etirement et rotation pré-calculés, partagés par tous les points d'une mise à jour
+**
+**    GroupCelPool
+**      - ccbs : Bloc d'entêtes CCB
+**      - capacity : Nombre total d'entêtes CCB
+**      - freeList : Premier entête CCB libre, chaîné par ccb_NextPtr
+**      - freeCount : Nombre d'entêtes CCB libres
 **
 **  Fonctions principales :
 **
@@ -74,12 +265,40 @@
 **    GroupCelElementsConfiguration()
 **      -> Définit plusieurs éléments du GroupCel en une seule passe avec des arguments variadiques.
 **
+**    GroupCelElementsTableConfiguration()
+**      -> Définit plusieurs éléments du GroupCel à partir d'une table constante de descripteurs.
+**         Valide la table entière une seule fois, lie la chaîne en une passe et
+**         met à jour toutes les positions à la fin.
+**
+**    GroupCelInstantiate()
+**      -> Crée un GroupCel à partir d'un modèle. Seuls les entêtes CCB sont copiés, depuis
+**         une réserve : les données source et les PLUT du modèle sont partagées.
+**
+**    GroupCelPoolInitialization()
+**      -> Crée une réserve d'entêtes CCB pour les instances.
+**
+**    GroupCelPoolCleanup()
+**      -> Libère la mémoire utilisée par la réserve.
+**
+**    GroupCelGridInitialization()
+**      -> Initialise un GroupCel en grille à partir de ses colonnes, rangées et taille de tuile.
+**
+**    GroupCelGridTileConfiguration()
+**      -> Définit la tuile d'une colonne et d'une rangée de la grille.
+**         Un appel à GroupCelUpdate() est nécessaire pour appliquer les modifications.
+**
+**    GroupCelGridTilesConfiguration()
+**      -> Définit toutes les tuiles de la grille à partir d'une table de CCB, rangée par rangée.
+**
 **    GroupCelMove()
 **      -> Déplace le GroupCel en valeurs relatives par rapport à lui-même.
 **
 **    GroupCelSetPosition()
 **      -> Déplace le GroupCel en valeurs absolues.
 **
+**    GroupCelSetPositionF16()
+**      -> Déplace le GroupCel en valeurs absolues en 16.16.
+**
 **    GroupCelElementMove()
 **      -> Déplace un élément dans le GroupCel en valeurs relatives par rapport à lui-même.
 **         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
@@ -88,6 +307,16 @@
 **      -> Déplace un élément dans le GroupCel en valeurs absolues dans le cadre du GroupCel.
 **         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
 **
+**    GroupCelElementSetPositionF16()
+**      -> Déplace un élément dans le GroupCel en valeurs absolues en 16.16.
+**         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
+**
+**    GroupCelElementAnimation()
+**      -> Donne à un élément une animation et la durée de ses images (NULL l'arrête).
+**
+**    GroupCelQuadCache()
+**      -> Active ou désactive le cache ignorant les éléments dont le quadrilatère n'a pas changé.
+**
 **    GroupCelStretch()
 **      -> Etire le GroupCel en modifiant les quatre coins du cadre en valeurs absolues.
 **         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
@@ -96,15 +325,124 @@
 **      -> Fais tourner le GroupCel en indiquant un angle et un pivot en valeurs absolues.
 **         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
 **
+**    GroupCelRotateF16()
+**      -> Fais tourner le GroupCel avec un angle et un pivot en 16.16.
+**         L'appel de GroupCelUpdate() est nécessaire pour la prise en compte des modifications
+**
 **    GroupCelUpdate()
 **      -> Mets à jour les élément dans le GroupCel
 **
+**    GroupCelUpdateElapsed()
+**      -> Avance les animations du temps écoulé et met à jour les éléments en un seul parcours.
+**
+**    GroupCelRevalidate()
+**      -> Recalcule uniquement les éléments dont le CCB a changé de taille depuis la dernière mise à jour,
+**         toute la grille si une tuile l'a fait, et refait le rendu d'un groupe aplati si un élément l'a fait.
+**
 **    GroupCelElementUpdatePosition()
 **      -> Fonction interne appliquant les modifications de position.
 **
 **    GroupCelUpdateTransformations()
 **      -> Fonction interne appliquant les modifications d'étirement et de rotation.
 **
+**    GroupCelElementUpdateTransform()
+**      -> Fonction interne appliquant les transformations du groupe à un élément.
+**
+**    GroupCelElementAnimationAdvance() / GroupCelElementAnimationFrame()
+**      -> Fonctions internes avançant une animation et affichant une image dans le CCB de l'élément.
+**
+**    GroupCelGridUpdate()
+**      -> Fonction interne plaçant les tuiles d'une grille à partir des sommets partagés du treillis.
+**
+**    GroupCelTransformPreparation() / GroupCelTransformPoint()
+**      -> Fonctions internes pré-calculant les transformations et les appliquant à un point.
+**
+**    GroupCelFrameInitialization()
+**      -> Fonction interne initialisant le cadre commun aux deux sortes de GroupCel.
+**
+**    GroupCelElementResized() / GroupCelElementCommit()
+**      -> Fonctions internes détectant un changement de dimension et écrivant la projection d'un élément.
+**
+**    GroupCelIsStretched()
+**      -> Fonction interne indiquant si le cadre du GroupCel est étiré.
+**
+**    GroupCelPoolAllocation() / GroupCelPoolRelease()
+**      -> Fonctions internes prenant et rendant les entêtes CCB d'une réserve.
+**
+**    GroupCelElementStore()
+**      -> Fonction interne stockant un élément dans la liste, au format large ou compact.
+**
+**    GroupCelMemoryReport()
+**      -> Affiche la mémoire utilisée par les éléments dans les deux modes de stockage, face à la disposition de base.
+**
+**    GroupCelQuadCacheReport()
+**      -> Affiche les succès et les échecs du cache des quadrilatères et retourne le taux de succès.
+**
+**    GroupCelCameraInitialization() / GroupCelCameraCleanup()
+**      -> Crée et supprime une caméra.
+**
+**    GroupCelCameraMove() / GroupCelCameraSetPosition()
+**      -> Déplace la caméra avec des valeurs relatives ou absolues.
+**         Les groupes qui lui sont rattachés suivent à leur prochain GroupCelUpdate().
+**
+**    GroupCelCameraZoom()
+**      -> Zoome la caméra autour d'un point focal à l'écran.
+**         Les groupes qui lui sont rattachés sont recalculés à leur prochain GroupCelUpdate().
+**
+**    GroupCelSetCamera()
+**      -> Rattache un GroupCel à une caméra (NULL le détache).
+**
+**    GroupCelCameraPan()
+**      -> Fonction interne ajoutant le déplacement de la caméra à chaque CCB d'un groupe.
+**
+**    GroupCelCameraPoint()
+**      -> Fonction interne appliquant le décalage et le zoom de la caméra à un point.
+**
+**    GroupCelLinkAfter() / GroupCelUnlink()
+**      -> Insère tout le GroupCel après un CCB d'une liste d'affichage, ou l'en retire, en O(1).
+**
+**    GroupCelSetVisible()
+**      -> Cache ou affiche le GroupCel en retirant sa chaîne de sa liste d'affichage ou en l'y remettant.
+**
+**    GroupCelSpliceIn() / GroupCelSpliceOut()
+**      -> Fonctions internes reliant le CCB précédant le groupe et le tail du groupe.
+**
+**    GroupCelChainRelink()
+**      -> Fonction interne reliant un GroupCel lié dont les éléments ont été configurés de nouveau.
+**
+**    GroupCelDrawOrder()
+**      -> Gère l'ordre de projection des éléments, trié par profondeur à chaque mise à jour ou non.
+**
+**    GroupCelBringToFront() / GroupCelSendToBack() / GroupCelMoveBefore()
+**      -> Déplace un élément dans l'ordre de projection en reliant son CCB en O(1).
+**
+**    GroupCelElementSetDepth() / GroupCelDrawOrderSort()
+**      -> Donne une clé de profondeur à un élément et trie l'ordre de projection par profondeur.
+**
+**    GroupCelOcclusion()
+**      -> Active ou désactive la passe sautant les éléments cachés par des éléments opaques.
+**
+**    GroupCelElementSetOpaque()
+**      -> Déclare un élément opaque : il cache les éléments qu'il couvre entièrement.
+**
+**    GroupCelOcclusionUpdate() / GroupCelOcclusionBounds() / GroupCelOcclusionCovers()
+**      -> Fonctions internes exécutant la passe, gardant les limites et testant une couverture.
+**
+**    GroupCelFlatten()
+**      -> Projette une fois les éléments dans un bitmap affiché par un seul CCB, ou ramène la chaîne.
+**
+**    GroupCelElementsChanged()
+**      -> Projette de nouveau un groupe aplati à la mise à jour suivante.
+**
+**    GroupCelElementLod()
+**      -> Donne à un élément des Cels pré-réduits, échangés selon la taille de sa projection.
+**
+**    GroupCelSetDirty()
+**      -> Signale à un GroupCelDirty où étaient les CCB et où ils sont après chaque changement.
+**
+**    GroupCelProjections() / GroupCelProjectionBounds()
+**      -> Garde sans coût les limites à l'écran de chaque élément, et donne celles du groupe.
+**
 **    GroupCelCleanup()
 **      -> Libère la mémoire utilisée par la structure GroupCel.
 **
@@ -114,6 +452,12 @@
 #include "graphics.h"
 // Point2D, Quad2D
 #include "Geometry.h"
+// CelQuadMapReciprocals
+#include "CelQuadMap.h"
+// ANIM, AnimFrame
+#include "animutils.h"
+// GroupCelDirty
+#include "GroupCelDirty.h"
 // int32
 #include "types.h"
 
@@ -130,19 +474,192 @@
 #define GROUPCEL_FLAG_STRETCH (1 << 1)
 // bit-2 -> rotation
 #define GROUPCEL_FLAG_ROTATE (1 << 2)
+// bit-3 -> éléments d'un groupe aplati
+#define GROUPCEL_FLAG_ELEMENTS (1 << 3)
+
+// Zoom de la caméra
+// 1.0 en 16.16 -> aucun zoom
+#define GROUPCEL_ZOOM_ONE (1 << 16)
+
+// PIXC d'un groupe aplati
+// Opaque : les pixels du bitmap sont copiés tels quels
+#define GROUPCEL_FLAT_PIXC 0x1F001F00
+
+// Bornes d'un angle en 256 unités en 16.16
+#define GROUPCEL_ANGLE_MASK ((256 << 16) - 1)
+
+// Aucun élément dans l'ordre de projection
+#define GROUPCEL_ORDER_NONE (-1)
+
+// Drapeaux d'un élément pour la passe d'occultation
+// bit-0 -> opaque, mis par GroupCelElementSetOpaque()
+#define GROUPCEL_OCCLUSION_OPAQUE (1 << 0)
+// bit-1 -> quad écrit en rectangle aligné sur les axes
+#define GROUPCEL_OCCLUSION_ALIGNED (1 << 1)
+// bit-2 -> CCB sauté par la passe
+#define GROUPCEL_OCCLUSION_HIDDEN (1 << 2)
+// Marge pour l'arrondi d'un CCB en 16.16 (1/256 pixel)
+#define GROUPCEL_OCCLUSION_MARGIN (1 << 8)
+// Plus petit entier au-dessus d'une valeur 16.16
+#define GROUPCEL_CEIL_F16(value) (((value) + 0xFFFF) >> 16)
+
+// Stockage des éléments
+// 0 -> positions en 16.16, dimension lue dans le CCB
+// 1 -> positions int16, dimension lue dans le cache
+// Les deux gardent la dernière dimension vue du CCB pour détecter un redimensionnement
+#ifndef GROUPCEL_STORAGE_COMPACT
+#define GROUPCEL_STORAGE_COMPACT 0
+#endif
 
 typedef struct {
-	// Position
+    // Position en 16.16
     Point2D position;
-	// CCB du cel
-	CCB *cel;
-} GroupCelList;
+    // CCB du Cel
+    CCB *cel;
+    // Dernière dimension vue
+    uint16 width;
+    uint16 height;
+} GroupCelListWide;
+
+typedef struct {
+    // CCB du Cel
+    CCB *cel;
+    // Position
+    Point2D16 position;
+    // Dernière dimension vue
+    uint16 width;
+    uint16 height;
+} GroupCelListCompact;
+
+#if GROUPCEL_STORAGE_COMPACT == 1
+typedef GroupCelListCompact GroupCelList;
+// Dimension d'un élément
+#define GROUPCEL_ELEMENT_WIDTH(element) ((int32)(element)->width)
+#define GROUPCEL_ELEMENT_HEIGHT(element) ((int32)(element)->height)
+// Position d'un élément en 16.16
+#define GROUPCEL_ELEMENT_X16(element) ((frac16)(element)->position.x << 16)
+#define GROUPCEL_ELEMENT_Y16(element) ((frac16)(element)->position.y << 16)
+// Position 16.16 telle que l'élément la stocke, arrondie au pixel
+#define GROUPCEL_POSITION_F16(value16) ((frac16)(((value16) + (1 << 15)) & ~0xFFFF))
+// Bornes d'une position locale
+#define GROUPCEL_POSITION_MIN (-32768)
+#define GROUPCEL_POSITION_MAX 32767
+#else
+typedef GroupCelListWide GroupCelList;
+// Dimension d'un élément
+#define GROUPCEL_ELEMENT_WIDTH(element) ((element)->cel->ccb_Width)
+#define GROUPCEL_ELEMENT_HEIGHT(element) ((element)->cel->ccb_Height)
+// Position d'un élément en 16.16
+#define GROUPCEL_ELEMENT_X16(element) ((element)->position.x)
+#define GROUPCEL_ELEMENT_Y16(element) ((element)->position.y)
+// Position 16.16 telle que l'élément la stocke
+#define GROUPCEL_POSITION_F16(value16) (value16)
+#endif
+// Dimension d'un élément dans son cadre : la pleine résolution de sa chaîne LOD quand il en a une
+#define GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex) ((((groupCel)->lods != NULL) && ((groupCel)->lods[celIndex].levels != NULL)) ? (int32)(groupCel)->lods[celIndex].levels[0]->ccb_Width : (int32)GROUPCEL_ELEMENT_WIDTH(&(groupCel)->cels[celIndex]))
+#define GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex) ((((groupCel)->lods != NULL) && ((groupCel)->lods[celIndex].levels != NULL)) ? (int32)(groupCel)->lods[celIndex].levels[0]->ccb_Height : (int32)GROUPCEL_ELEMENT_HEIGHT(&(groupCel)->cels[celIndex]))
+
+typedef struct {
+    // Index du CCB dans la table des cels
+    uint32 celReference;
+    // Position
+    int32 positionX;
+    int32 positionY;
+} GroupCelElement;
+
+typedef struct {
+    // Bloc d'entêtes CCB
+    CCB *ccbs;
+    // Nombre total d'entêtes CCB
+    uint32 capacity;
+    // Premier entête CCB libre (chaîné par ccb_NextPtr)
+    CCB *freeList;
+    // Nombre d'entêtes CCB libres
+    uint32 freeCount;
+} GroupCelPool;
+
+typedef struct {
+    // Position en 16.16
+    Point2D position16;
+    // Transformations à appliquer (1 = oui)
+    int32 doStretch;
+    int32 doRotate;
+    // Inverses largeur/hauteur en 16.16
+    int32 invW;
+    int32 invH;
+    // Coin A, vecteurs B et C, terme D en 16.16
+    Point2D corner16;
+    Point2D vectorB16;
+    Point2D vectorC16;
+    Point2D delta16;
+    // Sinus et cosinus en 16.16
+    int32 sinus16;
+    int32 cosinus16;
+    // Pivot relatif au groupe en 16.16
+    Point2D rotationPivot16;
+} GroupCelTransform;
+
+typedef struct {
+    // Animation (NULL lorsque l'élément n'est pas animé)
+    ANIM *anim;
+    // Index de l'image affichée
+    int32 frameIndex;
+    // Durée d'une image, dans l'unité du temps écoulé
+    int32 frameDuration;
+    // Temps écoulé dans l'image courante
+    int32 elapsed;
+} GroupCelAnimation;
+
+typedef struct {
+    // Cels pré-réduits, la pleine résolution en premier (NULL sans chaîne)
+    CCB **levels;
+    // Nombre de niveaux
+    uint32 levelsCount;
+    // Niveau affiché
+    uint32 level;
+} GroupCelLod;
+
+typedef struct {
+    // Position de la caméra dans la scène
+    Point2D position;
+    // Zoom en 16.16 (GROUPCEL_ZOOM_ONE = aucun zoom)
+    frac16 zoom;
+    // Point focal du zoom à l'écran
+    Point2D focus;
+} GroupCelCamera;
+
+typedef struct {
+    // Eléments projetés avant et après (GROUPCEL_ORDER_NONE aux extrémités)
+    int32 previous;
+    int32 next;
+    // Clé de profondeur, les plus grandes sont projetées en dernier
+    int32 depth;
+} GroupCelOrder;
+
+typedef struct {
+    // CCB projeté à la place des éléments
+    CCB cel;
+    // Bitmap hors écran dans lequel les éléments sont projetés
+    Item bitmap;
+    // Pixels du bitmap en mémoire vidéo
+    void *buffer;
+    int32 bufferSize;
+    // Dimension du bitmap
+    int32 width;
+    int32 height;
+    // Inverses de la dimension du CCB
+    CelQuadMapReciprocals reciprocals;
+    // Limites du CCB en 16.16, pour les rectangles à redessiner
+    Rectangle bounds;
+} GroupCelFlat;
 
 typedef struct {
 	// CCB principal du groupe
 	CCB *cel;
 	// Position
     Point2D position;
+    // Position en 16.16 (position contient sa partie entière)
+    Point2D position16;
 	// Dimension
     Point2D size;
     // Quadrilatère d'étirement en pixels (local 0..x, 0..y)
@@ -152,12 +669,91 @@ typedef struct {
     uint32 rotationAngle;
 	// -> Pivot absolu en pixels
     Point2D rotationPivot;
+    // Angle et pivot en 16.16 (rotationAngle et rotationPivot contiennent leurs parties entières)
+    frac16 rotationAngle16;
+    Point2D rotationPivot16;
 	// Transformations à réaliser (move = bit-0, stretch = bit-1, rotate = bit-2)
     int32 transformations;	
 	// Nombre total de cels
     uint32 celsCount;
 	// Tableau de cels
     GroupCelList *cels;
+    // Bloc contenant les données des éléments lorsqu'ils sont chargés depuis un paquet
+    void *data;
+    // Taille du bloc en octets
+    int32 dataSize;
+    // Réserve fournissant les entêtes CCB d'une instance
+    GroupCelPool *pool;
+    // Grille (0 colonne lorsque les positions sont stockées par élément)
+    uint32 gridColumns;
+    uint32 gridRows;
+    // Dimension d'une tuile
+    Point2D tileSize;
+    // Tableau des tuiles, rangée par rangée
+    CCB **tiles;
+    // Deux rangées de sommets du treillis partagées par les tuiles
+    Point2D *lattice;
+    // Etats d'animation des éléments (NULL si aucun n'est animé)
+    GroupCelAnimation *animations;
+    // Chaînes LOD des éléments (NULL quand aucun élément n'en a)
+    GroupCelLod *lods;
+    // Nombre de changements de niveau depuis la création
+    uint32 lodSwaps;
+    // Inverses de la dimension de chaque élément
+    CelQuadMapReciprocals *reciprocals;
+    // Inverses partagés par les tuiles d'une grille
+    CelQuadMapReciprocals tileReciprocals;
+    // Dernière dimension d'une tuile vue par les inverses partagés
+    Point2D tileDimension;
+    // Dernier quadrilatère écrit par chaque élément (NULL si le cache est désactivé)
+    Quad2D *quads;
+    // Ecritures évitées et réalisées par le cache des quadrilatères
+    uint32 quadHits;
+    uint32 quadMisses;
+    // Epoque de transformation, change à chaque écriture d'un CCB du groupe
+    uint32 epoch;
+    // Caméra à travers laquelle le groupe est vu (NULL si aucune)
+    GroupCelCamera *camera;
+    // Décalage de la caméra déjà appliqué dans les CCB
+    Point2D cameraOffset;
+    // Décalage mis à l'échelle par le zoom déjà appliqué dans les CCB, en 16.16
+    Point2D cameraPan;
+    // Zoom et point focal de la caméra déjà appliqués dans les CCB
+    frac16 cameraZoom;
+    Point2D cameraFocus;
+    // Dernier CCB de la chaîne du groupe
+    CCB *tail;
+    // CCB de la liste d'affichage que le groupe suit (NULL s'il n'est pas lié)
+    CCB *previous;
+    // Visibilité (1 = la chaîne est dans la liste d'affichage)
+    int32 visible;
+    // Ordre de projection des éléments (NULL s'il suit les index)
+    GroupCelOrder *order;
+    // Premier et dernier éléments de l'ordre de projection
+    int32 orderFirst;
+    int32 orderLast;
+    // Tri par profondeur à chaque mise à jour (1 = oui) et clé changée depuis le dernier tri
+    int32 depthSort;
+    int32 depthChanged;
+    // Limites de chaque élément telles qu'écrites dans son CCB en 16.16 (NULL quand la passe d'occultation est désactivée)
+    Rectangle *bounds;
+    // Drapeaux d'occultation de chaque élément
+    uint8 *occlusion;
+    // Eléments opaques alignés dans l'ordre de projection, listés par la passe
+    int32 *occluders;
+    // Epoque vue par la dernière passe, et un changement d'opacité ou d'ordre depuis
+    uint32 occlusionEpoch;
+    int32 occlusionChanged;
+    // Nombre d'éléments cachés par la dernière passe
+    uint32 occludedCount;
+    // CCB pré-rendu projeté à la place des éléments (NULL quand le groupe n'est pas aplati)
+    GroupCelFlat *flat;
+    // Accumulateur des rectangles à redessiner (NULL quand ils ne sont pas suivis)
+    GroupCelDirty *dirty;
+    // Limites de chaque élément telles qu'écrites dans son CCB en 16.16, pour les rectangles à redessiner
+    Rectangle *dirtyBounds;
+    // Limites à l'écran de chaque élément en 16.16, gardées par la mise à jour (NULL quand elles ne sont pas gardées)
+    Rectangle *projections;
 } GroupCel;
 
 // Référence au contexte global
@@ -169,30 +765,207 @@ GroupCel *GroupCelInitialization(int32 positionX, int32 positionY, uint32 sizeX,
 int32 GroupCelElementConfiguration(GroupCel *groupCel, uint32 celIndex, CCB *cel, uint32 positionX, uint32 positionY);
 // Configuration des cels d'un GroupCel
 int32 GroupCelElementsConfiguration(GroupCel *groupCel, int32 start, ...);
+// Configuration des cels d'un GroupCel à partir d'une table de descripteurs
+int32 GroupCelElementsTableConfiguration(GroupCel *groupCel, const GroupCelElement *elements, uint32 elementsCount, CCB **cels, uint32 celsCount);
+// Initialisation d'un GroupCel en grille
+GroupCel *GroupCelGridInitialization(int32 positionX, int32 positionY, uint32 columns, uint32 rows, uint32 tileSizeX, uint32 tileSizeY);
+// Configuration d'une tuile d'un GroupCel en grille
+int32 GroupCelGridTileConfiguration(GroupCel *groupCel, uint32 column, uint32 row, CCB *cel);
+// Configuration de toutes les tuiles d'un GroupCel en grille
+int32 GroupCelGridTilesConfiguration(GroupCel *groupCel, CCB **cels, uint32 celsCount);
+// Création d'un GroupCel partageant les données source d'un modèle
+GroupCel *GroupCelInstantiate(GroupCel *templateGroupCel, GroupCelPool *pool, int32 positionX, int32 positionY);
 
 // Déplace le GroupCel
 void GroupCelMove(GroupCel *groupCel, int32 moveX, int32 moveY);
 // Modifie la position du GroupCel
 void GroupCelSetPosition(GroupCel *groupCel, int32 positionX, int32 positionY);
+// Modifie la position du GroupCel en 16.16
+void GroupCelSetPositionF16(GroupCel *groupCel, frac16 positionX16, frac16 positionY16);
 
 // Déplace un élément dans le GroupCel
 void GroupCelElementMove(GroupCel *groupCel, int32 celIndex, int32 moveX, int32 moveY);
 // Modifie la position d'un cel du GroupCel
 void GroupCelElementSetPosition(GroupCel *groupCel, int32 celIndex, int32 positionX, int32 positionY);
+// Modifie la position d'un cel du GroupCel en 16.16
+void GroupCelElementSetPositionF16(GroupCel *groupCel, int32 celIndex, frac16 positionX16, frac16 positionY16);
+
+// Animation d'un élément du GroupCel
+int32 GroupCelElementAnimation(GroupCel *groupCel, uint32 celIndex, ANIM *anim, int32 frameDuration);
+// Active ou désactive le cache des quadrilatères des éléments
+int32 GroupCelQuadCache(GroupCel *groupCel, int32 enable);
 
 // Etire le groupe selon ses 4 coins en pixels
 void GroupCelStretch(GroupCel *groupCel, int32 point1X, int32 point1Y, int32 point2X, int32 point2Y, int32 point3X, int32 point3Y, int32 point4X, int32 point4Y);
 // Tourne le groupe selon un angle en 256 unités
 void GroupCelRotate(GroupCel *groupCel, uint32 angle, int32 pivotX, int32 pivotY);
+// Tourne le groupe selon un angle en 256 unités en 16.16
+void GroupCelRotateF16(GroupCel *groupCel, frac16 angle16, frac16 pivotX16, frac16 pivotY16);
 
 // Met à jour les élément dans le GroupCel
 void GroupCelUpdate(GroupCel *groupCel);
+// Avance les animations et met à jour les éléments du GroupCel
+void GroupCelUpdateElapsed(GroupCel *groupCel, int32 elapsed);
+// Recalcule uniquement les éléments dont la dimension a changé
+int32 GroupCelRevalidate(GroupCel *groupCel);
 // Applique la position dans le CCB du Cel
 void GroupCelElementUpdatePosition(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Applique les transformations du groupe dans le CCB du Cel
+void GroupCelElementUpdateTransform(GroupCel *groupCel, int32 celIndex, GroupCelTransform *transform, Quad2D *quadMap);
 // Applique les transformations Stretch et Rotate dans le CCB des Cels
 void GroupCelUpdateTransformations(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap);
+// Détecte un changement de dimension d'un élément
+int32 GroupCelElementResized(GroupCel *groupCel, int32 celIndex);
+// Ecrit la projection d'un élément dans son CCB
+void GroupCelElementCommit(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Avance l'animation d'un élément
+int32 GroupCelElementAnimationAdvance(GroupCel *groupCel, uint32 celIndex, int32 elapsed);
+// Affiche une image de l'animation dans le CCB de l'élément
+int32 GroupCelElementAnimationFrame(GroupCel *groupCel, uint32 celIndex, int32 frameIndex);
+// Chaîne de Cels pré-réduits d'un élément
+int32 GroupCelElementLod(GroupCel *groupCel, uint32 celIndex, CCB **levels, uint32 levelsCount);
+// Choisit le niveau d'un élément à partir de son quad projeté
+int32 GroupCelElementLodSelect(GroupCel *groupCel, int32 celIndex, Quad2D *quadMap);
+// Affiche un niveau de la chaîne dans le CCB de l'élément
+void GroupCelElementLodLevel(GroupCel *groupCel, int32 celIndex, uint32 level);
+// Longueur d'une arête en 16.16
+frac16 GroupCelEdgeLength(Point2D *point0, Point2D *point1);
+
+// Applique la position et les transformations aux tuiles d'une grille
+void GroupCelGridUpdate(GroupCel *groupCel, int32 doStretch, int32 doRotate, Quad2D *quadMap);
+// Prépare la transformation des points locaux du GroupCel
+void GroupCelTransformPreparation(GroupCel *groupCel, int32 doStretch, int32 doRotate, GroupCelTransform *transform);
+// Transforme un point local du GroupCel en point écran en 16.16
+void GroupCelTransformPoint(GroupCelTransform *transform, frac16 localX16, frac16 localY16, Point2D *point16);
+
+// Initialisation du cadre d'un GroupCel
+void GroupCelFrameInitialization(GroupCel *groupCel, int32 positionX, int32 positionY, uint32 sizeX, uint32 sizeY);
+// Le cadre du GroupCel est-il étiré
+int32 GroupCelIsStretched(GroupCel *groupCel);
+// Stocke un élément dans la liste (borne la position en mode compact)
+void GroupCelElementStore(GroupCelList *element, CCB *cel, frac16 positionX16, frac16 positionY16);
+// Affiche la mémoire utilisée par les éléments dans les deux modes de stockage
+int32 GroupCelMemoryReport(GroupCel *groupCel);
+// Affiche les succès du cache des quadrilatères
+int32 GroupCelQuadCacheReport(GroupCel *groupCel);
 
 // Supprime le GroupCel
 int32 GroupCelCleanup(GroupCel *groupCel);
 
+// Initialisation d'une réserve d'entêtes CCB
+GroupCelPool *GroupCelPoolInitialization(uint32 capacity);
+// Prend un entête CCB dans la réserve
+CCB *GroupCelPoolAllocation(GroupCelPool *pool);
+// Rend un entête CCB à la réserve
+void GroupCelPoolRelease(GroupCelPool *pool, CCB *cel);
+// Supprime la réserve
+int32 GroupCelPoolCleanup(GroupCelPool *pool);
+
+// Initialisation d'une caméra
+GroupCelCamera *GroupCelCameraInitialization(int32 positionX, int32 positionY);
+// Déplace la caméra
+void GroupCelCameraMove(GroupCelCamera *camera, int32 moveX, int32 moveY);
+// Modifie la position de la caméra
+void GroupCelCameraSetPosition(GroupCelCamera *camera, int32 positionX, int32 positionY);
+// Zoome la caméra autour d'un point focal
+void GroupCelCameraZoom(GroupCelCamera *camera, frac16 zoom, int32 focusX, int32 focusY);
+// Rattache un GroupCel à une caméra
+int32 GroupCelSetCamera(GroupCel *groupCel, GroupCelCamera *camera);
+// Déplace les CCB d'un GroupCel du déplacement de sa caméra
+void GroupCelCameraPan(GroupCel *groupCel);
+// Applique la caméra d'un GroupCel à un point en 16.16
+void GroupCelCameraPoint(GroupCel *groupCel, Point2D *point16);
+// Supprime la caméra
+int32 GroupCelCameraCleanup(GroupCelCamera *camera);
+
+// Affiche ou cache un GroupCel dans sa liste d'affichage
+int32 GroupCelSetVisible(GroupCel *groupCel, int32 visible);
+// Lie un GroupCel après un CCB d'une liste d'affichage
+int32 GroupCelLinkAfter(GroupCel *groupCel, CCB *previous);
+// Retire un GroupCel de sa liste d'affichage
+int32 GroupCelUnlink(GroupCel *groupCel);
+// Insère la chaîne d'un GroupCel après son CCB
+int32 GroupCelSpliceIn(GroupCel *groupCel);
+// Retire la chaîne d'un GroupCel de la liste
+int32 GroupCelSpliceOut(GroupCel *groupCel);
+// CCB projeté après un Cel
+CCB *GroupCelChainNext(CCB *cel);
+// Lie un Cel au suivant ou termine la liste sur lui
+void GroupCelChainLink(CCB *cel, CCB *next);
+// Relie un GroupCel dans sa liste d'affichage après un changement des extrémités de sa chaîne
+void GroupCelChainRelink(GroupCel *groupCel, CCB *follower);
+
+// Ordre de projection des éléments d'un GroupCel
+int32 GroupCelDrawOrder(GroupCel *groupCel, int32 depthSort);
+// Clé de profondeur d'un élément
+int32 GroupCelElementSetDepth(GroupCel *groupCel, uint32 celIndex, int32 depth);
+// Projette un élément au-dessus de tous les autres
+int32 GroupCelBringToFront(GroupCel *groupCel, uint32 celIndex);
+// Projette un élément sous tous les autres
+int32 GroupCelSendToBack(GroupCel *groupCel, uint32 celIndex);
+// Projette un élément juste avant un autre
+int32 GroupCelMoveBefore(GroupCel *groupCel, uint32 celIndex, uint32 beforeIndex);
+// Trie l'ordre de projection par profondeur
+int32 GroupCelDrawOrderSort(GroupCel *groupCel);
+// Alloue l'ordre de projection à partir de l'ordre des index
+int32 GroupCelDrawOrderAllocation(GroupCel *groupCel);
+// Vérifie qu'un élément peut être réordonné
+int32 GroupCelDrawOrderCheck(GroupCel *groupCel, uint32 celIndex);
+// Retire un élément de l'ordre de projection
+void GroupCelDrawOrderRemove(GroupCel *groupCel, int32 celIndex, CCB *follower);
+// Insère un élément dans l'ordre de projection avant un autre
+void GroupCelDrawOrderInsert(GroupCel *groupCel, int32 celIndex, int32 beforeIndex, CCB *follower);
+// Donne un nouveau CCB à un élément de l'ordre de projection
+void GroupCelDrawOrderReplace(GroupCel *groupCel, int32 celIndex);
+// Lie le CCB d'un élément au suivant dans l'ordre de projection
+void GroupCelDrawOrderLink(GroupCel *groupCel, int32 celIndex, CCB *follower);
+// Mets à jour le premier et le dernier CCB d'un groupe à partir de l'ordre de projection
+void GroupCelDrawOrderEnds(GroupCel *groupCel);
+// Supprime l'ordre de projection
+void GroupCelDrawOrderCleanup(GroupCel *groupCel);
+
+// Active ou désactive la passe d'occultation
+int32 GroupCelOcclusion(GroupCel *groupCel, int32 enable);
+// Indique si un élément cache ce qui est projeté derrière lui
+int32 GroupCelElementSetOpaque(GroupCel *groupCel, uint32 celIndex, int32 opaque);
+// Saute les éléments couverts par un élément opaque aligné projeté après eux
+void GroupCelOcclusionUpdate(GroupCel *groupCel);
+// Garde les limites d'un élément telles qu'écrites dans son CCB
+void GroupCelOcclusionBounds(GroupCel *groupCel, int32 celIndex, Quad2D *viewQuad);
+// Indique si un occulteur aligné couvre chaque pixel qu'un élément peut projeter
+int32 GroupCelOcclusionCovers(Rectangle *occluder, Rectangle *element);
+// Montre un élément caché par la passe d'occultation
+void GroupCelOcclusionShow(GroupCel *groupCel, int32 celIndex);
+// Supprime la passe d'occultation
+void GroupCelOcclusionCleanup(GroupCel *groupCel);
+
+// Aplatit le GroupCel en un seul CCB pré-rendu
+int32 GroupCelFlatten(GroupCel *groupCel, int32 enable);
+// Indique à un GroupCel aplati que ses éléments ont changé
+void GroupCelElementsChanged(GroupCel *groupCel);
+// Premier CCB projeté pour le GroupCel
+CCB *GroupCelChainFirst(GroupCel *groupCel);
+// Dernier CCB projeté pour le GroupCel
+CCB *GroupCelChainLast(GroupCel *groupCel);
+// Avance les animations et place le CCB aplati
+void GroupCelFlattenUpdate(GroupCel *groupCel, int32 elapsed, int32 doStretch, int32 doRotate);
+// Projette les éléments dans le bitmap hors écran
+int32 GroupCelFlattenRender(GroupCel *groupCel);
+// Supprime le CCB aplati
+int32 GroupCelFlattenCleanup(GroupCel *groupCel);
+
+// Donne au GroupCel l'accumulateur des rectangles à redessiner
+int32 GroupCelSetDirty(GroupCel *groupCel, GroupCelDirty *dirty);
+// Signale les rectangles qu'un CCB quitte et atteint
+void GroupCelDirtyQuad(GroupCel *groupCel, Rectangle *bounds16, Quad2D *viewQuad);
+// Signale toute la surface du GroupCel
+void GroupCelDirtyGroup(GroupCel *groupCel);
+// Signale les rectangles qu'un CCB quitte et atteint quand la caméra se déplace
+void GroupCelDirtyPan(GroupCel *groupCel, Rectangle *bounds16, frac16 panX, frac16 panY);
+
+// Garde les limites à l'écran de chaque élément, remplies par la mise à jour
+int32 GroupCelProjections(GroupCel *groupCel, int32 enable);
+// Plus petit rectangle à l'écran contenant tout le GroupCel
+int32 GroupCelProjectionBounds(GroupCel *groupCel, Rectangle *bounds);
+
 #endif // GROUPCEL_H
\ No newline at end of file
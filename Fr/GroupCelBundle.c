@@ -0,0 +1,326 @@
+
+#include "GroupCelBundle.h"
+
+// GroupCelLayoutInstantiate()
+#include "GroupCelLayout.h"
+// AllocMem(), FreeMem(), MEMTYPE_CEL
+#include "mem.h"
+// DeleteItem()
+#include "item.h"
+// printf()
+#include "stdio.h"
+
+// Lit un paquet et crée le GroupCel
+GroupCel *GroupCelBundleLoad(char *filename) {
+
+    // Flux lisant le paquet
+    GroupCelBundleStream stream;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+    // Etat du flux
+    int32 result = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleLoad()*\n"); }
+
+    // Lit le paquet entier en une seule lecture séquentielle
+    if (GroupCelBundleStreamStart(&stream, filename, 0) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelBundleStreamStart()\n");
+        return NULL;
+    }
+
+    // Attend la fin de la lecture
+    while ((result = GroupCelBundleStreamContinue(&stream, &groupCel)) == 0) {
+        WaitReadDoneBlockFile(stream.ioRequest);
+    }
+
+    // Si c'est un échec
+    if (result < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelBundleStreamContinue()\n");
+        return NULL;
+    }
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
+
+// Démarre la lecture en flux d'un paquet par morceaux
+int32 GroupCelBundleStreamStart(GroupCelBundleStream *stream, char *filename, int32 chunkSize) {
+
+    // Taille d'un bloc du périphérique
+    int32 blockSize = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamStart()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((stream == NULL) || (filename == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle unknow.\n");
+        return -1;
+    }
+
+    // Rien n'est encore alloué
+    stream->ioRequest = -1;
+    stream->data = NULL;
+    stream->offset = 0;
+
+    // Ouvre le fichier
+    if (OpenBlockFile(filename, &stream->file) < 0) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Taille du paquet arrondie aux blocs du périphérique
+    stream->dataSize = GetBlockFileSize(&stream->file);
+    blockSize = GetBlockFileBlockSize(&stream->file);
+    stream->bufferSize = ((stream->dataSize + blockSize - 1) / blockSize) * blockSize;
+
+    // Corrige les paramètres
+    // Les morceaux sont des blocs entiers, 0 lit le paquet entier d'un coup
+    chunkSize = ((chunkSize + blockSize - 1) / blockSize) * blockSize;
+    stream->chunkSize = ((chunkSize <= 0) || (chunkSize > stream->bufferSize)) ? stream->bufferSize : chunkSize;
+
+    // Alloue un seul bloc pour le paquet entier
+    stream->data = (uint8 *)AllocMem(stream->bufferSize, MEMTYPE_CEL);
+    // Si c'est un échec
+    if (stream->data == NULL) {
+        GroupCelBundleStreamAbort(stream);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for %s.\n", filename);
+        return -1;
+    }
+
+    // Crée la requête d'E/S
+    stream->ioRequest = CreateBlockFileIOReq(stream->file.fDevice, 0);
+    // Si c'est un échec
+    if (stream->ioRequest < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Affiche un message d'erreur
+        printf("Error : Failed to create I/O request for %s.\n", filename);
+        return -1;
+    }
+
+    // Lance la lecture du premier morceau
+    if (AsynchReadBlockFile(&stream->file, stream->ioRequest, stream->data, stream->chunkSize, 0) < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Affiche un message d'erreur
+        printf("Error : Failed to read %s.\n", filename);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Interroge le flux
+int32 GroupCelBundleStreamContinue(GroupCelBundleStream *stream, GroupCel **groupCel) {
+
+    // Taille du morceau suivant
+    int32 chunkSize = 0;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamContinue()*\n"); }
+
+    // Si le flux est inconnu
+    if ((stream == NULL) || (stream->data == NULL) || (groupCel == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle stream unknow.\n");
+        return -1;
+    }
+
+    // Si le morceau courant est encore en lecture
+    if (ReadDoneBlockFile(stream->ioRequest) == 0) {
+        // Revient plus tard
+        return 0;
+    }
+
+    // Si la lecture du morceau a échoué
+    if (WaitReadDoneBlockFile(stream->ioRequest) < 0) {
+        GroupCelBundleStreamAbort(stream);
+        // Retourne une erreur
+        printf("Error : Failed to read GroupCel bundle.\n");
+        return -1;
+    }
+
+    // Morceau suivant
+    stream->offset += stream->chunkSize;
+
+    // Si il reste quelque chose à lire
+    if (stream->offset < stream->bufferSize) {
+        // Lance la lecture du morceau suivant
+        chunkSize = stream->bufferSize - stream->offset;
+        chunkSize = (chunkSize < stream->chunkSize) ? chunkSize : stream->chunkSize;
+        if (AsynchReadBlockFile(&stream->file, stream->ioRequest, stream->data + stream->offset, chunkSize, stream->offset) < 0) {
+            GroupCelBundleStreamAbort(stream);
+            // Retourne une erreur
+            printf("Error : Failed to read GroupCel bundle.\n");
+            return -1;
+        }
+        // Revient plus tard
+        return 0;
+    }
+
+    // Libère les ressources d'E/S
+    DeleteItem(stream->ioRequest);
+    stream->ioRequest = -1;
+    CloseBlockFile(&stream->file);
+
+    // Crée le GroupCel, qui possède désormais le bloc
+    *groupCel = GroupCelBundleInstantiate(stream->data, stream->dataSize, stream->bufferSize);
+    // Si c'est un échec
+    if (*groupCel == NULL) {
+        FreeMem(stream->data, stream->bufferSize);
+        stream->data = NULL;
+        // Retourne une erreur
+        printf("Error <- GroupCelBundleInstantiate()\n");
+        return -1;
+    }
+    stream->data = NULL;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Arrête un flux
+void GroupCelBundleStreamAbort(GroupCelBundleStream *stream) {
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleStreamAbort()*\n"); }
+
+    // Si le flux est inconnu
+    if (stream == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle stream unknow.\n");
+        return;
+    }
+
+    // Si une requête existe
+    if (stream->ioRequest >= 0) {
+        // Supprimer la requête annule la lecture en cours
+        DeleteItem(stream->ioRequest);
+        stream->ioRequest = -1;
+        CloseBlockFile(&stream->file);
+    }
+
+    // Si le bloc existe
+    if (stream->data != NULL) {
+        FreeMem(stream->data, stream->bufferSize);
+        stream->data = NULL;
+    }
+}
+
+// Corrige les CCB d'un paquet en mémoire et crée le GroupCel
+GroupCel *GroupCelBundleInstantiate(void *data, int32 dataSize, int32 bufferSize) {
+
+    // Entête du paquet
+    GroupCelBundleHeader *header = (GroupCelBundleHeader *)data;
+    // Table des adresses des CCB
+    CCB **cels = NULL;
+    // Table des tailles
+    GroupCelBundleSizes *sizes = NULL;
+    // CCB courant
+    CCB *cel = NULL;
+    // Décalages de ses pixels et de sa PLUT
+    uint32 pixelsOffset = 0;
+    uint32 plutOffset = 0;
+    // Index pour parcourir les CCB
+    uint32 celIndex = 0;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_BUNDLE == 1) { printf("*GroupCelBundleInstantiate()*\n"); }
+
+    // Si le paquet est inconnu ou trop petit
+    if ((data == NULL) || (dataSize < (int32)sizeof(GroupCelBundleHeader))) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle unknow.\n");
+        return NULL;
+    }
+
+    // Si ce n'est pas un paquet d'une version connue
+    if ((header->magic != GROUPCEL_BUNDLE_MAGIC) || (header->version != GROUPCEL_BUNDLE_VERSION) || (header->dataSize > (uint32)dataSize)) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle version unknow.\n");
+        return NULL;
+    }
+
+    // Si les tables ne sont pas alignées sur un mot
+    if (((header->celsOffset | header->sizesOffset | header->referencesOffset | header->layoutOffset) & 3) != 0) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle misaligned.\n");
+        return NULL;
+    }
+
+    // Si les tables ou la disposition sont en dehors du paquet
+    if ((GroupCelBundleInside(header->celsOffset, header->celsCount, GROUPCEL_BUNDLE_CCB_SIZE, header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->sizesOffset, header->celsCount, GROUPCEL_BUNDLE_SIZES_SIZE, header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->referencesOffset, header->celsCount, sizeof(CCB *), header->dataSize) == 0) ||
+        (GroupCelBundleInside(header->layoutOffset, 1, header->layoutSize, header->dataSize) == 0)) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle truncated.\n");
+        return NULL;
+    }
+
+    // Table des adresses des CCB
+    cels = (CCB **)((uint8 *)data + header->referencesOffset);
+    // Table des tailles
+    sizes = (GroupCelBundleSizes *)((uint8 *)data + header->sizesOffset);
+
+    // Corrige chaque CCB sur place
+    for (celIndex = 0; celIndex < header->celsCount; celIndex++) {
+
+        cel = (CCB *)((uint8 *)data + header->celsOffset + celIndex * GROUPCEL_BUNDLE_CCB_SIZE);
+
+        pixelsOffset = (uint32)cel->ccb_SourcePtr;
+        plutOffset = (uint32)cel->ccb_PLUTPtr;
+
+        // Si les pixels ou la PLUT du Cel sont vides ou en dehors du paquet
+        if ((pixelsOffset == 0) || (sizes[celIndex].pixelsSize == 0) ||
+            (GroupCelBundleInside(pixelsOffset, 1, sizes[celIndex].pixelsSize, header->dataSize) == 0) ||
+            ((plutOffset != 0) && ((sizes[celIndex].plutSize == 0) || (GroupCelBundleInside(plutOffset, 1, sizes[celIndex].plutSize, header->dataSize) == 0)))) {
+            // Retourne une erreur
+            printf("Error : GroupCel bundle Cel %u truncated.\n", celIndex);
+            return NULL;
+        }
+
+        // Les décalages deviennent des adresses absolues dans le bloc
+        cel->ccb_SourcePtr = (CelData *)((uint8 *)data + pixelsOffset);
+        cel->ccb_PLUTPtr = (plutOffset != 0) ? (void *)((uint8 *)data + plutOffset) : NULL;
+        cel->ccb_Flags |= CCB_SPABS | CCB_PPABS | CCB_NPABS | CCB_LAST;
+        // Sans PLUT, rien à charger
+        if (cel->ccb_PLUTPtr == NULL) { cel->ccb_Flags &= ~CCB_LDPLUT; }
+        cel->ccb_NextPtr = NULL;
+
+        // Stocke l'adresse pour la disposition
+        cels[celIndex] = cel;
+    }
+
+    // Crée le GroupCel à partir de la disposition
+    groupCel = GroupCelLayoutInstantiate((uint8 *)data + header->layoutOffset, header->layoutSize, cels, header->celsCount);
+    // Si c'est un échec
+    if (groupCel == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelLayoutInstantiate()\n");
+        return NULL;
+    }
+
+    // Le groupe possède le bloc : une seule libération au nettoyage
+    groupCel->data = data;
+    groupCel->dataSize = bufferSize;
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
+
+// Indique si une plage d'éléments est dans le paquet
+int32 GroupCelBundleInside(uint32 offset, uint32 count, uint32 itemSize, uint32 dataSize) {
+
+    // Si la plage commence après la fin du paquet
+    if (offset > dataSize) { return 0; }
+
+    // Si les éléments ne tiennent pas dans ce qui reste, comparé par division pour ne jamais déborder
+    if ((itemSize != 0) && (count > (dataSize - offset) / itemSize)) { return 0; }
+
+    // La plage est dans le paquet
+    return 1;
+}
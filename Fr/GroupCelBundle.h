@@ -0,0 +1,156 @@
+#ifndef GROUPCEL_BUNDLE_H
+#define GROUPCEL_BUNDLE_H
+
+/******************************************************************************
+**
+**  GroupCelBundle - Paquet des ressources d'un GroupCel
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Ce module regroupe les CCB, PLUT et pixels de tous les éléments d'un
+**  GroupCel, ainsi que sa disposition, dans un seul fichier.
+**
+**  Le paquet est chargé dans une seule allocation, soit par une seule lecture
+**  séquentielle, soit en flux asynchrone par morceaux. Les CCB sont corrigés
+**  sur place pour pointer dans ce bloc, ainsi le GroupCel et tous ses éléments
+**  sont libérés d'un coup par GroupCelCleanup().
+**
+**  Notes importantes :
+**
+**    - Tous les mots du paquet sont stockés en big-endian, l'ordre natif de
+**      la 3DO. Chaque CCB est stocké sous la forme des 17 mots de la structure
+**      CCB, où ccb_SourcePtr et ccb_PLUTPtr contiennent des décalages depuis
+**      le début du paquet (0 pour aucune PLUT).
+**
+**    - La taille des pixels et de la PLUT de chaque Cel est stockée à côté de
+**      son CCB. Le chargeur vérifie que chaque plage est dans le paquet avant
+**      de corriger les pointeurs, ainsi un fichier corrompu est rejeté au lieu
+**      de faire pointer le moteur de cels en dehors du bloc.
+**
+**    - La disposition est un GroupCelLayout dont les références des cels sont
+**      des index dans la table des CCB du paquet.
+**
+**    - Le paquet réserve un emplacement de 32 bits par cel, rempli par le
+**      chargeur avec l'adresse du CCB. La disposition est créée à partir de
+**      cette table.
+**
+**    - Les éléments appartiennent au paquet : ils ne doivent pas être
+**      déchargés séparément.
+**
+**    - L'outil sur l'hôte écrit le paquet avec GroupCelBundleWrite(), déclarée
+**      dans GroupCelBundleWriter.h. Cet entête a besoin du SDK, celui-là non : ils
+**      ne partagent que GroupCelBundleFormat.h.
+**
+**  Format du fichier :
+**
+**    GroupCelBundleHeader
+**      - magic : 'GCBD'
+**      - version : Version du format
+**      - dataSize : Taille du paquet en octets
+**      - celsCount : Nombre de CCB
+**      - celsOffset : Décalage de la table des CCB
+**      - sizesOffset : Décalage de la table des tailles
+**      - referencesOffset : Décalage de la table des adresses des CCB
+**      - layoutOffset : Décalage du GroupCelLayout
+**      - layoutSize : Taille du GroupCelLayout en octets
+**
+**    CCB[celsCount] - 17 mots chacun
+**    GroupCelBundleSizes[celsCount] - tailles des pixels et de la PLUT en octets
+**    Adresses[celsCount] - emplacements de 32 bits remplis au chargement
+**    GroupCelLayout
+**    PLUT et pixels, alignés sur un mot
+**
+**  Fonctions principales :
+**
+**    GroupCelBundleLoad()
+**      -> Lit un paquet en une seule lecture séquentielle et crée le GroupCel.
+**
+**    GroupCelBundleStreamStart()
+**      -> Démarre la lecture en flux asynchrone d'un paquet par morceaux.
+**
+**    GroupCelBundleStreamContinue()
+**      -> Interroge le flux, lance le morceau suivant et crée le GroupCel à la fin.
+**
+**    GroupCelBundleStreamAbort()
+**      -> Arrête un flux et libère ses ressources.
+**
+**    GroupCelBundleInstantiate()
+**      -> Corrige les CCB d'un paquet en mémoire et crée le GroupCel.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// BlockFile
+#include "blockfile.h"
+// int32
+#include "types.h"
+// GROUPCEL_BUNDLE_MAGIC, GROUPCEL_BUNDLE_VERSION, GROUPCEL_BUNDLE_CCB_SIZE, GROUPCEL_BUNDLE_SIZES_SIZE
+#include "GroupCelBundleFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_BUNDLE 0
+
+typedef struct {
+    // Identifiant du fichier
+    uint32 magic;
+    // Version du format
+    uint32 version;
+    // Taille du paquet en octets
+    uint32 dataSize;
+    // Nombre de CCB
+    uint32 celsCount;
+    // Décalage de la table des CCB
+    uint32 celsOffset;
+    // Décalage de la table des tailles
+    uint32 sizesOffset;
+    // Décalage de la table des adresses des CCB
+    uint32 referencesOffset;
+    // Décalage et taille de la disposition
+    uint32 layoutOffset;
+    uint32 layoutSize;
+} GroupCelBundleHeader;
+
+typedef struct {
+    // Taille des pixels en octets
+    uint32 pixelsSize;
+    // Taille de la PLUT en octets (0 pour aucune PLUT)
+    uint32 plutSize;
+} GroupCelBundleSizes;
+
+typedef struct {
+    // Fichier
+    BlockFile file;
+    // Requête d'E/S
+    Item ioRequest;
+    // Bloc recevant le paquet
+    uint8 *data;
+    // Taille du paquet en octets
+    int32 dataSize;
+    // Taille du bloc, arrondie aux blocs du périphérique
+    int32 bufferSize;
+    // Taille d'un morceau, multiple des blocs du périphérique
+    int32 chunkSize;
+    // Décalage du morceau en cours de lecture
+    int32 offset;
+} GroupCelBundleStream;
+
+// Lit un paquet et crée le GroupCel
+GroupCel *GroupCelBundleLoad(char *filename);
+
+// Démarre la lecture en flux d'un paquet par morceaux (0 = paquet entier en une lecture)
+int32 GroupCelBundleStreamStart(GroupCelBundleStream *stream, char *filename, int32 chunkSize);
+// Interroge le flux (retourne 0 pendant la lecture, 1 une fois le GroupCel créé, -1 en cas d'erreur)
+int32 GroupCelBundleStreamContinue(GroupCelBundleStream *stream, GroupCel **groupCel);
+// Arrête un flux
+void GroupCelBundleStreamAbort(GroupCelBundleStream *stream);
+
+// Corrige les CCB d'un paquet en mémoire et crée le GroupCel
+GroupCel *GroupCelBundleInstantiate(void *data, int32 dataSize, int32 bufferSize);
+// Indique si une plage d'éléments est dans le paquet
+int32 GroupCelBundleInside(uint32 offset, uint32 count, uint32 itemSize, uint32 dataSize);
+
+#endif // GROUPCEL_BUNDLE_H
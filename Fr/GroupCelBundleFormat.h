@@ -0,0 +1,28 @@
+#ifndef GROUPCEL_BUNDLE_FORMAT_H
+#define GROUPCEL_BUNDLE_FORMAT_H
+
+/******************************************************************************
+**
+**  GroupCelBundleFormat - Identifiants et tailles du fichier paquet d'un GroupCel
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Le chargeur (GroupCelBundle.h) et l'écrivain sur l'hôte (GroupCelBundleWriter.h)
+**  incluent tous deux cet entête. Il n'inclut rien, ainsi l'outil sur l'hôte
+**  n'a pas besoin des entêtes du SDK pour s'accorder avec le chargeur.
+**
+******************************************************************************/
+
+// Identifiant du fichier ('GCBD')
+#define GROUPCEL_BUNDLE_MAGIC 0x47434244
+// Version du format
+#define GROUPCEL_BUNDLE_VERSION 2
+// Taille de l'entête dans le paquet (9 mots)
+#define GROUPCEL_BUNDLE_HEADER_SIZE (9 * 4)
+// Taille d'un CCB dans le paquet (17 mots)
+#define GROUPCEL_BUNDLE_CCB_SIZE (17 * 4)
+// Taille des tailles d'un Cel dans le paquet (2 mots)
+#define GROUPCEL_BUNDLE_SIZES_SIZE (2 * 4)
+
+#endif // GROUPCEL_BUNDLE_FORMAT_H
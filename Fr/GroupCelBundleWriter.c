@@ -0,0 +1,279 @@
+
+#include "GroupCelBundleWriter.h"
+
+// fopen(), fread(), fwrite(), printf()
+#include "stdio.h"
+// malloc(), free()
+#include "stdlib.h"
+// memset()
+#include "string.h"
+
+// Morceaux d'un fichier Cel
+#define GROUPCEL_BUNDLE_CHUNK_CCB 0x43434220
+#define GROUPCEL_BUNDLE_CHUNK_PLUT 0x504C5554
+#define GROUPCEL_BUNDLE_CHUNK_PDAT 0x50444154
+
+typedef struct {
+    // Contenu du fichier Cel
+    unsigned char *file;
+    long fileSize;
+    // 17 mots du CCB
+    uint32_t ccb[17];
+    // PLUT dans le fichier
+    unsigned char *plut;
+    uint32_t plutSize;
+    uint32_t plutOffset;
+    // Pixels dans le fichier
+    unsigned char *pixels;
+    uint32_t pixelsSize;
+    uint32_t pixelsOffset;
+} GroupCelBundleSource;
+
+// Lit un mot en big-endian
+static uint32_t GroupCelBundleReadWord(unsigned char *bytes) {
+    return ((uint32_t)bytes[0] << 24) | ((uint32_t)bytes[1] << 16) | ((uint32_t)bytes[2] << 8) | (uint32_t)bytes[3];
+}
+
+// Ecrit un mot en big-endian
+static int32_t GroupCelBundleWriteWord(FILE *file, uint32_t word) {
+
+    // Octets du mot
+    unsigned char bytes[4];
+
+    // Octet de poids fort en premier
+    bytes[0] = (unsigned char)(word >> 24);
+    bytes[1] = (unsigned char)(word >> 16);
+    bytes[2] = (unsigned char)(word >> 8);
+    bytes[3] = (unsigned char)word;
+
+    // Retourne 1 en cas de succès, 0 sinon
+    return (fwrite(bytes, 1, 4, file) == 4) ? 1 : 0;
+}
+
+// Ecrit des octets complétés jusqu'au mot suivant
+static int32_t GroupCelBundleWriteBytes(FILE *file, const unsigned char *bytes, uint32_t size) {
+
+    // Remplissage
+    unsigned char padding[4] = {0};
+
+    // Octets puis remplissage
+    if ((size > 0) && (fwrite(bytes, 1, size, file) != size)) { return 0; }
+    if ((size & 3) && (fwrite(padding, 1, 4 - (size & 3), file) != 4 - (size & 3))) { return 0; }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Lit un fichier Cel et trouve ses morceaux
+static int32_t GroupCelBundleReadCel(char *filename, GroupCelBundleSource *source) {
+
+    // Fichier
+    FILE *file = NULL;
+    // Morceau courant
+    long offset = 0;
+    uint32_t chunkType = 0;
+    uint32_t chunkSize = 0;
+    // Index pour parcourir les mots du CCB
+    uint32_t wordIndex = 0;
+
+    // Ouvre le fichier
+    file = fopen(filename, "rb");
+    // Si c'est un échec
+    if (file == NULL) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Lit le fichier entier
+    fseek(file, 0, SEEK_END);
+    source->fileSize = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    source->file = (unsigned char *)malloc((size_t)source->fileSize);
+    if ((source->file == NULL) || (fread(source->file, 1, (size_t)source->fileSize, file) != (size_t)source->fileSize)) {
+        fclose(file);
+        // Retourne une erreur
+        printf("Error : Failed to read %s.\n", filename);
+        return -1;
+    }
+    fclose(file);
+
+    // Parcourt les morceaux
+    while (offset + 8 <= source->fileSize) {
+
+        chunkType = GroupCelBundleReadWord(source->file + offset);
+        chunkSize = GroupCelBundleReadWord(source->file + offset + 4);
+
+        // Si le morceau est tronqué
+        if ((chunkSize < 8) || (offset + (long)chunkSize > source->fileSize)) {
+            // Retourne une erreur
+            printf("Error : Cel file %s truncated.\n", filename);
+            return -1;
+        }
+
+        switch (chunkType) {
+            // Identifiant, taille, version puis les 17 mots du CCB
+            case GROUPCEL_BUNDLE_CHUNK_CCB:
+                if (chunkSize < 12 + 17 * 4) { break; }
+                for (wordIndex = 0; wordIndex < 17; wordIndex++) {
+                    source->ccb[wordIndex] = GroupCelBundleReadWord(source->file + offset + 12 + wordIndex * 4);
+                }
+                break;
+            // Identifiant, taille, nombre d'entrées puis les entrées
+            case GROUPCEL_BUNDLE_CHUNK_PLUT:
+                if (chunkSize < 12) { break; }
+                source->plut = source->file + offset + 12;
+                source->plutSize = chunkSize - 12;
+                break;
+            // Identifiant, taille puis les pixels
+            case GROUPCEL_BUNDLE_CHUNK_PDAT:
+                source->pixels = source->file + offset + 8;
+                source->pixelsSize = chunkSize - 8;
+                break;
+            // Les autres morceaux sont ignorés
+            default:
+                break;
+        }
+
+        // Morceau suivant
+        offset += (long)chunkSize;
+    }
+
+    // Si le Cel est incomplet
+    if ((source->ccb[15] == 0) || (source->pixels == NULL) || (source->pixelsSize == 0)) {
+        // Retourne une erreur
+        printf("Error : Cel file %s has no CCB or pixels.\n", filename);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Ecrit un paquet (hôte)
+int32_t GroupCelBundleWrite(const char *filename, char **celFilenames, uint32_t celsCount, const void *layout, uint32_t layoutSize) {
+
+    // Cels à empaqueter
+    GroupCelBundleSource *sources = NULL;
+    // Décalages dans le paquet
+    uint32_t celsOffset = 0;
+    uint32_t sizesOffset = 0;
+    uint32_t referencesOffset = 0;
+    uint32_t layoutOffset = 0;
+    uint32_t dataSize = 0;
+    // Index pour parcourir les Cels et les mots
+    uint32_t celIndex = 0;
+    uint32_t wordIndex = 0;
+    // Fichier
+    FILE *file = NULL;
+    // Résultat des écritures
+    int32_t written = 1;
+
+    if (DEBUG_GROUPCEL_BUNDLE_WRITER == 1) { printf("*GroupCelBundleWrite()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((filename == NULL) || (celFilenames == NULL) || (celsCount == 0) || (layout == NULL) || (layoutSize == 0)) {
+        // Retourne une erreur
+        printf("Error : GroupCel bundle unknow.\n");
+        return -1;
+    }
+
+    // Lit tous les Cels
+    sources = (GroupCelBundleSource *)malloc(celsCount * sizeof(GroupCelBundleSource));
+    if (sources == NULL) {
+        // Retourne une erreur
+        printf("Error : Failed to allocate memory for GroupCel bundle.\n");
+        return -1;
+    }
+    memset(sources, 0, celsCount * sizeof(GroupCelBundleSource));
+    for (celIndex = 0; celIndex < celsCount; celIndex++) {
+        if (GroupCelBundleReadCel(celFilenames[celIndex], &sources[celIndex]) < 0) {
+            written = 0;
+            break;
+        }
+    }
+
+    // Place les tables, la disposition puis les données de chaque Cel, alignées sur un mot
+    if (written == 1) {
+        celsOffset = GROUPCEL_BUNDLE_HEADER_SIZE;
+        sizesOffset = celsOffset + celsCount * GROUPCEL_BUNDLE_CCB_SIZE;
+        referencesOffset = sizesOffset + celsCount * GROUPCEL_BUNDLE_SIZES_SIZE;
+        layoutOffset = referencesOffset + celsCount * 4;
+        dataSize = layoutOffset + ((layoutSize + 3) & ~3);
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            sources[celIndex].plutOffset = (sources[celIndex].plutSize != 0) ? dataSize : 0;
+            dataSize += (sources[celIndex].plutSize + 3) & ~3;
+            sources[celIndex].pixelsOffset = dataSize;
+            dataSize += (sources[celIndex].pixelsSize + 3) & ~3;
+        }
+        file = fopen(filename, "wb");
+        if (file == NULL) {
+            printf("Error : Failed to open %s.\n", filename);
+            written = 0;
+        }
+    }
+
+    // Ecrit le paquet
+    if (written == 1) {
+
+        // Entête
+        written &= GroupCelBundleWriteWord(file, GROUPCEL_BUNDLE_MAGIC);
+        written &= GroupCelBundleWriteWord(file, GROUPCEL_BUNDLE_VERSION);
+        written &= GroupCelBundleWriteWord(file, dataSize);
+        written &= GroupCelBundleWriteWord(file, celsCount);
+        written &= GroupCelBundleWriteWord(file, celsOffset);
+        written &= GroupCelBundleWriteWord(file, sizesOffset);
+        written &= GroupCelBundleWriteWord(file, referencesOffset);
+        written &= GroupCelBundleWriteWord(file, layoutOffset);
+        written &= GroupCelBundleWriteWord(file, layoutSize);
+
+        // CCB, les pointeurs de source et de PLUT contiennent des décalages dans le paquet
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            sources[celIndex].ccb[1] = 0;
+            sources[celIndex].ccb[2] = sources[celIndex].pixelsOffset;
+            sources[celIndex].ccb[3] = sources[celIndex].plutOffset;
+            for (wordIndex = 0; wordIndex < 17; wordIndex++) {
+                written &= GroupCelBundleWriteWord(file, sources[celIndex].ccb[wordIndex]);
+            }
+        }
+
+        // Tailles des pixels et de la PLUT, vérifiées par le chargeur
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteWord(file, sources[celIndex].pixelsSize);
+            written &= GroupCelBundleWriteWord(file, sources[celIndex].plutSize);
+        }
+
+        // Emplacements des adresses des CCB
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteWord(file, 0);
+        }
+
+        // Disposition
+        written &= GroupCelBundleWriteBytes(file, (const unsigned char *)layout, layoutSize);
+
+        // PLUT et pixels de chaque Cel
+        for (celIndex = 0; celIndex < celsCount; celIndex++) {
+            written &= GroupCelBundleWriteBytes(file, sources[celIndex].plut, sources[celIndex].plutSize);
+            written &= GroupCelBundleWriteBytes(file, sources[celIndex].pixels, sources[celIndex].pixelsSize);
+        }
+
+        // Ferme le fichier
+        if (fclose(file) != 0) { written = 0; }
+    }
+
+    // Libère les fichiers Cel
+    for (celIndex = 0; celIndex < celsCount; celIndex++) {
+        if (sources[celIndex].file != NULL) { free(sources[celIndex].file); }
+    }
+    free(sources);
+
+    // Si une étape a échoué
+    if (written == 0) {
+        // Retourne une erreur
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
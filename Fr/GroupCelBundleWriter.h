@@ -0,0 +1,34 @@
+#ifndef GROUPCEL_BUNDLE_WRITER_H
+#define GROUPCEL_BUNDLE_WRITER_H
+
+/******************************************************************************
+**
+**  GroupCelBundleWriter - Ecriture des paquets d'un GroupCel (hôte)
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  L'outil sur l'hôte inclut cet entête au lieu de GroupCelBundle.h. Il n'a
+**  besoin que de la bibliothèque C standard : les tailles et les décalages
+**  utilisent ses propres types de taille fixe, et chaque mot est écrit octet
+**  par octet en big-endian, quel que soit l'ordre de l'hôte.
+**
+**  Fonctions principales :
+**
+**    GroupCelBundleWrite()
+**      -> Ecrit un paquet à partir de fichiers Cel et d'un fichier de disposition déjà en mémoire.
+**
+******************************************************************************/
+
+// int32_t, uint32_t
+#include "stdint.h"
+// GROUPCEL_BUNDLE_MAGIC, GROUPCEL_BUNDLE_VERSION, GROUPCEL_BUNDLE_HEADER_SIZE, GROUPCEL_BUNDLE_CCB_SIZE, GROUPCEL_BUNDLE_SIZES_SIZE
+#include "GroupCelBundleFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_BUNDLE_WRITER 0
+
+// Ecrit un paquet
+int32_t GroupCelBundleWrite(const char *filename, char **celFilenames, uint32_t celsCount, const void *layout, uint32_t layoutSize);
+
+#endif // GROUPCEL_BUNDLE_WRITER_H
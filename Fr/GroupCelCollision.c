@@ -0,0 +1,501 @@
+
+#include "GroupCelCollision.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// MulSF16(), Convert32_F16()
+#include "operamath.h"
+// printf()
+#include "stdio.h"
+
+// Initialisation du module
+GroupCelCollision *GroupCelCollisionInitialization(uint32 capacity) {
+
+    // Module
+    GroupCelCollision *collision = NULL;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionInitialization()*\n"); }
+
+    // Corrige les paramètres
+    // Minimum = 2 groupes
+    capacity = (capacity > 2) ? capacity : 2;
+
+    // Alloue la mémoire pour le module
+    collision = (GroupCelCollision *)AllocMem(sizeof(GroupCelCollision), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (collision == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCelCollision.\n");
+        return NULL;
+    }
+
+    // Alloue la mémoire pour les entrées et leur ordre
+    collision->entries = (GroupCelCollisionEntry *)AllocMem(capacity * sizeof(GroupCelCollisionEntry), MEMTYPE_DRAM);
+    collision->order = (uint32 *)AllocMem(capacity * sizeof(uint32), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if ((collision->entries == NULL) || (collision->order == NULL)) {
+        // Libère la mémoire précédemment allouée
+        if (collision->entries != NULL) { FreeMem(collision->entries, capacity * sizeof(GroupCelCollisionEntry)); }
+        if (collision->order != NULL) { FreeMem(collision->order, capacity * sizeof(uint32)); }
+        FreeMem(collision, sizeof(GroupCelCollision));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCelCollision entries.\n");
+        return NULL;
+    }
+    collision->capacity = capacity;
+
+    // Aucun groupe enregistré pour l'instant
+    collision->entriesCount = 0;
+    collision->candidatesCount = 0;
+    collision->hitsCount = 0;
+
+    // Retourne le module créé
+    return collision;
+}
+
+// Enregistre un GroupCel
+int32 GroupCelCollisionAdd(GroupCelCollision *collision, GroupCel *groupCel, uint32 mask) {
+
+    // Entrée du groupe
+    GroupCelCollisionEntry *entry = NULL;
+    // Index pour parcourir les entrées
+    uint32 entryIndex = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionAdd()*\n"); }
+
+    // Si le module ou le groupe est inconnu
+    if ((collision == NULL) || (groupCel == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision or GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Si le groupe est déjà enregistré
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        if (collision->entries[entryIndex].groupCel == groupCel) {
+            // Seul son masque change
+            collision->entries[entryIndex].mask = mask;
+            return 1;
+        }
+    }
+
+    // S'il ne reste aucune entrée
+    if (collision->entriesCount >= collision->capacity) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision full (%u groups).\n", collision->capacity);
+        return -1;
+    }
+
+    // Remplit l'entrée, son quad est pris à la prochaine requête
+    entry = &collision->entries[collision->entriesCount];
+    entry->groupCel = groupCel;
+    entry->mask = mask;
+    entry->epoch = groupCel->epoch + 1;
+
+    // La nouvelle entrée va à la fin de l'ordre, le prochain tri la place
+    collision->order[collision->entriesCount] = collision->entriesCount;
+    collision->entriesCount++;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Retire un GroupCel
+int32 GroupCelCollisionRemove(GroupCelCollision *collision, GroupCel *groupCel) {
+
+    // Index de l'entrée du groupe et de la dernière entrée
+    uint32 removedIndex = 0;
+    uint32 lastIndex = 0;
+    // Index pour parcourir l'ordre
+    uint32 orderIndex = 0;
+    uint32 keptCount = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionRemove()*\n"); }
+
+    // Si le module ou le groupe est inconnu
+    if ((collision == NULL) || (groupCel == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision or GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Cherche l'entrée du groupe
+    for (removedIndex = 0; removedIndex < collision->entriesCount; removedIndex++) {
+        if (collision->entries[removedIndex].groupCel == groupCel) { break; }
+    }
+    // Si le groupe n'est pas enregistré
+    if (removedIndex == collision->entriesCount) {
+        // Retourne une erreur
+        printf("Error : GroupCel not registered in GroupCelCollision.\n");
+        return -1;
+    }
+
+    // La dernière entrée prend sa place
+    lastIndex = collision->entriesCount - 1;
+    collision->entries[removedIndex] = collision->entries[lastIndex];
+    collision->entriesCount--;
+
+    // L'ordre reste trié : l'entrée retirée le quitte et la dernière est renommée
+    for (orderIndex = 0; orderIndex <= lastIndex; orderIndex++) {
+        if (collision->order[orderIndex] == removedIndex) { continue; }
+        collision->order[keptCount] = (collision->order[orderIndex] == lastIndex) ? removedIndex : collision->order[orderIndex];
+        keptCount++;
+    }
+
+    // Retourne un succès
+    return 1;
+}
+
+// Appelle une fonction pour chaque paire de groupes qui se chevauchent
+int32 GroupCelCollisionQuery(GroupCelCollision *collision, GroupCelCollisionHit hit, void *context) {
+
+    // Index pour parcourir les entrées
+    uint32 entryIndex = 0;
+    // Index dans l'ordre du balayage
+    uint32 orderIndex = 0;
+    uint32 nextIndex = 0;
+    // Entrées comparées
+    GroupCelCollisionEntry *entry1 = NULL;
+    GroupCelCollisionEntry *entry2 = NULL;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionQuery()*\n"); }
+
+    // Si le module est inconnu
+    if (collision == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision unknow.\n");
+        return -1;
+    }
+
+    // Reprend les quads des groupes dont le placement a changé
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        entry1 = &collision->entries[entryIndex];
+        if (entry1->epoch == entry1->groupCel->epoch) { continue; }
+        GroupCelCollisionGroupQuad(entry1->groupCel, &entry1->quad);
+        Quad2DBounds(&entry1->quad, &entry1->bounds);
+        entry1->epoch = entry1->groupCel->epoch;
+    }
+
+    // Trie les entrées par le bord gauche de leurs limites, presque triées depuis la dernière requête
+    GroupCelCollisionSort(collision);
+
+    // Balaye les entrées de gauche à droite
+    collision->candidatesCount = 0;
+    collision->hitsCount = 0;
+    for (orderIndex = 0; orderIndex < collision->entriesCount; orderIndex++) {
+        entry1 = &collision->entries[collision->order[orderIndex]];
+        // Seules les entrées suivantes commençant avant le bord droit peuvent la chevaucher
+        for (nextIndex = orderIndex + 1; nextIndex < collision->entriesCount; nextIndex++) {
+            entry2 = &collision->entries[collision->order[nextIndex]];
+            if (entry2->bounds.topLeft.x > entry1->bounds.bottomRight.x) { break; }
+            // Si les groupes ne partagent aucune couche
+            if ((entry1->mask & entry2->mask) == 0) { continue; }
+            // Si les limites ne se chevauchent pas verticalement
+            if ((entry2->bounds.topLeft.y > entry1->bounds.bottomRight.y) || (entry1->bounds.topLeft.y > entry2->bounds.bottomRight.y)) { continue; }
+            collision->candidatesCount++;
+            // Si les quads se chevauchent
+            if (GroupCelCollisionQuads(&entry1->quad, &entry2->quad) == 1) {
+                collision->hitsCount++;
+                if (hit != NULL) { hit(context, entry1->groupCel, entry2->groupCel); }
+            }
+        }
+    }
+
+    // Retourne le nombre de paires qui se chevauchent
+    return (int32)collision->hitsCount;
+}
+
+// Teste deux groupes
+int32 GroupCelCollisionGroups(GroupCel *groupCel1, GroupCel *groupCel2) {
+
+    // Quads des groupes
+    Quad2D quad1;
+    Quad2D quad2;
+
+    // Si un groupe est inconnu
+    if ((groupCel1 == NULL) || (groupCel2 == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    // Teste les quads des groupes
+    GroupCelCollisionGroupQuad(groupCel1, &quad1);
+    GroupCelCollisionGroupQuad(groupCel2, &quad2);
+
+    // Retourne 1 si les groupes se chevauchent, 0 sinon
+    return GroupCelCollisionQuads(&quad1, &quad2);
+}
+
+// Appelle une fonction pour chaque paire d'éléments qui se chevauchent
+int32 GroupCelCollisionElements(GroupCel *groupCel1, GroupCel *groupCel2, GroupCelCollisionElementHit hit, void *context) {
+
+    // Index pour parcourir les CCB des groupes
+    uint32 celIndex1 = 0;
+    uint32 celIndex2 = 0;
+    // Nombre de CCB des groupes
+    uint32 celsCount1 = 0;
+    uint32 celsCount2 = 0;
+    // CCB des deux groupes
+    CCB *cel1 = NULL;
+    CCB *cel2 = NULL;
+    // Quad et limites d'un CCB du premier groupe
+    Quad2D quad1;
+    Rectangle bounds1;
+    // Quad et limites d'un CCB du second groupe
+    Quad2D quad2;
+    Rectangle bounds2;
+    // Nombre de paires qui se chevauchent
+    int32 hitsCount = 0;
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionElements()*\n"); }
+
+    // Si un groupe est inconnu
+    if ((groupCel1 == NULL) || (groupCel2 == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return -1;
+    }
+
+    celsCount1 = GroupCelCollisionCelsCount(groupCel1);
+    celsCount2 = GroupCelCollisionCelsCount(groupCel2);
+
+    // Chaque CCB du premier groupe
+    for (celIndex1 = 0; celIndex1 < celsCount1; celIndex1++) {
+        cel1 = GroupCelCollisionCel(groupCel1, celIndex1);
+        if (cel1 == NULL) { continue; }
+        CelProjectionQuad(cel1, &quad1);
+        Quad2DBounds(&quad1, &bounds1);
+        // Contre chaque CCB du second groupe
+        for (celIndex2 = 0; celIndex2 < celsCount2; celIndex2++) {
+            cel2 = GroupCelCollisionCel(groupCel2, celIndex2);
+            if (cel2 == NULL) { continue; }
+            CelProjectionQuad(cel2, &quad2);
+            Quad2DBounds(&quad2, &bounds2);
+            // Les limites rejettent la plupart des paires avant les axes séparateurs
+            if (RectanglesIntersection(&bounds1, &bounds2) == 0) { continue; }
+            if (GroupCelCollisionQuads(&quad1, &quad2) == 0) { continue; }
+            hitsCount++;
+            if (hit != NULL) { hit(context, (groupCel1->flat != NULL) ? GROUPCEL_COLLISION_FLAT : (int32)celIndex1, (groupCel2->flat != NULL) ? GROUPCEL_COLLISION_FLAT : (int32)celIndex2); }
+        }
+    }
+
+    // Retourne le nombre de paires qui se chevauchent
+    return hitsCount;
+}
+
+// Affiche les paires testées et trouvées par la dernière requête
+int32 GroupCelCollisionReport(GroupCelCollision *collision) {
+
+    // Index pour parcourir les entrées
+    uint32 entryIndex = 0;
+    // Entrée affichée
+    GroupCelCollisionEntry *entry = NULL;
+    // Nombre de paires de groupes
+    uint32 pairsCount = 0;
+
+    // Si le module est inconnu
+    if (collision == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision unknow.\n");
+        return -1;
+    }
+
+    // Affiche les totaux
+    pairsCount = (collision->entriesCount * (collision->entriesCount - 1)) / 2;
+    if (collision->entriesCount == 0) { pairsCount = 0; }
+    printf("GroupCelCollision : %u groups, %u pairs, %u kept by the sweep, %u overlapping\n", collision->entriesCount, pairsCount, collision->candidatesCount, collision->hitsCount);
+
+    // Affiche les groupes dans l'ordre du balayage
+    for (entryIndex = 0; entryIndex < collision->entriesCount; entryIndex++) {
+        entry = &collision->entries[collision->order[entryIndex]];
+        printf("  %u mask %08x : %d,%d -> %d,%d\n", collision->order[entryIndex], entry->mask, entry->bounds.topLeft.x >> 16, entry->bounds.topLeft.y >> 16, entry->bounds.bottomRight.x >> 16, entry->bounds.bottomRight.y >> 16);
+    }
+
+    // Retourne le nombre de paires qui se chevauchent
+    return (int32)collision->hitsCount;
+}
+
+// Supprime le module
+int32 GroupCelCollisionCleanup(GroupCelCollision *collision) {
+
+    if (DEBUG_GROUPCEL_COLLISION == 1) { printf("*GroupCelCollisionCleanup()*\n"); }
+
+    // Si le module est inconnu
+    if (collision == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelCollision unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée pour les entrées, leur ordre et le module
+    FreeMem(collision->entries, collision->capacity * sizeof(GroupCelCollisionEntry));
+    FreeMem(collision->order, collision->capacity * sizeof(uint32));
+    FreeMem(collision, sizeof(GroupCelCollision));
+
+    // Retourne un succès
+    return 1;
+}
+
+// Quad contenant les éléments d'un groupe, à l'écran en 16.16
+void GroupCelCollisionGroupQuad(GroupCel *groupCel, Quad2D *quad) {
+
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Rectangle contenant les éléments dans le groupe, en 16.16
+    frac16 left = 0;
+    frac16 top = 0;
+    frac16 right = 0;
+    frac16 bottom = 0;
+    // Coins d'un élément en 16.16
+    frac16 elementLeft = 0;
+    frac16 elementTop = 0;
+    // Nombre d'éléments contenus
+    uint32 heldCount = 0;
+    // Transformation du groupe
+    GroupCelTransform transform;
+
+    // Si c'est une grille
+    if (groupCel->cels == NULL) {
+        // Les tuiles couvrent la grille
+        right = Convert32_F16(groupCel->gridColumns * groupCel->tileSize.x);
+        bottom = Convert32_F16(groupCel->gridRows * groupCel->tileSize.y);
+    } else {
+        // Chaque élément configuré, au cadre de sa pleine résolution
+        for (celIndex = 0; celIndex < groupCel->celsCount; celIndex++) {
+            if (groupCel->cels[celIndex].cel == NULL) { continue; }
+            elementLeft = GROUPCEL_ELEMENT_X16(&groupCel->cels[celIndex]);
+            elementTop = GROUPCEL_ELEMENT_Y16(&groupCel->cels[celIndex]);
+            if ((heldCount == 0) || (elementLeft < left)) { left = elementLeft; }
+            if ((heldCount == 0) || (elementTop < top)) { top = elementTop; }
+            elementLeft += Convert32_F16(GROUPCEL_ELEMENT_FRAME_WIDTH(groupCel, celIndex));
+            elementTop += Convert32_F16(GROUPCEL_ELEMENT_FRAME_HEIGHT(groupCel, celIndex));
+            if ((heldCount == 0) || (elementLeft > right)) { right = elementLeft; }
+            if ((heldCount == 0) || (elementTop > bottom)) { bottom = elementTop; }
+            heldCount++;
+        }
+    }
+
+    // Transforme les 4 coins comme la mise à jour, les éléments restent dans leur quad
+    GroupCelTransformPreparation(groupCel, GroupCelIsStretched(groupCel), (groupCel->rotationAngle16 != 0) ? 1 : 0, &transform);
+    GroupCelTransformPoint(&transform, left, top, &quad->topLeft);
+    GroupCelTransformPoint(&transform, right, top, &quad->topRight);
+    GroupCelTransformPoint(&transform, right, bottom, &quad->bottomRight);
+    GroupCelTransformPoint(&transform, left, bottom, &quad->bottomLeft);
+
+    // Place le quad dans la vue de la caméra
+    GroupCelCameraPoint(groupCel, &quad->topLeft);
+    GroupCelCameraPoint(groupCel, &quad->topRight);
+    GroupCelCameraPoint(groupCel, &quad->bottomRight);
+    GroupCelCameraPoint(groupCel, &quad->bottomLeft);
+}
+
+// Trie les entrées par le bord gauche de leurs limites
+void GroupCelCollisionSort(GroupCelCollision *collision) {
+
+    // Index pour parcourir l'ordre
+    uint32 orderIndex = 0;
+    uint32 searchIndex = 0;
+    // Entrée déplacée
+    uint32 entryIndex = 0;
+
+    // Tri par insertion : chaque entrée ne dépasse que celles qui l'ont croisée depuis la dernière requête
+    for (orderIndex = 1; orderIndex < collision->entriesCount; orderIndex++) {
+        entryIndex = collision->order[orderIndex];
+        searchIndex = orderIndex;
+        while ((searchIndex > 0) && (collision->entries[collision->order[searchIndex - 1]].bounds.topLeft.x > collision->entries[entryIndex].bounds.topLeft.x)) {
+            collision->order[searchIndex] = collision->order[searchIndex - 1];
+            searchIndex--;
+        }
+        collision->order[searchIndex] = entryIndex;
+    }
+}
+
+// Indique si deux quads se chevauchent
+int32 GroupCelCollisionQuads(Quad2D *quad1, Quad2D *quad2) {
+
+    // Les quads se chevauchent si aucun bord de l'un ou de l'autre ne les sépare
+    if (GroupCelCollisionSeparated(quad1, quad2) == 1) { return 0; }
+    if (GroupCelCollisionSeparated(quad2, quad1) == 1) { return 0; }
+
+    // Retourne 1 si les quads se chevauchent
+    return 1;
+}
+
+// Indique si un bord du premier quad sépare les deux quads
+int32 GroupCelCollisionSeparated(Quad2D *quad1, Quad2D *quad2) {
+
+    // Coins des quads
+    Point2D *corners1[4];
+    Point2D *corners2[4];
+    // Index pour parcourir les bords et les coins
+    int32 edgeIndex = 0;
+    int32 cornerIndex = 0;
+    // Normale au bord en 16.16
+    frac16 axisX = 0;
+    frac16 axisY = 0;
+    // Projections des quads sur la normale
+    frac16 projection = 0;
+    frac16 minimum1 = 0;
+    frac16 maximum1 = 0;
+    frac16 minimum2 = 0;
+    frac16 maximum2 = 0;
+
+    corners1[0] = &quad1->topLeft;
+    corners1[1] = &quad1->topRight;
+    corners1[2] = &quad1->bottomRight;
+    corners1[3] = &quad1->bottomLeft;
+    corners2[0] = &quad2->topLeft;
+    corners2[1] = &quad2->topRight;
+    corners2[2] = &quad2->bottomRight;
+    corners2[3] = &quad2->bottomLeft;
+
+    // Chaque bord du premier quad
+    for (edgeIndex = 0; edgeIndex < 4; edgeIndex++) {
+
+        // Normale au bord
+        axisX = corners1[(edgeIndex + 1) & 3]->y - corners1[edgeIndex]->y;
+        axisY = corners1[edgeIndex]->x - corners1[(edgeIndex + 1) & 3]->x;
+        // Si le bord est un point
+        if ((axisX == 0) && (axisY == 0)) { continue; }
+        // Réduit la normale à 1.0 au plus, pour que les produits restent sur 32 bits
+        while ((axisX > (1 << 16)) || (axisX < -(1 << 16)) || (axisY > (1 << 16)) || (axisY < -(1 << 16))) {
+            axisX >>= 1;
+            axisY >>= 1;
+        }
+
+        // Projette les coins par rapport au premier, pour garder des valeurs petites
+        for (cornerIndex = 0; cornerIndex < 4; cornerIndex++) {
+            projection = MulSF16(corners1[cornerIndex]->x - corners1[0]->x, axisX) + MulSF16(corners1[cornerIndex]->y - corners1[0]->y, axisY);
+            if ((cornerIndex == 0) || (projection < minimum1)) { minimum1 = projection; }
+            if ((cornerIndex == 0) || (projection > maximum1)) { maximum1 = projection; }
+            projection = MulSF16(corners2[cornerIndex]->x - corners1[0]->x, axisX) + MulSF16(corners2[cornerIndex]->y - corners1[0]->y, axisY);
+            if ((cornerIndex == 0) || (projection < minimum2)) { minimum2 = projection; }
+            if ((cornerIndex == 0) || (projection > maximum2)) { maximum2 = projection; }
+        }
+
+        // Si les projections ne se chevauchent pas, le bord sépare les quads
+        if ((maximum1 < minimum2) || (maximum2 < minimum1)) { return 1; }
+    }
+
+    // Retourne 0 si aucun bord ne sépare les quads
+    return 0;
+}
+
+// Nombre de CCB d'un groupe
+uint32 GroupCelCollisionCelsCount(GroupCel *groupCel) {
+
+    // Un groupe aplati est projeté comme un seul CCB
+    if (groupCel->flat != NULL) { return 1; }
+    // Une grille a un CCB par tuile, une liste un par élément
+    return (groupCel->cels == NULL) ? groupCel->gridColumns * groupCel->gridRows : groupCel->celsCount;
+}
+
+// CCB d'un index d'un groupe (NULL quand il n'y en a pas)
+CCB *GroupCelCollisionCel(GroupCel *groupCel, uint32 celIndex) {
+
+    // Un groupe aplati est projeté comme un seul CCB
+    if (groupCel->flat != NULL) { return &groupCel->flat->cel; }
+    // Une tuile d'une grille ou un élément d'une liste
+    return (groupCel->cels == NULL) ? groupCel->tiles[celIndex] : groupCel->cels[celIndex].cel;
+}
@@ -0,0 +1,154 @@
+#ifndef GROUPCEL_COLLISION_H
+#define GROUPCEL_COLLISION_H
+
+/******************************************************************************
+**
+**  GroupCelCollision - Chevauchements entre GroupCels transformés
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Tester des groupes tournés ou étirés avec RectanglesIntersection() sur
+**  leurs limites alignées sur les axes signale des chevauchements là où leurs
+**  coins ne font que s'approcher. Ce module garde, pour chaque groupe
+**  enregistré, le quad que sa transformation donne au rectangle contenant ses
+**  éléments, et teste les quads selon les axes séparateurs de leurs bords.
+**
+**  Une requête trie d'abord les groupes par le bord gauche de leurs limites,
+**  déjà presque triés depuis l'image précédente, puis les balaye : seules les
+**  paires dont les limites se chevauchent sur les deux axes atteignent le test
+**  des axes séparateurs (sweep and prune). Les éléments de deux groupes en
+**  collision peuvent ensuite être testés paire par paire avec les quads de
+**  leurs CCB.
+**
+**  Notes importantes :
+**
+**    - Le quad d'un groupe n'est repris que quand son époque a changé, avec la
+**      transformation et la caméra qu'utilise la mise à jour. Les quads des
+**      éléments viennent de leurs CCB (CelProjectionQuad()), les groupes
+**      doivent donc être mis à jour avant une requête.
+**
+**    - Un quad étiré peut être courbé par son terme bilinéaire : il est testé
+**      comme le polygone de ses 4 coins, qui le contient. Un quad concave peut
+**      signaler un chevauchement près de son creux, jamais en manquer un.
+**
+**    - Seules les paires dont les masques partagent un bit sont testées. Les
+**      coordonnées sont en 16.16 à l'écran : deux groupes couvrant ensemble
+**      plus de 16384 pixels sont hors de portée du test.
+**
+**    - Les entrées sont prises dans un bloc alloué une seule fois avec le
+**      module, le nombre de groupes est donc limité par sa capacité.
+**
+**  Rôle des structures :
+**
+**    GroupCelCollisionEntry
+**      - groupCel : Groupe testé
+**      - mask : Couches de collision du groupe, les paires partageant un bit sont testées
+**      - quad : Quad transformé contenant les éléments, à l'écran en 16.16
+**      - bounds : Limites du quad
+**      - epoch : Epoque du groupe quand le quad a été pris
+**
+**    GroupCelCollision
+**      - entries, entriesCount, capacity : Groupes enregistrés
+**      - order : Entrées triées par le bord gauche de leurs limites
+**      - candidatesCount : Paires gardées par le balayage pendant la dernière requête
+**      - hitsCount : Paires trouvées en chevauchement pendant la dernière requête
+**
+**  Fonctions principales :
+**
+**    GroupCelCollisionInitialization()
+**      -> Crée le module pour un nombre maximal de groupes.
+**
+**    GroupCelCollisionAdd() / GroupCelCollisionRemove()
+**      -> Enregistre un GroupCel avec son masque, et le retire.
+**
+**    GroupCelCollisionQuery()
+**      -> Appelle une fonction pour chaque paire de groupes enregistrés qui se chevauchent.
+**
+**    GroupCelCollisionGroups()
+**      -> Teste deux groupes, enregistrés ou non.
+**
+**    GroupCelCollisionElements()
+**      -> Appelle une fonction pour chaque paire d'éléments de deux groupes qui se chevauchent.
+**
+**    GroupCelCollisionReport()
+**      -> Affiche les paires testées et trouvées par la dernière requête.
+**
+**    GroupCelCollisionCleanup()
+**      -> Libère la mémoire utilisée par le module.
+**
+******************************************************************************/
+
+// GroupCel
+#include "GroupCel.h"
+// Quad2D, Rectangle
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_COLLISION 0
+
+// Index donné au CCB aplati d'un groupe par GroupCelCollisionElements()
+#define GROUPCEL_COLLISION_FLAT (-1)
+
+// Fonction appelée pour chaque paire de groupes qui se chevauchent
+typedef void (*GroupCelCollisionHit)(void *context, GroupCel *groupCel1, GroupCel *groupCel2);
+// Fonction appelée pour chaque paire d'éléments qui se chevauchent
+typedef void (*GroupCelCollisionElementHit)(void *context, int32 celIndex1, int32 celIndex2);
+
+typedef struct {
+    // Groupe testé
+    GroupCel *groupCel;
+    // Couches de collision du groupe, les paires partageant un bit sont testées
+    uint32 mask;
+    // Quad transformé contenant les éléments, à l'écran en 16.16
+    Quad2D quad;
+    // Limites du quad
+    Rectangle bounds;
+    // Epoque du groupe quand le quad a été pris
+    uint32 epoch;
+} GroupCelCollisionEntry;
+
+typedef struct {
+    // Groupes enregistrés
+    GroupCelCollisionEntry *entries;
+    uint32 entriesCount;
+    uint32 capacity;
+    // Entrées triées par le bord gauche de leurs limites
+    uint32 *order;
+    // Paires gardées par le balayage et trouvées en chevauchement pendant la dernière requête
+    uint32 candidatesCount;
+    uint32 hitsCount;
+} GroupCelCollision;
+
+// Initialisation du module
+GroupCelCollision *GroupCelCollisionInitialization(uint32 capacity);
+// Enregistre un GroupCel
+int32 GroupCelCollisionAdd(GroupCelCollision *collision, GroupCel *groupCel, uint32 mask);
+// Retire un GroupCel
+int32 GroupCelCollisionRemove(GroupCelCollision *collision, GroupCel *groupCel);
+// Appelle une fonction pour chaque paire de groupes qui se chevauchent
+int32 GroupCelCollisionQuery(GroupCelCollision *collision, GroupCelCollisionHit hit, void *context);
+// Teste deux groupes
+int32 GroupCelCollisionGroups(GroupCel *groupCel1, GroupCel *groupCel2);
+// Appelle une fonction pour chaque paire d'éléments qui se chevauchent
+int32 GroupCelCollisionElements(GroupCel *groupCel1, GroupCel *groupCel2, GroupCelCollisionElementHit hit, void *context);
+// Affiche la dernière requête
+int32 GroupCelCollisionReport(GroupCelCollision *collision);
+// Supprime le module
+int32 GroupCelCollisionCleanup(GroupCelCollision *collision);
+
+// Quad contenant les éléments d'un groupe, à l'écran en 16.16
+void GroupCelCollisionGroupQuad(GroupCel *groupCel, Quad2D *quad);
+// Trie les entrées par le bord gauche de leurs limites
+void GroupCelCollisionSort(GroupCelCollision *collision);
+// Indique si deux quads se chevauchent
+int32 GroupCelCollisionQuads(Quad2D *quad1, Quad2D *quad2);
+// Indique si un bord du premier quad sépare les deux quads
+int32 GroupCelCollisionSeparated(Quad2D *quad1, Quad2D *quad2);
+// Nombre de CCB d'un groupe et CCB d'un index
+uint32 GroupCelCollisionCelsCount(GroupCel *groupCel);
+CCB *GroupCelCollisionCel(GroupCel *groupCel, uint32 celIndex);
+
+#endif // GROUPCEL_COLLISION_H
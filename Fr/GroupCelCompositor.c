@@ -0,0 +1,259 @@
+
+#include "GroupCelCompositor.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// memset()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialisation d'un compositeur
+GroupCelCompositor *GroupCelCompositorInitialization(uint32 layersCount, uint32 capacity) {
+
+    // Compositeur
+    GroupCelCompositor *compositor = NULL;
+    // Index pour parcourir les couches et les entrées
+    uint32 index = 0;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorInitialization()*\n"); }
+
+    // Corrige les paramètres
+    // Minimum = 1 couche et 1 entrée
+    layersCount = (layersCount > 1) ? layersCount : 1;
+    capacity = (capacity > 1) ? capacity : 1;
+
+    // Alloue la mémoire pour le compositeur
+    compositor = (GroupCelCompositor *)AllocMem(sizeof(GroupCelCompositor), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (compositor == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel compositor.\n");
+        return NULL;
+    }
+
+    // Alloue la mémoire pour les couches et les entrées, leurs ancres sont lues par le Cel Engine
+    compositor->layers = (GroupCelCompositorLayer *)AllocMem(layersCount * sizeof(GroupCelCompositorLayer), MEMTYPE_DRAM);
+    compositor->entries = (GroupCelCompositorEntry *)AllocMem(capacity * sizeof(GroupCelCompositorEntry), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if ((compositor->layers == NULL) || (compositor->entries == NULL)) {
+        // Libère la mémoire précédemment allouée
+        if (compositor->layers != NULL) { FreeMem(compositor->layers, layersCount * sizeof(GroupCelCompositorLayer)); }
+        if (compositor->entries != NULL) { FreeMem(compositor->entries, capacity * sizeof(GroupCelCompositorEntry)); }
+        FreeMem(compositor, sizeof(GroupCelCompositor));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel compositor layers.\n");
+        return NULL;
+    }
+
+    // Couches vides
+    memset(compositor->layers, 0, (size_t)layersCount * sizeof(GroupCelCompositorLayer));
+    compositor->layersCount = layersCount;
+
+    // Pour chaque couche
+    for (index = 0; index < layersCount; index++) {
+        // CCB vide ignoré par le Cel Engine, son pointeur suivant est absolu
+        compositor->layers[index].anchor.ccb_Flags = CCB_SKIP | CCB_NPABS;
+        // Indique au Cel Engine que la couche suivante suit
+        if (index > 0) { LinkCel(&compositor->layers[index - 1].anchor, &compositor->layers[index].anchor); }
+    }
+    // La dernière couche termine la liste
+    GroupCelChainLink(&compositor->layers[layersCount - 1].anchor, NULL);
+    // La liste commence par la première couche
+    compositor->head = &compositor->layers[0].anchor;
+
+    // Chaîne toutes les entrées dans la liste libre
+    memset(compositor->entries, 0, (size_t)capacity * sizeof(GroupCelCompositorEntry));
+    for (index = 0; index < capacity - 1; index++) {
+        compositor->entries[index].next = &compositor->entries[index + 1];
+    }
+    compositor->entries[capacity - 1].next = NULL;
+    compositor->capacity = capacity;
+    compositor->freeList = &compositor->entries[0];
+    compositor->freeCount = capacity;
+
+    // Retourne le compositeur créé
+    return compositor;
+}
+
+// Lie un GroupCel au-dessus d'une couche
+GroupCelCompositorEntry *GroupCelCompositorAdd(GroupCelCompositor *compositor, uint32 layer, GroupCel *groupCel) {
+
+    // Entrée du groupe
+    GroupCelCompositorEntry *entry = NULL;
+    // Couche du groupe
+    GroupCelCompositorLayer *compositorLayer = NULL;
+    // Dernier CCB de la couche
+    CCB *previous = NULL;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorAdd()*\n"); }
+
+    // Si le compositeur est inconnu
+    if (compositor == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel compositor unknow.\n");
+        return NULL;
+    }
+
+    // Si le groupe est inconnu
+    if (groupCel == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel unknow.\n");
+        return NULL;
+    }
+
+    // Si la couche n'existe pas
+    if (layer >= compositor->layersCount) {
+        // Retourne une erreur
+        printf("Error : GroupCel compositor layer %u out of %u layers.\n", layer, compositor->layersCount);
+        return NULL;
+    }
+
+    // S'il n'y a pas d'entrée libre
+    if (compositor->freeList == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCel compositor full (%u entries).\n", compositor->capacity);
+        return NULL;
+    }
+
+    // Prend la première entrée libre
+    entry = compositor->freeList;
+    compositorLayer = &compositor->layers[layer];
+
+    // CCB vide ignoré par le Cel Engine, son pointeur suivant est absolu
+    memset(&entry->anchor, 0, sizeof(CCB));
+    entry->anchor.ccb_Flags = CCB_SKIP | CCB_NPABS;
+
+    // L'ancre va après le dernier CCB de la couche
+    previous = (compositorLayer->last != NULL) ? GroupCelCompositorEntryEnd(compositorLayer->last) : &compositorLayer->anchor;
+    GroupCelChainLink(&entry->anchor, GroupCelChainNext(previous));
+    LinkCel(previous, &entry->anchor);
+
+    // Le groupe va après son ancre
+    if (GroupCelLinkAfter(groupCel, &entry->anchor) < 0) {
+        // Retire de nouveau l'ancre
+        GroupCelChainLink(previous, GroupCelChainNext(&entry->anchor));
+        // Retourne une erreur
+        printf("Error <- GroupCelLinkAfter()\n");
+        return NULL;
+    }
+
+    // L'entrée est utilisée
+    compositor->freeList = entry->next;
+    compositor->freeCount--;
+
+    // Ajoute l'entrée au-dessus de la couche
+    entry->groupCel = groupCel;
+    entry->layer = layer;
+    entry->previous = compositorLayer->last;
+    entry->next = NULL;
+    if (compositorLayer->last == NULL) { compositorLayer->first = entry; } else { compositorLayer->last->next = entry; }
+    compositorLayer->last = entry;
+
+    // Retourne l'entrée du groupe
+    return entry;
+}
+
+// Retire le GroupCel d'une entrée de la liste d'affichage
+int32 GroupCelCompositorRemove(GroupCelCompositor *compositor, GroupCelCompositorEntry *entry) {
+
+    // Couche du groupe
+    GroupCelCompositorLayer *compositorLayer = NULL;
+    // CCB projeté avant l'ancre
+    CCB *previous = NULL;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorRemove()*\n"); }
+
+    // Si le compositeur est inconnu
+    if (compositor == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel compositor unknow.\n");
+        return -1;
+    }
+
+    // Si l'entrée n'est pas utilisée par un groupe
+    if ((entry == NULL) || (entry->groupCel == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel compositor entry unknow.\n");
+        return -1;
+    }
+
+    compositorLayer = &compositor->layers[entry->layer];
+
+    // Retire le groupe après son ancre
+    if (GroupCelUnlink(entry->groupCel) < 0) {
+        // Retourne une erreur
+        printf("Error <- GroupCelUnlink()\n");
+        return -1;
+    }
+
+    // Le CCB avant l'ancre passe directement à celui qui la suit
+    previous = (entry->previous != NULL) ? GroupCelCompositorEntryEnd(entry->previous) : &compositorLayer->anchor;
+    GroupCelChainLink(previous, GroupCelChainNext(&entry->anchor));
+
+    // Joint les voisins dans la couche
+    if (entry->previous == NULL) { compositorLayer->first = entry->next; } else { entry->previous->next = entry->next; }
+    if (entry->next == NULL) { compositorLayer->last = entry->previous; } else { entry->next->previous = entry->previous; }
+
+    // Rend l'entrée
+    entry->groupCel = NULL;
+    entry->previous = NULL;
+    entry->next = compositor->freeList;
+    compositor->freeList = entry;
+    compositor->freeCount++;
+
+    // Retourne un succès
+    return 1;
+}
+
+// Projette toutes les couches
+int32 GroupCelCompositorDraw(GroupCelCompositor *compositor, Item bitmapItem) {
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorDraw()*\n"); }
+
+    // Si le compositeur est inconnu
+    if (compositor == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel compositor unknow.\n");
+        return -1;
+    }
+
+    // Un seul appel pour toute la liste
+    return DrawCels(bitmapItem, compositor->head);
+}
+
+// Dernier CCB d'une entrée dans la liste d'affichage
+CCB *GroupCelCompositorEntryEnd(GroupCelCompositorEntry *entry) {
+
+    // Un groupe caché ne laisse que son ancre dans la liste
+    return (entry->groupCel->visible == 1) ? GroupCelChainLast(entry->groupCel) : &entry->anchor;
+}
+
+// Supprime le compositeur
+int32 GroupCelCompositorCleanup(GroupCelCompositor *compositor) {
+
+    // Index pour parcourir les entrées
+    uint32 index = 0;
+
+    if (DEBUG_GROUPCEL_COMPOSITOR == 1) { printf("*GroupCelCompositorCleanup()*\n"); }
+
+    // Si le compositeur est inconnu
+    if (compositor == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel compositor unknow.\n");
+        return -1;
+    }
+
+    // Retire de la liste les groupes encore liés, ils restent utilisables
+    for (index = 0; index < compositor->capacity; index++) {
+        if (compositor->entries[index].groupCel != NULL) { GroupCelUnlink(compositor->entries[index].groupCel); }
+    }
+
+    // Libère la mémoire utilisée par les couches, les entrées et le compositeur
+    FreeMem(compositor->layers, compositor->layersCount * sizeof(GroupCelCompositorLayer));
+    FreeMem(compositor->entries, compositor->capacity * sizeof(GroupCelCompositorEntry));
+    FreeMem(compositor, sizeof(GroupCelCompositor));
+
+    // Retourne un succès
+    return 1;
+}
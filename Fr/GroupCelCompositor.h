@@ -0,0 +1,139 @@
+#ifndef GROUPCEL_COMPOSITOR_H
+#define GROUPCEL_COMPOSITOR_H
+
+/******************************************************************************
+**
+**  GroupCelCompositor - Couches de GroupCel liées en une seule liste d'affichage
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Ce module garde de nombreux GroupCel dans des couches ordonnées (fond, monde,
+**  HUD...) et lie toutes leurs chaînes en une liste continue de CCB. Toute la
+**  scène est projetée par un seul appel à DrawCels() depuis la tête de la liste.
+**
+**  Chaque couche commence par un CCB vide, et chaque groupe est précédé d'un
+**  autre : ces ancres sont ignorées par le Cel Engine et ne bougent jamais.
+**  Ajouter ou retirer un groupe ne relie que les CCB autour de sa place, quel
+**  que soit le nombre de couches et de groupes.
+**
+**  Notes importantes :
+**
+**    - Un groupe est ajouté au-dessus de sa couche : il est projeté après les
+**      groupes déjà présents dans la couche et avant la couche suivante.
+**
+**    - Un groupe du compositeur peut toujours être caché et affiché avec
+**      GroupCelSetVisible() et réordonné avec son ordre de projection : son ancre
+**      garde sa place dans la liste. Il ne doit pas être retiré ni lié ailleurs
+**      tant qu'il est dans le compositeur, et doit en être retiré avant d'être supprimé.
+**
+**    - Les entrées sont prises dans un bloc alloué une seule fois avec le
+**      compositeur, le nombre de groupes est donc limité par sa capacité.
+**
+**  Rôle des structures :
+**
+**    GroupCelCompositorEntry
+**      - anchor : CCB vide devant le groupe, ignoré par le Cel Engine
+**      - groupCel : Groupe projeté après l'ancre
+**      - layer : Couche du groupe
+**      - previous, next : Entrées projetées avant et après dans la couche (next chaîne les entrées libres)
+**
+**    GroupCelCompositorLayer
+**      - anchor : CCB vide commençant la couche, ignoré par le Cel Engine
+**      - first, last : Première et dernière entrées de la couche
+**
+**    GroupCelCompositor
+**      - layers : Tableau des couches, projetées dans l'ordre
+**      - layersCount : Nombre de couches
+**      - entries : Bloc d'entrées
+**      - capacity : Nombre total d'entrées
+**      - freeList : Première entrée libre
+**      - freeCount : Nombre d'entrées libres
+**      - head : Premier CCB de la liste d'affichage, donné à DrawCels()
+**
+**  Fonctions principales :
+**
+**    GroupCelCompositorInitialization()
+**      -> Crée le compositeur avec ses couches et un bloc d'entrées.
+**
+**    GroupCelCompositorAdd()
+**      -> Lie un GroupCel au-dessus d'une couche en O(1) et retourne son entrée.
+**
+**    GroupCelCompositorRemove()
+**      -> Retire le GroupCel d'une entrée de la liste d'affichage en O(1).
+**
+**    GroupCelCompositorDraw()
+**      -> Projette toutes les couches avec un seul appel à DrawCels().
+**
+**    GroupCelCompositorEntryEnd()
+**      -> Fonction interne donnant le dernier CCB d'une entrée dans la liste d'affichage.
+**
+**    GroupCelCompositorCleanup()
+**      -> Libère la mémoire utilisée par le compositeur.
+**
+******************************************************************************/
+
+// CCB, DrawCels()
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_COMPOSITOR 0
+
+typedef struct GroupCelCompositorEntry {
+    // CCB vide devant le groupe, ignoré par le Cel Engine
+    CCB anchor;
+    // Groupe projeté après l'ancre
+    GroupCel *groupCel;
+    // Couche du groupe
+    uint32 layer;
+    // Entrées projetées avant et après dans la couche (next chaîne les entrées libres)
+    struct GroupCelCompositorEntry *previous;
+    struct GroupCelCompositorEntry *next;
+} GroupCelCompositorEntry;
+
+typedef struct {
+    // CCB vide commençant la couche, ignoré par le Cel Engine
+    CCB anchor;
+    // Première et dernière entrées de la couche
+    GroupCelCompositorEntry *first;
+    GroupCelCompositorEntry *last;
+} GroupCelCompositorLayer;
+
+typedef struct {
+    // Tableau des couches, projetées dans l'ordre
+    GroupCelCompositorLayer *layers;
+    // Nombre de couches
+    uint32 layersCount;
+    // Bloc d'entrées
+    GroupCelCompositorEntry *entries;
+    // Nombre total d'entrées
+    uint32 capacity;
+    // Première entrée libre (chaînée par next)
+    GroupCelCompositorEntry *freeList;
+    // Nombre d'entrées libres
+    uint32 freeCount;
+    // Premier CCB de la liste d'affichage, donné à DrawCels()
+    CCB *head;
+} GroupCelCompositor;
+
+// Initialisation d'un compositeur
+GroupCelCompositor *GroupCelCompositorInitialization(uint32 layersCount, uint32 capacity);
+
+// Lie un GroupCel au-dessus d'une couche
+GroupCelCompositorEntry *GroupCelCompositorAdd(GroupCelCompositor *compositor, uint32 layer, GroupCel *groupCel);
+// Retire le GroupCel d'une entrée de la liste d'affichage
+int32 GroupCelCompositorRemove(GroupCelCompositor *compositor, GroupCelCompositorEntry *entry);
+// Projette toutes les couches
+int32 GroupCelCompositorDraw(GroupCelCompositor *compositor, Item bitmapItem);
+
+// Dernier CCB d'une entrée dans la liste d'affichage
+CCB *GroupCelCompositorEntryEnd(GroupCelCompositorEntry *entry);
+
+// Supprime le compositeur
+int32 GroupCelCompositorCleanup(GroupCelCompositor *compositor);
+
+#endif // GROUPCEL_COMPOSITOR_H
@@ -0,0 +1,304 @@
+
+#include "GroupCelDirty.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// printf()
+#include "stdio.h"
+
+// Initialisation d'un accumulateur
+GroupCelDirty *GroupCelDirtyInitialization(int32 width, int32 height, uint32 regionsCapacity) {
+
+    // Accumulateur
+    GroupCelDirty *dirty = NULL;
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyInitialization()*\n"); }
+
+    // Si l'écran est vide
+    if ((width <= 0) || (height <= 0)) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty screen %d x %d is empty.\n", width, height);
+        return NULL;
+    }
+
+    // Corrige les paramètres
+    // Minimum = 1 région
+    regionsCapacity = (regionsCapacity > 1) ? regionsCapacity : 1;
+
+    // Alloue la mémoire pour l'accumulateur
+    dirty = (GroupCelDirty *)AllocMem(sizeof(GroupCelDirty), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (dirty == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCelDirty.\n");
+        return NULL;
+    }
+
+    // Alloue la mémoire pour les régions
+    dirty->regions = (Rectangle *)AllocMem(regionsCapacity * sizeof(Rectangle), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (dirty->regions == NULL) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(dirty, sizeof(GroupCelDirty));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCelDirty regions.\n");
+        return NULL;
+    }
+    dirty->regionsCapacity = regionsCapacity;
+
+    // Ecran auquel les régions sont découpées
+    dirty->screen.topLeft.x = 0;
+    dirty->screen.topLeft.y = 0;
+    dirty->screen.bottomRight.x = width;
+    dirty->screen.bottomRight.y = height;
+
+    // Rien à redessiner pour l'instant
+    GroupCelDirtyClear(dirty);
+
+    // Retourne l'accumulateur créé
+    return dirty;
+}
+
+// Ajoute un rectangle en pixels et le fusionne dans les régions
+void GroupCelDirtyAdd(GroupCelDirty *dirty, Rectangle *rectangle) {
+
+    // Rectangle découpé à l'écran, puis agrandi par les fusions
+    Rectangle added;
+    // Union avec une région
+    Rectangle merged;
+    // Index pour parcourir les régions
+    uint32 regionIndex = 0;
+    // Région la plus proche du rectangle quand la liste est pleine
+    uint32 closestIndex = 0;
+    // Pixels couverts par une union et pixels qu'elle gaspille
+    uint32 areaUnion = 0;
+    uint32 waste = 0;
+    uint32 closestWaste = 0;
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyAdd()*\n"); }
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return;
+    }
+
+    // Si tout l'écran est déjà redessiné
+    if (dirty->full == 1) {
+        // Rien à ajouter
+        return;
+    }
+
+    // Découpe le rectangle à l'écran
+    added = *rectangle;
+    if (added.topLeft.x < dirty->screen.topLeft.x) { added.topLeft.x = dirty->screen.topLeft.x; }
+    if (added.topLeft.y < dirty->screen.topLeft.y) { added.topLeft.y = dirty->screen.topLeft.y; }
+    if (added.bottomRight.x > dirty->screen.bottomRight.x) { added.bottomRight.x = dirty->screen.bottomRight.x; }
+    if (added.bottomRight.y > dirty->screen.bottomRight.y) { added.bottomRight.y = dirty->screen.bottomRight.y; }
+
+    // Si rien ne reste à l'écran
+    if ((added.topLeft.x >= added.bottomRight.x) || (added.topLeft.y >= added.bottomRight.y)) {
+        // Rien à ajouter
+        return;
+    }
+    dirty->addedCount++;
+
+    // Fusionne le rectangle avec chaque région dont l'union gaspille peu de pixels
+    regionIndex = 0;
+    while (regionIndex < dirty->regionsCount) {
+        GroupCelDirtyUnion(&dirty->regions[regionIndex], &added, &merged);
+        areaUnion = GroupCelDirtyRectangleArea(&merged);
+        waste = areaUnion - (GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]) + GroupCelDirtyRectangleArea(&added) - GroupCelDirtyOverlap(&dirty->regions[regionIndex], &added));
+        // Si l'union coûte peu
+        if (waste <= (areaUnion >> GROUPCEL_DIRTY_WASTE_SHIFT)) {
+            // La région devient le rectangle, qui est comparé de nouveau à toutes les régions
+            GroupCelDirtyRemove(dirty, regionIndex);
+            added = merged;
+            regionIndex = 0;
+            continue;
+        }
+        regionIndex++;
+    }
+
+    // Si la liste est pleine
+    if (dirty->regionsCount >= dirty->regionsCapacity) {
+        // Cherche la région dont l'union avec le rectangle gaspille le moins de pixels
+        for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+            GroupCelDirtyUnion(&dirty->regions[regionIndex], &added, &merged);
+            waste = GroupCelDirtyRectangleArea(&merged) - (GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]) + GroupCelDirtyRectangleArea(&added) - GroupCelDirtyOverlap(&dirty->regions[regionIndex], &added));
+            if ((regionIndex == 0) || (waste < closestWaste)) {
+                closestIndex = regionIndex;
+                closestWaste = waste;
+            }
+        }
+        // Les fusionne
+        GroupCelDirtyUnion(&dirty->regions[closestIndex], &added, &added);
+        GroupCelDirtyRemove(dirty, closestIndex);
+    }
+
+    // Ajoute la région
+    dirty->regions[dirty->regionsCount] = added;
+    dirty->regionsCount++;
+}
+
+// Ajoute un rectangle en 16.16, arrondi vers l'extérieur aux pixels entiers
+void GroupCelDirtyAddF16(GroupCelDirty *dirty, Rectangle *rectangle16) {
+
+    // Rectangle en pixels
+    Rectangle rectangle;
+
+    // Les pixels touchés par le rectangle, même en partie
+    rectangle.topLeft.x = rectangle16->topLeft.x >> 16;
+    rectangle.topLeft.y = rectangle16->topLeft.y >> 16;
+    rectangle.bottomRight.x = (rectangle16->bottomRight.x + 0xFFFF) >> 16;
+    rectangle.bottomRight.y = (rectangle16->bottomRight.y + 0xFFFF) >> 16;
+
+    GroupCelDirtyAdd(dirty, &rectangle);
+}
+
+// Marque tout l'écran à redessiner
+void GroupCelDirtyFull(GroupCelDirty *dirty) {
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return;
+    }
+
+    // Une seule région couvre l'écran
+    dirty->regions[0] = dirty->screen;
+    dirty->regionsCount = 1;
+    dirty->full = 1;
+}
+
+// Vide les régions une fois l'image dessinée
+void GroupCelDirtyClear(GroupCelDirty *dirty) {
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return;
+    }
+
+    // Rien à redessiner
+    dirty->regionsCount = 0;
+    dirty->addedCount = 0;
+    dirty->full = 0;
+}
+
+// Pixels couverts par les régions, les chevauchements comptés une fois par région
+uint32 GroupCelDirtyArea(GroupCelDirty *dirty) {
+
+    // Index pour parcourir les régions
+    uint32 regionIndex = 0;
+    // Somme des surfaces
+    uint32 area = 0;
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return 0;
+    }
+
+    for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+        area += GroupCelDirtyRectangleArea(&dirty->regions[regionIndex]);
+    }
+
+    // Retourne les pixels à redessiner
+    return area;
+}
+
+// Affiche les régions et la part de l'écran qu'elles couvrent
+int32 GroupCelDirtyReport(GroupCelDirty *dirty) {
+
+    // Index pour parcourir les régions
+    uint32 regionIndex = 0;
+    // Pixels des régions et de l'écran
+    uint32 area = 0;
+    uint32 screenArea = 0;
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return -1;
+    }
+
+    // Affiche les totaux
+    area = GroupCelDirtyArea(dirty);
+    screenArea = GroupCelDirtyRectangleArea(&dirty->screen);
+    printf("GroupCelDirty : %u regions from %u rectangles, %u pixels (%u%% of the screen)%s\n", dirty->regionsCount, dirty->addedCount, area, (area * 100) / screenArea, (dirty->full == 1) ? ", full" : "");
+
+    // Affiche les régions
+    for (regionIndex = 0; regionIndex < dirty->regionsCount; regionIndex++) {
+        printf("  %d,%d -> %d,%d\n", dirty->regions[regionIndex].topLeft.x, dirty->regions[regionIndex].topLeft.y, dirty->regions[regionIndex].bottomRight.x, dirty->regions[regionIndex].bottomRight.y);
+    }
+
+    // Retourne les pixels à redessiner
+    return (int32)area;
+}
+
+// Supprime l'accumulateur
+int32 GroupCelDirtyCleanup(GroupCelDirty *dirty) {
+
+    if (DEBUG_GROUPCEL_DIRTY == 1) { printf("*GroupCelDirtyCleanup()*\n"); }
+
+    // Si l'accumulateur est inconnu
+    if (dirty == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCelDirty unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée pour les régions et l'accumulateur
+    FreeMem(dirty->regions, dirty->regionsCapacity * sizeof(Rectangle));
+    FreeMem(dirty, sizeof(GroupCelDirty));
+
+    // Retourne un succès
+    return 1;
+}
+
+// Surface d'un rectangle en pixels
+uint32 GroupCelDirtyRectangleArea(Rectangle *rectangle) {
+
+    return (uint32)(rectangle->bottomRight.x - rectangle->topLeft.x) * (uint32)(rectangle->bottomRight.y - rectangle->topLeft.y);
+}
+
+// Surface commune à deux rectangles en pixels
+uint32 GroupCelDirtyOverlap(Rectangle *rectangle1, Rectangle *rectangle2) {
+
+    // Intersection des rectangles
+    Rectangle overlap;
+
+    overlap.topLeft.x = (rectangle1->topLeft.x > rectangle2->topLeft.x) ? rectangle1->topLeft.x : rectangle2->topLeft.x;
+    overlap.topLeft.y = (rectangle1->topLeft.y > rectangle2->topLeft.y) ? rectangle1->topLeft.y : rectangle2->topLeft.y;
+    overlap.bottomRight.x = (rectangle1->bottomRight.x < rectangle2->bottomRight.x) ? rectangle1->bottomRight.x : rectangle2->bottomRight.x;
+    overlap.bottomRight.y = (rectangle1->bottomRight.y < rectangle2->bottomRight.y) ? rectangle1->bottomRight.y : rectangle2->bottomRight.y;
+
+    // Si les rectangles ne se chevauchent pas
+    if ((overlap.topLeft.x >= overlap.bottomRight.x) || (overlap.topLeft.y >= overlap.bottomRight.y)) {
+        return 0;
+    }
+
+    return GroupCelDirtyRectangleArea(&overlap);
+}
+
+// Plus petit rectangle contenant deux rectangles
+void GroupCelDirtyUnion(Rectangle *rectangle1, Rectangle *rectangle2, Rectangle *result) {
+
+    result->topLeft.x = (rectangle1->topLeft.x < rectangle2->topLeft.x) ? rectangle1->topLeft.x : rectangle2->topLeft.x;
+    result->topLeft.y = (rectangle1->topLeft.y < rectangle2->topLeft.y) ? rectangle1->topLeft.y : rectangle2->topLeft.y;
+    result->bottomRight.x = (rectangle1->bottomRight.x > rectangle2->bottomRight.x) ? rectangle1->bottomRight.x : rectangle2->bottomRight.x;
+    result->bottomRight.y = (rectangle1->bottomRight.y > rectangle2->bottomRight.y) ? rectangle1->bottomRight.y : rectangle2->bottomRight.y;
+}
+
+// Retire une région, la dernière prend sa place
+void GroupCelDirtyRemove(GroupCelDirty *dirty, uint32 regionIndex) {
+
+    dirty->regionsCount--;
+    dirty->regions[regionIndex] = dirty->regions[dirty->regionsCount];
+}
@@ -0,0 +1,119 @@
+#ifndef GROUPCEL_DIRTY_H
+#define GROUPCEL_DIRTY_H
+
+/******************************************************************************
+**
+**  GroupCelDirty - Régions de l'écran à redessiner dans une image
+**
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Un écran au fond statique n'a pas besoin d'être entièrement redessiné
+**  quand seuls quelques GroupCels bougent ou s'animent. Ce module rassemble,
+**  pour une image, les rectangles que les groupes signalent quand leurs CCB
+**  changent : où étaient les éléments et où ils sont maintenant. Les
+**  rectangles sont fusionnés à leur arrivée dans une petite liste de régions,
+**  pour que le rendu ne restaure le fond et ne projette de nouveau les Cels
+**  que dans ces régions.
+**
+**  Un rectangle est fusionné avec les régions dont l'union avec lui gaspille
+**  peu de pixels, et avec la région la plus proche quand la liste est pleine :
+**  le nombre de régions reste borné quel que soit le nombre de rectangles.
+**
+**  Notes importantes :
+**
+**    - Les régions sont en pixels, découpées à l'écran, bottomRight exclu. Les
+**      rectangles signalés par les groupes viennent des quads de leurs CCB en
+**      16.16, arrondis vers l'extérieur.
+**
+**    - Un groupe ne signale ses rectangles qu'une fois l'accumulateur donné
+**      par GroupCelSetDirty(), et seulement quand il est visible.
+**      L'accumulateur doit être vidé (GroupCelDirtyClear()) une fois l'image
+**      dessinée.
+**
+**    - Les régions peuvent se chevaucher quand leur union gaspillerait trop de
+**      pixels. Redessiner une région après une autre reste correct : tout ce
+**      qu'elle contient est restauré et projeté.
+**
+**  Rôle des structures :
+**
+**    GroupCelDirty
+**      - screen : Ecran auquel les régions sont découpées
+**      - regions, regionsCount, regionsCapacity : Régions à redessiner
+**      - addedCount : Nombre de rectangles ajoutés depuis le dernier vidage
+**      - full : 1 quand tout l'écran doit être redessiné
+**
+**  Fonctions principales :
+**
+**    GroupCelDirtyInitialization()
+**      -> Crée un accumulateur pour une taille d'écran et un nombre maximal de régions.
+**
+**    GroupCelDirtyAdd() / GroupCelDirtyAddF16()
+**      -> Ajoute un rectangle en pixels ou en 16.16 et le fusionne dans les régions.
+**
+**    GroupCelDirtyFull()
+**      -> Marque tout l'écran à redessiner.
+**
+**    GroupCelDirtyClear()
+**      -> Vide les régions une fois l'image dessinée.
+**
+**    GroupCelDirtyReport()
+**      -> Affiche les régions et la part de l'écran qu'elles couvrent.
+**
+**    GroupCelDirtyCleanup()
+**      -> Libère la mémoire utilisée par l'accumulateur.
+**
+******************************************************************************/
+
+// Rectangle
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_DIRTY 0
+
+// Pixels qu'une union peut gaspiller, en décalage de sa surface
+// 2 -> un quart de l'union
+#define GROUPCEL_DIRTY_WASTE_SHIFT 2
+
+typedef struct {
+    // Ecran auquel les régions sont découpées
+    Rectangle screen;
+    // Régions à redessiner en pixels, bottomRight exclu
+    Rectangle *regions;
+    uint32 regionsCount;
+    uint32 regionsCapacity;
+    // Nombre de rectangles ajoutés depuis le dernier vidage
+    uint32 addedCount;
+    // 1 quand tout l'écran doit être redessiné
+    int32 full;
+} GroupCelDirty;
+
+// Initialisation d'un accumulateur
+GroupCelDirty *GroupCelDirtyInitialization(int32 width, int32 height, uint32 regionsCapacity);
+// Ajoute un rectangle en pixels
+void GroupCelDirtyAdd(GroupCelDirty *dirty, Rectangle *rectangle);
+// Ajoute un rectangle en 16.16, arrondi vers l'extérieur
+void GroupCelDirtyAddF16(GroupCelDirty *dirty, Rectangle *rectangle16);
+// Marque tout l'écran à redessiner
+void GroupCelDirtyFull(GroupCelDirty *dirty);
+// Vide les régions
+void GroupCelDirtyClear(GroupCelDirty *dirty);
+// Pixels couverts par les régions
+uint32 GroupCelDirtyArea(GroupCelDirty *dirty);
+// Affiche les régions
+int32 GroupCelDirtyReport(GroupCelDirty *dirty);
+// Supprime l'accumulateur
+int32 GroupCelDirtyCleanup(GroupCelDirty *dirty);
+
+// Surface d'un rectangle en pixels
+uint32 GroupCelDirtyRectangleArea(Rectangle *rectangle);
+// Surface commune à deux rectangles en pixels
+uint32 GroupCelDirtyOverlap(Rectangle *rectangle1, Rectangle *rectangle2);
+// Plus petit rectangle contenant deux rectangles
+void GroupCelDirtyUnion(Rectangle *rectangle1, Rectangle *rectangle2, Rectangle *result);
+// Retire une région, la dernière prend sa place
+void GroupCelDirtyRemove(GroupCelDirty *dirty, uint32 regionIndex);
+
+#endif // GROUPCEL_DIRTY_H
@@ -0,0 +1,188 @@
+
+#include "GroupCelLayout.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM
+#include "mem.h"
+// OpenBlockFile(), AsynchReadBlockFile()
+#include "blockfile.h"
+// DeleteItem()
+#include "item.h"
+// printf()
+#include "stdio.h"
+
+// Lit un fichier entier en une seule opération d'E/S
+static void *GroupCelLayoutReadFile(char *filename, int32 *fileSize, int32 *bufferSize) {
+
+    // Fichier
+    BlockFile blockFile;
+    // Requête d'E/S
+    Item ioRequest = 0;
+    // Taille d'un bloc du périphérique
+    int32 blockSize = 0;
+    // Tampon recevant le fichier
+    void *buffer = NULL;
+
+    // Ouvre le fichier
+    if (OpenBlockFile(filename, &blockFile) < 0) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return NULL;
+    }
+
+    // Taille du fichier arrondie aux blocs du périphérique
+    *fileSize = GetBlockFileSize(&blockFile);
+    blockSize = GetBlockFileBlockSize(&blockFile);
+    *bufferSize = ((*fileSize + blockSize - 1) / blockSize) * blockSize;
+
+    // Alloue de la mémoire pour le fichier entier
+    buffer = AllocMem(*bufferSize, MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (buffer == NULL) {
+        CloseBlockFile(&blockFile);
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for %s.\n", filename);
+        return NULL;
+    }
+
+    // Crée la requête d'E/S
+    ioRequest = CreateBlockFileIOReq(blockFile.fDevice, 0);
+    // Si c'est un échec
+    if (ioRequest < 0) {
+        FreeMem(buffer, *bufferSize);
+        CloseBlockFile(&blockFile);
+        // Affiche un message d'erreur
+        printf("Error : Failed to create I/O request for %s.\n", filename);
+        return NULL;
+    }
+
+    // Lit le fichier entier d'un coup
+    if ((AsynchReadBlockFile(&blockFile, ioRequest, buffer, *bufferSize, 0) < 0) || (WaitReadDoneBlockFile(ioRequest) < 0)) {
+        DeleteItem(ioRequest);
+        FreeMem(buffer, *bufferSize);
+        CloseBlockFile(&blockFile);
+        // Affiche un message d'erreur
+        printf("Error : Failed to read %s.\n", filename);
+        return NULL;
+    }
+
+    // Libère les ressources d'E/S
+    DeleteItem(ioRequest);
+    CloseBlockFile(&blockFile);
+
+    // Retourne le contenu du fichier
+    return buffer;
+}
+
+// Lit un fichier de disposition et crée le GroupCel
+GroupCel *GroupCelLayoutLoad(char *filename, CCB **cels, uint32 celsCount) {
+
+    // Contenu du fichier
+    void *layout = NULL;
+    int32 layoutSize = 0;
+    int32 bufferSize = 0;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_LAYOUT == 1) { printf("*GroupCelLayoutLoad()*\n"); }
+
+    // Si le nom du fichier est inconnu
+    if (filename == NULL) {
+        // Retourne une erreur
+        printf("Error : GroupCel layout filename unknow.\n");
+        return NULL;
+    }
+
+    // Lit le fichier entier en une seule opération d'E/S
+    layout = GroupCelLayoutReadFile(filename, &layoutSize, &bufferSize);
+    // Si c'est un échec
+    if (layout == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelLayoutReadFile()\n");
+        return NULL;
+    }
+
+    // Crée le GroupCel
+    groupCel = GroupCelLayoutInstantiate(layout, (uint32)layoutSize, cels, celsCount);
+
+    // La disposition n'est plus nécessaire
+    FreeMem(layout, bufferSize);
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
+
+// Crée le GroupCel à partir d'une disposition en mémoire
+GroupCel *GroupCelLayoutInstantiate(void *layout, uint32 layoutSize, CCB **cels, uint32 celsCount) {
+
+    // Entête de la disposition
+    GroupCelLayoutHeader *header = (GroupCelLayoutHeader *)layout;
+    // Table des éléments qui suit l'entête
+    GroupCelElement *elements = NULL;
+    // GroupCel
+    GroupCel *groupCel = NULL;
+
+    if (DEBUG_GROUPCEL_LAYOUT == 1) { printf("*GroupCelLayoutInstantiate()*\n"); }
+
+    // Si la disposition est inconnue ou trop petite
+    if ((layout == NULL) || (layoutSize < sizeof(GroupCelLayoutHeader))) {
+        // Retourne une erreur
+        printf("Error : GroupCel layout unknow.\n");
+        return NULL;
+    }
+
+    // Si ce n'est pas une disposition d'une version connue
+    if ((header->magic != GROUPCEL_LAYOUT_MAGIC) || (header->version != GROUPCEL_LAYOUT_VERSION)) {
+        // Retourne une erreur
+        printf("Error : GroupCel layout version unknow.\n");
+        return NULL;
+    }
+
+    // Si la table des éléments est tronquée, comparé sans multiplier pour qu'un nombre énorme ne déborde pas
+    if (header->elementsCount > (layoutSize - sizeof(GroupCelLayoutHeader)) / sizeof(GroupCelElement)) {
+        // Retourne une erreur
+        printf("Error : GroupCel layout truncated.\n");
+        return NULL;
+    }
+
+    // La table des éléments suit l'entête
+    elements = (GroupCelElement *)(header + 1);
+
+    // Crée le GroupCel
+    groupCel = GroupCelInitialization(header->position.x, header->position.y, header->size.x, header->size.y, header->celsCount);
+    // Si c'est un échec
+    if (groupCel == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    // Stocke les éléments et les lie en une seule passe
+    if (GroupCelElementsTableConfiguration(groupCel, elements, header->elementsCount, cels, celsCount) < 0) {
+        GroupCelCleanup(groupCel);
+        // Retourne une erreur
+        printf("Error <- GroupCelElementsTableConfiguration()\n");
+        return NULL;
+    }
+
+    // Etirement
+    groupCel->stretching = header->stretching;
+    // Si le cadre est étiré
+    if (GroupCelIsStretched(groupCel) == 1) {
+        // Active l'étirement
+        groupCel->transformations |= GROUPCEL_FLAG_STRETCH;
+    }
+
+    // Rotation
+    GroupCelRotate(groupCel, header->rotationAngle % 256, header->rotationPivot.x, header->rotationPivot.y);
+    // Si le groupe est tourné
+    if (groupCel->rotationAngle != 0) {
+        // Active la rotation
+        groupCel->transformations |= GROUPCEL_FLAG_ROTATE;
+    }
+
+    // Applique les transformations de la disposition
+    GroupCelUpdate(groupCel);
+
+    // Retourne le GroupCel créé
+    return groupCel;
+}
@@ -0,0 +1,97 @@
+#ifndef GROUPCEL_LAYOUT_H
+#define GROUPCEL_LAYOUT_H
+
+/******************************************************************************
+**
+**  GroupCelLayout - Fichier binaire de disposition d'un GroupCel
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Ce module décrit un GroupCel dans un fichier binaire compact produit par
+**  un outil sur l'hôte : position, taille, étirement, rotation et la table
+**  des éléments (références des cels et positions locales).
+**
+**  Le chargeur lit le fichier entier en une seule opération d'E/S et construit
+**  le GroupCel et ses liaisons sans aucun appel de configuration par élément.
+**
+**  Notes importantes :
+**
+**    - Tous les mots du fichier sont stockés en big-endian, l'ordre natif
+**      de la 3DO. Le chargeur utilise les données sur place sans conversion.
+**
+**    - Les références des cels sont des index dans la table de CCB donnée au
+**      chargeur. Les Cels eux-mêmes ne font pas partie de la disposition.
+**
+**    - L'outil sur l'hôte écrit le fichier avec GroupCelLayoutWrite(), déclarée
+**      dans GroupCelLayoutWriter.h. Cet entête a besoin du SDK, celui-là non : ils
+**      ne partagent que GroupCelLayoutFormat.h.
+**
+**  Format du fichier :
+**
+**    GroupCelLayoutHeader
+**      - magic : 'GCLY'
+**      - version : Version du format
+**      - position : Position du GroupCel
+**      - size : Taille du GroupCel
+**      - stretching : Quadrilatère d'étirement en pixels (local 0..x, 0..y)
+**      - rotationAngle : Angle de rotation en 256 unités
+**      - rotationPivot : Pivot de rotation absolu en pixels
+**      - celsCount : Nombre total de Cels dans le GroupCel
+**      - elementsCount : Nombre de "GroupCelElement" qui suivent l'entête
+**
+**    GroupCelElement[elementsCount]
+**      - celReference : Index du CCB de l'élément dans la table des cels
+**      - positionX, positionY : Position de l'élément dans le GroupCel
+**
+**  Fonctions principales :
+**
+**    GroupCelLayoutLoad()
+**      -> Lit un fichier de disposition en une seule opération d'E/S et crée le GroupCel.
+**
+**    GroupCelLayoutInstantiate()
+**      -> Crée le GroupCel à partir d'une disposition déjà en mémoire.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel, GroupCelElement
+#include "GroupCel.h"
+// Point2D, Quad2D
+#include "Geometry.h"
+// int32
+#include "types.h"
+// GROUPCEL_LAYOUT_MAGIC, GROUPCEL_LAYOUT_VERSION
+#include "GroupCelLayoutFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_LAYOUT 0
+
+typedef struct {
+    // Identifiant du fichier
+    uint32 magic;
+    // Version du format
+    uint32 version;
+    // Position
+    Point2D position;
+    // Dimension
+    Point2D size;
+    // Quadrilatère d'étirement en pixels (local 0..x, 0..y)
+    Quad2D stretching;
+    // Angle de rotation en 256 unités
+    uint32 rotationAngle;
+    // Pivot de rotation absolu en pixels
+    Point2D rotationPivot;
+    // Nombre total de cels
+    uint32 celsCount;
+    // Nombre d'éléments qui suivent l'entête
+    uint32 elementsCount;
+} GroupCelLayoutHeader;
+
+// Lit un fichier de disposition et crée le GroupCel
+GroupCel *GroupCelLayoutLoad(char *filename, CCB **cels, uint32 celsCount);
+// Crée le GroupCel à partir d'une disposition en mémoire
+GroupCel *GroupCelLayoutInstantiate(void *layout, uint32 layoutSize, CCB **cels, uint32 celsCount);
+
+#endif // GROUPCEL_LAYOUT_H
@@ -0,0 +1,22 @@
+#ifndef GROUPCEL_LAYOUT_FORMAT_H
+#define GROUPCEL_LAYOUT_FORMAT_H
+
+/******************************************************************************
+**
+**  GroupCelLayoutFormat - Identifiants du fichier de disposition d'un GroupCel
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Le chargeur (GroupCelLayout.h) et l'écrivain sur l'hôte (GroupCelLayoutWriter.h)
+**  incluent tous deux cet entête. Il n'inclut rien, ainsi l'outil sur l'hôte
+**  n'a pas besoin des entêtes du SDK pour s'accorder avec le chargeur.
+**
+******************************************************************************/
+
+// Identifiant du fichier ('GCLY')
+#define GROUPCEL_LAYOUT_MAGIC 0x47434C59
+// Version du format
+#define GROUPCEL_LAYOUT_VERSION 1
+
+#endif // GROUPCEL_LAYOUT_FORMAT_H
@@ -0,0 +1,98 @@
+
+#include "GroupCelLayoutWriter.h"
+
+// fopen(), fwrite(), printf()
+#include "stdio.h"
+
+// Ecrit un mot en big-endian
+static int32_t GroupCelLayoutWriteWord(FILE *file, uint32_t word) {
+
+    // Octets du mot
+    unsigned char bytes[4];
+
+    // Octet de poids fort en premier
+    bytes[0] = (unsigned char)(word >> 24);
+    bytes[1] = (unsigned char)(word >> 16);
+    bytes[2] = (unsigned char)(word >> 8);
+    bytes[3] = (unsigned char)word;
+
+    // Retourne 1 en cas de succès, 0 sinon
+    return (fwrite(bytes, 1, 4, file) == 4) ? 1 : 0;
+}
+
+// Ecrit un fichier de disposition (hôte)
+int32_t GroupCelLayoutWrite(const char *filename, const GroupCelLayoutDescription *description, const GroupCelLayoutEntry *elements) {
+
+    // Fichier
+    FILE *file = NULL;
+    // Index pour parcourir les éléments
+    uint32_t celIndex = 0;
+    // Résultat des écritures
+    int32_t written = 1;
+
+    if (DEBUG_GROUPCEL_LAYOUT_WRITER == 1) { printf("*GroupCelLayoutWrite()*\n"); }
+
+    // Si les paramètres sont inconnus
+    if ((filename == NULL) || (description == NULL) || (elements == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel layout unknow.\n");
+        return -1;
+    }
+
+    // Si la table ne tient pas dans le groupe
+    if ((description->elementsCount == 0) || (description->elementsCount > description->celsCount)) {
+        // Retourne une erreur
+        printf("Error : GroupCel table of %u elements doesn't fit %u cels.\n", description->elementsCount, description->celsCount);
+        return -1;
+    }
+
+    // Ouvre le fichier
+    file = fopen(filename, "wb");
+    // Si c'est un échec
+    if (file == NULL) {
+        // Retourne une erreur
+        printf("Error : Failed to open %s.\n", filename);
+        return -1;
+    }
+
+    // Entête
+    written &= GroupCelLayoutWriteWord(file, GROUPCEL_LAYOUT_MAGIC);
+    written &= GroupCelLayoutWriteWord(file, GROUPCEL_LAYOUT_VERSION);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->position.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->position.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->size.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->size.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topLeft.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topLeft.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topRight.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.topRight.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomRight.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomRight.y);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomLeft.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->stretching.bottomLeft.y);
+    written &= GroupCelLayoutWriteWord(file, description->rotationAngle);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->rotationPivot.x);
+    written &= GroupCelLayoutWriteWord(file, (uint32_t)description->rotationPivot.y);
+    written &= GroupCelLayoutWriteWord(file, description->celsCount);
+    written &= GroupCelLayoutWriteWord(file, description->elementsCount);
+
+    // Table des éléments
+    for (celIndex = 0; celIndex < description->elementsCount; celIndex++) {
+        written &= GroupCelLayoutWriteWord(file, elements[celIndex].celReference);
+        written &= GroupCelLayoutWriteWord(file, (uint32_t)elements[celIndex].positionX);
+        written &= GroupCelLayoutWriteWord(file, (uint32_t)elements[celIndex].positionY);
+    }
+
+    // Ferme le fichier
+    if (fclose(file) != 0) { written = 0; }
+
+    // Si une écriture a échoué
+    if (written == 0) {
+        // Retourne une erreur
+        printf("Error : Failed to write %s.\n", filename);
+        return -1;
+    }
+
+    // Retourne un succès
+    return 1;
+}
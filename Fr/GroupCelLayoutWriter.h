@@ -0,0 +1,94 @@
+#ifndef GROUPCEL_LAYOUT_WRITER_H
+#define GROUPCEL_LAYOUT_WRITER_H
+
+/******************************************************************************
+**
+**  GroupCelLayoutWriter - Ecriture des fichiers de disposition d'un GroupCel (hôte)
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  L'outil sur l'hôte inclut cet entête au lieu de GroupCelLayout.h. Il n'a
+**  besoin que de la bibliothèque C standard : la description du groupe utilise
+**  ses propres types de taille fixe, et chaque mot est écrit octet par octet
+**  en big-endian, quel que soit l'ordre de l'hôte.
+**
+**  Rôle des structures :
+**
+**    GroupCelLayoutPoint
+**      - x, y : Coordonnées en pixels
+**
+**    GroupCelLayoutQuad
+**      - topLeft, topRight, bottomRight, bottomLeft : Coins en pixels
+**
+**    GroupCelLayoutDescription
+**      - position : Position du GroupCel
+**      - size : Taille du GroupCel
+**      - stretching : Quadrilatère d'étirement en pixels (local 0..x, 0..y)
+**      - rotationAngle : Angle de rotation en 256 unités
+**      - rotationPivot : Pivot de rotation absolu en pixels
+**      - celsCount : Nombre total de Cels dans le GroupCel
+**      - elementsCount : Nombre de "GroupCelLayoutEntry" dans la table (1 à celsCount)
+**
+**    GroupCelLayoutEntry
+**      - celReference : Index du CCB de l'élément dans la table des cels
+**      - positionX, positionY : Position de l'élément dans le GroupCel
+**
+**  Fonctions principales :
+**
+**    GroupCelLayoutWrite()
+**      -> Ecrit un fichier de disposition lu par GroupCelLayoutLoad().
+**
+******************************************************************************/
+
+// int32_t, uint32_t
+#include "stdint.h"
+// GROUPCEL_LAYOUT_MAGIC, GROUPCEL_LAYOUT_VERSION
+#include "GroupCelLayoutFormat.h"
+
+// Debug
+#define DEBUG_GROUPCEL_LAYOUT_WRITER 0
+
+typedef struct {
+    // Coordonnées en pixels
+    int32_t x;
+    int32_t y;
+} GroupCelLayoutPoint;
+
+typedef struct {
+    // Coins en pixels
+    GroupCelLayoutPoint topLeft;
+    GroupCelLayoutPoint topRight;
+    GroupCelLayoutPoint bottomRight;
+    GroupCelLayoutPoint bottomLeft;
+} GroupCelLayoutQuad;
+
+typedef struct {
+    // Position
+    GroupCelLayoutPoint position;
+    // Dimension
+    GroupCelLayoutPoint size;
+    // Quadrilatère d'étirement en pixels (local 0..x, 0..y)
+    GroupCelLayoutQuad stretching;
+    // Angle de rotation en 256 unités
+    uint32_t rotationAngle;
+    // Pivot de rotation absolu en pixels
+    GroupCelLayoutPoint rotationPivot;
+    // Nombre total de cels
+    uint32_t celsCount;
+    // Nombre d'éléments dans la table
+    uint32_t elementsCount;
+} GroupCelLayoutDescription;
+
+typedef struct {
+    // Index du CCB dans la table des cels
+    uint32_t celReference;
+    // Position
+    int32_t positionX;
+    int32_t positionY;
+} GroupCelLayoutEntry;
+
+// Ecrit un fichier de disposition
+int32_t GroupCelLayoutWrite(const char *filename, const GroupCelLayoutDescription *description, const GroupCelLayoutEntry *elements);
+
+#endif // GROUPCEL_LAYOUT_WRITER_H
@@ -0,0 +1,341 @@
+
+#include "GroupCelScroll.h"
+
+// AllocMem(), FreeMem(), MEMTYPE_DRAM, MEMTYPE_CEL
+#include "mem.h"
+// memmove()
+#include "string.h"
+// printf()
+#include "stdio.h"
+
+// Initialisation d'une vue défilante
+GroupCelScroll *GroupCelScrollInitialization(int32 positionX, int32 positionY, uint32 viewSizeX, uint32 viewSizeY, const uint16 *map, uint32 mapColumns, uint32 mapRows, CCB **tileset, uint32 tilesetCount) {
+
+    // Vue défilante
+    GroupCelScroll *scroll = NULL;
+    // Table des CCB de la fenêtre
+    CCB **cels = NULL;
+    // Taille de la fenêtre en tuiles
+    uint32 columns = 0;
+    uint32 rows = 0;
+    // Taille d'une tuile
+    uint32 tileSizeX = 0;
+    uint32 tileSizeY = 0;
+    // Index pour parcourir la fenêtre
+    uint32 column = 0;
+    uint32 row = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollInitialization()*\n"); }
+
+    // Si la carte ou le jeu de tuiles est inconnu
+    if ((map == NULL) || (tileset == NULL) || (tilesetCount == 0) || (tileset[0] == NULL)) {
+        // Retourne une erreur
+        printf("Error : GroupCel scroll map unknow.\n");
+        return NULL;
+    }
+
+    // Le premier Cel du jeu de tuiles donne la taille des tuiles
+    tileSizeX = tileset[0]->ccb_Width;
+    tileSizeY = tileset[0]->ccb_Height;
+
+    // Corrige les paramètres
+    // Tuile minimum = 1 x 1 pixel
+    tileSizeX = (tileSizeX > 1) ? tileSizeX : 1;
+    tileSizeY = (tileSizeY > 1) ? tileSizeY : 1;
+    // Vue minimum = 1 x 1 pixel
+    viewSizeX = (viewSizeX > 1) ? viewSizeX : 1;
+    viewSizeY = (viewSizeY > 1) ? viewSizeY : 1;
+    // Carte minimum = 1 x 1 tuile
+    mapColumns = (mapColumns > 1) ? mapColumns : 1;
+    mapRows = (mapRows > 1) ? mapRows : 1;
+
+    // La fenêtre couvre la vue plus une colonne et une rangée
+    columns = (viewSizeX + tileSizeX - 1) / tileSizeX + 1;
+    rows = (viewSizeY + tileSizeY - 1) / tileSizeY + 1;
+
+    // Alloue de la mémoire pour la vue
+    scroll = (GroupCelScroll *)AllocMem(sizeof(GroupCelScroll), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if (scroll == NULL) {
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel scroll.\n");
+        return NULL;
+    }
+
+    // Carte et jeu de tuiles
+    scroll->map = map;
+    scroll->mapColumns = mapColumns;
+    scroll->mapRows = mapRows;
+    scroll->tileset = tileset;
+    scroll->tilesetCount = tilesetCount;
+    // Vue
+    scroll->position.x = positionX;
+    scroll->position.y = positionY;
+    scroll->viewSize.x = viewSizeX;
+    scroll->viewSize.y = viewSizeY;
+    // Coin supérieur gauche de la carte
+    scroll->scroll.x = 0;
+    scroll->scroll.y = 0;
+    scroll->origin.x = 0;
+    scroll->origin.y = 0;
+
+    // Crée le GroupCel en grille de la fenêtre
+    scroll->groupCel = GroupCelGridInitialization(positionX, positionY, columns, rows, tileSizeX, tileSizeY);
+    // Alloue un seul bloc pour les CCB de la fenêtre
+    scroll->ccbs = (CCB *)AllocMem(columns * rows * sizeof(CCB), MEMTYPE_CEL);
+    // Alloue la table servant à configurer la grille
+    cels = (CCB **)AllocMem(columns * rows * sizeof(CCB *), MEMTYPE_DRAM);
+    // Si c'est un échec
+    if ((scroll->groupCel == NULL) || (scroll->ccbs == NULL) || (cels == NULL)) {
+        // Libère la mémoire précédemment allouée
+        if (scroll->groupCel != NULL) { GroupCelCleanup(scroll->groupCel); }
+        if (scroll->ccbs != NULL) { FreeMem(scroll->ccbs, columns * rows * sizeof(CCB)); }
+        if (cels != NULL) { FreeMem(cels, columns * rows * sizeof(CCB *)); }
+        FreeMem(scroll, sizeof(GroupCelScroll));
+        // Affiche un message d'erreur
+        printf("Error : Failed to allocate memory for GroupCel scroll window.\n");
+        return NULL;
+    }
+
+    // Pour chaque tuile de la fenêtre
+    for (row = 0; row < rows; row++) {
+        for (column = 0; column < columns; column++) {
+            // Copie l'entête du premier Cel du jeu de tuiles
+            cels[row * columns + column] = &scroll->ccbs[row * columns + column];
+            *cels[row * columns + column] = *tileset[0];
+            // Affiche la tuile de la carte
+            GroupCelScrollTileSource(scroll, cels[row * columns + column], (int32)column, (int32)row);
+        }
+    }
+
+    // Lie la fenêtre une seule fois et place les tuiles
+    if (GroupCelGridTilesConfiguration(scroll->groupCel, cels, columns * rows) < 0) {
+        // Libère la mémoire précédemment allouée
+        FreeMem(cels, columns * rows * sizeof(CCB *));
+        GroupCelScrollCleanup(scroll);
+        // Retourne une erreur
+        printf("Error <- GroupCelGridTilesConfiguration()\n");
+        return NULL;
+    }
+
+    // Le dernier CCB de la fenêtre termine la chaîne
+    cels[columns * rows - 1]->ccb_NextPtr = NULL;
+    cels[columns * rows - 1]->ccb_Flags |= CCB_LAST;
+
+    // Libère la table, la grille garde la sienne
+    FreeMem(cels, columns * rows * sizeof(CCB *));
+
+    // Retourne la vue créée
+    return scroll;
+}
+
+// Fait défiler la vue
+void GroupCelScrollMove(GroupCelScroll *scroll, int32 moveX, int32 moveY) {
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollMove()*\n"); }
+
+    // Si la vue est inconnue
+    if (scroll == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel scroll unknow.\n");
+        return;
+    }
+
+    // Modifie la position de la vue dans la carte
+    GroupCelScrollSetPosition(scroll, scroll->scroll.x + moveX, scroll->scroll.y + moveY);
+}
+
+// Définit la position de la vue dans la carte
+void GroupCelScrollSetPosition(GroupCelScroll *scroll, int32 scrollX, int32 scrollY) {
+
+    // Taille d'une tuile
+    int32 tileSizeX = 0;
+    int32 tileSizeY = 0;
+    // Tuile de la carte à afficher dans la première tuile de la fenêtre
+    int32 originX = 0;
+    int32 originY = 0;
+    // Index pour parcourir la fenêtre
+    uint32 column = 0;
+    uint32 row = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollSetPosition()*\n"); }
+
+    // Si la vue est inconnue
+    if (scroll == NULL){
+        // Retourne une erreur
+        printf("Error : GroupCel scroll unknow.\n");
+        return;
+    }
+
+    // Taille d'une tuile
+    tileSizeX = scroll->groupCel->tileSize.x;
+    tileSizeY = scroll->groupCel->tileSize.y;
+
+    // Garde la vue dans la carte
+    scrollX = (scrollX < (int32)(scroll->mapColumns * tileSizeX) - scroll->viewSize.x) ? scrollX : (int32)(scroll->mapColumns * tileSizeX) - scroll->viewSize.x;
+    scrollY = (scrollY < (int32)(scroll->mapRows * tileSizeY) - scroll->viewSize.y) ? scrollY : (int32)(scroll->mapRows * tileSizeY) - scroll->viewSize.y;
+    scrollX = (scrollX > 0) ? scrollX : 0;
+    scrollY = (scrollY > 0) ? scrollY : 0;
+
+    // Applique les modifications
+    scroll->scroll.x = scrollX;
+    scroll->scroll.y = scrollY;
+
+    // Tuile de la carte sous le coin supérieur gauche de la vue
+    originX = scrollX / tileSizeX;
+    originY = scrollY / tileSizeY;
+
+    // Si la vue a sauté plus loin que la fenêtre
+    if ((originX - scroll->origin.x >= (int32)scroll->groupCel->gridColumns) || (scroll->origin.x - originX >= (int32)scroll->groupCel->gridColumns) ||
+        (originY - scroll->origin.y >= (int32)scroll->groupCel->gridRows) || (scroll->origin.y - originY >= (int32)scroll->groupCel->gridRows)) {
+        // Chaque tuile de la fenêtre affiche une nouvelle tuile de la carte
+        scroll->origin.x = originX;
+        scroll->origin.y = originY;
+        for (row = 0; row < scroll->groupCel->gridRows; row++) {
+            for (column = 0; column < scroll->groupCel->gridColumns; column++) {
+                GroupCelScrollTileSource(scroll, scroll->groupCel->tiles[row * scroll->groupCel->gridColumns + column], originX + (int32)column, originY + (int32)row);
+            }
+        }
+        // Les tuiles ont changé de place : la grille doit être replacée, même si sa position ne change pas
+        scroll->groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+    // Sinon
+    } else {
+        // Recycle une colonne par limite de tuile franchie
+        while (scroll->origin.x < originX) { GroupCelScrollRecycleColumn(scroll, 1); }
+        while (scroll->origin.x > originX) { GroupCelScrollRecycleColumn(scroll, -1); }
+        // Recycle une rangée par limite de tuile franchie
+        while (scroll->origin.y < originY) { GroupCelScrollRecycleRow(scroll, 1); }
+        while (scroll->origin.y > originY) { GroupCelScrollRecycleRow(scroll, -1); }
+    }
+
+    // Le défilement à l'intérieur d'une tuile déplace toute la fenêtre
+    GroupCelSetPosition(scroll->groupCel, scroll->position.x - (scrollX - originX * tileSizeX), scroll->position.y - (scrollY - originY * tileSizeY));
+}
+
+// Déplace la première ou la dernière colonne de la fenêtre de l'autre côté
+void GroupCelScrollRecycleColumn(GroupCelScroll *scroll, int32 direction) {
+
+    // Grille de la fenêtre
+    GroupCel *groupCel = scroll->groupCel;
+    // Première tuile de la rangée courante
+    CCB **tiles = NULL;
+    // Tuile sortie de la vue
+    CCB *cel = NULL;
+    // Index pour parcourir les rangées
+    uint32 row = 0;
+
+    // Tuile de la carte affichée par la première tuile de la fenêtre
+    scroll->origin.x += direction;
+    // Les tuiles changent de place : la grille doit être replacée, même si sa position ne change pas
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Pour chaque rangée de la fenêtre
+    for (row = 0; row < groupCel->gridRows; row++) {
+        tiles = &groupCel->tiles[row * groupCel->gridColumns];
+        // Si la vue se déplace vers la droite
+        if (direction > 0) {
+            // La première tuile passe à la fin de la rangée
+            cel = tiles[0];
+            memmove(&tiles[0], &tiles[1], (groupCel->gridColumns - 1) * sizeof(CCB *));
+            tiles[groupCel->gridColumns - 1] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)groupCel->gridColumns - 1, scroll->origin.y + (int32)row);
+        // Sinon
+        } else {
+            // La dernière tuile passe au début de la rangée
+            cel = tiles[groupCel->gridColumns - 1];
+            memmove(&tiles[1], &tiles[0], (groupCel->gridColumns - 1) * sizeof(CCB *));
+            tiles[0] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x, scroll->origin.y + (int32)row);
+        }
+    }
+}
+
+// Déplace la première ou la dernière rangée de la fenêtre de l'autre côté
+void GroupCelScrollRecycleRow(GroupCelScroll *scroll, int32 direction) {
+
+    // Grille de la fenêtre
+    GroupCel *groupCel = scroll->groupCel;
+    // Tuile sortie de la vue
+    CCB *cel = NULL;
+    // Index pour parcourir la fenêtre
+    uint32 column = 0;
+    uint32 row = 0;
+
+    // Tuile de la carte affichée par la première tuile de la fenêtre
+    scroll->origin.y += direction;
+    // Les tuiles changent de place : la grille doit être replacée, même si sa position ne change pas
+    groupCel->transformations |= GROUPCEL_FLAG_MOVE;
+
+    // Pour chaque colonne de la fenêtre
+    for (column = 0; column < groupCel->gridColumns; column++) {
+        // Si la vue se déplace vers le bas
+        if (direction > 0) {
+            // La tuile du haut passe en bas de la colonne
+            cel = groupCel->tiles[column];
+            for (row = 0; row < groupCel->gridRows - 1; row++) {
+                groupCel->tiles[row * groupCel->gridColumns + column] = groupCel->tiles[(row + 1) * groupCel->gridColumns + column];
+            }
+            groupCel->tiles[(groupCel->gridRows - 1) * groupCel->gridColumns + column] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)column, scroll->origin.y + (int32)groupCel->gridRows - 1);
+        // Sinon
+        } else {
+            // La tuile du bas passe en haut de la colonne
+            cel = groupCel->tiles[(groupCel->gridRows - 1) * groupCel->gridColumns + column];
+            for (row = groupCel->gridRows - 1; row > 0; row--) {
+                groupCel->tiles[row * groupCel->gridColumns + column] = groupCel->tiles[(row - 1) * groupCel->gridColumns + column];
+            }
+            groupCel->tiles[column] = cel;
+            GroupCelScrollTileSource(scroll, cel, scroll->origin.x + (int32)column, scroll->origin.y);
+        }
+    }
+}
+
+// Donne à une tuile de la fenêtre les données source d'une tuile de la carte
+void GroupCelScrollTileSource(GroupCelScroll *scroll, CCB *cel, int32 mapColumn, int32 mapRow) {
+
+    // Index de la tuile dans le jeu de tuiles
+    uint32 tileIndex = GROUPCEL_SCROLL_EMPTY;
+
+    // Si la tuile de la carte existe
+    if ((mapColumn >= 0) && (mapColumn < (int32)scroll->mapColumns) && (mapRow >= 0) && (mapRow < (int32)scroll->mapRows)) {
+        tileIndex = scroll->map[mapRow * scroll->mapColumns + mapColumn];
+    }
+
+    // Si la case est vide
+    if (tileIndex >= scroll->tilesetCount) {
+        // Le Cel Engine ignore la tuile
+        cel->ccb_Flags |= CCB_SKIP;
+        return;
+    }
+
+    // Echange les données source et la PLUT
+    cel->ccb_SourcePtr = scroll->tileset[tileIndex]->ccb_SourcePtr;
+    cel->ccb_PLUTPtr = scroll->tileset[tileIndex]->ccb_PLUTPtr;
+    cel->ccb_Flags &= ~CCB_SKIP;
+}
+
+// Supprime la vue
+int32 GroupCelScrollCleanup(GroupCelScroll *scroll) {
+
+    // Taille de la fenêtre en tuiles
+    uint32 tilesCount = 0;
+
+    if (DEBUG_GROUPCEL_SCROLL == 1) { printf("*GroupCelScrollCleanup()*\n"); }
+
+    // Si la vue n'existe pas
+    if (scroll == NULL){
+        // Affiche une erreur
+        printf("Error : GroupCel scroll unknow.\n");
+        return -1;
+    }
+
+    // Libère la mémoire utilisée pour la grille puis pour les CCB de la fenêtre
+    tilesCount = scroll->groupCel->celsCount;
+    GroupCelCleanup(scroll->groupCel);
+    FreeMem(scroll->ccbs, tilesCount * sizeof(CCB));
+    // Libère la mémoire utilisée pour la vue
+    FreeMem(scroll, sizeof(GroupCelScroll));
+
+    // Retourne un succès
+    return 1;
+}
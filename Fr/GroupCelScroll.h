@@ -0,0 +1,132 @@
+#ifndef GROUPCEL_SCROLL_H
+#define GROUPCEL_SCROLL_H
+
+/******************************************************************************
+**
+**  GroupCelScroll - Vue défilante d'une carte de tuiles basée sur un GroupCel en grille
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Ce module affiche une grande carte de tuiles à travers une fenêtre de tuiles
+**  juste plus grande que la vue : une colonne et une rangée supplémentaires.
+**  Seuls les CCB de cette fenêtre existent, et chacun reçoit les données source
+**  de la tuile de la carte qu'il affiche.
+**
+**  Lorsque la vue franchit une limite de tuile, la colonne ou la rangée sortie
+**  de la vue passe de l'autre côté de la fenêtre et seuls ses CCB reçoivent de
+**  nouvelles données source. Le défilement à l'intérieur d'une tuile est un
+**  déplacement du GroupCel en grille. La mémoire et le coût par image dépendent
+**  de la taille de la vue, pas de celle de la carte.
+**
+**  Notes importantes :
+**
+**    - La carte est un tableau d'index de tuiles, rangée par rangée, dans le jeu
+**      de tuiles. GROUPCEL_SCROLL_EMPTY laisse une case vide. La carte et le jeu
+**      de tuiles ne sont pas copiés : ils doivent rester chargés tant que la vue existe.
+**
+**    - Tous les Cels du jeu de tuiles doivent avoir la taille et le format du
+**      premier : seules leurs données source et leur PLUT sont échangées dans la fenêtre.
+**
+**    - Les CCB de la fenêtre sont liés une seule fois et la chaîne n'est jamais
+**      reconstruite : les tuiles ne se chevauchent pas, l'ordre d'affichage n'a donc
+**      pas d'importance. Le dernier CCB de la fenêtre termine la chaîne.
+**
+**    - Chaque modification du défilement doit être appliquée en appelant
+**      GroupCelUpdate() sur le GroupCel de la vue.
+**
+**  Rôle des structures :
+**
+**    GroupCelScroll
+**      - groupCel : GroupCel en grille affichant la fenêtre
+**      - ccbs : Bloc de CCB de la fenêtre
+**      - map : Index des tuiles de la carte, rangée par rangée
+**      - mapColumns, mapRows : Taille de la carte en tuiles
+**      - tileset : CCB fournissant les données source des tuiles
+**      - tilesetCount : Nombre de CCB dans le jeu de tuiles
+**      - position : Position de la vue à l'écran
+**      - viewSize : Taille de la vue en pixels
+**      - scroll : Position de la vue dans la carte en pixels
+**      - origin : Tuile de la carte affichée par la première tuile de la fenêtre
+**
+**  Fonctions principales :
+**
+**    GroupCelScrollInitialization()
+**      -> Crée la vue, sa fenêtre de tuiles, et affiche le coin supérieur gauche de la carte.
+**
+**    GroupCelScrollMove()
+**      -> Fait défiler la vue en valeurs relatives.
+**
+**    GroupCelScrollSetPosition()
+**      -> Fait défiler la vue en valeurs absolues dans la carte.
+**
+**    GroupCelScrollRecycleColumn() / GroupCelScrollRecycleRow()
+**      -> Fonctions internes déplaçant la colonne ou la rangée sortie de la vue de
+**         l'autre côté de la fenêtre.
+**
+**    GroupCelScrollTileSource()
+**      -> Fonction interne donnant à une tuile de la fenêtre les données source d'une tuile de la carte.
+**
+**    GroupCelScrollCleanup()
+**      -> Libère la mémoire utilisée par la vue.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+// GroupCel
+#include "GroupCel.h"
+// Point2D
+#include "Geometry.h"
+// int32
+#include "types.h"
+
+// Debug
+#define DEBUG_GROUPCEL_SCROLL 0
+
+// Case vide de la carte
+#define GROUPCEL_SCROLL_EMPTY 0xFFFF
+
+typedef struct {
+    // GroupCel en grille affichant la fenêtre
+    GroupCel *groupCel;
+    // Bloc de CCB de la fenêtre
+    CCB *ccbs;
+    // Index des tuiles de la carte, rangée par rangée
+    const uint16 *map;
+    // Taille de la carte en tuiles
+    uint32 mapColumns;
+    uint32 mapRows;
+    // CCB fournissant les données source des tuiles
+    CCB **tileset;
+    // Nombre de CCB dans le jeu de tuiles
+    uint32 tilesetCount;
+    // Position de la vue à l'écran
+    Point2D position;
+    // Taille de la vue en pixels
+    Point2D viewSize;
+    // Position de la vue dans la carte en pixels
+    Point2D scroll;
+    // Tuile de la carte affichée par la première tuile de la fenêtre
+    Point2D origin;
+} GroupCelScroll;
+
+// Initialisation d'une vue défilante
+GroupCelScroll *GroupCelScrollInitialization(int32 positionX, int32 positionY, uint32 viewSizeX, uint32 viewSizeY, const uint16 *map, uint32 mapColumns, uint32 mapRows, CCB **tileset, uint32 tilesetCount);
+
+// Fait défiler la vue
+void GroupCelScrollMove(GroupCelScroll *scroll, int32 moveX, int32 moveY);
+// Définit la position de la vue dans la carte
+void GroupCelScrollSetPosition(GroupCelScroll *scroll, int32 scrollX, int32 scrollY);
+
+// Déplace la première ou la dernière colonne de la fenêtre de l'autre côté
+void GroupCelScrollRecycleColumn(GroupCelScroll *scroll, int32 direction);
+// Déplace la première ou la dernière rangée de la fenêtre de l'autre côté
+void GroupCelScrollRecycleRow(GroupCelScroll *scroll, int32 direction);
+// Donne à une tuile de la fenêtre les données source d'une tuile de la carte
+void GroupCelScrollTileSource(GroupCelScroll *scroll, CCB *cel, int32 mapColumn, int32 mapRow);
+
+// Supprime la vue
+int32 GroupCelScrollCleanup(GroupCelScroll *scroll);
+
+#endif // GROUPCEL_SCROLL_H
@@ -0,0 +1,124 @@
+// CelOverdraw
+#include "CelOverdraw.h"
+// GroupCel
+#include "GroupCel.h"
+// printf()
+#include "stdio.h"
+// memset()
+#include "string.h"
+
+// Taille de l'écran
+#define OVERDRAW_WIDTH 64
+#define OVERDRAW_HEIGHT 48
+// Eléments d'un groupe : 2 x 2 Cels de 16 x 12 pixels
+#define OVERDRAW_CELS_COUNT 4
+#define OVERDRAW_CEL_WIDTH 16
+#define OVERDRAW_CEL_HEIGHT 12
+// Nombre de lignes de chaque classement
+#define OVERDRAW_LINES 8
+// Nombre de Cels que la scène occulte : celui sous le couvercle
+#define OVERDRAW_OCCLUDED 1
+
+// Place un Cel aligné sur les axes de width x height pixels en (x, y)
+static void OverdrawCelInitialization(CCB *cel, int32 x, int32 y, int32 width, int32 height, uint32 flags) {
+
+    memset(cel, 0, sizeof(CCB));
+    cel->ccb_Flags = flags | CCB_LAST;
+    cel->ccb_XPos = x << 16;
+    cel->ccb_YPos = y << 16;
+    cel->ccb_HDX = 1 << 20;
+    cel->ccb_VDY = 1 << 16;
+    cel->ccb_Width = width;
+    cel->ccb_Height = height;
+}
+
+// Crée un groupe de 2 x 2 éléments transparents en (x, y)
+static GroupCel *OverdrawGroupInitialization(CCB *cels, int32 x, int32 y) {
+
+    // Groupe créé
+    GroupCel *groupCel = NULL;
+    // Index pour parcourir les éléments
+    int32 celIndex = 0;
+
+    groupCel = GroupCelInitialization(x, y, OVERDRAW_CEL_WIDTH * 2, OVERDRAW_CEL_HEIGHT * 2, OVERDRAW_CELS_COUNT);
+    // Si c'est un échec
+    if (groupCel == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelInitialization()\n");
+        return NULL;
+    }
+
+    for (celIndex = 0; celIndex < OVERDRAW_CELS_COUNT; celIndex++) {
+        OverdrawCelInitialization(&cels[celIndex], 0, 0, OVERDRAW_CEL_WIDTH, OVERDRAW_CEL_HEIGHT, 0);
+        GroupCelElementConfiguration(groupCel, celIndex, &cels[celIndex], (celIndex & 1) * OVERDRAW_CEL_WIDTH, (celIndex >> 1) * OVERDRAW_CEL_HEIGHT);
+    }
+
+    return groupCel;
+}
+
+// Analyse une scène de deux groupes sur un fond opaque, avec un Cel caché par un
+// couvercle opaque, affiche le rapport et écrit la carte dans le fichier donné
+int main(int argc, char **argv) {
+
+    // Carte écrite
+    char *filename = "overdraw.ppm";
+    // Fond, Cel caché et son couvercle
+    CCB background;
+    CCB hidden;
+    CCB cover;
+    // Eléments des groupes
+    CCB axisCels[OVERDRAW_CELS_COUNT];
+    CCB rotatedCels[OVERDRAW_CELS_COUNT];
+    // Groupes : un aligné sur les axes, un tourné par-dessus
+    GroupCel *axis = NULL;
+    GroupCel *rotated = NULL;
+    // Analyse
+    CelOverdraw *overdraw = NULL;
+    // Nombre de Cels occultés
+    int32 occludedCount = 0;
+
+    // Arguments : [carte]
+    if (argc > 1) { filename = argv[1]; }
+
+    // Fond opaque couvrant l'écran, puis les groupes
+    OverdrawCelInitialization(&background, 0, 0, OVERDRAW_WIDTH, OVERDRAW_HEIGHT, CCB_BGND);
+    axis = OverdrawGroupInitialization(axisCels, 6, 6);
+    rotated = OverdrawGroupInitialization(rotatedCels, 22, 14);
+    if ((axis == NULL) || (rotated == NULL)) { return 1; }
+    GroupCelRotate(rotated, 32, 22 + OVERDRAW_CEL_WIDTH, 14 + OVERDRAW_CEL_HEIGHT);
+    GroupCelUpdate(axis);
+    GroupCelUpdate(rotated);
+
+    // Un Cel transparent, puis un Cel opaque le couvrant entièrement
+    OverdrawCelInitialization(&hidden, 48, 32, 10, 10, 0);
+    OverdrawCelInitialization(&cover, 46, 30, 16, 16, CCB_BGND);
+
+    // Liste d'affichage : fond, groupes, Cel caché, couvercle
+    GroupCelLinkAfter(axis, &background);
+    GroupCelLinkAfter(rotated, axis->tail);
+    LinkCel(rotated->tail, &hidden);
+    LinkCel(&hidden, &cover);
+
+    // Analyse de l'écran avec les deux groupes
+    overdraw = CelOverdrawInitialization(OVERDRAW_WIDTH, OVERDRAW_HEIGHT, 2);
+    // Si c'est un échec
+    if (overdraw == NULL) {
+        // Retourne une erreur
+        printf("Error <- CelOverdrawInitialization()\n");
+        return 1;
+    }
+    CelOverdrawAddGroup(overdraw, axis);
+    CelOverdrawAddGroup(overdraw, rotated);
+
+    CelOverdrawAnalyze(overdraw, &background);
+    occludedCount = CelOverdrawReport(overdraw, OVERDRAW_LINES);
+    if (CelOverdrawWriteHeatmap(overdraw, filename) < 0) { occludedCount = -1; }
+
+    // Supprime les groupes, le dernier lié en premier
+    CelOverdrawCleanup(overdraw);
+    GroupCelCleanup(rotated);
+    GroupCelCleanup(axis);
+
+    // Retourne 1 si le Cel sous le couvercle n'est pas le seul occulté
+    return (occludedCount == OVERDRAW_OCCLUDED) ? 0 : 1;
+}
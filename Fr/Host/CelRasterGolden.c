@@ -0,0 +1,174 @@
+// CelRaster
+#include "CelRaster.h"
+// CelQuadMap(), CelQuadMapReciprocal()
+#include "CelQuadMap.h"
+// RotatePoint2D(), Quad2D
+#include "Geometry.h"
+// printf(), sprintf()
+#include "stdio.h"
+// strcmp()
+#include "string.h"
+
+// Taille du framebuffer
+#define GOLDEN_WIDTH 96
+#define GOLDEN_HEIGHT 80
+// Eléments d'un groupe : une grille de 3 x 2 Cels de 12 x 10 pixels
+#define GOLDEN_COLUMNS 3
+#define GOLDEN_ROWS 2
+#define GOLDEN_CEL_WIDTH 12
+#define GOLDEN_CEL_HEIGHT 10
+// Sinus et cosinus de 30 degrés au format 16.16
+#define GOLDEN_SIN30 32768
+#define GOLDEN_COS30 56756
+// Fond du framebuffer
+#define GOLDEN_BACKGROUND 0x202020
+
+typedef struct {
+    // Nom de l'image de référence
+    char *name;
+    // Coins du groupe en pixels (haut gauche, haut droit, bas droit, bas gauche)
+    int32 x[4];
+    int32 y[4];
+    // Rotation de 30 degrés autour du centre du groupe
+    int32 rotate;
+    // 1 pour projeter les éléments avec CelQuadMapReciprocal()
+    int32 reciprocal;
+} GoldenScene;
+
+// Groupe aligné sur les axes, tourné et étiré en bilinéaire
+static const GoldenScene goldenScenes[3] = {
+    { "axis", { 13, 83, 83, 13 }, { 21, 21, 59, 59 }, 0, 0 },
+    { "rotated", { 12, 84, 84, 12 }, { 20, 20, 60, 60 }, 1, 0 },
+    { "stretched", { 20, 76, 90, 6 }, { 10, 14, 70, 66 }, 0, 1 }
+};
+
+// Point du groupe en (colonne / GOLDEN_COLUMNS, ligne / GOLDEN_ROWS), bilinéaire au format 16.16
+static void GoldenGroupPoint(int32 *x, int32 *y, int32 column, int32 row, Point2D *point) {
+
+    // Poids des coins, sur GOLDEN_COLUMNS * GOLDEN_ROWS
+    long long weightTopLeft = (long long)(GOLDEN_COLUMNS - column) * (GOLDEN_ROWS - row);
+    long long weightTopRight = (long long)column * (GOLDEN_ROWS - row);
+    long long weightBottomRight = (long long)column * row;
+    long long weightBottomLeft = (long long)(GOLDEN_COLUMNS - column) * row;
+
+    point->x = (int32)(((x[0] * weightTopLeft + x[1] * weightTopRight + x[2] * weightBottomRight + x[3] * weightBottomLeft) << 16) / (GOLDEN_COLUMNS * GOLDEN_ROWS));
+    point->y = (int32)(((y[0] * weightTopLeft + y[1] * weightTopRight + y[2] * weightBottomRight + y[3] * weightBottomLeft) << 16) / (GOLDEN_COLUMNS * GOLDEN_ROWS));
+}
+
+// Projette les éléments d'une scène sur son groupe et les lie en une liste
+static void GoldenSceneBuild(const GoldenScene *scene, CCB *cels) {
+
+    // Coins du groupe en pixels
+    int32 x[4];
+    int32 y[4];
+    // Centre du groupe
+    int32 centerX = 0;
+    int32 centerY = 0;
+    // Quadrilatère d'un élément au format 16.16
+    Quad2D quad;
+    // Inverses de la dimension des éléments
+    CelQuadMapReciprocals reciprocals;
+    // Index pour parcourir les coins et les éléments
+    int32 corner = 0;
+    int32 column = 0;
+    int32 row = 0;
+    CCB *cel = NULL;
+
+    // Coins du groupe, tournés autour de son centre
+    centerX = (scene->x[0] + scene->x[2]) / 2;
+    centerY = (scene->y[0] + scene->y[2]) / 2;
+    for (corner = 0; corner < 4; corner++) {
+        x[corner] = scene->x[corner];
+        y[corner] = scene->y[corner];
+        if (scene->rotate != 0) { RotatePoint2D(scene->x[corner], scene->y[corner], centerX, centerY, GOLDEN_SIN30, GOLDEN_COS30, &x[corner], &y[corner]); }
+    }
+
+    // Chaque élément couvre sa case du groupe
+    memset(cels, 0, GOLDEN_COLUMNS * GOLDEN_ROWS * sizeof(CCB));
+    for (row = 0; row < GOLDEN_ROWS; row++) {
+        for (column = 0; column < GOLDEN_COLUMNS; column++) {
+
+            cel = &cels[row * GOLDEN_COLUMNS + column];
+            cel->ccb_Width = GOLDEN_CEL_WIDTH;
+            cel->ccb_Height = GOLDEN_CEL_HEIGHT;
+            cel->ccb_Flags = CCB_LAST;
+
+            GoldenGroupPoint(x, y, column, row, &quad.topLeft);
+            GoldenGroupPoint(x, y, column + 1, row, &quad.topRight);
+            GoldenGroupPoint(x, y, column + 1, row + 1, &quad.bottomRight);
+            GoldenGroupPoint(x, y, column, row + 1, &quad.bottomLeft);
+
+            if (scene->reciprocal != 0) {
+                CelQuadMapReciprocalsInitialization(cel, &reciprocals);
+                CelQuadMapReciprocal(cel, &quad, &reciprocals);
+            } else {
+                CelQuadMap(cel, &quad);
+            }
+
+            // Lie l'élément précédent à celui-ci
+            if (cel != cels) { LinkCel(cel - 1, cel); }
+        }
+    }
+}
+
+// Dessine chaque scène et la compare avec son image de référence, ou l'écrit avec -write
+int main(int argc, char **argv) {
+
+    // Dossier des images de référence
+    char *folder = "Golden";
+    // 1 pour écrire les images de référence au lieu de comparer
+    int32 write = 0;
+    // Eléments du groupe
+    CCB cels[GOLDEN_COLUMNS * GOLDEN_ROWS];
+    // Framebuffer
+    CelRaster *raster = NULL;
+    // Image de référence
+    char filename[256];
+    // Index pour parcourir les arguments et les scènes
+    int32 argument = 0;
+    int32 scene = 0;
+    // Nombre de pixels différents
+    int32 differences = 0;
+    // Nombre de scènes en échec
+    int32 failures = 0;
+
+    // Arguments : [-write] [dossier]
+    for (argument = 1; argument < argc; argument++) {
+        if (strcmp(argv[argument], "-write") == 0) { write = 1; } else { folder = argv[argument]; }
+    }
+
+    // Crée le framebuffer
+    raster = CelRasterInitialization(GOLDEN_WIDTH, GOLDEN_HEIGHT);
+    // Si c'est un échec
+    if (raster == NULL) {
+        // Retourne une erreur
+        printf("Error <- CelRasterInitialization()\n");
+        return 1;
+    }
+
+    for (scene = 0; scene < 3; scene++) {
+
+        // Dessine le groupe
+        GoldenSceneBuild(&goldenScenes[scene], cels);
+        CelRasterClear(raster, GOLDEN_BACKGROUND);
+        CelRasterDrawCels(raster, cels);
+        sprintf(filename, "%s/%s.ppm", folder, goldenScenes[scene].name);
+
+        // Ecrit l'image de référence
+        if (write == 1) {
+            if (CelRasterWritePPM(raster, filename) < 0) { failures++; }
+            printf("%s : written\n", filename);
+            continue;
+        }
+
+        // Compare avec l'image de référence, exactement
+        differences = CelRasterCompare(raster, filename, 0);
+        if (differences != 0) { failures++; }
+        printf("%s : %s (%d pixels differ)\n", filename, (differences == 0) ? "ok" : "FAILED", differences);
+    }
+
+    CelRasterCleanup(raster);
+
+    // Retourne 1 si une scène a échoué
+    return (failures == 0) ? 0 : 1;
+}
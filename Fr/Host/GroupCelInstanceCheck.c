@@ -0,0 +1,127 @@
+// GroupCel
+#include "GroupCel.h"
+// Convert32_F16()
+#include "operamath.h"
+// printf()
+#include "stdio.h"
+// memset()
+#include "string.h"
+
+// Eléments du modèle : 2 x 2 Cels de 16 x 8 pixels
+#define CHECK_CELS_COUNT 4
+#define CHECK_CEL_WIDTH 16
+#define CHECK_CEL_HEIGHT 8
+// Position du modèle et décalage de la seconde instance
+#define CHECK_POSITION_X 40
+#define CHECK_POSITION_Y 30
+#define CHECK_OFFSET_X 10
+#define CHECK_OFFSET_Y 5
+
+// Compare les CCB d'une instance avec ceux de son modèle, décalés de (offsetX, offsetY) pixels
+static int32 CheckInstance(char *name, GroupCel *templateGroupCel, GroupCel *instance, int32 offsetX, int32 offsetY) {
+
+    // CCB comparés
+    CCB *cel = NULL;
+    CCB *instanceCel = NULL;
+    // Index pour parcourir les éléments
+    uint32 celIndex = 0;
+    // Nombre d'éléments différents
+    int32 failures = 0;
+
+    for (celIndex = 0; celIndex < templateGroupCel->celsCount; celIndex++) {
+
+        cel = templateGroupCel->cels[celIndex].cel;
+        instanceCel = instance->cels[celIndex].cel;
+
+        // L'instance a son propre entête, avec la même projection déplacée du décalage
+        if ((instanceCel == cel) ||
+            (instanceCel->ccb_SourcePtr != cel->ccb_SourcePtr) ||
+            (instanceCel->ccb_XPos != cel->ccb_XPos + Convert32_F16(offsetX)) ||
+            (instanceCel->ccb_YPos != cel->ccb_YPos + Convert32_F16(offsetY)) ||
+            (instanceCel->ccb_HDX != cel->ccb_HDX) || (instanceCel->ccb_HDY != cel->ccb_HDY) ||
+            (instanceCel->ccb_VDX != cel->ccb_VDX) || (instanceCel->ccb_VDY != cel->ccb_VDY) ||
+            (instanceCel->ccb_HDDX != cel->ccb_HDDX) || (instanceCel->ccb_HDDY != cel->ccb_HDDY)) {
+            printf("%s : element %u differs\n", name, celIndex);
+            printf("  template : X %d Y %d HDX %d HDY %d VDX %d VDY %d HDDX %d HDDY %d\n", cel->ccb_XPos, cel->ccb_YPos, cel->ccb_HDX, cel->ccb_HDY, cel->ccb_VDX, cel->ccb_VDY, cel->ccb_HDDX, cel->ccb_HDDY);
+            printf("  instance : X %d Y %d HDX %d HDY %d VDX %d VDY %d HDDX %d HDDY %d\n", instanceCel->ccb_XPos, instanceCel->ccb_YPos, instanceCel->ccb_HDX, instanceCel->ccb_HDY, instanceCel->ccb_VDX, instanceCel->ccb_VDY, instanceCel->ccb_HDDX, instanceCel->ccb_HDDY);
+            failures++;
+        }
+    }
+
+    printf("%s : %s\n", name, (failures == 0) ? "ok" : "FAILED");
+    return failures;
+}
+
+// Instancie un modèle simple, étiré et tourné, et compare les CCB
+int main(void) {
+
+    // Données source partagées par les Cels
+    static CelData pixels[CHECK_CEL_WIDTH * CHECK_CEL_HEIGHT / 2];
+    // Cels du modèle
+    CCB cels[CHECK_CELS_COUNT];
+    // Modèle, instances et leur réserve
+    GroupCel *templateGroupCel = NULL;
+    GroupCel *instance = NULL;
+    GroupCelPool *pool = NULL;
+    // Index pour parcourir les Cels et les transformations
+    int32 celIndex = 0;
+    int32 transformation = 0;
+    // Noms des transformations
+    char *names[3] = { "plain", "stretched", "rotated" };
+    char name[64];
+    // Nombre de vérifications en échec
+    int32 failures = 0;
+
+    // Réserve des instances
+    pool = GroupCelPoolInitialization(CHECK_CELS_COUNT * 2);
+    if (pool == NULL) {
+        // Retourne une erreur
+        printf("Error <- GroupCelPoolInitialization()\n");
+        return 1;
+    }
+
+    for (transformation = 0; transformation < 3; transformation++) {
+
+        // Cels de 16 x 8 pixels partageant leurs données source
+        memset(cels, 0, sizeof(cels));
+        for (celIndex = 0; celIndex < CHECK_CELS_COUNT; celIndex++) {
+            cels[celIndex].ccb_SourcePtr = pixels;
+            cels[celIndex].ccb_Width = CHECK_CEL_WIDTH;
+            cels[celIndex].ccb_Height = CHECK_CEL_HEIGHT;
+            cels[celIndex].ccb_HDX = 1 << 20;
+            cels[celIndex].ccb_VDY = 1 << 16;
+        }
+
+        // Modèle de 2 x 2 éléments
+        templateGroupCel = GroupCelInitialization(CHECK_POSITION_X, CHECK_POSITION_Y, CHECK_CEL_WIDTH * 2, CHECK_CEL_HEIGHT * 2, CHECK_CELS_COUNT);
+        if (templateGroupCel == NULL) {
+            // Retourne une erreur
+            printf("Error <- GroupCelInitialization()\n");
+            return 1;
+        }
+        for (celIndex = 0; celIndex < CHECK_CELS_COUNT; celIndex++) {
+            GroupCelElementConfiguration(templateGroupCel, celIndex, &cels[celIndex], (celIndex & 1) * CHECK_CEL_WIDTH, (celIndex >> 1) * CHECK_CEL_HEIGHT);
+        }
+        if (transformation == 1) { GroupCelStretch(templateGroupCel, 0, 0, 40, 4, 36, 20, -4, 16); }
+        if (transformation == 2) { GroupCelRotate(templateGroupCel, 32, CHECK_POSITION_X + CHECK_CEL_WIDTH, CHECK_POSITION_Y + CHECK_CEL_HEIGHT); }
+        GroupCelUpdate(templateGroupCel);
+
+        // Instance sur le modèle, puis déplacée d'un décalage
+        instance = GroupCelInstantiate(templateGroupCel, pool, CHECK_POSITION_X, CHECK_POSITION_Y);
+        sprintf(name, "%s instance", names[transformation]);
+        failures += (instance != NULL) ? CheckInstance(name, templateGroupCel, instance, 0, 0) : 1;
+        if (instance != NULL) { GroupCelCleanup(instance); }
+
+        instance = GroupCelInstantiate(templateGroupCel, pool, CHECK_POSITION_X + CHECK_OFFSET_X, CHECK_POSITION_Y + CHECK_OFFSET_Y);
+        sprintf(name, "%s instance moved", names[transformation]);
+        failures += (instance != NULL) ? CheckInstance(name, templateGroupCel, instance, CHECK_OFFSET_X, CHECK_OFFSET_Y) : 1;
+        if (instance != NULL) { GroupCelCleanup(instance); }
+
+        GroupCelCleanup(templateGroupCel);
+    }
+
+    GroupCelPoolCleanup(pool);
+
+    // Retourne 1 si une vérification a échoué
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,47 @@
+
+// AllocMem(), FreeMem()
+#include "mem.h"
+// CreateItem(), DeleteItem()
+#include "item.h"
+// DrawCels()
+#include "graphics.h"
+// calloc(), free()
+#include "stdlib.h"
+
+// Alloue un bloc, effacé
+void *AllocMem(int32 size, uint32 type) {
+
+    // Le type de mémoire n'importe pas sur l'hôte
+    (void)type;
+    return calloc(1, (size_t)size);
+}
+
+// Libère un bloc
+void FreeMem(void *block, int32 size) {
+
+    (void)size;
+    free(block);
+}
+
+// Crée un item (échoue toujours sur l'hôte)
+Item CreateItem(int32 type, TagArg *tags) {
+
+    (void)type;
+    (void)tags;
+    return -1;
+}
+
+// Supprime un item
+Err DeleteItem(Item item) {
+
+    (void)item;
+    return 0;
+}
+
+// Dessine une liste de CCB dans un bitmap (ne fait rien sur l'hôte)
+int32 DrawCels(Item bitmap, CCB *ccb) {
+
+    (void)bitmap;
+    (void)ccb;
+    return 0;
+}
@@ -0,0 +1,37 @@
+#ifndef HOST_ANIMUTILS_H
+#define HOST_ANIMUTILS_H
+
+/******************************************************************************
+**
+**  animutils.h - Animations du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Seules les structures lues par GroupCel sont définies. La compilation sur
+**  l'hôte ne charge pas d'animations : une vérification sur l'hôte construit
+**  ses images en code.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+typedef struct AnimFrame {
+    // CCB, PLUT et pixels de l'image
+    CCB *af_CCB;
+    char *af_PLUT;
+    char *af_pix;
+    int32 reserved;
+} AnimFrame;
+
+typedef struct ANIM {
+    // Nombre d'images et image courante au format 16.16
+    int32 num_Frames;
+    frac16 cur_Frame;
+    int32 num_Alloced_Frames;
+    // Images
+    AnimFrame *pentries;
+} ANIM;
+
+#endif // HOST_ANIMUTILS_H
@@ -0,0 +1,26 @@
+#ifndef HOST_CELUTILS_H
+#define HOST_CELUTILS_H
+
+/******************************************************************************
+**
+**  celutils.h - Utilitaires des Cels du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Seulement déclarées : la compilation sur l'hôte ne charge pas de fichiers
+**  Cel, une vérification sur l'hôte construit ses CCB en code.
+**
+******************************************************************************/
+
+// CCB
+#include "graphics.h"
+
+// Charge un fichier Cel
+CCB *LoadCel(char *filename, uint32 type);
+// Décharge un Cel
+void UnloadCel(CCB *cel);
+// Copie un Cel
+CCB *CloneCel(CCB *cel, int32 options);
+
+#endif // HOST_CELUTILS_H
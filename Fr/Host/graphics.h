@@ -0,0 +1,91 @@
+#ifndef HOST_GRAPHICS_H
+#define HOST_GRAPHICS_H
+
+/******************************************************************************
+**
+**  graphics.h - CCB du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Le CCB garde l'ordre des mots du Cel Engine. Sur un hôte 64 bits les
+**  pointeurs sont plus larges, un CCB ne doit donc pas être lu ici depuis un
+**  fichier ou un paquet : la compilation sur l'hôte le remplit seulement en code.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Données source d'un Cel
+typedef uint32 CelData;
+
+typedef struct CCB {
+    // Drapeaux
+    uint32 ccb_Flags;
+    // CCB suivant, données source et PLUT
+    struct CCB *ccb_NextPtr;
+    CelData *ccb_SourcePtr;
+    void *ccb_PLUTPtr;
+    // Position au format 16.16
+    int32 ccb_XPos;
+    int32 ccb_YPos;
+    // Pas horizontal au format 12.20
+    int32 ccb_HDX;
+    int32 ccb_HDY;
+    // Pas vertical au format 16.16
+    int32 ccb_VDX;
+    int32 ccb_VDY;
+    // Variation du pas horizontal par ligne au format 12.20
+    int32 ccb_HDDX;
+    int32 ccb_HDDY;
+    // Contrôle du processeur de pixels et préambules
+    uint32 ccb_PIXC;
+    uint32 ccb_PRE0;
+    uint32 ccb_PRE1;
+    // Dimension en pixels
+    int32 ccb_Width;
+    int32 ccb_Height;
+} CCB;
+
+// Drapeaux du CCB
+#define CCB_SKIP 0x80000000
+#define CCB_LAST 0x40000000
+#define CCB_NPABS 0x20000000
+#define CCB_SPABS 0x10000000
+#define CCB_PPABS 0x08000000
+#define CCB_LDSIZE 0x04000000
+#define CCB_LDPRS 0x02000000
+#define CCB_LDPPMP 0x01000000
+#define CCB_LDPLUT 0x00800000
+#define CCB_CCBPRE 0x00400000
+#define CCB_YOXY 0x00200000
+#define CCB_ACW 0x00040000
+#define CCB_ACCW 0x00020000
+#define CCB_PACKED 0x00000200
+#define CCB_BGND 0x00000020
+#define CCB_NOBLK 0x00000010
+
+// Préambules d'un Cel 16 bits linéaire non codé
+#define PRE0_BPP_16 0x00000006
+#define PRE0_LINEAR 0x00000010
+#define PRE0_VCNT_SHIFT 6
+#define PRE1_TLHPCNT_SHIFT 0
+#define PRE1_LRFORM 0x00000800
+#define PRE1_TLLSB_PDC0 0x00001000
+#define PRE1_WOFFSET10_SHIFT 16
+
+// Type d'un item bitmap et étiquettes de sa création
+#define TYPE_BITMAP 5
+#define CBM_TAG_DONE 0
+#define CBM_TAG_WIDTH 11
+#define CBM_TAG_HEIGHT 12
+#define CBM_TAG_BUFFER 13
+
+// Dessine une liste de CCB dans un bitmap (ne fait rien sur l'hôte)
+int32 DrawCels(Item bitmap, CCB *ccb);
+
+// Lie un CCB au suivant
+#define LinkCel(ccb, next) { (ccb)->ccb_NextPtr = (next); (ccb)->ccb_Flags &= ~CCB_LAST; }
+
+#endif // HOST_GRAPHICS_H
@@ -0,0 +1,25 @@
+#ifndef HOST_ITEM_H
+#define HOST_ITEM_H
+
+/******************************************************************************
+**
+**  item.h - Items du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  Il n'y a pas de noyau sur l'hôte : CreateItem() échoue toujours, ainsi ce
+**  qui a besoin d'un bitmap (GroupCelFlatten()) signale une erreur au lieu de
+**  dessiner.
+**
+******************************************************************************/
+
+// Item, TagArg
+#include "types.h"
+
+// Crée un item (échoue toujours sur l'hôte)
+Item CreateItem(int32 type, TagArg *tags);
+// Supprime un item
+Err DeleteItem(Item item);
+
+#endif // HOST_ITEM_H
@@ -0,0 +1,31 @@
+#ifndef HOST_MEM_H
+#define HOST_MEM_H
+
+/******************************************************************************
+**
+**  mem.h - Mémoire du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  AllocMem() efface le bloc comme le ferait MEMTYPE_FILL avec 0, ainsi une
+**  vérification sur l'hôte ne lit jamais un champ non initialisé. Les types
+**  de mémoire sont ignorés.
+**
+******************************************************************************/
+
+// int32
+#include "types.h"
+
+// Types de mémoire
+#define MEMTYPE_DRAM 0x00000001
+#define MEMTYPE_VRAM 0x00000002
+#define MEMTYPE_CEL 0x00000004
+#define MEMTYPE_FILL 0x00000008
+
+// Alloue un bloc, effacé
+void *AllocMem(int32 size, uint32 type);
+// Libère un bloc
+void FreeMem(void *block, int32 size);
+
+#endif // HOST_MEM_H
@@ -0,0 +1,19 @@
+#ifndef HOST_NODES_H
+#define HOST_NODES_H
+
+/******************************************************************************
+**
+**  nodes.h - Noeuds du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+******************************************************************************/
+
+// Identifiant d'un type de noeud dans un sous-système
+#define MKNODEID(subsystem, type) (((subsystem) << 8) | (type))
+
+// Sous-système des graphismes
+#define NODE_GRAPHICS 1
+
+#endif // HOST_NODES_H
@@ -0,0 +1,33 @@
+
+#include "operamath.h"
+
+// sin(), cos(), floor()
+#include "math.h"
+
+// Produit au format 16.16
+frac16 MulSF16(frac16 a, frac16 b) {
+
+    // Bits hauts du produit sur 64 bits, arrondis vers le bas
+    return (frac16)(((int64_t)a * b) >> 16);
+}
+
+// Produit au format 2.30
+frac30 MulSF30(frac30 a, frac30 b) {
+
+    // Bits hauts du produit sur 64 bits, arrondis vers le bas
+    return (frac30)(((int64_t)a * b) >> 30);
+}
+
+// Sinus au format 16.16, d'un angle au format 16.16 où 256 est un tour
+frac16 SinF16(frac16 angle) {
+
+    // Arrondi au plus proche
+    return (frac16)floor(sin((double)angle * 3.14159265358979323846 / (128.0 * 65536.0)) * 65536.0 + 0.5);
+}
+
+// Cosinus au format 16.16, d'un angle au format 16.16 où 256 est un tour
+frac16 CosF16(frac16 angle) {
+
+    // Arrondi au plus proche
+    return (frac16)floor(cos((double)angle * 3.14159265358979323846 / (128.0 * 65536.0)) * 65536.0 + 0.5);
+}
@@ -0,0 +1,33 @@
+#ifndef HOST_OPERAMATH_H
+#define HOST_OPERAMATH_H
+
+/******************************************************************************
+**
+**  operamath.h - Virgule fixe du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  MulSF16() et MulSF30() gardent les bits hauts du produit sur 64 bits, ils
+**  arrondissent donc vers le bas comme les routines ARM du SDK. SinF16() et
+**  CosF16() arrondissent le sinus de la bibliothèque C au plus proche. Elles
+**  sont définies dans operamath.c de ce dossier.
+**
+******************************************************************************/
+
+// frac16, frac30
+#include "types.h"
+
+// Conversions entre entiers et format 16.16
+#define Convert32_F16(x) ((int32)(x) << 16)
+#define ConvertF16_32(x) ((int32)(x) >> 16)
+
+// Produit au format 16.16
+frac16 MulSF16(frac16 a, frac16 b);
+// Produit au format 2.30
+frac30 MulSF30(frac30 a, frac30 b);
+// Sinus et cosinus au format 16.16, d'un angle au format 16.16 où 256 est un tour
+frac16 SinF16(frac16 angle);
+frac16 CosF16(frac16 angle);
+
+#endif // HOST_OPERAMATH_H
@@ -0,0 +1,50 @@
+#ifndef HOST_TYPES_H
+#define HOST_TYPES_H
+
+/******************************************************************************
+**
+**  types.h - Types du SDK de la 3DO pour la compilation sur l'hôte
+**  
+**  Auteur : Christophe Geoffroy (Topper) - Licence MIT
+**  Dernière mise à jour : 19-10-2026
+**
+**  La compilation sur l'hôte (Makefile de ce dossier) place ce dossier avant
+**  les sources dans le chemin des inclusions, ainsi CelRaster, CelQuadMap,
+**  Geometry, GroupCel et CelOverdraw se compilent avec un compilateur C
+**  standard, sans le SDK. Seuls les types qu'ils utilisent sont définis, avec
+**  leur taille sur la 3DO.
+**
+******************************************************************************/
+
+// int8_t ... uint32_t
+#include "stdint.h"
+// va_list, inclus par types.h sur la 3DO
+#include "stdarg.h"
+
+// Entiers
+typedef int8_t int8;
+typedef uint8_t uint8;
+typedef int16_t int16;
+typedef uint16_t uint16;
+typedef int32_t int32;
+typedef uint32_t uint32;
+
+// Virgule fixe aux formats 16.16 et 2.30
+typedef int32 frac16;
+typedef int32 frac30;
+
+// Item du noyau et code d'erreur
+typedef int32 Item;
+typedef int32 Err;
+
+// Etiquette de la création d'un item
+typedef struct TagArg {
+    uint32 ta_Tag;
+    void *ta_Arg;
+} TagArg;
+
+// Booléens
+#define TRUE 1
+#define FALSE 0
+
+#endif // HOST_TYPES_H